@@ -26,6 +26,9 @@
 #include <stdio.h>
 #include <stdarg.h>
 #include <string.h>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 
 #include "cutils.h"
 
@@ -639,3 +642,752 @@ void rqsort(void *base, size_t nmemb, size_t size, cmp_f cmp, void *opaque)
 }
 
 #endif
+
+/* Stable merge sort (timsort): natural runs are detected and extended
+   with a binary insertion sort, then merged with galloping when one
+   run wins consistently. The comparison function may be inconsistent
+   (e.g. user supplied): the result is then unspecified but memory
+   accesses stay within the array. */
+
+#define MSORT_MIN_GALLOP 7
+#define MSORT_MAX_PENDING 85 /* enough for 2^64 elements */
+
+typedef struct {
+    uint8_t *base;
+    size_t len;
+} MSortRun;
+
+typedef struct {
+    size_t size;
+    cmp_f cmp;
+    void *opaque;
+    uint8_t *tmp; /* room for at least nmemb / 2 elements */
+    size_t min_gallop;
+    int n; /* number of pending runs */
+    MSortRun pending[MSORT_MAX_PENDING];
+} MSortState;
+
+#define MS_LT(ms, a, b)  ((ms)->cmp(a, b, (ms)->opaque) < 0)
+
+/* sort [lo, hi[ knowing that [lo, start[ is already sorted */
+static void msort_binary_insertion(MSortState *ms, uint8_t *lo, uint8_t *hi,
+                                   uint8_t *start)
+{
+    size_t size = ms->size;
+    uint8_t *l, *r, *p, *pivot = ms->tmp;
+    size_t n;
+
+    for(; start < hi; start += size) {
+        l = lo;
+        r = start;
+        /* find the rightmost insertion point to keep the sort stable */
+        while (l < r) {
+            n = (r - l) / size;
+            p = l + (n >> 1) * size;
+            if (MS_LT(ms, start, p))
+                r = p;
+            else
+                l = p + size;
+        }
+        if (l != start) {
+            memcpy(pivot, start, size);
+            memmove(l + size, l, start - l);
+            memcpy(l, pivot, size);
+        }
+    }
+}
+
+/* return the length of the run starting at 'lo'. A strictly descending
+   run is reversed in place. */
+static size_t msort_count_run(MSortState *ms, uint8_t *lo, uint8_t *hi)
+{
+    size_t size = ms->size;
+    uint8_t *p, *q;
+    size_t n;
+    exchange_f swap;
+
+    if (lo + size == hi)
+        return 1;
+    n = 2;
+    p = lo + 2 * size;
+    if (MS_LT(ms, lo + size, lo)) {
+        for(; p < hi && MS_LT(ms, p, p - size); p += size)
+            n++;
+        swap = exchange_func(lo, size);
+        for(q = p - size; lo < q; lo += size, q -= size)
+            swap(lo, q, size);
+    } else {
+        for(; p < hi && !MS_LT(ms, p, p - size); p += size)
+            n++;
+    }
+    return n;
+}
+
+/* return k such that a[k - 1] < key <= a[k], starting the search at
+   a[hint] */
+static size_t msort_gallop_left(MSortState *ms, const uint8_t *key,
+                                uint8_t *a, size_t n, size_t hint)
+{
+    size_t size = ms->size, ofs, lastofs, maxofs, k, m;
+    uint8_t *p = a + hint * size;
+
+    lastofs = 0;
+    ofs = 1;
+    if (MS_LT(ms, p, key)) {
+        /* a[hint] < key: gallop right until a[hint + lastofs] < key <=
+           a[hint + ofs] */
+        maxofs = n - hint;
+        while (ofs < maxofs && MS_LT(ms, p + ofs * size, key)) {
+            lastofs = ofs;
+            ofs = (ofs << 1) + 1;
+        }
+        if (ofs > maxofs)
+            ofs = maxofs;
+        lastofs += hint + 1;
+        ofs += hint;
+    } else {
+        /* key <= a[hint]: gallop left until a[hint - ofs] < key <=
+           a[hint - lastofs] */
+        maxofs = hint + 1;
+        while (ofs < maxofs && !MS_LT(ms, p - ofs * size, key)) {
+            lastofs = ofs;
+            ofs = (ofs << 1) + 1;
+        }
+        if (ofs > maxofs)
+            ofs = maxofs;
+        k = lastofs;
+        lastofs = hint + 1 - ofs;
+        ofs = hint - k;
+    }
+    /* a[lastofs - 1] < key <= a[ofs] */
+    while (lastofs < ofs) {
+        m = lastofs + ((ofs - lastofs) >> 1);
+        if (MS_LT(ms, a + m * size, key))
+            lastofs = m + 1;
+        else
+            ofs = m;
+    }
+    return ofs;
+}
+
+/* return k such that a[k - 1] <= key < a[k], starting the search at
+   a[hint] */
+static size_t msort_gallop_right(MSortState *ms, const uint8_t *key,
+                                 uint8_t *a, size_t n, size_t hint)
+{
+    size_t size = ms->size, ofs, lastofs, maxofs, k, m;
+    uint8_t *p = a + hint * size;
+
+    lastofs = 0;
+    ofs = 1;
+    if (MS_LT(ms, key, p)) {
+        /* key < a[hint]: gallop left until a[hint - ofs] <= key <
+           a[hint - lastofs] */
+        maxofs = hint + 1;
+        while (ofs < maxofs && MS_LT(ms, key, p - ofs * size)) {
+            lastofs = ofs;
+            ofs = (ofs << 1) + 1;
+        }
+        if (ofs > maxofs)
+            ofs = maxofs;
+        k = lastofs;
+        lastofs = hint + 1 - ofs;
+        ofs = hint - k;
+    } else {
+        /* a[hint] <= key: gallop right until a[hint + lastofs] <= key <
+           a[hint + ofs] */
+        maxofs = n - hint;
+        while (ofs < maxofs && !MS_LT(ms, key, p + ofs * size)) {
+            lastofs = ofs;
+            ofs = (ofs << 1) + 1;
+        }
+        if (ofs > maxofs)
+            ofs = maxofs;
+        lastofs += hint + 1;
+        ofs += hint;
+    }
+    /* a[lastofs - 1] <= key < a[ofs] */
+    while (lastofs < ofs) {
+        m = lastofs + ((ofs - lastofs) >> 1);
+        if (MS_LT(ms, key, a + m * size))
+            ofs = m;
+        else
+            lastofs = m + 1;
+    }
+    return ofs;
+}
+
+/* merge the adjacent runs a and b in place when na <= nb: a is copied
+   to the temporary buffer and the merge proceeds from the left. */
+static void msort_merge_lo(MSortState *ms, uint8_t *a, size_t na,
+                           uint8_t *b, size_t nb)
+{
+    size_t size = ms->size, min_gallop, acount, bcount, k;
+    uint8_t *dest = a;
+
+    memcpy(ms->tmp, a, na * size);
+    a = ms->tmp;
+    memcpy(dest, b, size);
+    dest += size;
+    b += size;
+    if (--nb == 0)
+        goto done;
+    if (na == 1)
+        goto copy_b;
+    min_gallop = ms->min_gallop;
+    for(;;) {
+        acount = bcount = 0;
+        /* one element at a time until a run wins consistently */
+        for(;;) {
+            if (MS_LT(ms, b, a)) {
+                memcpy(dest, b, size);
+                dest += size;
+                b += size;
+                acount = 0;
+                if (--nb == 0)
+                    goto done;
+                if (++bcount >= min_gallop)
+                    break;
+            } else {
+                memcpy(dest, a, size);
+                dest += size;
+                a += size;
+                bcount = 0;
+                if (--na == 1)
+                    goto copy_b;
+                if (++acount >= min_gallop)
+                    break;
+            }
+        }
+        /* galloping mode */
+        min_gallop++;
+        do {
+            min_gallop -= min_gallop > 1;
+            ms->min_gallop = min_gallop;
+            k = acount = msort_gallop_right(ms, b, a, na, 0);
+            if (k) {
+                memcpy(dest, a, k * size);
+                dest += k * size;
+                a += k * size;
+                na -= k;
+                if (na == 1)
+                    goto copy_b;
+                /* na == 0 only with an inconsistent comparison */
+                if (na == 0)
+                    goto done;
+            }
+            memcpy(dest, b, size);
+            dest += size;
+            b += size;
+            if (--nb == 0)
+                goto done;
+            k = bcount = msort_gallop_left(ms, a, b, nb, 0);
+            if (k) {
+                memmove(dest, b, k * size);
+                dest += k * size;
+                b += k * size;
+                nb -= k;
+                if (nb == 0)
+                    goto done;
+            }
+            memcpy(dest, a, size);
+            dest += size;
+            a += size;
+            if (--na == 1)
+                goto copy_b;
+        } while (acount >= MSORT_MIN_GALLOP || bcount >= MSORT_MIN_GALLOP);
+        min_gallop++;
+        ms->min_gallop = min_gallop;
+    }
+ done:
+    if (na)
+        memcpy(dest, a, na * size);
+    return;
+ copy_b:
+    /* the last element of a belongs at the end of the merge */
+    memmove(dest, b, nb * size);
+    memcpy(dest + nb * size, a, size);
+}
+
+/* merge the adjacent runs a and b in place when na > nb: b is copied
+   to the temporary buffer and the merge proceeds from the right. */
+static void msort_merge_hi(MSortState *ms, uint8_t *a, size_t na,
+                           uint8_t *b, size_t nb)
+{
+    size_t size = ms->size, min_gallop, acount, bcount, k;
+    uint8_t *dest, *basea, *baseb;
+
+    /* the pointers designate the last element of each part */
+    dest = b + (nb - 1) * size;
+    memcpy(ms->tmp, b, nb * size);
+    basea = a;
+    baseb = ms->tmp;
+    b = baseb + (nb - 1) * size;
+    a += (na - 1) * size;
+    memcpy(dest, a, size);
+    dest -= size;
+    a -= size;
+    if (--na == 0)
+        goto done;
+    if (nb == 1)
+        goto copy_a;
+    min_gallop = ms->min_gallop;
+    for(;;) {
+        acount = bcount = 0;
+        for(;;) {
+            if (MS_LT(ms, b, a)) {
+                memcpy(dest, a, size);
+                dest -= size;
+                a -= size;
+                bcount = 0;
+                if (--na == 0)
+                    goto done;
+                if (++acount >= min_gallop)
+                    break;
+            } else {
+                memcpy(dest, b, size);
+                dest -= size;
+                b -= size;
+                acount = 0;
+                if (--nb == 1)
+                    goto copy_a;
+                if (++bcount >= min_gallop)
+                    break;
+            }
+        }
+        min_gallop++;
+        do {
+            min_gallop -= min_gallop > 1;
+            ms->min_gallop = min_gallop;
+            k = acount = na - msort_gallop_right(ms, b, basea, na, na - 1);
+            if (k) {
+                dest -= k * size;
+                a -= k * size;
+                memmove(dest + size, a + size, k * size);
+                na -= k;
+                if (na == 0)
+                    goto done;
+            }
+            memcpy(dest, b, size);
+            dest -= size;
+            b -= size;
+            if (--nb == 1)
+                goto copy_a;
+            k = bcount = nb - msort_gallop_left(ms, a, baseb, nb, nb - 1);
+            if (k) {
+                dest -= k * size;
+                b -= k * size;
+                memcpy(dest + size, b + size, k * size);
+                nb -= k;
+                if (nb == 1)
+                    goto copy_a;
+                /* nb == 0 only with an inconsistent comparison */
+                if (nb == 0)
+                    goto done;
+            }
+            memcpy(dest, a, size);
+            dest -= size;
+            a -= size;
+            if (--na == 0)
+                goto done;
+        } while (acount >= MSORT_MIN_GALLOP || bcount >= MSORT_MIN_GALLOP);
+        min_gallop++;
+        ms->min_gallop = min_gallop;
+    }
+ done:
+    if (nb)
+        memcpy(dest - (nb - 1) * size, baseb, nb * size);
+    return;
+ copy_a:
+    /* the first element of b belongs at the front of the merge */
+    dest -= na * size;
+    a -= na * size;
+    memmove(dest + size, a + size, na * size);
+    memcpy(dest, b, size);
+}
+
+/* merge the pending runs i and i + 1 */
+static void msort_merge_at(MSortState *ms, int i)
+{
+    size_t size = ms->size, na, nb, k;
+    uint8_t *a, *b;
+
+    a = ms->pending[i].base;
+    na = ms->pending[i].len;
+    b = ms->pending[i + 1].base;
+    nb = ms->pending[i + 1].len;
+    ms->pending[i].len = na + nb;
+    if (i == ms->n - 3)
+        ms->pending[i + 1] = ms->pending[i + 2];
+    ms->n--;
+
+    /* elements of a already in place */
+    k = msort_gallop_right(ms, b, a, na, 0);
+    a += k * size;
+    na -= k;
+    if (na == 0)
+        return;
+    /* elements of b already in place */
+    nb = msort_gallop_left(ms, a + (na - 1) * size, b, nb, nb - 1);
+    if (nb == 0)
+        return;
+    if (na <= nb)
+        msort_merge_lo(ms, a, na, b, nb);
+    else
+        msort_merge_hi(ms, a, na, b, nb);
+}
+
+/* restore the run length invariants of the pending stack */
+static void msort_merge_collapse(MSortState *ms)
+{
+    MSortRun *p = ms->pending;
+    int n;
+
+    while (ms->n > 1) {
+        n = ms->n - 2;
+        if ((n > 0 && p[n - 1].len <= p[n].len + p[n + 1].len) ||
+            (n > 1 && p[n - 2].len <= p[n - 1].len + p[n].len)) {
+            if (p[n - 1].len < p[n + 1].len)
+                n--;
+        } else if (p[n].len > p[n + 1].len) {
+            break;
+        }
+        msort_merge_at(ms, n);
+    }
+}
+
+static size_t msort_min_run(size_t n)
+{
+    size_t r = 0;
+    while (n >= 64) {
+        r |= n & 1;
+        n >>= 1;
+    }
+    return n + r;
+}
+
+void rmergesort(void *base, size_t nmemb, size_t size, cmp_f cmp,
+                void *opaque, void *tmp)
+{
+    MSortState ms_s, *ms = &ms_s;
+    uint8_t *lo, *hi;
+    size_t min_run, n, force;
+    int i;
+
+    if (nmemb < 2 || size <= 0)
+        return;
+    ms->size = size;
+    ms->cmp = cmp;
+    ms->opaque = opaque;
+    ms->tmp = tmp;
+    ms->min_gallop = MSORT_MIN_GALLOP;
+    ms->n = 0;
+
+    min_run = msort_min_run(nmemb);
+    lo = base;
+    hi = lo + nmemb * size;
+    while (lo < hi) {
+        n = msort_count_run(ms, lo, hi);
+        if (n < min_run) {
+            /* extend the run to min_run elements */
+            force = (hi - lo) / size;
+            if (force > min_run)
+                force = min_run;
+            msort_binary_insertion(ms, lo, lo + force * size, lo + n * size);
+            n = force;
+        }
+        ms->pending[ms->n].base = lo;
+        ms->pending[ms->n].len = n;
+        ms->n++;
+        msort_merge_collapse(ms);
+        lo += n * size;
+    }
+    while (ms->n > 1) {
+        i = ms->n - 2;
+        if (i > 0 && ms->pending[i - 1].len < ms->pending[i + 1].len)
+            i--;
+        msort_merge_at(ms, i);
+    }
+}
+
+/* String kernels on 8 bit (Latin-1) and 16 bit characters. The SSE2
+   versions process 16 bytes at a time. */
+
+#if defined(__SSE2__)
+
+/* return the mask of the 16 bit lanes which are equal, one bit per lane */
+static inline int mm_cmpeq16_mask(__m128i a, __m128i b)
+{
+    __m128i r = _mm_cmpeq_epi16(a, b);
+    return _mm_movemask_epi8(_mm_packs_epi16(r, _mm_setzero_si128()));
+}
+
+static inline __m128i mm_load8to16(const uint8_t *p)
+{
+    return _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)p),
+                             _mm_setzero_si128());
+}
+
+#endif
+
+const uint16_t *memchr16(const uint16_t *s, uint16_t c, size_t n)
+{
+    size_t i = 0;
+#if defined(__SSE2__)
+    __m128i vc = _mm_set1_epi16(c);
+    int m;
+    for(; i + 8 <= n; i += 8) {
+        m = mm_cmpeq16_mask(_mm_loadu_si128((const __m128i *)(s + i)), vc);
+        if (m)
+            return s + i + ctz32(m);
+    }
+#endif
+    for(; i < n; i++) {
+        if (s[i] == c)
+            return s + i;
+    }
+    return NULL;
+}
+
+int memcmp16(const uint16_t *s1, const uint16_t *s2, size_t n)
+{
+    size_t i = 0;
+#if defined(__SSE2__)
+    int m;
+    for(; i + 8 <= n; i += 8) {
+        m = mm_cmpeq16_mask(_mm_loadu_si128((const __m128i *)(s1 + i)),
+                            _mm_loadu_si128((const __m128i *)(s2 + i)));
+        if (m != 0xff) {
+            i += ctz32(~m);
+            return s1[i] - s2[i];
+        }
+    }
+#endif
+    for(; i < n; i++) {
+        if (s1[i] != s2[i])
+            return s1[i] - s2[i];
+    }
+    return 0;
+}
+
+int memcmp16_8(const uint16_t *s1, const uint8_t *s2, size_t n)
+{
+    size_t i = 0;
+#if defined(__SSE2__)
+    int m;
+    for(; i + 8 <= n; i += 8) {
+        m = mm_cmpeq16_mask(_mm_loadu_si128((const __m128i *)(s1 + i)),
+                            mm_load8to16(s2 + i));
+        if (m != 0xff) {
+            i += ctz32(~m);
+            return s1[i] - s2[i];
+        }
+    }
+#endif
+    for(; i < n; i++) {
+        if (s1[i] != s2[i])
+            return s1[i] - s2[i];
+    }
+    return 0;
+}
+
+/* 'dst' and 'src' may point to the same memory: the copy is done from
+   the end */
+void memcpy8to16(uint16_t *dst, const uint8_t *src, size_t n)
+{
+    size_t i = n;
+#if defined(__SSE2__)
+    __m128i zero = _mm_setzero_si128(), v;
+    while (i & 15) {
+        i--;
+        dst[i] = src[i];
+    }
+    while (i != 0) {
+        i -= 16;
+        v = _mm_loadu_si128((const __m128i *)(src + i));
+        _mm_storeu_si128((__m128i *)(dst + i + 8), _mm_unpackhi_epi8(v, zero));
+        _mm_storeu_si128((__m128i *)(dst + i), _mm_unpacklo_epi8(v, zero));
+    }
+#else
+    while (i != 0) {
+        i--;
+        dst[i] = src[i];
+    }
+#endif
+}
+
+/* Substring search. The SSE2 versions compare the first and last
+   characters of the needle at 16 (resp. 8) consecutive positions and
+   only check the candidates matching both. Return NULL if not found. */
+
+const uint8_t *memmem8(const uint8_t *h, size_t hlen,
+                       const uint8_t *n, size_t nlen)
+{
+    size_t i, end;
+
+    if (nlen == 0)
+        return h;
+    if (nlen > hlen)
+        return NULL;
+    if (nlen == 1)
+        return memchr(h, n[0], hlen);
+    end = hlen - nlen + 1;
+    i = 0;
+#if defined(__SSE2__)
+    {
+        __m128i first = _mm_set1_epi8(n[0]);
+        __m128i last = _mm_set1_epi8(n[nlen - 1]);
+        __m128i b0, b1;
+        int m, k;
+        for(; i + 16 <= end; i += 16) {
+            b0 = _mm_loadu_si128((const __m128i *)(h + i));
+            b1 = _mm_loadu_si128((const __m128i *)(h + i + nlen - 1));
+            m = _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(b0, first),
+                                                _mm_cmpeq_epi8(b1, last)));
+            while (m) {
+                k = ctz32(m);
+                if (!memcmp(h + i + k + 1, n + 1, nlen - 2))
+                    return h + i + k;
+                m &= m - 1;
+            }
+        }
+    }
+#endif
+    for(; i < end; i++) {
+        if (h[i] == n[0] && !memcmp(h + i + 1, n + 1, nlen - 1))
+            return h + i;
+    }
+    return NULL;
+}
+
+const uint16_t *memmem16(const uint16_t *h, size_t hlen,
+                         const uint16_t *n, size_t nlen)
+{
+    size_t i, end;
+
+    if (nlen == 0)
+        return h;
+    if (nlen > hlen)
+        return NULL;
+    if (nlen == 1)
+        return memchr16(h, n[0], hlen);
+    end = hlen - nlen + 1;
+    i = 0;
+#if defined(__SSE2__)
+    {
+        __m128i first = _mm_set1_epi16(n[0]);
+        __m128i last = _mm_set1_epi16(n[nlen - 1]);
+        int m, k;
+        for(; i + 8 <= end; i += 8) {
+            m = mm_cmpeq16_mask(_mm_loadu_si128((const __m128i *)(h + i)), first) &
+                mm_cmpeq16_mask(_mm_loadu_si128((const __m128i *)(h + i + nlen - 1)), last);
+            while (m) {
+                k = ctz32(m);
+                if (!memcmp16(h + i + k + 1, n + 1, nlen - 2))
+                    return h + i + k;
+                m &= m - 1;
+            }
+        }
+    }
+#endif
+    for(; i < end; i++) {
+        if (h[i] == n[0] && !memcmp16(h + i + 1, n + 1, nlen - 1))
+            return h + i;
+    }
+    return NULL;
+}
+
+/* 16 bit haystack, 8 bit needle */
+const uint16_t *memmem16_8(const uint16_t *h, size_t hlen,
+                           const uint8_t *n, size_t nlen)
+{
+    size_t i, end;
+
+    if (nlen == 0)
+        return h;
+    if (nlen > hlen)
+        return NULL;
+    if (nlen == 1)
+        return memchr16(h, n[0], hlen);
+    end = hlen - nlen + 1;
+    i = 0;
+#if defined(__SSE2__)
+    {
+        __m128i first = _mm_set1_epi16(n[0]);
+        __m128i last = _mm_set1_epi16(n[nlen - 1]);
+        int m, k;
+        for(; i + 8 <= end; i += 8) {
+            m = mm_cmpeq16_mask(_mm_loadu_si128((const __m128i *)(h + i)), first) &
+                mm_cmpeq16_mask(_mm_loadu_si128((const __m128i *)(h + i + nlen - 1)), last);
+            while (m) {
+                k = ctz32(m);
+                if (!memcmp16_8(h + i + k + 1, n + 1, nlen - 2))
+                    return h + i + k;
+                m &= m - 1;
+            }
+        }
+    }
+#endif
+    for(; i < end; i++) {
+        if (h[i] == n[0] && !memcmp16_8(h + i + 1, n + 1, nlen - 1))
+            return h + i;
+    }
+    return NULL;
+}
+
+/* return the length of the JSON white space (space, tab, CR, LF) at
+   the start of p[0..n[ */
+size_t json_space_len(const uint8_t *p, size_t n)
+{
+    size_t i = 0;
+    int c;
+#if defined(__SSE2__)
+    __m128i v, ws;
+    int m;
+    for(; i + 16 <= n; i += 16) {
+        v = _mm_loadu_si128((const __m128i *)(p + i));
+        ws = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8(' ')),
+                                       _mm_cmpeq_epi8(v, _mm_set1_epi8('\t'))),
+                          _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('\n')),
+                                       _mm_cmpeq_epi8(v, _mm_set1_epi8('\r'))));
+        m = _mm_movemask_epi8(ws) ^ 0xffff;
+        if (m)
+            return i + ctz32(m);
+    }
+#endif
+    for(; i < n; i++) {
+        c = p[i];
+        if (c != ' ' && c != '\t' && c != '\n' && c != '\r')
+            break;
+    }
+    return i;
+}
+
+/* return the length of the prefix of p[0..n[ made of ASCII characters
+   which need no decoding in a JSON string, i.e. >= 0x20 and different
+   from 'sep' and the backslash */
+size_t json_plain_string_len(const uint8_t *p, size_t n, int sep)
+{
+    size_t i = 0;
+    int c;
+#if defined(__SSE2__)
+    __m128i v, bad;
+    int m;
+    for(; i + 16 <= n; i += 16) {
+        v = _mm_loadu_si128((const __m128i *)(p + i));
+        /* signed comparison: also true for bytes >= 0x80 */
+        bad = _mm_or_si128(_mm_cmplt_epi8(v, _mm_set1_epi8(0x20)),
+                           _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8(sep)),
+                                        _mm_cmpeq_epi8(v, _mm_set1_epi8('\\'))));
+        m = _mm_movemask_epi8(bad);
+        if (m)
+            return i + ctz32(m);
+    }
+#endif
+    for(; i < n; i++) {
+        c = p[i];
+        if (c < 0x20 || c >= 0x80 || c == sep || c == '\\')
+            break;
+    }
+    return i;
+}
@@ -377,6 +377,24 @@ static inline int from_hex(int c)
 void rqsort(void *base, size_t nmemb, size_t size,
             int (*cmp)(const void *, const void *, void *),
             void *arg);
+/* stable sort. 'tmp' must have room for nmemb / 2 elements. */
+void rmergesort(void *base, size_t nmemb, size_t size,
+                int (*cmp)(const void *, const void *, void *),
+                void *arg, void *tmp);
+
+/* 8 bit (Latin-1) and 16 bit character strings */
+const uint16_t *memchr16(const uint16_t *s, uint16_t c, size_t n);
+int memcmp16(const uint16_t *s1, const uint16_t *s2, size_t n);
+int memcmp16_8(const uint16_t *s1, const uint8_t *s2, size_t n);
+void memcpy8to16(uint16_t *dst, const uint8_t *src, size_t n);
+const uint8_t *memmem8(const uint8_t *h, size_t hlen,
+                       const uint8_t *n, size_t nlen);
+const uint16_t *memmem16(const uint16_t *h, size_t hlen,
+                         const uint16_t *n, size_t nlen);
+const uint16_t *memmem16_8(const uint16_t *h, size_t hlen,
+                           const uint8_t *n, size_t nlen);
+size_t json_space_len(const uint8_t *p, size_t n);
+size_t json_plain_string_len(const uint8_t *p, size_t n, int sep);
 
 static inline uint64_t float64_as_uint64(double d)
 {
@@ -82,6 +82,23 @@ static inline int list_empty(struct list_head *el)
     return el->next == el;
 }
 
+/* move all the elements of 'list' at the end of 'head'. 'list' becomes
+   empty. */
+static inline void list_splice_tail(struct list_head *list,
+                                    struct list_head *head)
+{
+    struct list_head *first, *last;
+    if (list_empty(list))
+        return;
+    first = list->next;
+    last = list->prev;
+    first->prev = head->prev;
+    head->prev->next = first;
+    last->next = head;
+    head->prev = last;
+    init_list_head(list);
+}
+
 #define list_for_each(el, head) \
   for(el = (head)->next; el != (head); el = el->next)
 
@@ -32,6 +32,10 @@
 #include <errno.h>
 #include <fcntl.h>
 #include <time.h>
+#if !defined(_WIN32)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
 #if defined(__APPLE__)
 #include <malloc/malloc.h>
 #elif defined(__linux__) || defined(__GLIBC__)
@@ -103,6 +107,61 @@ static int eval_file(JSContext *ctx, const char *filename, int module, int stric
     return ret;
 }
 
+typedef struct {
+    uint8_t *buf;
+    size_t buf_len;
+} SnapshotFile;
+
+/* the snapshot data is mapped and must stay valid until the runtime
+   is freed because the bytecode is not copied */
+static int load_snapshot(JSContext *ctx, SnapshotFile *sf, const char *filename)
+{
+#if defined(_WIN32)
+    uint8_t *buf;
+    size_t buf_len;
+    int ret;
+
+    buf = js_load_file(ctx, &buf_len, filename);
+    if (!buf) {
+        perror(filename);
+        return -1;
+    }
+    ret = JS_ReadSnapshot(ctx, buf, buf_len, 0);
+    js_free(ctx, buf);
+#else
+    struct stat st;
+    int fd, ret;
+
+    fd = open(filename, O_RDONLY);
+    if (fd < 0 || fstat(fd, &st) < 0) {
+        perror(filename);
+        if (fd >= 0)
+            close(fd);
+        return -1;
+    }
+    sf->buf_len = st.st_size;
+    sf->buf = mmap(NULL, sf->buf_len, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (sf->buf == MAP_FAILED) {
+        sf->buf = NULL;
+        perror(filename);
+        return -1;
+    }
+    ret = JS_ReadSnapshot(ctx, sf->buf, sf->buf_len, JS_READ_OBJ_ROM_DATA);
+#endif
+    if (ret < 0)
+        js_std_dump_error(ctx);
+    return ret;
+}
+
+static void free_snapshot(SnapshotFile *sf)
+{
+#if !defined(_WIN32)
+    if (sf->buf)
+        munmap(sf->buf, sf->buf_len);
+#endif
+}
+
 /* also used to initialize the worker context */
 static JSContext *JS_NewCustomContext(JSRuntime *rt)
 {
@@ -301,12 +360,16 @@ void help(void)
            "-I  --include file include an additional file\n"
            "    --std          make 'std' and 'os' available to the loaded script\n"
            "-T  --trace        trace memory allocation\n"
+           "    --arena        allocate the runtime in an arena released at exit\n"
            "-d  --dump         dump the memory usage stats\n"
+           "    --dump-feedback   dump the operand types seen by the hot opcodes\n"
            "    --memory-limit n  limit the memory usage to 'n' bytes (SI suffixes allowed)\n"
            "    --stack-size n    limit the stack size to 'n' bytes (SI suffixes allowed)\n"
+           "    --gc-pause n      use the generational GC with a pause budget of 'n' microseconds\n"
            "    --no-unhandled-rejection  ignore unhandled promise rejections\n"
            "-s                    strip all the debug info\n"
            "    --strip-source    strip the source code\n"
+           "    --snapshot file   restore the context saved by 'qjsc --snapshot'\n"
            "-q  --quit         just instantiate the interpreter and quit\n");
     exit(1);
 }
@@ -320,17 +383,22 @@ int main(int argc, char **argv)
     char *expr = NULL;
     int interactive = 0;
     int dump_memory = 0;
+    int dump_feedback = 0;
     int trace_memory = 0;
+    int use_arena = 0;
     int empty_run = 0;
     int module = -1;
     int strict = 0;
     int load_std = 0;
     int dump_unhandled_promise_rejection = 1;
     size_t memory_limit = 0;
+    int gc_pause_budget = 0;
     char *include_list[32];
     int i, include_count = 0;
     int strip_flags = 0;
     size_t stack_size = 0;
+    const char *snapshot_filename = NULL;
+    SnapshotFile snapshot_file = { NULL, 0 };
 
     /* cannot use getopt because we want to pass the command line to
        the script */
@@ -401,10 +469,18 @@ int main(int argc, char **argv)
                 dump_memory++;
                 continue;
             }
+            if (!strcmp(longopt, "dump-feedback")) {
+                dump_feedback = 1;
+                continue;
+            }
             if (opt == 'T' || !strcmp(longopt, "trace")) {
                 trace_memory++;
                 continue;
             }
+            if (!strcmp(longopt, "arena")) {
+                use_arena = 1;
+                continue;
+            }
             if (!strcmp(longopt, "std")) {
                 load_std = 1;
                 continue;
@@ -425,6 +501,22 @@ int main(int argc, char **argv)
                 memory_limit = get_suffixed_size(argv[optind++]);
                 continue;
             }
+            if (!strcmp(longopt, "gc-pause")) {
+                if (optind >= argc) {
+                    fprintf(stderr, "expecting GC pause budget");
+                    exit(1);
+                }
+                gc_pause_budget = strtol(argv[optind++], NULL, 0);
+                continue;
+            }
+            if (!strcmp(longopt, "snapshot")) {
+                if (optind >= argc) {
+                    fprintf(stderr, "expecting snapshot filename");
+                    exit(1);
+                }
+                snapshot_filename = argv[optind++];
+                continue;
+            }
             if (!strcmp(longopt, "stack-size")) {
                 if (optind >= argc) {
                     fprintf(stderr, "expecting stack size");
@@ -453,6 +545,8 @@ int main(int argc, char **argv)
     if (trace_memory) {
         js_trace_malloc_init(&trace_data);
         rt = JS_NewRuntime2(&trace_mf, &trace_data);
+    } else if (use_arena) {
+        rt = JS_NewArenaRuntime();
     } else {
         rt = JS_NewRuntime();
     }
@@ -464,7 +558,11 @@ int main(int argc, char **argv)
         JS_SetMemoryLimit(rt, memory_limit);
     if (stack_size != 0)
         JS_SetMaxStackSize(rt, stack_size);
+    if (gc_pause_budget != 0)
+        JS_SetGCPauseBudget(rt, gc_pause_budget);
     JS_SetStripInfo(rt, strip_flags);
+    if (dump_feedback)
+        JS_EnableTypeFeedback(rt, TRUE);
     js_std_set_worker_new_context_func(JS_NewCustomContext);
     js_std_init_handlers(rt);
     ctx = JS_NewCustomContext(rt);
@@ -484,6 +582,11 @@ int main(int argc, char **argv)
     if (!empty_run) {
         js_std_add_helpers(ctx, argc - optind, argv + optind);
 
+        if (snapshot_filename) {
+            if (load_snapshot(ctx, &snapshot_file, snapshot_filename))
+                goto fail;
+        }
+
         /* make 'std' and 'os' visible to non module code */
         if (load_std) {
             const char *str = "import * as std from 'std';\n"
@@ -526,6 +629,8 @@ int main(int argc, char **argv)
         js_std_loop(ctx);
     }
 
+    if (dump_feedback)
+        JS_DumpTypeFeedback(stdout, rt);
     if (dump_memory) {
         JSMemoryUsage stats;
         JS_ComputeMemoryUsage(rt, &stats);
@@ -534,6 +639,7 @@ int main(int argc, char **argv)
     js_std_free_handlers(rt);
     JS_FreeContext(ctx);
     JS_FreeRuntime(rt);
+    free_snapshot(&snapshot_file);
 
     if (empty_run && dump_memory) {
         clock_t t[5];
@@ -564,5 +670,6 @@ int main(int argc, char **argv)
     js_std_free_handlers(rt);
     JS_FreeContext(ctx);
     JS_FreeRuntime(rt);
+    free_snapshot(&snapshot_file);
     return 1;
 }
@@ -407,7 +407,8 @@ void help(void)
            "-p prefix   set the prefix of the generated C names\n"
            "-S n        set the maximum stack size to 'n' bytes (default=%d)\n"
            "-s            strip all the debug info\n"
-           "--keep-source keep the source code\n",
+           "--keep-source keep the source code\n"
+           "--snapshot  evaluate the scripts and output a snapshot of the context for 'qjs --snapshot'\n",
            JS_DEFAULT_STACK_SIZE);
 #ifdef CONFIG_LTO
     {
@@ -556,8 +557,75 @@ typedef enum {
     OUTPUT_C,
     OUTPUT_C_MAIN,
     OUTPUT_EXECUTABLE,
+    OUTPUT_SNAPSHOT,
 } OutputTypeEnum;
 
+/* the context must be initialized as in qjs */
+static int output_snapshot(const char *out_filename, int count,
+                           char **filenames, int strip_flags)
+{
+    JSRuntime *rt;
+    JSContext *ctx;
+    JSValue val;
+    uint8_t *buf, *out_buf;
+    size_t buf_len, out_buf_len;
+    FILE *f;
+    int i, ret;
+
+    rt = JS_NewRuntime();
+    JS_SetStripInfo(rt, strip_flags);
+    js_std_init_handlers(rt);
+    ctx = JS_NewContext(rt);
+    js_init_module_std(ctx, "std");
+    js_init_module_os(ctx, "os");
+    JS_SetModuleLoaderFunc2(rt, NULL, js_module_loader, js_module_check_attributes, NULL);
+    js_std_add_helpers(ctx, 0, NULL);
+    if (JS_EnableSnapshot(ctx))
+        goto exception;
+
+    for(i = 0; i < count; i++) {
+        buf = js_load_file(ctx, &buf_len, filenames[i]);
+        if (!buf) {
+            fprintf(stderr, "Could not load '%s'\n", filenames[i]);
+            exit(1);
+        }
+        val = JS_Eval(ctx, (const char *)buf, buf_len, filenames[i],
+                      JS_EVAL_TYPE_GLOBAL);
+        js_free(ctx, buf);
+        if (JS_IsException(val))
+            goto exception;
+        JS_FreeValue(ctx, val);
+    }
+    /* run the pending jobs so that the snapshot contains their result */
+    for(;;) {
+        ret = JS_ExecutePendingJob(rt, NULL);
+        if (ret < 0)
+            goto exception;
+        if (ret == 0)
+            break;
+    }
+
+    out_buf = JS_WriteSnapshot(ctx, &out_buf_len);
+    if (!out_buf)
+        goto exception;
+    f = fopen(out_filename, "wb");
+    if (!f) {
+        perror(out_filename);
+        exit(1);
+    }
+    fwrite(out_buf, 1, out_buf_len, f);
+    fclose(f);
+    js_free(ctx, out_buf);
+
+    js_std_free_handlers(rt);
+    JS_FreeContext(ctx);
+    JS_FreeRuntime(rt);
+    return 0;
+ exception:
+    js_std_dump_error(ctx);
+    exit(1);
+}
+
 static const char *get_short_optarg(int *poptind, int opt,
                                     const char *arg, int argc, char **argv)
 {
@@ -717,6 +785,10 @@ int main(int argc, char **argv)
                 strip_flags = 0;
                 continue;
             }
+            if (!strcmp(longopt, "snapshot")) {
+                output_type = OUTPUT_SNAPSHOT;
+                continue;
+            }
             if (opt) {
                 fprintf(stderr, "qjsc: unknown option '-%c'\n", opt);
             } else {
@@ -729,6 +801,11 @@ int main(int argc, char **argv)
     if (optind >= argc)
         help();
 
+    if (output_type == OUTPUT_SNAPSHOT) {
+        return output_snapshot(out_filename ? out_filename : "out.snap",
+                               argc - optind, argv + optind, strip_flags);
+    }
+
     if (!out_filename) {
         if (output_type == OUTPUT_EXECUTABLE) {
             out_filename = "a.out";
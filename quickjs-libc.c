@@ -46,6 +46,14 @@
 #include <termios.h>
 #include <sys/ioctl.h>
 #include <sys/wait.h>
+#include <poll.h>
+
+#if defined(__linux__)
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#define USE_EPOLL
+#define USE_EVENTFD
+#endif
 
 #if defined(__FreeBSD__)
 extern char **environ;
@@ -84,10 +92,14 @@ typedef sig_t sighandler_t;
    - add socket calls
 */
 
-typedef struct {
+typedef struct JSOSRWHandler {
     struct list_head link;
     int fd;
+    struct JSOSRWHandler *hash_next; /* in rh_hash */
     JSValue rw_func[2];
+#ifdef USE_EPOLL
+    int epoll_state; /* 0 = not registered, 1 = registered, -1 = error */
+#endif
 } JSOSRWHandler;
 
 typedef struct {
@@ -96,20 +108,28 @@ typedef struct {
     JSValue func;
 } JSOSSignalHandler;
 
-typedef struct {
-    struct list_head link;
+typedef struct JSOSTimer {
+    struct list_head link; /* in os_expired_timers if heap_idx < 0 */
     int timer_id;
+    int heap_idx; /* index in timer_heap or -1 if expired */
     int64_t timeout;
+    uint64_t seq; /* creation order of the timers with the same timeout */
+    struct JSOSTimer *hash_next; /* in timer_hash if timer_id > 0 */
     JSValue func;
 } JSOSTimer;
 
-typedef struct {
+typedef struct JSWorkerMessage {
     struct list_head link;
+    struct JSWorkerMessage *next; /* in JSWorkerMessagePipe.post_stack */
     uint8_t *data;
     size_t data_len;
     /* list of SharedArrayBuffers, necessary to free the message */
     uint8_t **sab_tab;
     size_t sab_tab_len;
+    /* data of the transferred ArrayBuffers. NULL once received. */
+    uint8_t **transfer_data;
+    int transfer_len;
+    int task_id; /* WorkerPool task id or -1 */
 } JSWorkerMessage;
 
 typedef struct JSWaker {
@@ -121,12 +141,20 @@ typedef struct JSWaker {
 #endif
 } JSWaker;
 
+/* The messages are pushed by any number of threads to a lock-free
+   stack and received by a single thread. The receiving thread moves
+   all the posted messages at once to 'msg_queue'. The waker is
+   signaled while there are messages and at most once per batch of
+   received messages. */
 typedef struct {
     int ref_count;
 #ifdef USE_WORKER
-    pthread_mutex_t mutex;
+    _Atomic(JSWorkerMessage *) post_stack; /* last posted message first */
+    atomic_int signaled; /* TRUE if the waker is signaled or about to be */
 #endif
-    struct list_head msg_queue; /* list of JSWorkerMessage.link */
+    /* list of JSWorkerMessage.link. Only accessed by the receiving
+       thread */
+    struct list_head msg_queue;
     JSWaker waker;
 } JSWorkerMessagePipe;
 
@@ -134,8 +162,25 @@ typedef struct {
     struct list_head link;
     JSWorkerMessagePipe *recv_pipe;
     JSValue on_message_func;
+    /* object kept alive while the port is in the port list */
+    JSValue keep_alive;
+#ifdef USE_EPOLL
+    BOOL epoll_registered;
+#endif
 } JSWorkerMessageHandler;
 
+#define OS_EV_READ  (1 << 0)
+#define OS_EV_WRITE (1 << 1)
+
+/* maximum number of events returned by one wait */
+#define OS_READY_MAX 256
+
+typedef struct {
+    int fd;
+    uint8_t events; /* OS_EV_x */
+    uint8_t is_port; /* message pipe of a JSWorkerMessageHandler */
+} JSOSReadyEvent;
+
 typedef struct {
     struct list_head link;
     JSValue promise;
@@ -145,15 +190,50 @@ typedef struct {
 typedef struct JSThreadState {
     struct list_head os_rw_handlers; /* list of JSOSRWHandler.link */
     struct list_head os_signal_handlers; /* list JSOSSignalHandler.link */
-    struct list_head os_timers; /* list of JSOSTimer.link */
+    /* pending timers, ordered by (timeout, seq) */
+    JSOSTimer **timer_heap;
+    int timer_count;
+    int timer_heap_size;
+    uint64_t timer_seq;
+    /* expired timers which are not called yet */
+    struct list_head os_expired_timers; /* list of JSOSTimer.link */
+    /* setTimeout() timers indexed by id */
+    JSOSTimer **timer_hash;
+    int timer_hash_size; /* power of two */
+    int timer_hash_count;
     struct list_head port_list; /* list of JSWorkerMessageHandler.link */
     struct list_head rejected_promise_list; /* list of JSRejectedPromiseEntry.link */
     int eval_script_recurse; /* only used in the main thread */
     int next_timer_id; /* for setTimeout() */
     /* not used in the main thread */
     JSWorkerMessagePipe *recv_pipe, *send_pipe;
+    BOOL is_pool_thread; /* thread of a WorkerPool */
+    /* read/write handlers indexed by fd */
+    JSOSRWHandler **rh_hash;
+    int rh_hash_size; /* power of two */
+    int rh_hash_count;
+    /* events returned by the last wait. They are dispatched one per
+       js_os_poll() call so that the pending jobs are executed between
+       the handlers. */
+    JSOSReadyEvent ready_tab[OS_READY_MAX];
+    int ready_pos;
+    int ready_count;
+#ifndef _WIN32
+    struct pollfd *poll_tab;
+    int poll_tab_size;
+#endif
+#ifdef USE_EPOLL
+    int epoll_fd; /* -1 if not created */
+    int epoll_error_count; /* number of handlers not registered in epoll */
+#endif
 } JSThreadState;
 
+static BOOL is_main_thread(JSRuntime *rt)
+{
+    JSThreadState *ts = JS_GetRuntimeOpaque(rt);
+    return !ts->recv_pipe && !ts->is_pool_thread;
+}
+
 static uint64_t os_pending_signals;
 static int (*os_poll_func)(JSContext *ctx);
 
@@ -896,7 +976,7 @@ static JSValue js_evalScript(JSContext *ctx, JSValueConst this_val,
     str = JS_ToCStringLen(ctx, &len, argv[0]);
     if (!str)
         return JS_EXCEPTION;
-    if (!ts->recv_pipe && ++ts->eval_script_recurse == 1) {
+    if (is_main_thread(JS_GetRuntime(ctx)) && ++ts->eval_script_recurse == 1) {
         /* install the interrupt handler */
         JS_SetInterruptHandler(JS_GetRuntime(ctx), interrupt_handler, NULL);
     }
@@ -907,7 +987,7 @@ static JSValue js_evalScript(JSContext *ctx, JSValueConst this_val,
         flags |= JS_EVAL_FLAG_ASYNC;
     ret = JS_Eval(ctx, str, len, "<evalScript>", flags);
     JS_FreeCString(ctx, str);
-    if (!ts->recv_pipe && --ts->eval_script_recurse == 0) {
+    if (is_main_thread(JS_GetRuntime(ctx)) && --ts->eval_script_recurse == 0) {
         /* remove the interrupt handler */
         JS_SetInterruptHandler(JS_GetRuntime(ctx), NULL, NULL);
         os_pending_signals &= ~((uint64_t)1 << SIGINT);
@@ -972,6 +1052,86 @@ static JSValue js_std_parseExtJSON(JSContext *ctx, JSValueConst this_val,
     return obj;
 }
 
+/* return the bytes of an ArrayBuffer or of a typed array */
+static uint8_t *js_std_get_bytes(JSContext *ctx, size_t *psize,
+                                 JSValueConst obj)
+{
+    JSValue abuf;
+    size_t offset, len, size;
+    uint8_t *buf;
+
+    if (JS_GetTypedArrayType(obj) < 0)
+        return JS_GetArrayBuffer(ctx, psize, obj);
+    abuf = JS_GetTypedArrayBuffer(ctx, obj, &offset, &len, NULL);
+    if (JS_IsException(abuf))
+        return NULL;
+    /* the typed array keeps a reference to the buffer */
+    buf = JS_GetArrayBuffer(ctx, &size, abuf);
+    JS_FreeValue(ctx, abuf);
+    if (!buf)
+        return NULL;
+    *psize = len;
+    return buf + offset;
+}
+
+/* parseJSONBuffer(buf[, ext]): 'buf' is a UTF-8 encoded ArrayBuffer,
+   typed array or an array of them */
+static JSValue js_std_parseJSONBuffer(JSContext *ctx, JSValueConst this_val,
+                                      int argc, JSValueConst *argv)
+{
+    JSValue val, obj;
+    DynBuf dbuf;
+    uint8_t *buf;
+    size_t len;
+    uint32_t i, count;
+    int flags, ret;
+
+    flags = 0;
+    if (argc > 1 && JS_ToBool(ctx, argv[1]))
+        flags |= JS_PARSE_JSON_EXT;
+    ret = JS_IsArray(ctx, argv[0]);
+    if (ret < 0)
+        return JS_EXCEPTION;
+    if (!ret) {
+        buf = js_std_get_bytes(ctx, &len, argv[0]);
+        if (!buf)
+            return JS_EXCEPTION;
+        return JS_ParseJSONBuffer(ctx, buf, len, "<input>", flags);
+    }
+
+    /* concatenate the chunks */
+    val = JS_GetPropertyStr(ctx, argv[0], "length");
+    if (JS_IsException(val))
+        return JS_EXCEPTION;
+    ret = JS_ToUint32(ctx, &count, val);
+    JS_FreeValue(ctx, val);
+    if (ret)
+        return JS_EXCEPTION;
+    js_std_dbuf_init(ctx, &dbuf);
+    for(i = 0; i < count; i++) {
+        val = JS_GetPropertyUint32(ctx, argv[0], i);
+        if (JS_IsException(val))
+            goto fail;
+        buf = js_std_get_bytes(ctx, &len, val);
+        if (buf)
+            dbuf_put(&dbuf, buf, len);
+        JS_FreeValue(ctx, val);
+        if (!buf)
+            goto fail;
+    }
+    dbuf_putc(&dbuf, '\0');
+    if (dbuf_error(&dbuf)) {
+        JS_ThrowOutOfMemory(ctx);
+        goto fail;
+    }
+    obj = JS_ParseJSON2(ctx, (char *)dbuf.buf, dbuf.size - 1, "<input>", flags);
+    dbuf_free(&dbuf);
+    return obj;
+ fail:
+    dbuf_free(&dbuf);
+    return JS_EXCEPTION;
+}
+
 static JSValue js_new_std_file(JSContext *ctx, FILE *f,
                                BOOL close_in_finalizer,
                                BOOL is_popen)
@@ -1650,6 +1810,7 @@ static const JSCFunctionListEntry js_std_funcs[] = {
     JS_CFUNC_DEF("loadFile", 1, js_std_loadFile ),
     JS_CFUNC_DEF("strerror", 1, js_std_strerror ),
     JS_CFUNC_DEF("parseExtJSON", 1, js_std_parseExtJSON ),
+    JS_CFUNC_DEF("parseJSONBuffer", 1, js_std_parseJSONBuffer ),
 
     /* FILE I/O */
     JS_CFUNC_DEF("open", 2, js_std_open ),
@@ -1975,28 +2136,115 @@ static JSValue js_os_rename(JSContext *ctx, JSValueConst this_val,
     return JS_NewInt32(ctx, ret);
 }
 
-static BOOL is_main_thread(JSRuntime *rt)
-{
-    JSThreadState *ts = JS_GetRuntimeOpaque(rt);
-    return !ts->recv_pipe;
-}
-
 static JSOSRWHandler *find_rh(JSThreadState *ts, int fd)
 {
     JSOSRWHandler *rh;
-    struct list_head *el;
-
-    list_for_each(el, &ts->os_rw_handlers) {
-        rh = list_entry(el, JSOSRWHandler, link);
+    if (ts->rh_hash_size == 0)
+        return NULL;
+    for(rh = ts->rh_hash[fd & (ts->rh_hash_size - 1)]; rh != NULL;
+        rh = rh->hash_next) {
         if (rh->fd == fd)
             return rh;
     }
     return NULL;
 }
 
+static int rh_hash_resize(JSRuntime *rt, JSThreadState *ts, int new_size)
+{
+    JSOSRWHandler **new_hash, *rh, *rh_next;
+    int i, h;
+
+    new_hash = js_mallocz_rt(rt, sizeof(new_hash[0]) * new_size);
+    if (!new_hash)
+        return -1;
+    for(i = 0; i < ts->rh_hash_size; i++) {
+        for(rh = ts->rh_hash[i]; rh != NULL; rh = rh_next) {
+            rh_next = rh->hash_next;
+            h = rh->fd & (new_size - 1);
+            rh->hash_next = new_hash[h];
+            new_hash[h] = rh;
+        }
+    }
+    js_free_rt(rt, ts->rh_hash);
+    ts->rh_hash = new_hash;
+    ts->rh_hash_size = new_size;
+    return 0;
+}
+
+/* drop the pending ready events of 'fd' when its handlers are
+   removed, so that the handlers set later for a reused fd do not get
+   them */
+static void os_drop_ready_events(JSThreadState *ts, int fd, int events)
+{
+    JSOSReadyEvent *ev;
+    int i;
+
+    for(i = ts->ready_pos; i < ts->ready_count; i++) {
+        ev = &ts->ready_tab[i];
+        if (!ev->is_port && ev->fd == fd)
+            ev->events &= ~events;
+    }
+}
+
+#ifdef USE_EPOLL
+/* register the events of 'rh' in the epoll set. If it is not
+   possible (e.g. 'fd' is a regular file), js_os_poll() falls back to
+   poll(). */
+static void rh_update_epoll(JSThreadState *ts, JSOSRWHandler *rh)
+{
+    struct epoll_event ev;
+    int ret;
+
+    ret = -1;
+    if (ts->epoll_fd < 0)
+        ts->epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    if (ts->epoll_fd >= 0) {
+        memset(&ev, 0, sizeof(ev));
+        if (!JS_IsNull(rh->rw_func[0]))
+            ev.events |= EPOLLIN;
+        if (!JS_IsNull(rh->rw_func[1]))
+            ev.events |= EPOLLOUT;
+        ev.data.u64 = rh->fd;
+        ret = epoll_ctl(ts->epoll_fd, rh->epoll_state == 1 ?
+                        EPOLL_CTL_MOD : EPOLL_CTL_ADD, rh->fd, &ev);
+        /* the fd may have been closed and reopened */
+        if (ret < 0 && errno == ENOENT)
+            ret = epoll_ctl(ts->epoll_fd, EPOLL_CTL_ADD, rh->fd, &ev);
+        else if (ret < 0 && errno == EEXIST)
+            ret = epoll_ctl(ts->epoll_fd, EPOLL_CTL_MOD, rh->fd, &ev);
+    }
+    if (ret == 0) {
+        if (rh->epoll_state < 0)
+            ts->epoll_error_count--;
+        rh->epoll_state = 1;
+    } else {
+        if (rh->epoll_state >= 0)
+            ts->epoll_error_count++;
+        rh->epoll_state = -1;
+    }
+}
+#endif
+
 static void free_rw_handler(JSRuntime *rt, JSOSRWHandler *rh)
 {
+    JSThreadState *ts = JS_GetRuntimeOpaque(rt);
+    JSOSRWHandler **prh;
     int i;
+
+#ifdef USE_EPOLL
+    if (rh->epoll_state > 0) {
+        /* may fail if the fd was closed */
+        epoll_ctl(ts->epoll_fd, EPOLL_CTL_DEL, rh->fd, NULL);
+    } else if (rh->epoll_state < 0) {
+        ts->epoll_error_count--;
+    }
+#endif
+    prh = &ts->rh_hash[rh->fd & (ts->rh_hash_size - 1)];
+    while (*prh != rh)
+        prh = &(*prh)->hash_next;
+    *prh = rh->hash_next;
+    ts->rh_hash_count--;
+    os_drop_ready_events(ts, rh->fd, OS_EV_READ | OS_EV_WRITE);
     list_del(&rh->link);
     for(i = 0; i < 2; i++) {
         JS_FreeValueRT(rt, rh->rw_func[i]);
@@ -2010,7 +2258,7 @@ static JSValue js_os_setReadHandler(JSContext *ctx, JSValueConst this_val,
     JSRuntime *rt = JS_GetRuntime(ctx);
     JSThreadState *ts = JS_GetRuntimeOpaque(rt);
     JSOSRWHandler *rh;
-    int fd;
+    int fd, h;
     JSValueConst func;
 
     if (JS_ToInt32(ctx, &fd, argv[0]))
@@ -2021,17 +2269,28 @@ static JSValue js_os_setReadHandler(JSContext *ctx, JSValueConst this_val,
         if (rh) {
             JS_FreeValue(ctx, rh->rw_func[magic]);
             rh->rw_func[magic] = JS_NULL;
+            os_drop_ready_events(ts, fd, magic == 0 ? OS_EV_READ : OS_EV_WRITE);
             if (JS_IsNull(rh->rw_func[0]) &&
                 JS_IsNull(rh->rw_func[1])) {
                 /* remove the entry */
                 free_rw_handler(JS_GetRuntime(ctx), rh);
+            } else {
+#ifdef USE_EPOLL
+                rh_update_epoll(ts, rh);
+#endif
             }
         }
     } else {
         if (!JS_IsFunction(ctx, func))
             return JS_ThrowTypeError(ctx, "not a function");
+        if (fd < 0)
+            return JS_ThrowRangeError(ctx, "invalid file descriptor");
         rh = find_rh(ts, fd);
         if (!rh) {
+            if (ts->rh_hash_count >= ts->rh_hash_size) {
+                if (rh_hash_resize(rt, ts, max_int(16, ts->rh_hash_size * 2)))
+                    return JS_ThrowOutOfMemory(ctx);
+            }
             rh = js_mallocz(ctx, sizeof(*rh));
             if (!rh)
                 return JS_EXCEPTION;
@@ -2039,9 +2298,16 @@ static JSValue js_os_setReadHandler(JSContext *ctx, JSValueConst this_val,
             rh->rw_func[0] = JS_NULL;
             rh->rw_func[1] = JS_NULL;
             list_add_tail(&rh->link, &ts->os_rw_handlers);
+            h = fd & (ts->rh_hash_size - 1);
+            rh->hash_next = ts->rh_hash[h];
+            ts->rh_hash[h] = rh;
+            ts->rh_hash_count++;
         }
         JS_FreeValue(ctx, rh->rw_func[magic]);
         rh->rw_func[magic] = JS_DupValue(ctx, func);
+#ifdef USE_EPOLL
+        rh_update_epoll(ts, rh);
+#endif
     }
     return JS_UNDEFINED;
 }
@@ -2158,13 +2424,149 @@ static JSValue js_os_now(JSContext *ctx, JSValue this_val,
     return JS_NewFloat64(ctx, (double)get_time_ns() / 1e6);
 }
 
+static inline BOOL timer_lt(const JSOSTimer *a, const JSOSTimer *b)
+{
+    return a->timeout < b->timeout ||
+        (a->timeout == b->timeout && a->seq < b->seq);
+}
+
+static void timer_heap_set(JSThreadState *ts, int idx, JSOSTimer *th)
+{
+    ts->timer_heap[idx] = th;
+    th->heap_idx = idx;
+}
+
+static void timer_heap_up(JSThreadState *ts, int idx, JSOSTimer *th)
+{
+    int parent;
+    while (idx > 0) {
+        parent = (idx - 1) / 2;
+        if (!timer_lt(th, ts->timer_heap[parent]))
+            break;
+        timer_heap_set(ts, idx, ts->timer_heap[parent]);
+        idx = parent;
+    }
+    timer_heap_set(ts, idx, th);
+}
+
+static void timer_heap_down(JSThreadState *ts, int idx, JSOSTimer *th)
+{
+    int child, n = ts->timer_count;
+    for(;;) {
+        child = 2 * idx + 1;
+        if (child >= n)
+            break;
+        if (child + 1 < n &&
+            timer_lt(ts->timer_heap[child + 1], ts->timer_heap[child]))
+            child++;
+        if (!timer_lt(ts->timer_heap[child], th))
+            break;
+        timer_heap_set(ts, idx, ts->timer_heap[child]);
+        idx = child;
+    }
+    timer_heap_set(ts, idx, th);
+}
+
+static void timer_heap_remove(JSThreadState *ts, JSOSTimer *th)
+{
+    int idx = th->heap_idx;
+    JSOSTimer *last;
+
+    last = ts->timer_heap[--ts->timer_count];
+    if (last != th) {
+        if (idx > 0 && timer_lt(last, ts->timer_heap[(idx - 1) / 2]))
+            timer_heap_up(ts, idx, last);
+        else
+            timer_heap_down(ts, idx, last);
+    }
+    th->heap_idx = -1;
+}
+
+static int timer_hash_resize(JSRuntime *rt, JSThreadState *ts, int new_size)
+{
+    JSOSTimer **new_hash, *th, *th_next;
+    int i, h;
+
+    new_hash = js_mallocz_rt(rt, sizeof(new_hash[0]) * new_size);
+    if (!new_hash)
+        return -1;
+    for(i = 0; i < ts->timer_hash_size; i++) {
+        for(th = ts->timer_hash[i]; th != NULL; th = th_next) {
+            th_next = th->hash_next;
+            h = th->timer_id & (new_size - 1);
+            th->hash_next = new_hash[h];
+            new_hash[h] = th;
+        }
+    }
+    js_free_rt(rt, ts->timer_hash);
+    ts->timer_hash = new_hash;
+    ts->timer_hash_size = new_size;
+    return 0;
+}
+
 static void free_timer(JSRuntime *rt, JSOSTimer *th)
 {
-    list_del(&th->link);
+    JSThreadState *ts = JS_GetRuntimeOpaque(rt);
+    JSOSTimer **pth;
+
+    if (th->heap_idx >= 0)
+        timer_heap_remove(ts, th);
+    else
+        list_del(&th->link);
+    if (th->timer_id > 0) {
+        pth = &ts->timer_hash[th->timer_id & (ts->timer_hash_size - 1)];
+        while (*pth != th)
+            pth = &(*pth)->hash_next;
+        *pth = th->hash_next;
+        ts->timer_hash_count--;
+    }
     JS_FreeValueRT(rt, th->func);
     js_free_rt(rt, th);
 }
 
+/* insert a timer expiring in 'delay' ms. Return NULL if error. */
+static JSOSTimer *add_timer(JSContext *ctx, int64_t delay, int timer_id,
+                            JSValueConst func)
+{
+    JSRuntime *rt = JS_GetRuntime(ctx);
+    JSThreadState *ts = JS_GetRuntimeOpaque(rt);
+    JSOSTimer *th;
+    int h;
+
+    if (ts->timer_count >= ts->timer_heap_size) {
+        JSOSTimer **new_heap;
+        int new_size;
+        new_size = max_int(16, ts->timer_heap_size * 3 / 2);
+        new_heap = js_realloc(ctx, ts->timer_heap,
+                              sizeof(new_heap[0]) * new_size);
+        if (!new_heap)
+            return NULL;
+        ts->timer_heap = new_heap;
+        ts->timer_heap_size = new_size;
+    }
+    if (timer_id > 0 && ts->timer_hash_count >= ts->timer_hash_size) {
+        if (timer_hash_resize(rt, ts, max_int(16, ts->timer_hash_size * 2))) {
+            JS_ThrowOutOfMemory(ctx);
+            return NULL;
+        }
+    }
+    th = js_mallocz(ctx, sizeof(*th));
+    if (!th)
+        return NULL;
+    th->timer_id = timer_id;
+    th->timeout = get_time_ms() + delay;
+    th->seq = ts->timer_seq++;
+    th->func = JS_DupValue(ctx, func);
+    timer_heap_up(ts, ts->timer_count++, th);
+    if (timer_id > 0) {
+        h = timer_id & (ts->timer_hash_size - 1);
+        th->hash_next = ts->timer_hash[h];
+        ts->timer_hash[h] = th;
+        ts->timer_hash_count++;
+    }
+    return th;
+}
+
 static JSValue js_os_setTimeout(JSContext *ctx, JSValueConst this_val,
                                 int argc, JSValueConst *argv)
 {
@@ -2179,27 +2581,23 @@ static JSValue js_os_setTimeout(JSContext *ctx, JSValueConst this_val,
         return JS_ThrowTypeError(ctx, "not a function");
     if (JS_ToInt64(ctx, &delay, argv[1]))
         return JS_EXCEPTION;
-    th = js_mallocz(ctx, sizeof(*th));
+    th = add_timer(ctx, delay, ts->next_timer_id, func);
     if (!th)
         return JS_EXCEPTION;
-    th->timer_id = ts->next_timer_id;
     if (ts->next_timer_id == INT32_MAX)
         ts->next_timer_id = 1;
     else
         ts->next_timer_id++;
-    th->timeout = get_time_ms() + delay;
-    th->func = JS_DupValue(ctx, func);
-    list_add_tail(&th->link, &ts->os_timers);
     return JS_NewInt32(ctx, th->timer_id);
 }
 
 static JSOSTimer *find_timer_by_id(JSThreadState *ts, int timer_id)
 {
-    struct list_head *el;
-    if (timer_id <= 0)
+    JSOSTimer *th;
+    if (timer_id <= 0 || ts->timer_hash_size == 0)
         return NULL;
-    list_for_each(el, &ts->os_timers) {
-        JSOSTimer *th = list_entry(el, JSOSTimer, link);
+    for(th = ts->timer_hash[timer_id & (ts->timer_hash_size - 1)];
+        th != NULL; th = th->hash_next) {
         if (th->timer_id == timer_id)
             return th;
     }
@@ -2227,8 +2625,6 @@ static JSValue js_os_clearTimeout(JSContext *ctx, JSValueConst this_val,
 static JSValue js_os_sleepAsync(JSContext *ctx, JSValueConst this_val,
                                 int argc, JSValueConst *argv)
 {
-    JSRuntime *rt = JS_GetRuntime(ctx);
-    JSThreadState *ts = JS_GetRuntimeOpaque(rt);
     int64_t delay;
     JSOSTimer *th;
     JSValue promise, resolving_funcs[2];
@@ -2239,17 +2635,13 @@ static JSValue js_os_sleepAsync(JSContext *ctx, JSValueConst this_val,
     if (JS_IsException(promise))
         return JS_EXCEPTION;
 
-    th = js_mallocz(ctx, sizeof(*th));
+    th = add_timer(ctx, delay, -1, resolving_funcs[0]);
     if (!th) {
         JS_FreeValue(ctx, promise);
         JS_FreeValue(ctx, resolving_funcs[0]);
         JS_FreeValue(ctx, resolving_funcs[1]);
         return JS_EXCEPTION;
     }
-    th->timer_id = -1;
-    th->timeout = get_time_ms() + delay;
-    th->func = JS_DupValue(ctx, resolving_funcs[0]);
-    list_add_tail(&th->link, &ts->os_timers);
     JS_FreeValue(ctx, resolving_funcs[0]);
     JS_FreeValue(ctx, resolving_funcs[1]);
     return promise;
@@ -2268,6 +2660,52 @@ static void call_handler(JSContext *ctx, JSValueConst func)
     JS_FreeValue(ctx, ret);
 }
 
+/* Call the first expired timer and return TRUE. Otherwise return
+   FALSE and the delay in ms until the next timer in '*pmin_delay' (-1
+   if no timer). All the timers expired at the same time are moved to
+   os_expired_timers so that they are called in order without reading
+   the clock again. */
+static BOOL call_expired_timer(JSContext *ctx, int *pmin_delay)
+{
+    JSRuntime *rt = JS_GetRuntime(ctx);
+    JSThreadState *ts = JS_GetRuntimeOpaque(rt);
+    JSOSTimer *th;
+    JSValue func;
+    int64_t cur_time, delay;
+
+    if (list_empty(&ts->os_expired_timers)) {
+        if (ts->timer_count == 0) {
+            *pmin_delay = -1;
+            return FALSE;
+        }
+        cur_time = get_time_ms();
+        while (ts->timer_count != 0) {
+            th = ts->timer_heap[0];
+            delay = th->timeout - cur_time;
+            if (delay > 0) {
+                if (!list_empty(&ts->os_expired_timers))
+                    break;
+                *pmin_delay = delay < 10000 ? delay : 10000;
+                return FALSE;
+            }
+            timer_heap_remove(ts, th);
+            list_add_tail(&th->link, &ts->os_expired_timers);
+        }
+    }
+    th = list_entry(ts->os_expired_timers.next, JSOSTimer, link);
+    func = th->func;
+    th->func = JS_UNDEFINED;
+    free_timer(rt, th);
+    call_handler(ctx, func);
+    JS_FreeValue(ctx, func);
+    return TRUE;
+}
+
+static BOOL has_timers(JSThreadState *ts)
+{
+    return ts->timer_count != 0 || !list_empty(&ts->os_expired_timers);
+}
+
 #ifdef USE_WORKER
 
 #ifdef _WIN32
@@ -2294,7 +2732,56 @@ static void js_waker_close(JSWaker *w)
     w->handle = INVALID_HANDLE_VALUE;
 }
 
-#else // !_WIN32
+#elif defined(USE_EVENTFD)
+
+static int js_waker_init(JSWaker *w)
+{
+    int fd;
+
+    fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if (fd < 0)
+        return -1;
+    w->read_fd = fd;
+    w->write_fd = fd;
+    return 0;
+}
+
+static void js_waker_signal(JSWaker *w)
+{
+    uint64_t v = 1;
+    int ret;
+
+    for(;;) {
+        ret = write(w->write_fd, &v, sizeof(v));
+        if (ret == sizeof(v))
+            break;
+        if (ret < 0 && errno != EINTR)
+            break;
+    }
+}
+
+static void js_waker_clear(JSWaker *w)
+{
+    uint64_t v;
+    int ret;
+
+    for(;;) {
+        ret = read(w->read_fd, &v, sizeof(v));
+        if (ret >= 0)
+            break;
+        if (errno != EINTR)
+            break; /* EAGAIN: not signaled */
+    }
+}
+
+static void js_waker_close(JSWaker *w)
+{
+    close(w->read_fd);
+    w->read_fd = -1;
+    w->write_fd = -1;
+}
+
+#else
 
 static int js_waker_init(JSWaker *w)
 {
@@ -2302,6 +2789,8 @@ static int js_waker_init(JSWaker *w)
 
     if (pipe(fds) < 0)
         return -1;
+    /* js_waker_clear() may be called when the waker is not signaled */
+    fcntl(fds[0], F_SETFL, O_NONBLOCK);
     w->read_fd = fds[0];
     w->write_fd = fds[1];
     return 0;
@@ -2329,8 +2818,8 @@ static void js_waker_clear(JSWaker *w)
         ret = read(w->read_fd, buf, sizeof(buf));
         if (ret >= 0)
             break;
-        if (errno != EAGAIN && errno != EINTR)
-            break;
+        if (errno != EINTR)
+            break; /* EAGAIN: not signaled */
     }
 }
 
@@ -2345,43 +2834,125 @@ static void js_waker_close(JSWaker *w)
 #endif // _WIN32
 
 static void js_free_message(JSWorkerMessage *msg);
+static JSWorkerMessagePipe *js_dup_message_pipe(JSWorkerMessagePipe *ps);
+static JSValue worker_pool_error_result(JSContext *ctx, int id);
+static void js_free_message_pipe(JSWorkerMessagePipe *ps);
 
-/* return 1 if a message was handled, 0 if no message */
-static int handle_posted_message(JSRuntime *rt, JSContext *ctx,
-                                 JSWorkerMessageHandler *port)
+/* can be called from any thread */
+static void js_post_message(JSWorkerMessagePipe *ps, JSWorkerMessage *msg)
 {
-    JSWorkerMessagePipe *ps = port->recv_pipe;
-    int ret;
-    struct list_head *el;
-    JSWorkerMessage *msg;
-    JSValue obj, data_obj, func, retval;
-
-    pthread_mutex_lock(&ps->mutex);
-    if (!list_empty(&ps->msg_queue)) {
-        el = ps->msg_queue.next;
-        msg = list_entry(el, JSWorkerMessage, link);
+    JSWorkerMessage *head;
 
-        /* remove the message from the queue */
-        list_del(&msg->link);
+    head = atomic_load_explicit(&ps->post_stack, memory_order_relaxed);
+    do {
+        msg->next = head;
+    } while (!atomic_compare_exchange_weak_explicit(&ps->post_stack, &head, msg,
+                                                    memory_order_release,
+                                                    memory_order_relaxed));
+    /* indicate that data is present */
+    if (!atomic_exchange(&ps->signaled, TRUE))
+        js_waker_signal(&ps->waker);
+}
 
-        if (list_empty(&ps->msg_queue))
-            js_waker_clear(&ps->waker);
+/* move the posted messages to the end of 'msg_queue' */
+static void js_receive_posted_messages(JSWorkerMessagePipe *ps)
+{
+    JSWorkerMessage *msg, *next;
+    struct list_head batch;
 
-        pthread_mutex_unlock(&ps->mutex);
+    msg = atomic_exchange_explicit(&ps->post_stack, NULL, memory_order_acquire);
+    if (!msg)
+        return;
+    /* the stack is in reverse posting order */
+    init_list_head(&batch);
+    for(; msg != NULL; msg = next) {
+        next = msg->next;
+        list_add(&msg->link, &batch);
+    }
+    list_splice_tail(&batch, &ps->msg_queue);
+}
 
-        data_obj = JS_ReadObject(ctx, msg->data, msg->data_len,
-                                 JS_READ_OBJ_SAB | JS_READ_OBJ_REFERENCE);
+/* called when 'msg_queue' is empty */
+static void js_rearm_message_pipe(JSWorkerMessagePipe *ps)
+{
+    /* the waker stays signaled as long as messages are posted */
+    js_receive_posted_messages(ps);
+    if (!list_empty(&ps->msg_queue))
+        return;
+    js_waker_clear(&ps->waker);
+    atomic_store(&ps->signaled, FALSE);
+    /* the messages posted while 'signaled' was TRUE did not signal
+       the waker */
+    js_receive_posted_messages(ps);
+    if (!list_empty(&ps->msg_queue)) {
+        if (!atomic_exchange(&ps->signaled, TRUE))
+            js_waker_signal(&ps->waker);
+    }
+}
 
-        js_free_message(msg);
+/* return the next received message or NULL if none. '*pmore' is set
+   to TRUE if other messages of the same batch are available. Only
+   called by the receiving thread. */
+static JSWorkerMessage *js_get_message(JSWorkerMessagePipe *ps, BOOL *pmore)
+{
+    JSWorkerMessage *msg;
 
-        if (JS_IsException(data_obj))
-            goto fail;
-        obj = JS_NewObject(ctx);
-        if (JS_IsException(obj)) {
-            JS_FreeValue(ctx, data_obj);
-            goto fail;
+    if (list_empty(&ps->msg_queue)) {
+        js_receive_posted_messages(ps);
+        if (list_empty(&ps->msg_queue)) {
+            js_rearm_message_pipe(ps);
+            if (list_empty(&ps->msg_queue))
+                return NULL;
         }
-        JS_DefinePropertyValueStr(ctx, obj, "data", data_obj, JS_PROP_C_W_E);
+    }
+    msg = list_entry(ps->msg_queue.next, JSWorkerMessage, link);
+    list_del(&msg->link);
+    *pmore = !list_empty(&ps->msg_queue);
+    /* the waker is only cleared once per batch of messages */
+    if (!*pmore)
+        js_rearm_message_pipe(ps);
+    return msg;
+}
+
+/* return 0 if no message, 1 if a message was handled, 2 if a message
+   was handled and the next message of the batch can be handled
+   without waiting */
+static int handle_posted_message(JSRuntime *rt, JSContext *ctx,
+                                 JSWorkerMessageHandler *port)
+{
+    JSWorkerMessagePipe *ps = port->recv_pipe;
+    int ret, task_id;
+    BOOL more;
+    JSWorkerMessage *msg;
+    JSValue obj, data_obj, func, retval;
+
+    msg = js_get_message(ps, &more);
+    if (msg) {
+        /* 'port' may be freed by the handler */
+        js_dup_message_pipe(ps);
+
+        if (msg->data) {
+            data_obj = JS_ReadObject2(ctx, msg->data, msg->data_len,
+                                      JS_READ_OBJ_SAB | JS_READ_OBJ_REFERENCE,
+                                      msg->transfer_data, msg->transfer_len);
+        } else {
+            /* empty result of a WorkerPool task */
+            data_obj = JS_ThrowInternalError(ctx, "the task result could not be sent");
+        }
+        task_id = msg->task_id;
+        js_free_message(msg);
+
+        /* the WorkerPool tasks are always settled */
+        if (JS_IsException(data_obj) && task_id >= 0)
+            data_obj = worker_pool_error_result(ctx, task_id);
+        if (JS_IsException(data_obj))
+            goto fail;
+        obj = JS_NewObject(ctx);
+        if (JS_IsException(obj)) {
+            JS_FreeValue(ctx, data_obj);
+            goto fail;
+        }
+        JS_DefinePropertyValueStr(ctx, obj, "data", data_obj, JS_PROP_C_W_E);
 
         /* 'func' might be destroyed when calling itself (if it frees the
            handler), so must take extra care */
@@ -2395,9 +2966,9 @@ static int handle_posted_message(JSRuntime *rt, JSContext *ctx,
         } else {
             JS_FreeValue(ctx, retval);
         }
-        ret = 1;
+        ret = 1 + more;
+        js_free_message_pipe(ps);
     } else {
-        pthread_mutex_unlock(&ps->mutex);
         ret = 0;
     }
     return ret;
@@ -2417,40 +2988,19 @@ static int js_os_poll(JSContext *ctx)
     JSRuntime *rt = JS_GetRuntime(ctx);
     JSThreadState *ts = JS_GetRuntimeOpaque(rt);
     int min_delay, count;
-    int64_t cur_time, delay;
     JSOSRWHandler *rh;
     struct list_head *el;
     HANDLE handles[MAXIMUM_WAIT_OBJECTS]; // 64
 
     /* XXX: handle signals if useful */
 
-    if (list_empty(&ts->os_rw_handlers) && list_empty(&ts->os_timers) &&
+    if (list_empty(&ts->os_rw_handlers) && !has_timers(ts) &&
         list_empty(&ts->port_list)) {
         return -1; /* no more events */
     }
     
-    if (!list_empty(&ts->os_timers)) {
-        cur_time = get_time_ms();
-        min_delay = 10000;
-        list_for_each(el, &ts->os_timers) {
-            JSOSTimer *th = list_entry(el, JSOSTimer, link);
-            delay = th->timeout - cur_time;
-            if (delay <= 0) {
-                JSValue func;
-                /* the timer expired */
-                func = th->func;
-                th->func = JS_UNDEFINED;
-                free_timer(rt, th);
-                call_handler(ctx, func);
-                JS_FreeValue(ctx, func);
-                return 0;
-            } else if (delay < min_delay) {
-                min_delay = delay;
-            }
-        }
-    } else {
-        min_delay = -1;
-    }
+    if (call_expired_timer(ctx, &min_delay))
+        return 0;
 
     count = 0;
     list_for_each(el, &ts->os_rw_handlers) {
@@ -2507,19 +3057,185 @@ static int js_os_poll(JSContext *ctx)
 
 #else
 
+static void os_add_ready_event(JSThreadState *ts, int fd, int events,
+                               BOOL is_port)
+{
+    JSOSReadyEvent *ev;
+    if (events == 0 || ts->ready_count >= OS_READY_MAX)
+        return;
+    ev = &ts->ready_tab[ts->ready_count++];
+    ev->fd = fd;
+    ev->events = events;
+    ev->is_port = is_port;
+}
+
+/* wait for the read/write handlers and the message pipes with poll() */
+static void os_wait_poll(JSRuntime *rt, JSThreadState *ts, int timeout)
+{
+    struct list_head *el;
+    struct pollfd *pfd;
+    JSOSRWHandler *rh;
+    int n, nb_rh, i, ret, events;
+
+    n = 0;
+    list_for_each(el, &ts->os_rw_handlers)
+        n++;
+    nb_rh = n;
+    list_for_each(el, &ts->port_list)
+        n++;
+    if (n > ts->poll_tab_size) {
+        struct pollfd *new_tab;
+        int new_size;
+        new_size = max_int(n, ts->poll_tab_size * 3 / 2);
+        new_tab = js_realloc_rt(rt, ts->poll_tab, sizeof(new_tab[0]) * new_size);
+        if (!new_tab)
+            return;
+        ts->poll_tab = new_tab;
+        ts->poll_tab_size = new_size;
+    }
+
+    pfd = ts->poll_tab;
+    list_for_each(el, &ts->os_rw_handlers) {
+        rh = list_entry(el, JSOSRWHandler, link);
+        pfd->fd = rh->fd;
+        pfd->events = 0;
+        if (!JS_IsNull(rh->rw_func[0]))
+            pfd->events |= POLLIN;
+        if (!JS_IsNull(rh->rw_func[1]))
+            pfd->events |= POLLOUT;
+        pfd->revents = 0;
+        pfd++;
+    }
+    list_for_each(el, &ts->port_list) {
+        JSWorkerMessageHandler *port = list_entry(el, JSWorkerMessageHandler, link);
+        /* ignored by poll() if negative */
+        pfd->fd = -1;
+        if (!JS_IsNull(port->on_message_func))
+            pfd->fd = port->recv_pipe->waker.read_fd;
+        pfd->events = POLLIN;
+        pfd->revents = 0;
+        pfd++;
+    }
+
+    ret = poll(ts->poll_tab, n, timeout);
+    if (ret <= 0)
+        return;
+    for(i = 0; i < n; i++) {
+        pfd = &ts->poll_tab[i];
+        if (pfd->revents == 0)
+            continue;
+        events = 0;
+        if (pfd->revents & (POLLIN | POLLHUP | POLLERR | POLLNVAL))
+            events |= OS_EV_READ;
+        if (pfd->revents & (POLLOUT | POLLHUP | POLLERR | POLLNVAL))
+            events |= OS_EV_WRITE;
+        if (i < nb_rh) {
+            if (!(pfd->events & POLLIN))
+                events &= ~OS_EV_READ;
+            if (!(pfd->events & POLLOUT))
+                events &= ~OS_EV_WRITE;
+            os_add_ready_event(ts, pfd->fd, events, FALSE);
+        } else {
+            os_add_ready_event(ts, pfd->fd, events & OS_EV_READ, TRUE);
+        }
+    }
+}
+
+#ifdef USE_EPOLL
+#define OS_EPOLL_PORT ((uint64_t)1 << 32)
+
+static void os_wait_epoll(JSRuntime *rt, JSThreadState *ts, int timeout)
+{
+    struct epoll_event evs[OS_READY_MAX], *ev;
+    struct list_head *el;
+    int n, i, events;
+
+    /* the message pipes are registered when first waited for */
+    list_for_each(el, &ts->port_list) {
+        JSWorkerMessageHandler *port = list_entry(el, JSWorkerMessageHandler, link);
+        if (!port->epoll_registered && !JS_IsNull(port->on_message_func)) {
+            struct epoll_event pev;
+            int fd = port->recv_pipe->waker.read_fd;
+            memset(&pev, 0, sizeof(pev));
+            pev.events = EPOLLIN;
+            pev.data.u64 = OS_EPOLL_PORT | fd;
+            if (epoll_ctl(ts->epoll_fd, EPOLL_CTL_ADD, fd, &pev) == 0 ||
+                errno == EEXIST) {
+                port->epoll_registered = TRUE;
+            } else {
+                /* should not happen with a pipe */
+                os_wait_poll(rt, ts, timeout);
+                return;
+            }
+        }
+    }
+
+    n = epoll_wait(ts->epoll_fd, evs, OS_READY_MAX, timeout);
+    for(i = 0; i < n; i++) {
+        ev = &evs[i];
+        events = 0;
+        if (ev->events & (EPOLLIN | EPOLLHUP | EPOLLERR))
+            events |= OS_EV_READ;
+        if (ev->events & (EPOLLOUT | EPOLLHUP | EPOLLERR))
+            events |= OS_EV_WRITE;
+        if (ev->data.u64 & OS_EPOLL_PORT) {
+            os_add_ready_event(ts, (uint32_t)ev->data.u64,
+                               events & OS_EV_READ, TRUE);
+        } else {
+            os_add_ready_event(ts, ev->data.u64, events, FALSE);
+        }
+    }
+}
+#endif /* USE_EPOLL */
+
+/* dispatch the first pending ready event. The handlers are looked up
+   again because they may have been modified by the previous ones. */
+static void os_dispatch_ready(JSContext *ctx, JSThreadState *ts)
+{
+    JSRuntime *rt = JS_GetRuntime(ctx);
+    JSOSReadyEvent *ev;
+    JSOSRWHandler *rh;
+    struct list_head *el;
+
+    ev = &ts->ready_tab[ts->ready_pos];
+    if (ev->is_port) {
+        ts->ready_pos++;
+        list_for_each(el, &ts->port_list) {
+            JSWorkerMessageHandler *port = list_entry(el, JSWorkerMessageHandler, link);
+            if (!JS_IsNull(port->on_message_func) &&
+                port->recv_pipe->waker.read_fd == ev->fd) {
+                /* the next received messages are handled on the next
+                   calls without waiting */
+                if (handle_posted_message(rt, ctx, port) == 2)
+                    ts->ready_pos--;
+                break;
+            }
+        }
+    } else {
+        rh = find_rh(ts, ev->fd);
+        if (rh && (ev->events & OS_EV_READ) && !JS_IsNull(rh->rw_func[0])) {
+            /* the write handler is called on the next call */
+            ev->events &= ~OS_EV_READ;
+            if (!(ev->events & OS_EV_WRITE))
+                ts->ready_pos++;
+            call_handler(ctx, rh->rw_func[0]);
+        } else {
+            ts->ready_pos++;
+            if (rh && (ev->events & OS_EV_WRITE) && !JS_IsNull(rh->rw_func[1]))
+                call_handler(ctx, rh->rw_func[1]);
+        }
+    }
+}
+
 static int js_os_poll(JSContext *ctx)
 {
     JSRuntime *rt = JS_GetRuntime(ctx);
     JSThreadState *ts = JS_GetRuntimeOpaque(rt);
-    int ret, fd_max, min_delay;
-    int64_t cur_time, delay;
-    fd_set rfds, wfds;
-    JSOSRWHandler *rh;
+    int min_delay;
     struct list_head *el;
-    struct timeval tv, *tvp;
 
     /* only check signals in the main thread */
-    if (!ts->recv_pipe &&
+    if (is_main_thread(rt) &&
         unlikely(os_pending_signals != 0)) {
         JSOSSignalHandler *sh;
         uint64_t mask;
@@ -2535,87 +3251,29 @@ static int js_os_poll(JSContext *ctx)
         }
     }
 
-    if (list_empty(&ts->os_rw_handlers) && list_empty(&ts->os_timers) &&
+    if (list_empty(&ts->os_rw_handlers) && !has_timers(ts) &&
         list_empty(&ts->port_list))
         return -1; /* no more events */
 
-    if (!list_empty(&ts->os_timers)) {
-        cur_time = get_time_ms();
-        min_delay = 10000;
-        list_for_each(el, &ts->os_timers) {
-            JSOSTimer *th = list_entry(el, JSOSTimer, link);
-            delay = th->timeout - cur_time;
-            if (delay <= 0) {
-                JSValue func;
-                /* the timer expired */
-                func = th->func;
-                th->func = JS_UNDEFINED;
-                free_timer(rt, th);
-                call_handler(ctx, func);
-                JS_FreeValue(ctx, func);
-                return 0;
-            } else if (delay < min_delay) {
-                min_delay = delay;
-            }
-        }
-        tv.tv_sec = min_delay / 1000;
-        tv.tv_usec = (min_delay % 1000) * 1000;
-        tvp = &tv;
-    } else {
-        tvp = NULL;
-    }
-
-    FD_ZERO(&rfds);
-    FD_ZERO(&wfds);
-    fd_max = -1;
-    list_for_each(el, &ts->os_rw_handlers) {
-        rh = list_entry(el, JSOSRWHandler, link);
-        fd_max = max_int(fd_max, rh->fd);
-        if (!JS_IsNull(rh->rw_func[0]))
-            FD_SET(rh->fd, &rfds);
-        if (!JS_IsNull(rh->rw_func[1]))
-            FD_SET(rh->fd, &wfds);
-    }
-
-    list_for_each(el, &ts->port_list) {
-        JSWorkerMessageHandler *port = list_entry(el, JSWorkerMessageHandler, link);
-        if (!JS_IsNull(port->on_message_func)) {
-            JSWorkerMessagePipe *ps = port->recv_pipe;
-            fd_max = max_int(fd_max, ps->waker.read_fd);
-            FD_SET(ps->waker.read_fd, &rfds);
-        }
-    }
-
-    ret = select(fd_max + 1, &rfds, &wfds, NULL, tvp);
-    if (ret > 0) {
-        list_for_each(el, &ts->os_rw_handlers) {
-            rh = list_entry(el, JSOSRWHandler, link);
-            if (!JS_IsNull(rh->rw_func[0]) &&
-                FD_ISSET(rh->fd, &rfds)) {
-                call_handler(ctx, rh->rw_func[0]);
-                /* must stop because the list may have been modified */
-                goto done;
-            }
-            if (!JS_IsNull(rh->rw_func[1]) &&
-                FD_ISSET(rh->fd, &wfds)) {
-                call_handler(ctx, rh->rw_func[1]);
-                /* must stop because the list may have been modified */
-                goto done;
-            }
-        }
+    if (call_expired_timer(ctx, &min_delay))
+        return 0;
 
-        list_for_each(el, &ts->port_list) {
-            JSWorkerMessageHandler *port = list_entry(el, JSWorkerMessageHandler, link);
-            if (!JS_IsNull(port->on_message_func)) {
-                JSWorkerMessagePipe *ps = port->recv_pipe;
-                if (FD_ISSET(ps->waker.read_fd, &rfds)) {
-                    if (handle_posted_message(rt, ctx, port))
-                        goto done;
-                }
-            }
-        }
+    /* the events of the previous wait are dispatched before waiting
+       again */
+    if (ts->ready_pos >= ts->ready_count) {
+        ts->ready_pos = 0;
+        ts->ready_count = 0;
+#ifdef USE_EPOLL
+        /* epoll cannot be used if some fds could not be registered */
+        if (ts->epoll_fd >= 0 && ts->epoll_error_count == 0)
+            os_wait_epoll(rt, ts, min_delay);
+        else
+#endif
+            os_wait_poll(rt, ts, min_delay);
+        if (ts->ready_count == 0)
+            return 0;
     }
- done:
+    os_dispatch_ready(ctx, ts);
     return 0;
 }
 #endif /* !_WIN32 */
@@ -3493,8 +4151,9 @@ static JSWorkerMessagePipe *js_new_message_pipe(void)
         return NULL;
     }
     ps->ref_count = 1;
+    atomic_init(&ps->post_stack, NULL);
+    atomic_init(&ps->signaled, FALSE);
     init_list_head(&ps->msg_queue);
-    pthread_mutex_init(&ps->mutex, NULL);
     return ps;
 }
 
@@ -3504,7 +4163,8 @@ static JSWorkerMessagePipe *js_dup_message_pipe(JSWorkerMessagePipe *ps)
     return ps;
 }
 
-static void js_free_message(JSWorkerMessage *msg)
+/* free the content of the message, which is left empty */
+static void js_free_message_data(JSWorkerMessage *msg)
 {
     size_t i;
     /* free the SAB */
@@ -3512,7 +4172,23 @@ static void js_free_message(JSWorkerMessage *msg)
         js_sab_free(NULL, msg->sab_tab[i]);
     }
     free(msg->sab_tab);
+    msg->sab_tab = NULL;
+    msg->sab_tab_len = 0;
+    /* free the transferred data which was not received */
+    for(i = 0; i < msg->transfer_len; i++) {
+        free(msg->transfer_data[i]);
+    }
+    free(msg->transfer_data);
+    msg->transfer_data = NULL;
+    msg->transfer_len = 0;
     free(msg->data);
+    msg->data = NULL;
+    msg->data_len = 0;
+}
+
+static void js_free_message(JSWorkerMessage *msg)
+{
+    js_free_message_data(msg);
     free(msg);
 }
 
@@ -3528,23 +4204,39 @@ static void js_free_message_pipe(JSWorkerMessagePipe *ps)
     ref_count = atomic_add_int(&ps->ref_count, -1);
     assert(ref_count >= 0);
     if (ref_count == 0) {
+        js_receive_posted_messages(ps);
         list_for_each_safe(el, el1, &ps->msg_queue) {
             msg = list_entry(el, JSWorkerMessage, link);
             js_free_message(msg);
         }
-        pthread_mutex_destroy(&ps->mutex);
         js_waker_close(&ps->waker);
         free(ps);
     }
 }
 
+/* remove the port from the list of the ports waited for by the event
+   loop */
+static void js_port_unlink(JSRuntime *rt, JSWorkerMessageHandler *port)
+{
+    if (!port->link.prev)
+        return;
+#ifdef USE_EPOLL
+    if (port->epoll_registered) {
+        JSThreadState *ts = JS_GetRuntimeOpaque(rt);
+        epoll_ctl(ts->epoll_fd, EPOLL_CTL_DEL,
+                  port->recv_pipe->waker.read_fd, NULL);
+        port->epoll_registered = FALSE;
+    }
+#endif
+    list_del(&port->link);
+}
+
 static void js_free_port(JSRuntime *rt, JSWorkerMessageHandler *port)
 {
     if (port) {
+        js_port_unlink(rt, port);
         js_free_message_pipe(port->recv_pipe);
         JS_FreeValueRT(rt, port->on_message_func);
-        if (port->link.prev)
-            list_del(&port->link);
         js_free_rt(rt, port);
     }
 }
@@ -3744,72 +4436,114 @@ static JSValue js_worker_ctor(JSContext *ctx, JSValueConst new_target,
     return JS_EXCEPTION;
 }
 
-static JSValue js_worker_postMessage(JSContext *ctx, JSValueConst this_val,
-                                     int argc, JSValueConst *argv)
+/* serialize 'obj' in a new message. 'transfer' is undefined or an
+   array of ArrayBuffers whose data is moved to the message. Return
+   NULL if exception. */
+static JSWorkerMessage *js_new_message(JSContext *ctx, JSValueConst obj,
+                                       JSValueConst transfer)
 {
-    JSWorkerData *worker = JS_GetOpaque2(ctx, this_val, js_worker_class_id);
-    JSWorkerMessagePipe *ps;
     size_t data_len, sab_tab_len, i;
     uint8_t *data;
     JSWorkerMessage *msg;
     uint8_t **sab_tab;
+    JSValue *transfer_tab;
+    uint32_t transfer_len;
 
-    if (!worker)
-        return JS_EXCEPTION;
+    msg = malloc(sizeof(*msg));
+    if (!msg) {
+        JS_ThrowOutOfMemory(ctx);
+        return NULL;
+    }
+    memset(msg, 0, sizeof(*msg));
+    msg->task_id = -1;
+
+    transfer_tab = NULL;
+    transfer_len = 0;
+    if (!JS_IsUndefined(transfer)) {
+        JSValue len_val;
+        int ret;
+        len_val = JS_GetPropertyStr(ctx, transfer, "length");
+        if (JS_IsException(len_val))
+            goto fail;
+        ret = JS_ToUint32(ctx, &transfer_len, len_val);
+        JS_FreeValue(ctx, len_val);
+        if (ret)
+            goto fail;
+        if (transfer_len > 0) {
+            transfer_tab = js_mallocz(ctx, sizeof(transfer_tab[0]) * transfer_len);
+            if (!transfer_tab)
+                goto fail;
+            msg->transfer_data = malloc(sizeof(msg->transfer_data[0]) * transfer_len);
+            if (!msg->transfer_data) {
+                JS_ThrowOutOfMemory(ctx);
+                goto fail;
+            }
+            for(i = 0; i < transfer_len; i++) {
+                transfer_tab[i] = JS_GetPropertyUint32(ctx, transfer, i);
+                if (JS_IsException(transfer_tab[i]))
+                    goto fail;
+            }
+        }
+    }
 
-    data = JS_WriteObject2(ctx, &data_len, argv[0],
+    /* the data is directly allocated with malloc() because the
+       allocator of the receiving runtime may be different */
+    data = JS_WriteObject3(ctx, &data_len, obj,
                            JS_WRITE_OBJ_SAB | JS_WRITE_OBJ_REFERENCE,
-                           &sab_tab, &sab_tab_len);
+                           &sab_tab, &sab_tab_len,
+                           (JSValueConst *)transfer_tab, transfer_len,
+                           msg->transfer_data);
     if (!data)
-        return JS_EXCEPTION;
-
-    msg = malloc(sizeof(*msg));
-    if (!msg)
-        goto fail;
-    msg->data = NULL;
-    msg->sab_tab = NULL;
-
-    /* must reallocate because the allocator may be different */
-    msg->data = malloc(data_len);
-    if (!msg->data)
         goto fail;
-    memcpy(msg->data, data, data_len);
+    msg->data = data;
     msg->data_len = data_len;
+    msg->transfer_len = transfer_len;
 
     if (sab_tab_len > 0) {
         msg->sab_tab = malloc(sizeof(msg->sab_tab[0]) * sab_tab_len);
-        if (!msg->sab_tab)
+        if (!msg->sab_tab) {
+            js_free(ctx, sab_tab);
+            JS_ThrowOutOfMemory(ctx);
             goto fail;
+        }
         memcpy(msg->sab_tab, sab_tab, sizeof(msg->sab_tab[0]) * sab_tab_len);
     }
     msg->sab_tab_len = sab_tab_len;
-
-    js_free(ctx, data);
     js_free(ctx, sab_tab);
 
     /* increment the SAB reference counts */
     for(i = 0; i < msg->sab_tab_len; i++) {
         js_sab_dup(NULL, msg->sab_tab[i]);
     }
-
-    ps = worker->send_pipe;
-    pthread_mutex_lock(&ps->mutex);
-    /* indicate that data is present */
-    if (list_empty(&ps->msg_queue))
-        js_waker_signal(&ps->waker);
-    list_add_tail(&msg->link, &ps->msg_queue);
-    pthread_mutex_unlock(&ps->mutex);
-    return JS_UNDEFINED;
+    for(i = 0; i < transfer_len; i++)
+        JS_FreeValue(ctx, transfer_tab[i]);
+    js_free(ctx, transfer_tab);
+    return msg;
  fail:
-    if (msg) {
-        free(msg->data);
-        free(msg->sab_tab);
-        free(msg);
-    }
-    js_free(ctx, data);
-    js_free(ctx, sab_tab);
-    return JS_EXCEPTION;
+    if (transfer_tab) {
+        for(i = 0; i < transfer_len; i++)
+            JS_FreeValue(ctx, transfer_tab[i]);
+        js_free(ctx, transfer_tab);
+    }
+    /* the SAB references are not taken yet */
+    msg->sab_tab_len = 0;
+    js_free_message(msg);
+    return NULL;
+}
+
+static JSValue js_worker_postMessage(JSContext *ctx, JSValueConst this_val,
+                                     int argc, JSValueConst *argv)
+{
+    JSWorkerData *worker = JS_GetOpaque2(ctx, this_val, js_worker_class_id);
+    JSWorkerMessage *msg;
 
+    if (!worker)
+        return JS_EXCEPTION;
+    msg = js_new_message(ctx, argv[0], argc >= 2 ? argv[1] : JS_UNDEFINED);
+    if (!msg)
+        return JS_EXCEPTION;
+    js_post_message(worker->send_pipe, msg);
+    return JS_UNDEFINED;
 }
 
 static JSValue js_worker_set_onmessage(JSContext *ctx, JSValueConst this_val,
@@ -3838,6 +4572,7 @@ static JSValue js_worker_set_onmessage(JSContext *ctx, JSValueConst this_val,
                 return JS_EXCEPTION;
             port->recv_pipe = js_dup_message_pipe(worker->recv_pipe);
             port->on_message_func = JS_NULL;
+            port->keep_alive = JS_UNDEFINED;
             list_add_tail(&port->link, &ts->port_list);
             worker->msg_handler = port;
         }
@@ -3866,52 +4601,874 @@ static const JSCFunctionListEntry js_worker_proto_funcs[] = {
     JS_CGETSET_DEF("onmessage", js_worker_get_onmessage, js_worker_set_onmessage ),
 };
 
-#endif /* USE_WORKER */
+/* WorkerPool: a fixed set of threads, each with its own runtime and
+   an instance of the same module, running the exported functions of
+   the module. Each thread has a task queue. An idle thread takes the
+   oldest task of its queue or steals the newest task of another
+   queue. */
 
-void js_std_set_worker_new_context_func(JSContext *(*func)(JSRuntime *rt))
+typedef struct {
+    pthread_mutex_t mutex;
+    struct list_head task_list; /* list of JSWorkerMessage.link */
+} JSWorkerPoolQueue;
+
+/* shared by the WorkerPool object and the pool threads */
+typedef struct {
+    int ref_count;
+    char *filename; /* module filename */
+    char *basename; /* module base name */
+    int strip_flags;
+    /* the results are posted to the thread of the WorkerPool object */
+    JSWorkerMessagePipe *result_pipe;
+    pthread_mutex_t mutex;
+    pthread_cond_t cond; /* signaled when a task is queued or the pool
+                            is terminated */
+    int task_count; /* number of queued tasks (protected by 'mutex') */
+    BOOL terminated; /* protected by 'mutex' */
+    int nb_threads;
+    JSWorkerPoolQueue queues[0];
+} JSWorkerPoolState;
+
+typedef struct {
+    JSWorkerPoolState *state;
+    JSWorkerMessageHandler *msg_handler; /* receives the results */
+    /* resolving functions of the pending tasks, indexed by task id.
+       JS_UNDEFINED if the entry is free. */
+    JSValue *pending_tab;
+    int pending_size;
+    int pending_count;
+    int *free_ids; /* stack of the free entries of pending_tab */
+    int free_ids_count;
+    int next_queue;
+} JSWorkerPool;
+
+typedef struct {
+    JSWorkerPoolState *state;
+    int idx;
+} WorkerPoolFuncArgs;
+
+static JSClassID js_worker_pool_class_id;
+
+static void js_worker_pool_state_free(JSWorkerPoolState *st)
 {
-#ifdef USE_WORKER
-    js_worker_new_context_func = func;
-#endif
+    struct list_head *el, *el1;
+    int i;
+
+    if (atomic_add_int(&st->ref_count, -1) != 0)
+        return;
+    for(i = 0; i < st->nb_threads; i++) {
+        JSWorkerPoolQueue *q = &st->queues[i];
+        list_for_each_safe(el, el1, &q->task_list) {
+            js_free_message(list_entry(el, JSWorkerMessage, link));
+        }
+        pthread_mutex_destroy(&q->mutex);
+    }
+    js_free_message_pipe(st->result_pipe);
+    pthread_cond_destroy(&st->cond);
+    pthread_mutex_destroy(&st->mutex);
+    free(st->filename);
+    free(st->basename);
+    free(st);
 }
 
-#if defined(_WIN32)
-#define OS_PLATFORM "win32"
-#elif defined(__APPLE__)
-#define OS_PLATFORM "darwin"
-#elif defined(EMSCRIPTEN)
-#define OS_PLATFORM "js"
-#else
-#define OS_PLATFORM "linux"
-#endif
+/* no new task is accepted. The queued tasks are still run. */
+static void js_worker_pool_state_terminate(JSWorkerPoolState *st)
+{
+    pthread_mutex_lock(&st->mutex);
+    st->terminated = TRUE;
+    pthread_cond_broadcast(&st->cond);
+    pthread_mutex_unlock(&st->mutex);
+}
 
-#define OS_FLAG(x) JS_PROP_INT32_DEF(#x, x, JS_PROP_CONFIGURABLE )
+/* return NULL if the pool is terminated and there are no more tasks */
+static JSWorkerMessage *worker_pool_get_task(JSWorkerPoolState *st, int idx)
+{
+    JSWorkerPoolQueue *q;
+    JSWorkerMessage *msg;
+    struct list_head *el;
+    int i;
 
-static const JSCFunctionListEntry js_os_funcs[] = {
-    JS_CFUNC_DEF("open", 2, js_os_open ),
-    OS_FLAG(O_RDONLY),
-    OS_FLAG(O_WRONLY),
-    OS_FLAG(O_RDWR),
-    OS_FLAG(O_APPEND),
-    OS_FLAG(O_CREAT),
-    OS_FLAG(O_EXCL),
-    OS_FLAG(O_TRUNC),
-#if defined(_WIN32)
-    OS_FLAG(O_BINARY),
-    OS_FLAG(O_TEXT),
-#endif
-    JS_CFUNC_DEF("close", 1, js_os_close ),
-    JS_CFUNC_DEF("seek", 3, js_os_seek ),
-    JS_CFUNC_MAGIC_DEF("read", 4, js_os_read_write, 0 ),
-    JS_CFUNC_MAGIC_DEF("write", 4, js_os_read_write, 1 ),
-    JS_CFUNC_DEF("isatty", 1, js_os_isatty ),
-    JS_CFUNC_DEF("ttyGetWinSize", 1, js_os_ttyGetWinSize ),
-    JS_CFUNC_DEF("ttySetRaw", 1, js_os_ttySetRaw ),
-    JS_CFUNC_DEF("remove", 1, js_os_remove ),
-    JS_CFUNC_DEF("rename", 2, js_os_rename ),
-    JS_CFUNC_MAGIC_DEF("setReadHandler", 2, js_os_setReadHandler, 0 ),
-    JS_CFUNC_MAGIC_DEF("setWriteHandler", 2, js_os_setReadHandler, 1 ),
-    JS_CFUNC_DEF("signal", 2, js_os_signal ),
+    for(;;) {
+        for(i = 0; i < st->nb_threads; i++) {
+            q = &st->queues[(idx + i) % st->nb_threads];
+            pthread_mutex_lock(&q->mutex);
+            if (!list_empty(&q->task_list)) {
+                if (i == 0)
+                    el = q->task_list.next;
+                else
+                    el = q->task_list.prev; /* steal */
+                msg = list_entry(el, JSWorkerMessage, link);
+                list_del(&msg->link);
+                pthread_mutex_unlock(&q->mutex);
+
+                pthread_mutex_lock(&st->mutex);
+                st->task_count--;
+                pthread_mutex_unlock(&st->mutex);
+                return msg;
+            }
+            pthread_mutex_unlock(&q->mutex);
+        }
+
+        pthread_mutex_lock(&st->mutex);
+        while (st->task_count == 0 && !st->terminated)
+            pthread_cond_wait(&st->cond, &st->mutex);
+        if (st->task_count == 0) {
+            pthread_mutex_unlock(&st->mutex);
+            return NULL;
+        }
+        pthread_mutex_unlock(&st->mutex);
+    }
+}
+
+static int worker_pool_get_int32(JSContext *ctx, int *pres,
+                                 JSValueConst obj, uint32_t idx)
+{
+    JSValue val;
+    int ret;
+    val = JS_GetPropertyUint32(ctx, obj, idx);
+    if (JS_IsException(val))
+        return -1;
+    ret = JS_ToInt32(ctx, pres, val);
+    JS_FreeValue(ctx, val);
+    return ret;
+}
+
+/* return a plain object with the 'name', 'message' and 'stack'
+   properties of the error 'err' */
+static JSValue worker_pool_error_to_object(JSContext *ctx, JSValueConst err)
+{
+    static const char * const names[] = { "name", "message", "stack" };
+    JSValue obj, val;
+    int i;
+
+    obj = JS_NewObject(ctx);
+    if (JS_IsException(obj))
+        return obj;
+    for(i = 0; i < countof(names); i++) {
+        val = JS_GetPropertyStr(ctx, err, names[i]);
+        if (JS_IsException(val)) {
+            JS_FreeValue(ctx, obj);
+            return JS_EXCEPTION;
+        }
+        if (JS_IsString(val))
+            JS_SetPropertyStr(ctx, obj, names[i], val);
+        else
+            JS_FreeValue(ctx, val);
+    }
+    return obj;
+}
+
+/* the result message is [id, status, value]. status = 0 if 'value' is
+   the returned value, 1 if it is the thrown value and 2 if it is the
+   thrown error converted with worker_pool_error_to_object(). */
+static JSWorkerMessage *worker_pool_new_result(JSContext *ctx, int id,
+                                               int status, JSValueConst val)
+{
+    JSWorkerMessage *msg;
+    JSValue res, err;
+
+    if (status == 1 && JS_IsError(ctx, val)) {
+        val = worker_pool_error_to_object(ctx, val);
+        if (JS_IsException(val))
+            return NULL;
+        msg = worker_pool_new_result(ctx, id, 2, val);
+        JS_FreeValue(ctx, (JSValue)val);
+        return msg;
+    }
+    res = JS_NewArray(ctx);
+    if (JS_IsException(res))
+        return NULL;
+    JS_SetPropertyUint32(ctx, res, 0, JS_NewInt32(ctx, id));
+    JS_SetPropertyUint32(ctx, res, 1, JS_NewInt32(ctx, status));
+    JS_SetPropertyUint32(ctx, res, 2, JS_DupValue(ctx, val));
+    msg = js_new_message(ctx, res, JS_UNDEFINED);
+    JS_FreeValue(ctx, res);
+    if (msg)
+        msg->task_id = id;
+    if (!msg && status != 2) {
+        /* the value cannot be serialized: return the error instead */
+        err = JS_GetException(ctx);
+        msg = worker_pool_new_result(ctx, id, 1, err);
+        JS_FreeValue(ctx, err);
+    }
+    return msg;
+}
+
+/* return the result [id, 1, exception] of a task whose result could
+   not be read */
+static JSValue worker_pool_error_result(JSContext *ctx, int id)
+{
+    JSValue res, err;
+
+    err = JS_GetException(ctx);
+    res = JS_NewArray(ctx);
+    if (JS_IsException(res)) {
+        JS_FreeValue(ctx, err);
+        return JS_EXCEPTION;
+    }
+    JS_SetPropertyUint32(ctx, res, 0, JS_NewInt32(ctx, id));
+    JS_SetPropertyUint32(ctx, res, 1, JS_NewInt32(ctx, 1));
+    JS_SetPropertyUint32(ctx, res, 2, err);
+    return res;
+}
+
+static void worker_pool_run_task(JSContext *ctx, JSWorkerPoolState *st,
+                                 JSValueConst ns, JSWorkerMessage *msg)
+{
+    JSValue task, func_name, func, args, ret, *argv;
+    JSWorkerMessage *res_msg;
+    uint32_t argc, i;
+    int id, status;
+    const char *str;
+    JSAtom atom;
+
+    id = msg->task_id;
+    task = JS_ReadObject2(ctx, msg->data, msg->data_len,
+                          JS_READ_OBJ_SAB | JS_READ_OBJ_REFERENCE,
+                          msg->transfer_data, msg->transfer_len);
+    /* the empty message is posted if the result cannot be sent */
+    js_free_message_data(msg);
+    argv = NULL;
+    if (JS_IsException(task)) {
+        func_name = JS_UNDEFINED;
+        args = JS_UNDEFINED;
+        ret = JS_EXCEPTION;
+        goto done;
+    }
+    /* the task is [func_name, args] */
+    func_name = JS_GetPropertyUint32(ctx, task, 0);
+    args = JS_GetPropertyUint32(ctx, task, 1);
+    JS_FreeValue(ctx, task);
+
+    if (JS_IsException(ns)) {
+        /* the module could not be loaded: the load error is pending */
+        ret = JS_EXCEPTION;
+        goto done;
+    }
+    atom = JS_ValueToAtom(ctx, func_name);
+    if (atom == JS_ATOM_NULL) {
+        ret = JS_EXCEPTION;
+        goto done;
+    }
+    func = JS_GetProperty(ctx, ns, atom);
+    JS_FreeAtom(ctx, atom);
+    if (JS_IsException(func)) {
+        ret = JS_EXCEPTION;
+        goto done;
+    }
+    if (!JS_IsFunction(ctx, func)) {
+        JS_FreeValue(ctx, func);
+        str = JS_ToCString(ctx, func_name);
+        JS_ThrowTypeError(ctx, "'%s' is not an exported function",
+                          str ? str : "?");
+        JS_FreeCString(ctx, str);
+        ret = JS_EXCEPTION;
+        goto done;
+    }
+    ret = JS_GetPropertyStr(ctx, args, "length");
+    if (JS_IsException(ret))
+        goto call_fail;
+    if (JS_ToUint32(ctx, &argc, ret)) {
+        JS_FreeValue(ctx, ret);
+        goto call_fail;
+    }
+    JS_FreeValue(ctx, ret);
+    if (argc > 65535) {
+        JS_ThrowRangeError(ctx, "too many arguments");
+        goto call_fail;
+    }
+    argv = js_mallocz(ctx, sizeof(argv[0]) * max_int(argc, 1));
+    if (!argv)
+        goto call_fail;
+    for(i = 0; i < argc; i++)
+        argv[i] = JS_GetPropertyUint32(ctx, args, i);
+    ret = JS_Call(ctx, func, JS_UNDEFINED, argc, (JSValueConst *)argv);
+    for(i = 0; i < argc; i++)
+        JS_FreeValue(ctx, argv[i]);
+    JS_FreeValue(ctx, func);
+    /* wait until the returned promise is settled */
+    ret = js_std_await(ctx, ret);
+    goto done;
+ call_fail:
+    JS_FreeValue(ctx, func);
+    ret = JS_EXCEPTION;
+ done:
+    js_free(ctx, argv);
+    JS_FreeValue(ctx, func_name);
+    JS_FreeValue(ctx, args);
+
+    if (JS_IsException(ret)) {
+        ret = JS_GetException(ctx);
+        status = 1;
+    } else {
+        status = 0;
+    }
+    res_msg = worker_pool_new_result(ctx, id, status, ret);
+    JS_FreeValue(ctx, ret);
+    if (res_msg) {
+        free(msg);
+    } else {
+        /* the task is rejected by the WorkerPool thread */
+        js_std_dump_error(ctx);
+        res_msg = msg;
+    }
+    js_post_message(st->result_pipe, res_msg);
+}
+
+static void *worker_pool_func(void *opaque)
+{
+    WorkerPoolFuncArgs *args = opaque;
+    JSWorkerPoolState *st = args->state;
+    int idx = args->idx;
+    JSRuntime *rt;
+    JSThreadState *ts;
+    JSContext *ctx;
+    JSValue ns, load_error;
+    JSWorkerMessage *msg;
+
+    free(args);
+    rt = JS_NewRuntime();
+    if (rt == NULL) {
+        fprintf(stderr, "JS_NewRuntime failure");
+        exit(1);
+    }
+    JS_SetStripInfo(rt, st->strip_flags);
+    js_std_init_handlers(rt);
+
+    JS_SetModuleLoaderFunc2(rt, NULL, js_module_loader, js_module_check_attributes, NULL);
+
+    ts = JS_GetRuntimeOpaque(rt);
+    ts->is_pool_thread = TRUE;
+
+    ctx = js_worker_new_context_func(rt);
+    if (ctx == NULL) {
+        fprintf(stderr, "JS_NewContext failure");
+        exit(1);
+    }
+
+    JS_SetCanBlock(rt, TRUE);
+
+    js_std_add_helpers(ctx, -1, NULL);
+
+    /* the module is loaded once for all the tasks */
+    ns = js_std_await(ctx, JS_LoadModule(ctx, st->basename, st->filename));
+    load_error = JS_UNDEFINED;
+    if (JS_IsException(ns))
+        load_error = JS_GetException(ctx);
+
+    while ((msg = worker_pool_get_task(st, idx)) != NULL) {
+        if (!JS_IsUndefined(load_error))
+            JS_Throw(ctx, JS_DupValue(ctx, load_error));
+        worker_pool_run_task(ctx, st, ns, msg);
+    }
+
+    JS_FreeValue(ctx, ns);
+    JS_FreeValue(ctx, load_error);
+    js_std_loop(ctx);
+
+    JS_FreeContext(ctx);
+    js_std_free_handlers(rt);
+    JS_FreeRuntime(rt);
+    js_worker_pool_state_free(st);
+    return NULL;
+}
+
+static void js_worker_pool_finalizer(JSRuntime *rt, JSValue val)
+{
+    JSWorkerPool *pool = JS_GetOpaque(val, js_worker_pool_class_id);
+    int i;
+
+    if (pool) {
+        js_worker_pool_state_terminate(pool->state);
+        js_worker_pool_state_free(pool->state);
+        js_free_port(rt, pool->msg_handler);
+        for(i = 0; i < 2 * pool->pending_size; i++)
+            JS_FreeValueRT(rt, pool->pending_tab[i]);
+        js_free_rt(rt, pool->pending_tab);
+        js_free_rt(rt, pool->free_ids);
+        js_free_rt(rt, pool);
+    }
+}
+
+static void js_worker_pool_mark(JSRuntime *rt, JSValueConst val,
+                                JS_MarkFunc *mark_func)
+{
+    JSWorkerPool *pool = JS_GetOpaque(val, js_worker_pool_class_id);
+    int i;
+
+    if (pool) {
+        if (pool->msg_handler)
+            JS_MarkValue(rt, pool->msg_handler->on_message_func, mark_func);
+        for(i = 0; i < 2 * pool->pending_size; i++)
+            JS_MarkValue(rt, pool->pending_tab[i], mark_func);
+    }
+}
+
+static JSClassDef js_worker_pool_class = {
+    "WorkerPool",
+    .finalizer = js_worker_pool_finalizer,
+    .gc_mark = js_worker_pool_mark,
+};
+
+/* rebuild an error from the object made by
+   worker_pool_error_to_object(). The native errors get their
+   prototype in this context. */
+static JSValue worker_pool_object_to_error(JSContext *ctx, JSValueConst obj)
+{
+    JSValue err, prop;
+    const char *name;
+
+    err = JS_UNDEFINED;
+    prop = JS_GetPropertyStr(ctx, obj, "name");
+    if (JS_IsException(prop))
+        return prop;
+    if (JS_IsString(prop)) {
+        name = JS_ToCString(ctx, prop);
+        if (!name) {
+            JS_FreeValue(ctx, prop);
+            return JS_EXCEPTION;
+        }
+        err = JS_NewNativeError(ctx, name);
+        JS_FreeCString(ctx, name);
+        if (JS_IsException(err)) {
+            JS_FreeValue(ctx, prop);
+            return err;
+        }
+    }
+    if (JS_IsUndefined(err)) {
+        err = JS_NewError(ctx);
+        if (JS_IsException(err)) {
+            JS_FreeValue(ctx, prop);
+            return err;
+        }
+        if (JS_IsString(prop)) {
+            JS_DefinePropertyValueStr(ctx, err, "name", prop,
+                                      JS_PROP_WRITABLE | JS_PROP_CONFIGURABLE);
+            prop = JS_UNDEFINED;
+        }
+    }
+    JS_FreeValue(ctx, prop);
+    prop = JS_GetPropertyStr(ctx, obj, "message");
+    if (JS_IsString(prop))
+        JS_DefinePropertyValueStr(ctx, err, "message", prop,
+                                  JS_PROP_WRITABLE | JS_PROP_CONFIGURABLE);
+    else
+        JS_FreeValue(ctx, prop);
+    prop = JS_GetPropertyStr(ctx, obj, "stack");
+    if (JS_IsString(prop))
+        JS_DefinePropertyValueStr(ctx, err, "stack", prop,
+                                  JS_PROP_WRITABLE | JS_PROP_CONFIGURABLE);
+    else
+        JS_FreeValue(ctx, prop);
+    return err;
+}
+
+/* called in the thread of the WorkerPool object with the result of a
+   task */
+static JSValue js_worker_pool_on_result(JSContext *ctx, JSValueConst this_val,
+                                        int argc, JSValueConst *argv,
+                                        int magic, JSValue *func_data)
+{
+    JSRuntime *rt = JS_GetRuntime(ctx);
+    JSWorkerPool *pool = JS_GetOpaque(func_data[0], js_worker_pool_class_id);
+    JSValue data, val, ret, self, *resolving_funcs;
+    int id, status;
+
+    data = JS_GetPropertyStr(ctx, argv[0], "data");
+    if (JS_IsException(data))
+        return JS_EXCEPTION;
+    if (worker_pool_get_int32(ctx, &id, data, 0)) {
+        JS_FreeValue(ctx, data);
+        return JS_EXCEPTION;
+    }
+    if (id < 0 || id >= pool->pending_size ||
+        JS_IsUndefined(pool->pending_tab[2 * id])) {
+        JS_FreeValue(ctx, data);
+        return JS_ThrowInternalError(ctx, "invalid task id");
+    }
+
+    /* from now on, the task is always settled: it is rejected with
+       the exception if the result cannot be read */
+    if (worker_pool_get_int32(ctx, &status, data, 1)) {
+        val = JS_EXCEPTION;
+    } else {
+        val = JS_GetPropertyUint32(ctx, data, 2);
+        if (status == 2 && !JS_IsException(val)) {
+            JSValue err;
+            err = worker_pool_object_to_error(ctx, val);
+            JS_FreeValue(ctx, val);
+            val = err;
+        }
+    }
+    JS_FreeValue(ctx, data);
+    if (JS_IsException(val)) {
+        val = JS_GetException(ctx);
+        status = 1;
+    }
+
+    /* free the entry before calling the resolving function */
+    resolving_funcs = &pool->pending_tab[2 * id];
+    ret = JS_Call(ctx, resolving_funcs[status != 0], JS_UNDEFINED,
+                  1, (JSValueConst *)&val);
+    JS_FreeValue(ctx, val);
+    JS_FreeValue(ctx, ret);
+    JS_FreeValue(ctx, resolving_funcs[0]);
+    JS_FreeValue(ctx, resolving_funcs[1]);
+    resolving_funcs[0] = JS_UNDEFINED;
+    resolving_funcs[1] = JS_UNDEFINED;
+    pool->free_ids[pool->free_ids_count++] = id;
+
+    if (--pool->pending_count == 0) {
+        /* the event loop no longer waits for the results */
+        js_port_unlink(rt, pool->msg_handler);
+        self = pool->msg_handler->keep_alive;
+        pool->msg_handler->keep_alive = JS_UNDEFINED;
+        JS_FreeValue(ctx, self);
+    }
+    return JS_UNDEFINED;
+}
+
+static JSValue js_worker_pool_new(JSContext *ctx, JSValueConst new_target,
+                                  const char *basename, const char *filename,
+                                  int nb_threads)
+{
+    JSRuntime *rt = JS_GetRuntime(ctx);
+    JSWorkerPoolState *st;
+    JSWorkerPool *pool;
+    JSWorkerMessageHandler *port;
+    WorkerPoolFuncArgs *args;
+    JSValue obj, proto;
+    pthread_t tid;
+    pthread_attr_t attr;
+    int i, nb_started;
+
+    if (!is_main_thread(rt))
+        return JS_ThrowTypeError(ctx, "cannot create a worker pool inside a worker");
+    if (!JS_IsRegisteredClass(rt, js_worker_pool_class_id))
+        return JS_ThrowTypeError(ctx, "the os module is not initialized");
+    if (nb_threads < 1 || nb_threads > 1024)
+        return JS_ThrowRangeError(ctx, "invalid number of threads");
+
+    if (JS_IsUndefined(new_target)) {
+        proto = JS_GetClassProto(ctx, js_worker_pool_class_id);
+    } else {
+        proto = JS_GetPropertyStr(ctx, new_target, "prototype");
+        if (JS_IsException(proto))
+            return JS_EXCEPTION;
+    }
+    obj = JS_NewObjectProtoClass(ctx, proto, js_worker_pool_class_id);
+    JS_FreeValue(ctx, proto);
+    if (JS_IsException(obj))
+        return JS_EXCEPTION;
+
+    st = malloc(sizeof(*st) + sizeof(st->queues[0]) * nb_threads);
+    if (!st)
+        goto oom_fail;
+    memset(st, 0, sizeof(*st));
+    st->ref_count = 1;
+    st->nb_threads = nb_threads;
+    st->strip_flags = JS_GetStripInfo(rt);
+    pthread_mutex_init(&st->mutex, NULL);
+    pthread_cond_init(&st->cond, NULL);
+    for(i = 0; i < nb_threads; i++) {
+        pthread_mutex_init(&st->queues[i].mutex, NULL);
+        init_list_head(&st->queues[i].task_list);
+    }
+    st->filename = strdup(filename);
+    st->basename = strdup(basename);
+    st->result_pipe = js_new_message_pipe();
+    if (!st->filename || !st->basename || !st->result_pipe) {
+        js_worker_pool_state_free(st);
+        goto oom_fail;
+    }
+
+    pool = js_mallocz(ctx, sizeof(*pool));
+    if (!pool) {
+        js_worker_pool_state_free(st);
+        goto fail;
+    }
+    pool->state = st;
+    JS_SetOpaque(obj, pool);
+
+    port = js_mallocz(ctx, sizeof(*port));
+    if (!port)
+        goto fail;
+    port->recv_pipe = js_dup_message_pipe(st->result_pipe);
+    port->keep_alive = JS_UNDEFINED;
+    port->on_message_func = JS_NewCFunctionData(ctx, js_worker_pool_on_result,
+                                                1, 0, 1, (JSValueConst *)&obj);
+    pool->msg_handler = port;
+    if (JS_IsException(port->on_message_func))
+        goto fail;
+
+    pthread_attr_init(&attr);
+    /* no join at the end */
+    pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+    nb_started = 0;
+    for(i = 0; i < nb_threads; i++) {
+        args = malloc(sizeof(*args));
+        if (!args)
+            break;
+        args->state = st;
+        args->idx = i;
+        atomic_add_int(&st->ref_count, 1);
+        if (pthread_create(&tid, &attr, worker_pool_func, args) != 0) {
+            atomic_add_int(&st->ref_count, -1);
+            free(args);
+            break;
+        }
+        nb_started++;
+    }
+    pthread_attr_destroy(&attr);
+    /* the queues of the missing threads are emptied by the others */
+    if (nb_started == 0) {
+        JS_ThrowTypeError(ctx, "could not create worker pool threads");
+        goto fail;
+    }
+    return obj;
+ oom_fail:
+    JS_ThrowOutOfMemory(ctx);
+ fail:
+    JS_FreeValue(ctx, obj);
+    return JS_EXCEPTION;
+}
+
+static JSValue js_worker_pool_ctor(JSContext *ctx, JSValueConst new_target,
+                                   int argc, JSValueConst *argv)
+{
+    const char *filename = NULL, *basename = NULL;
+    JSAtom basename_atom;
+    JSValue obj;
+    int nb_threads;
+
+    if (argc >= 2 && !JS_IsUndefined(argv[1])) {
+        int64_t v;
+        if (JS_ToInt64(ctx, &v, argv[1]))
+            return JS_EXCEPTION;
+        /* checked in js_worker_pool_new() */
+        nb_threads = max_int64(min_int64(v, INT32_MAX), INT32_MIN);
+    } else {
+#if defined(_SC_NPROCESSORS_ONLN)
+        nb_threads = max_int(sysconf(_SC_NPROCESSORS_ONLN), 1);
+#else
+        nb_threads = 4;
+#endif
+    }
+
+    /* base name, assuming the calling function is a normal JS
+       function */
+    basename_atom = JS_GetScriptOrModuleName(ctx, 1);
+    if (basename_atom == JS_ATOM_NULL) {
+        return JS_ThrowTypeError(ctx, "could not determine calling script or module name");
+    }
+    basename = JS_AtomToCString(ctx, basename_atom);
+    JS_FreeAtom(ctx, basename_atom);
+    if (!basename)
+        return JS_EXCEPTION;
+
+    /* module name */
+    filename = JS_ToCString(ctx, argv[0]);
+    if (!filename) {
+        JS_FreeCString(ctx, basename);
+        return JS_EXCEPTION;
+    }
+    obj = js_worker_pool_new(ctx, new_target, basename, filename, nb_threads);
+    JS_FreeCString(ctx, basename);
+    JS_FreeCString(ctx, filename);
+    return obj;
+}
+
+static JSValue js_worker_pool_run_internal(JSContext *ctx, JSValueConst this_val,
+                                           JSValueConst func_name,
+                                           JSValueConst args,
+                                           JSValueConst transfer)
+{
+    JSRuntime *rt = JS_GetRuntime(ctx);
+    JSThreadState *ts = JS_GetRuntimeOpaque(rt);
+    JSWorkerPool *pool = JS_GetOpaque2(ctx, this_val, js_worker_pool_class_id);
+    JSWorkerPoolState *st;
+    JSWorkerPoolQueue *q;
+    JSWorkerMessage *msg;
+    JSValue task, promise, resolving_funcs[2];
+    BOOL terminated;
+    int id;
+
+    if (!pool)
+        return JS_EXCEPTION;
+    st = pool->state;
+    pthread_mutex_lock(&st->mutex);
+    terminated = st->terminated;
+    pthread_mutex_unlock(&st->mutex);
+    if (terminated)
+        return JS_ThrowTypeError(ctx, "the worker pool is terminated");
+    if (!JS_IsString(func_name))
+        return JS_ThrowTypeError(ctx, "function name expected");
+    /* the arguments are read as an array-like object by the worker */
+    if (!JS_IsUndefined(args) && !JS_IsObject(args))
+        return JS_ThrowTypeError(ctx, "array of arguments expected");
+
+    /* allocate a task id */
+    if (pool->free_ids_count == 0) {
+        JSValue *new_tab;
+        int *new_ids;
+        int new_size, i;
+        new_size = max_int(16, pool->pending_size * 3 / 2);
+        new_tab = js_realloc(ctx, pool->pending_tab,
+                             sizeof(new_tab[0]) * 2 * new_size);
+        if (!new_tab)
+            return JS_EXCEPTION;
+        pool->pending_tab = new_tab;
+        new_ids = js_realloc(ctx, pool->free_ids,
+                             sizeof(new_ids[0]) * new_size);
+        if (!new_ids)
+            return JS_EXCEPTION;
+        pool->free_ids = new_ids;
+        for(i = new_size - 1; i >= pool->pending_size; i--) {
+            new_tab[2 * i] = JS_UNDEFINED;
+            new_tab[2 * i + 1] = JS_UNDEFINED;
+            new_ids[pool->free_ids_count++] = i;
+        }
+        pool->pending_size = new_size;
+    }
+    id = pool->free_ids[pool->free_ids_count - 1];
+
+    task = JS_NewArray(ctx);
+    if (JS_IsException(task))
+        return JS_EXCEPTION;
+    JS_SetPropertyUint32(ctx, task, 0, JS_DupValue(ctx, func_name));
+    if (JS_IsUndefined(args))
+        JS_SetPropertyUint32(ctx, task, 1, JS_NewArray(ctx));
+    else
+        JS_SetPropertyUint32(ctx, task, 1, JS_DupValue(ctx, args));
+    msg = js_new_message(ctx, task, transfer);
+    JS_FreeValue(ctx, task);
+    if (!msg)
+        return JS_EXCEPTION;
+    msg->task_id = id;
+
+    promise = JS_NewPromiseCapability(ctx, resolving_funcs);
+    if (JS_IsException(promise)) {
+        js_free_message(msg);
+        return JS_EXCEPTION;
+    }
+    pool->free_ids_count--;
+    pool->pending_tab[2 * id] = resolving_funcs[0];
+    pool->pending_tab[2 * id + 1] = resolving_funcs[1];
+    if (pool->pending_count++ == 0) {
+        /* the event loop waits for the results */
+        list_add_tail(&pool->msg_handler->link, &ts->port_list);
+        pool->msg_handler->keep_alive = JS_DupValue(ctx, this_val);
+    }
+
+    q = &st->queues[pool->next_queue];
+    pool->next_queue = (pool->next_queue + 1) % st->nb_threads;
+    pthread_mutex_lock(&q->mutex);
+    list_add_tail(&msg->link, &q->task_list);
+    pthread_mutex_unlock(&q->mutex);
+
+    pthread_mutex_lock(&st->mutex);
+    st->task_count++;
+    pthread_cond_signal(&st->cond);
+    pthread_mutex_unlock(&st->mutex);
+    return promise;
+}
+
+static JSValue js_worker_pool_run(JSContext *ctx, JSValueConst this_val,
+                                  int argc, JSValueConst *argv)
+{
+    return js_worker_pool_run_internal(ctx, this_val, argv[0],
+                                       argc >= 2 ? argv[1] : JS_UNDEFINED,
+                                       argc >= 3 ? argv[2] : JS_UNDEFINED);
+}
+
+static JSValue js_worker_pool_terminate(JSContext *ctx, JSValueConst this_val,
+                                        int argc, JSValueConst *argv)
+{
+    JSWorkerPool *pool = JS_GetOpaque2(ctx, this_val, js_worker_pool_class_id);
+    if (!pool)
+        return JS_EXCEPTION;
+    js_worker_pool_state_terminate(pool->state);
+    return JS_UNDEFINED;
+}
+
+static const JSCFunctionListEntry js_worker_pool_proto_funcs[] = {
+    JS_CFUNC_DEF("run", 1, js_worker_pool_run ),
+    JS_CFUNC_DEF("terminate", 0, js_worker_pool_terminate ),
+};
+
+#endif /* USE_WORKER */
+
+JSValue js_std_new_worker_pool(JSContext *ctx, const char *filename,
+                               int nb_threads)
+{
+#ifdef USE_WORKER
+    return js_worker_pool_new(ctx, JS_UNDEFINED, "", filename, nb_threads);
+#else
+    return JS_ThrowTypeError(ctx, "workers are not supported");
+#endif
+}
+
+JSValue js_std_worker_pool_run(JSContext *ctx, JSValueConst pool,
+                               const char *func_name, JSValueConst args,
+                               JSValueConst transfer)
+{
+#ifdef USE_WORKER
+    JSValue name, ret;
+    name = JS_NewString(ctx, func_name);
+    if (JS_IsException(name))
+        return JS_EXCEPTION;
+    ret = js_worker_pool_run_internal(ctx, pool, name, args, transfer);
+    JS_FreeValue(ctx, name);
+    return ret;
+#else
+    return JS_ThrowTypeError(ctx, "workers are not supported");
+#endif
+}
+
+void js_std_set_worker_new_context_func(JSContext *(*func)(JSRuntime *rt))
+{
+#ifdef USE_WORKER
+    js_worker_new_context_func = func;
+#endif
+}
+
+#if defined(_WIN32)
+#define OS_PLATFORM "win32"
+#elif defined(__APPLE__)
+#define OS_PLATFORM "darwin"
+#elif defined(EMSCRIPTEN)
+#define OS_PLATFORM "js"
+#else
+#define OS_PLATFORM "linux"
+#endif
+
+#define OS_FLAG(x) JS_PROP_INT32_DEF(#x, x, JS_PROP_CONFIGURABLE )
+
+static const JSCFunctionListEntry js_os_funcs[] = {
+    JS_CFUNC_DEF("open", 2, js_os_open ),
+    OS_FLAG(O_RDONLY),
+    OS_FLAG(O_WRONLY),
+    OS_FLAG(O_RDWR),
+    OS_FLAG(O_APPEND),
+    OS_FLAG(O_CREAT),
+    OS_FLAG(O_EXCL),
+    OS_FLAG(O_TRUNC),
+#if defined(_WIN32)
+    OS_FLAG(O_BINARY),
+    OS_FLAG(O_TEXT),
+#endif
+    JS_CFUNC_DEF("close", 1, js_os_close ),
+    JS_CFUNC_DEF("seek", 3, js_os_seek ),
+    JS_CFUNC_MAGIC_DEF("read", 4, js_os_read_write, 0 ),
+    JS_CFUNC_MAGIC_DEF("write", 4, js_os_read_write, 1 ),
+    JS_CFUNC_DEF("isatty", 1, js_os_isatty ),
+    JS_CFUNC_DEF("ttyGetWinSize", 1, js_os_ttyGetWinSize ),
+    JS_CFUNC_DEF("ttySetRaw", 1, js_os_ttySetRaw ),
+    JS_CFUNC_DEF("remove", 1, js_os_remove ),
+    JS_CFUNC_DEF("rename", 2, js_os_rename ),
+    JS_CFUNC_MAGIC_DEF("setReadHandler", 2, js_os_setReadHandler, 0 ),
+    JS_CFUNC_MAGIC_DEF("setWriteHandler", 2, js_os_setReadHandler, 1 ),
+    JS_CFUNC_DEF("signal", 2, js_os_signal ),
     OS_FLAG(SIGINT),
     OS_FLAG(SIGABRT),
     OS_FLAG(SIGFPE),
@@ -4001,6 +5558,20 @@ static int js_os_init(JSContext *ctx, JSModuleDef *m)
         }
 
         JS_SetModuleExport(ctx, m, "Worker", obj);
+
+        /* WorkerPool class */
+        JS_NewClassID(&js_worker_pool_class_id);
+        JS_NewClass(JS_GetRuntime(ctx), js_worker_pool_class_id, &js_worker_pool_class);
+        proto = JS_NewObject(ctx);
+        JS_SetPropertyFunctionList(ctx, proto, js_worker_pool_proto_funcs, countof(js_worker_pool_proto_funcs));
+
+        obj = JS_NewCFunction2(ctx, js_worker_pool_ctor, "WorkerPool", 1,
+                               JS_CFUNC_constructor, 0);
+        JS_SetConstructor(ctx, obj, proto);
+
+        JS_SetClassProto(ctx, js_worker_pool_class_id, proto);
+
+        JS_SetModuleExport(ctx, m, "WorkerPool", obj);
     }
 #endif /* USE_WORKER */
 
@@ -4017,6 +5588,7 @@ JSModuleDef *js_init_module_os(JSContext *ctx, const char *module_name)
     JS_AddModuleExportList(ctx, m, js_os_funcs, countof(js_os_funcs));
 #ifdef USE_WORKER
     JS_AddModuleExport(ctx, m, "Worker");
+    JS_AddModuleExport(ctx, m, "WorkerPool");
 #endif
     return m;
 }
@@ -4105,10 +5677,13 @@ void js_std_init_handlers(JSRuntime *rt)
     memset(ts, 0, sizeof(*ts));
     init_list_head(&ts->os_rw_handlers);
     init_list_head(&ts->os_signal_handlers);
-    init_list_head(&ts->os_timers);
+    init_list_head(&ts->os_expired_timers);
     init_list_head(&ts->port_list);
     init_list_head(&ts->rejected_promise_list);
     ts->next_timer_id = 1;
+#ifdef USE_EPOLL
+    ts->epoll_fd = -1;
+#endif
 
     JS_SetRuntimeOpaque(rt, ts);
 
@@ -4140,10 +5715,14 @@ void js_std_free_handlers(JSRuntime *rt)
         free_sh(rt, sh);
     }
 
-    list_for_each_safe(el, el1, &ts->os_timers) {
+    while (ts->timer_count != 0)
+        free_timer(rt, ts->timer_heap[ts->timer_count - 1]);
+    list_for_each_safe(el, el1, &ts->os_expired_timers) {
         JSOSTimer *th = list_entry(el, JSOSTimer, link);
         free_timer(rt, th);
     }
+    js_free_rt(rt, ts->timer_heap);
+    js_free_rt(rt, ts->timer_hash);
 
     list_for_each_safe(el, el1, &ts->rejected_promise_list) {
         JSRejectedPromiseEntry *rp = list_entry(el, JSRejectedPromiseEntry, link);
@@ -4158,12 +5737,26 @@ void js_std_free_handlers(JSRuntime *rt)
 
     list_for_each_safe(el, el1, &ts->port_list) {
         JSWorkerMessageHandler *port = list_entry(el, JSWorkerMessageHandler, link);
-        /* unlink the message ports. They are freed by the Worker object */
+        JSValue keep_alive;
+        /* unlink the message ports. They are freed by the Worker or
+           WorkerPool object */
         port->link.prev = NULL;
         port->link.next = NULL;
+        keep_alive = port->keep_alive;
+        port->keep_alive = JS_UNDEFINED;
+        JS_FreeValueRT(rt, keep_alive);
     }
 #endif
 
+    js_free_rt(rt, ts->rh_hash);
+#ifndef _WIN32
+    js_free_rt(rt, ts->poll_tab);
+#endif
+#ifdef USE_EPOLL
+    if (ts->epoll_fd >= 0)
+        close(ts->epoll_fd);
+#endif
+
     free(ts);
     JS_SetRuntimeOpaque(rt, NULL); /* fail safe */
 }
@@ -4312,8 +5905,17 @@ JSValue js_std_await(JSContext *ctx, JSValue obj)
 void js_std_eval_binary(JSContext *ctx, const uint8_t *buf, size_t buf_len,
                         int load_only)
 {
+    JSRuntime *rt = JS_GetRuntime(ctx);
     JSValue obj, val;
-    obj = JS_ReadObject(ctx, buf, buf_len, JS_READ_OBJ_BYTECODE);
+    int flags;
+
+    /* the workers usually load the same precompiled modules. The
+       shared bytecode is never quickened, so the main thread keeps a
+       private copy. */
+    flags = JS_READ_OBJ_BYTECODE;
+    if (JS_GetRuntimeOpaque(rt) && !is_main_thread(rt))
+        flags |= JS_READ_OBJ_SHARED;
+    obj = JS_ReadObject(ctx, buf, buf_len, flags);
     if (JS_IsException(obj))
         goto exception;
     if (load_only) {
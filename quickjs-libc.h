@@ -58,6 +58,16 @@ void js_std_promise_rejection_tracker(JSContext *ctx, JSValueConst promise,
                                       JSValueConst reason,
                                       JS_BOOL is_handled, void *opaque);
 void js_std_set_worker_new_context_func(JSContext *(*func)(JSRuntime *rt));
+/* create a pool of 'nb_threads' threads running the exported functions
+   of the module 'filename' (os.WorkerPool). Must be called from the
+   main thread after the os module is initialized. */
+JSValue js_std_new_worker_pool(JSContext *ctx, const char *filename,
+                               int nb_threads);
+/* run the exported function 'func_name' with the arguments in the array
+   'args' in a thread of 'pool'. Return a promise. */
+JSValue js_std_worker_pool_run(JSContext *ctx, JSValueConst pool,
+                               const char *func_name, JSValueConst args,
+                               JSValueConst transfer);
 
 #ifdef __cplusplus
 } /* extern "C" { */
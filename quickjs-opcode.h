@@ -131,9 +131,9 @@ DEF(   put_var_init, 3, 1, 0, var_ref) /* must come after put_var. Used to initi
 DEF(  get_ref_value, 1, 2, 3, none)
 DEF(  put_ref_value, 1, 3, 0, none)
 
-DEF(      get_field, 5, 1, 1, atom)
-DEF(     get_field2, 5, 1, 2, atom)
-DEF(      put_field, 5, 2, 0, atom)
+DEF(      get_field, 7, 1, 1, atom_u16) /* u16 is the inline cache slot */
+DEF(     get_field2, 7, 1, 2, atom_u16) /* u16 is the inline cache slot */
+DEF(      put_field, 7, 2, 0, atom_u16) /* u16 is the inline cache slot */
 DEF( get_private_field, 1, 2, 1, none) /* obj prop -> value */
 DEF( put_private_field, 1, 3, 0, none) /* obj value prop -> */
 DEF(define_private_field, 1, 3, 1, none) /* obj prop value -> obj */
@@ -280,7 +280,7 @@ def(scope_get_private_field, 7, 1, 1, atom_u16) /* obj -> value, emitted in phas
 def(scope_get_private_field2, 7, 1, 2, atom_u16) /* obj -> obj value, emitted in phase 1, removed in phase 2 */
 def(scope_put_private_field, 7, 2, 0, atom_u16) /* obj value ->, emitted in phase 1, removed in phase 2 */
 def(scope_in_private_field, 7, 1, 1, atom_u16) /* obj -> res emitted in phase 1, removed in phase 2 */
-def(get_field_opt_chain, 5, 1, 1, atom) /* emitted in phase 1, removed in phase 2 */
+def(get_field_opt_chain, 7, 1, 1, atom_u16) /* emitted in phase 1, removed in phase 2 */
 def(get_array_el_opt_chain, 1, 2, 1, none) /* emitted in phase 1, removed in phase 2 */
 def( set_class_name, 5, 1, 1, u32) /* emitted in phase 1, removed in phase 2 */
 
@@ -361,6 +361,28 @@ DEF(typeof_is_undefined, 1, 1, 1, none)
 DEF( typeof_is_function, 1, 1, 1, none)
 #endif
 
+/* quickened opcodes: never emitted by the compiler. The interpreter
+   rewrites the generic opcode in place once it has seen the operand
+   type and reverts it when the guard fails (see js_unquicken_op()) */
+DEF(get_array_el_typed, 1, 2, 1, none) /* get_array_el on a typed array */
+DEF(put_array_el_typed, 1, 3, 0, none) /* put_array_el on a typed array */
+#if SHORT_OPCODES
+DEF(get_length_array, 1, 1, 1, none) /* get_length on an Array */
+DEF(get_length_string, 1, 1, 1, none) /* get_length on a string */
+#endif
+
+#if SHORT_OPCODES
+/* super-instructions: they replace the first opcode of a frequent
+   opcode pair and have the same size and stack effect. The second
+   opcode is left in place and is executed without dispatch, so the
+   jumps and the line numbers are not modified (see fuse_opcodes()) */
+DEF(   lt_if_false8, 1, 2, 1, none) /* lt if_false8 */
+DEF(   gt_if_false8, 1, 2, 1, none) /* gt if_false8 */
+DEF(  inc_loc_goto8, 2, 0, 0, loc8) /* inc_loc goto8 */
+DEF(  get_loc0_loc1, 1, 0, 1, none) /* get_loc0 get_loc1 */
+DEF(get_loc0_get_field2, 1, 0, 1, none) /* get_loc0 get_field2 */
+#endif
+
 #undef DEF
 #undef def
 #endif  /* DEF */
@@ -77,6 +77,21 @@
 #define CONFIG_STACK_CHECK
 #endif
 
+/* CONFIG_SLAB_ALLOC: allocate the small objects, shapes, strings,
+   closure variables and map records from per-runtime pools of fixed
+   size blocks. Disabled with the address sanitizer so that it can
+   check these blocks. */
+#if defined(CONFIG_SLAB_ALLOC) && defined(__SANITIZE_ADDRESS__)
+#undef CONFIG_SLAB_ALLOC
+#endif
+
+/* the baseline JIT compiler (CONFIG_JIT) only supports x86-64 with
+   the 128 bit JSValue representation */
+#if defined(CONFIG_JIT) && (!defined(__x86_64__) || defined(_WIN32) || \
+                            defined(JS_NAN_BOXING) || defined(CONFIG_CHECK_JSVALUE))
+#undef CONFIG_JIT
+#endif
+
 
 /* dump object free */
 //#define DUMP_FREE
@@ -107,6 +122,9 @@
 //#define DUMP_PROMISE
 //#define DUMP_READ_OBJECT
 //#define DUMP_ROPE_REBALANCE
+/* dump the number of sites and executions of the super-instructions
+   in JS_FreeRuntime() */
+//#define DUMP_SUPER_INSTRUCTIONS
 
 /* test the GC by forcing it before each object allocation */
 //#define FORCE_GC_AT_MALLOC
@@ -117,6 +135,10 @@
 #include <errno.h>
 #endif
 
+#ifdef CONFIG_JIT
+#include <sys/mman.h>
+#endif
+
 enum {
     /* classid tag        */    /* union usage   | properties */
     JS_CLASS_OBJECT = 1,        /* must be first */
@@ -235,9 +257,43 @@ typedef enum {
 
 typedef enum OPCodeEnum OPCodeEnum;
 
+/* the block sizes of the slab allocator are multiples of 16 bytes */
+#define JS_SLAB_SHIFT      4
+
+#ifdef CONFIG_SLAB_ALLOC
+#define JS_SLAB_MAX_SIZE   (JS_SLAB_CLASS_COUNT << JS_SLAB_SHIFT)
+#define JS_SLAB_CHUNK_SIZE (16 * 1024)
+
+typedef struct JSSlabChunk {
+    struct JSSlabChunk *next;
+} JSSlabChunk;
+
+/* keep the blocks aligned on 16 bytes */
+#define JS_SLAB_CHUNK_HEADER_SIZE (1 << JS_SLAB_SHIFT)
+
+typedef struct JSSlabBlock {
+    struct JSSlabBlock *next; /* next free block */
+} JSSlabBlock;
+
+typedef struct JSSlabClass {
+    JSSlabBlock *free_list;
+    uint8_t *ptr, *end; /* blocks not yet used in the last chunk */
+    JSSlabChunk *chunks;
+    int chunk_count;
+    int64_t used_count; /* number of allocated blocks */
+} JSSlabClass;
+#else
+#define JS_SLAB_MAX_SIZE   0
+#endif
+
 struct JSRuntime {
     JSMallocFunctions mf;
     JSMallocState malloc_state;
+#ifdef CONFIG_SLAB_ALLOC
+    JSSlabClass slab_classes[JS_SLAB_CLASS_COUNT];
+    size_t slab_free_size; /* free bytes in the slab chunks */
+#endif
+    BOOL is_arena; /* created by JS_NewArenaRuntime() */
     const char *rt_info;
 
     int atom_hash_size; /* power of two */
@@ -255,11 +311,26 @@ struct JSRuntime {
     /* list of JSGCObjectHeader.link. List of allocated GC objects (used
        by the garbage collector) */
     struct list_head gc_obj_list;
+    /* list of JSGCObjectHeader.link. GC objects allocated since the
+       last GC when the generational GC is enabled */
+    struct list_head gc_young_obj_list;
     /* list of JSGCObjectHeader.link. Used during JS_FreeValueRT() */
     struct list_head gc_zero_ref_count_list;
     struct list_head tmp_obj_list; /* used during GC */
     JSGCPhaseEnum gc_phase : 8;
     size_t malloc_gc_threshold;
+    int gc_pause_budget; /* in us, 0 if the generational GC is disabled */
+    int gc_young_count; /* objects added to gc_young_obj_list */
+    int gc_young_limit; /* a minor GC is done when gc_young_count reaches it */
+    int gc_old_slice; /* number of old objects collected by a minor GC */
+    int gc_minor_cost; /* estimated cost of a minor GC, in ns per object */
+    int gc_old_count; /* estimated number of objects in gc_obj_list */
+    /* > 0 if an incremental major GC is in progress: number of old
+       objects remaining to be collected by the minor GCs */
+    int gc_major_remaining;
+    /* a full GC is done above this size because the minor GCs cannot
+       collect the cycles spanning several old slices */
+    size_t gc_full_threshold;
     struct list_head weakref_list; /* list of JSWeakRefHeader.link */
 #ifdef DUMP_LEAKS
     struct list_head string_list; /* list of JSString.link */
@@ -301,12 +372,30 @@ struct JSRuntime {
     JSSharedArrayBufferFunctions sab_funcs;
     /* see JS_SetStripInfo() */
     uint8_t strip_flags;
+    /* see JS_EnableTypeFeedback() */
+    BOOL type_feedback;
+#ifdef DUMP_SUPER_INSTRUCTIONS
+    /* indexed by opcode */
+    uint32_t super_insn_sites[256];
+    uint64_t super_insn_count[256];
+#endif
     
     /* Shape hash table */
     int shape_hash_bits;
     int shape_hash_size;
     int shape_hash_count; /* number of hashed shapes */
     JSShape **shape_hash;
+    /* incremented when the properties or the prototype of an object
+       used as prototype are modified (see JSInlineCacheEntry) */
+    uint32_t proto_epoch;
+    /* bytecode read with JS_READ_OBJ_SHARED, released when the
+       runtime is freed */
+    struct JSSharedBytecode **shared_bytecode_tab;
+    int shared_bytecode_count;
+    int shared_bytecode_size;
+#ifdef CONFIG_JIT
+    struct list_head jit_code_list; /* list of JSJitCode.link */
+#endif
     void *user_opaque;
 };
 
@@ -356,7 +445,8 @@ struct JSGCObjectHeader {
     int ref_count; /* must come first, 32-bit */
     JSGCObjectTypeEnum gc_obj_type : 4;
     uint8_t mark : 1; /* used by the GC */
-    uint8_t dummy0: 3;
+    uint8_t young : 1; /* in the set collected by gc_minor() */
+    uint8_t dummy0: 2;
     uint8_t dummy1; /* not used by the GC */
     uint16_t dummy2; /* not used by the GC */
     struct list_head link;
@@ -474,6 +564,8 @@ struct JSContext {
     JSValue global_obj; /* global object */
     JSValue global_var_obj; /* contains the global let/const definitions */
 
+    struct JSSnapshotBase *snapshot_base; /* set by JS_EnableSnapshot() */
+
     uint64_t random_state;
 
     /* when the counter reaches zero, JSRutime.interrupt_handler is called */
@@ -515,8 +607,11 @@ typedef enum {
 
 struct JSString {
     JSRefCountHeader header; /* must come first, 32-bit */
-    uint32_t len : 31;
+    uint32_t len : 30;
     uint8_t is_wide_char : 1; /* 0 = 8 bits, 1 = 16 bits characters */
+    /* allocated with js_slab_alloc_rt(). The size class is given by
+       'len', so the length can only change inside the same block */
+    uint8_t is_slab : 1;
     /* for JS_ATOM_TYPE_SYMBOL: hash = weakref_count, atom_type = 3,
        for JS_ATOM_TYPE_PRIVATE: hash = JS_ATOM_HASH_PRIVATE, atom_type = 3
        XXX: could change encoding to have one more bit in hash */
@@ -617,6 +712,45 @@ typedef enum JSFunctionKindEnum {
     JS_FUNC_ASYNC_GENERATOR = (JS_FUNC_GENERATOR | JS_FUNC_ASYNC),
 } JSFunctionKindEnum;
 
+/* Inline cache of get_field, get_field2 and put_field. Each entry
+   maps a shape to the index of the own property. The shapes are
+   hashed and referenced by the cache: such a shape is never modified
+   in place (add_property() and js_shape_prepare_update() clone it),
+   so comparing the shape pointer is enough to validate an entry.
+
+   For get_field, an entry may also reference a property of an object
+   'holder' of the prototype chain. The rest of the chain is not
+   pinned, so such an entry is only valid while JSRuntime.proto_epoch
+   is unchanged. The holder is not referenced: it stays alive as long
+   as the chain is not modified. */
+#define JS_IC_MAX_ENTRIES 4
+#define JS_IC_MAX_COUNT   0xffff /* slot value meaning "no inline cache" */
+
+typedef struct JSInlineCacheEntry {
+    JSShape *shape;
+    JSObject *holder; /* NULL for an own property */
+    uint32_t prop_idx;
+    uint32_t proto_epoch; /* only used if holder != NULL */
+} JSInlineCacheEntry;
+
+typedef struct JSInlineCache {
+    int count; /* number of used entries */
+    JSInlineCacheEntry entries[JS_IC_MAX_ENTRIES];
+} JSInlineCache;
+
+/* Cache of the get_var/put_var slow path, used when a global
+   variable is not bound to a variable reference (undefined variable,
+   getter/setter or property of the prototype of the global
+   object). The global object is flagged as prototype, so the cached
+   lookup is valid while JSRuntime.proto_epoch is unchanged. */
+typedef struct JSGlobalVarCache {
+    uint8_t is_valid : 1;
+    uint8_t is_getset : 1;
+    JSObject *holder; /* NULL if the variable is not defined */
+    uint32_t prop_idx;
+    uint32_t proto_epoch;
+} JSGlobalVarCache;
+
 typedef struct JSFunctionBytecode {
     JSGCObjectHeader header; /* must come first */
     uint8_t js_mode;
@@ -631,7 +765,7 @@ typedef struct JSFunctionBytecode {
     uint8_t super_allowed : 1;
     uint8_t arguments_allowed : 1;
     uint8_t has_debug : 1;
-    uint8_t read_only_bytecode : 1;
+    uint8_t read_only_bytecode : 1; /* byte_code_buf and debug.pc2line_buf are not owned */
     uint8_t is_direct_or_indirect_eval : 1; /* used by JS_GetScriptOrModuleName() */
     /* XXX: 10 bits available */
     uint8_t *byte_code_buf; /* (self pointer) */
@@ -644,10 +778,21 @@ typedef struct JSFunctionBytecode {
     uint16_t defined_arg_count; /* for length function property */
     uint16_t stack_size; /* maximum stack size */
     uint16_t var_ref_count; /* number of local variable references */
+    uint16_t ic_count; /* number of inline cache slots */
+    uint16_t deopt_count; /* number of reverted quickened opcodes */
+    JSInlineCache *ic; /* ic_count elements, allocated on first use */
+    /* allocated on the first call if the type feedback is enabled */
+    struct JSTypeFeedback *feedback;
+    /* closure_var_count elements, allocated on first use */
+    JSGlobalVarCache *global_var_cache;
     JSContext *realm; /* function realm */
     JSValue *cpool; /* constant pool (self pointer) */
     int cpool_count;
     int closure_var_count;
+#ifdef CONFIG_JIT
+    int jit_counter; /* calls and loop iterations before compilation */
+    struct JSJitCode *jit_code; /* native code or NULL */
+#endif
     struct {
         /* debug info, move to separate structure to save memory? */
         JSAtom filename;
@@ -723,6 +868,7 @@ typedef struct JSAsyncFunctionState {
     BOOL throw_flag; /* used to throw an exception in JS_CallInternal() */
     BOOL is_completed; /* TRUE if the function has returned. The stack
                           frame is no longer valid */
+    int alloc_size; /* size of the structure and of the buffers */
     JSValue resolving_funcs[2]; /* only used in JS async functions */
     JSStackFrame frame;
     /* arg_buf, var_buf, stack_buf and var_refs follow */
@@ -928,7 +1074,8 @@ struct JSObject {
         JSGCObjectHeader header;
         struct {
             int __gc_ref_count; /* corresponds to header.ref_count */
-            uint8_t __gc_mark : 7; /* corresponds to header.mark/gc_obj_type */
+            uint8_t __gc_mark : 6; /* corresponds to header.mark/young/gc_obj_type */
+            uint8_t is_prototype : 1; /* TRUE if the object is or was used as prototype */
             /* TRUE if the array prototype is "normal":
                - no small index properties which are get/set or non writable
                - its prototype is Object.prototype
@@ -1085,11 +1232,75 @@ enum OPCodeEnum {
     OP_TEMP_END,
 };
 
+/* return the generic opcode of a quickened opcode. The quickened
+   opcodes have the same size and format as their generic opcode. */
+static inline int js_unquicken_op(int op)
+{
+    switch(op) {
+    case OP_get_array_el_typed:
+        return OP_get_array_el;
+    case OP_put_array_el_typed:
+        return OP_put_array_el;
+#if SHORT_OPCODES
+    case OP_get_length_array:
+    case OP_get_length_string:
+        return OP_get_length;
+#endif
+    default:
+        return op;
+    }
+}
+
+/* return the first opcode of a super-instruction. The quickened
+   opcodes are also converted to their generic opcode. */
+static inline int js_unfuse_op(int op)
+{
+    switch(op) {
+#if SHORT_OPCODES
+    case OP_lt_if_false8:
+        return OP_lt;
+    case OP_gt_if_false8:
+        return OP_gt;
+    case OP_inc_loc_goto8:
+        return OP_inc_loc;
+    case OP_get_loc0_loc1:
+    case OP_get_loc0_get_field2:
+        return OP_get_loc0;
+#endif
+    default:
+        return js_unquicken_op(op);
+    }
+}
+
+/* stop quickening the opcodes of a function after this number of
+   deoptimizations to avoid flip-flopping on the polymorphic sites */
+#define JS_QUICKEN_MAX_DEOPT 64
+
+/* replace the one byte opcode before 'pc' with its quickened version */
+static inline void js_quicken_op(JSFunctionBytecode *b, const uint8_t *pc,
+                                 int op)
+{
+    if (!b->read_only_bytecode && b->deopt_count < JS_QUICKEN_MAX_DEOPT)
+        *(uint8_t *)(pc - 1) = op;
+}
+
 static int JS_InitAtoms(JSRuntime *rt);
 static JSAtom __JS_NewAtomInit(JSRuntime *rt, const char *str, int len,
                                int atom_type);
 static void JS_FreeAtomStruct(JSRuntime *rt, JSAtomStruct *p);
 static void free_function_bytecode(JSRuntime *rt, JSFunctionBytecode *b);
+#ifdef DUMP_SUPER_INSTRUCTIONS
+static void js_dump_super_instructions(JSRuntime *rt);
+#endif
+static void js_free_shared_bytecode_tab(JSRuntime *rt);
+#ifdef CONFIG_JIT
+static void js_jit_free(JSRuntime *rt, JSFunctionBytecode *b);
+static void js_jit_free_all(JSRuntime *rt);
+static BOOL js_jit_tier_up(JSContext *ctx, JSFunctionBytecode *b);
+static JSValue *js_jit_run(JSContext *ctx, JSFunctionBytecode *b,
+                           JSValue *sp, JSValue *var_buf, JSValue *arg_buf,
+                           const uint8_t **ppc);
+#endif
 static JSValue js_call_c_function(JSContext *ctx, JSValueConst func_obj,
                                   JSValueConst this_obj,
                                   int argc, JSValueConst *argv, int flags);
@@ -1197,6 +1408,13 @@ static JSValue js_new_string8_len(JSContext *ctx, const char *buf, int len);
 static JSValue js_compile_regexp(JSContext *ctx, JSValueConst pattern,
                                  JSValueConst flags);
 static JSValue JS_NewRegexp(JSContext *ctx, JSValue pattern, JSValue bc);
+static JSValue js_map_constructor(JSContext *ctx, JSValueConst new_target,
+                                  int argc, JSValueConst *argv, int magic);
+static JSMapRecord *map_add_record(JSContext *ctx, JSMapState *s,
+                                   JSValueConst key);
+static void js_snapshot_base_mark(JSRuntime *rt, struct JSSnapshotBase *b,
+                                  JS_MarkFunc *mark_func);
+static void js_snapshot_base_free(JSRuntime *rt, struct JSSnapshotBase *b);
 static void gc_decref(JSRuntime *rt);
 static int JS_NewClass1(JSRuntime *rt, JSClassID class_id,
                         const JSClassDef *class_def, JSAtom name);
@@ -1236,6 +1454,7 @@ static JSValue js_array_buffer_constructor3(JSContext *ctx,
                                             JSFreeArrayBufferDataFunc *free_func,
                                             void *opaque, BOOL alloc_flag);
 static void js_array_buffer_free(JSRuntime *rt, void *opaque, void *ptr);
+static uint8_t *js_array_buffer_release(JSContext *ctx, JSArrayBuffer *abuf);
 static JSArrayBuffer *js_get_array_buffer(JSContext *ctx, JSValueConst obj);
 static BOOL array_buffer_is_resizable(const JSArrayBuffer *abuf);
 static JSValue js_typed_array_constructor(JSContext *ctx,
@@ -1351,23 +1570,52 @@ static const JSClassExoticMethods js_proxy_exotic_methods;
 static const JSClassExoticMethods js_module_ns_exotic_methods;
 static JSClassID js_class_id_alloc = JS_CLASS_INIT_COUNT;
 
+static void gc_minor(JSRuntime *rt);
+static void gc_update_young_limit(JSRuntime *rt);
+
+/* allocated memory, not counting the free blocks of the slab
+   allocator */
+static inline size_t js_get_used_size(JSRuntime *rt)
+{
+#ifdef CONFIG_SLAB_ALLOC
+    return rt->malloc_state.malloc_size - rt->slab_free_size;
+#else
+    return rt->malloc_state.malloc_size;
+#endif
+}
+
 static void js_trigger_gc(JSRuntime *rt, size_t size)
 {
     BOOL force_gc;
+    size_t new_size;
+
+    new_size = js_get_used_size(rt) + size;
 #ifdef FORCE_GC_AT_MALLOC
     force_gc = TRUE;
 #else
-    force_gc = ((rt->malloc_state.malloc_size + size) >
-                rt->malloc_gc_threshold);
+    force_gc = (new_size > rt->malloc_gc_threshold);
 #endif
+    if (force_gc && rt->gc_pause_budget != 0 &&
+        new_size <= rt->gc_full_threshold) {
+        if (rt->gc_major_remaining == 0) {
+            /* start an incremental major GC: the old objects are
+               collected by the next minor GCs */
+            rt->gc_major_remaining = max_int(rt->gc_old_count, 1);
+            gc_update_young_limit(rt);
+        }
+        force_gc = FALSE;
+    }
     if (force_gc) {
 #ifdef DUMP_GC
         printf("GC: size=%" PRIu64 "\n",
                (uint64_t)rt->malloc_state.malloc_size);
 #endif
         JS_RunGC(rt);
-        rt->malloc_gc_threshold = rt->malloc_state.malloc_size +
-            (rt->malloc_state.malloc_size >> 1);
+        rt->malloc_gc_threshold = js_get_used_size(rt) +
+            (js_get_used_size(rt) >> 1);
+    } else if (rt->gc_pause_budget != 0 &&
+               rt->gc_young_count >= rt->gc_young_limit) {
+        gc_minor(rt);
     }
 }
 
@@ -1467,6 +1715,115 @@ size_t js_malloc_usable_size(JSContext *ctx, const void *ptr)
     return js_malloc_usable_size_rt(ctx->rt, ptr);
 }
 
+/* Slab allocator: the blocks of at most JS_SLAB_MAX_SIZE bytes are
+   taken from per-runtime pools of fixed size blocks, which avoids the
+   malloc overhead for the small and frequently allocated
+   structures. The chunks are only freed with the runtime. The size
+   given to js_slab_free_rt() must be the allocated size. */
+#ifdef CONFIG_SLAB_ALLOC
+static inline int js_slab_class(size_t size)
+{
+    return (size - 1) >> JS_SLAB_SHIFT;
+}
+
+static inline size_t js_slab_block_size(int class_idx)
+{
+    return (size_t)(class_idx + 1) << JS_SLAB_SHIFT;
+}
+
+static no_inline int js_slab_new_chunk(JSRuntime *rt, JSSlabClass *sc,
+                                       size_t block_size)
+{
+    JSSlabChunk *c;
+
+    c = js_malloc_rt(rt, JS_SLAB_CHUNK_SIZE);
+    if (!c)
+        return -1;
+    c->next = sc->chunks;
+    sc->chunks = c;
+    sc->chunk_count++;
+    sc->ptr = (uint8_t *)c + JS_SLAB_CHUNK_HEADER_SIZE;
+    sc->end = sc->ptr + (JS_SLAB_CHUNK_SIZE - JS_SLAB_CHUNK_HEADER_SIZE) /
+        block_size * block_size;
+    rt->slab_free_size += sc->end - sc->ptr;
+    return 0;
+}
+
+static void js_slab_free_all(JSRuntime *rt)
+{
+    JSSlabChunk *c, *c_next;
+    int i;
+
+    for(i = 0; i < JS_SLAB_CLASS_COUNT; i++) {
+        JSSlabClass *sc = &rt->slab_classes[i];
+        for(c = sc->chunks; c != NULL; c = c_next) {
+            c_next = c->next;
+            js_free_rt(rt, c);
+        }
+        memset(sc, 0, sizeof(*sc));
+    }
+    rt->slab_free_size = 0;
+}
+#endif
+
+static inline void *js_slab_alloc_rt(JSRuntime *rt, size_t size)
+{
+#ifdef CONFIG_SLAB_ALLOC
+    if (size <= JS_SLAB_MAX_SIZE) {
+        int class_idx = js_slab_class(size);
+        JSSlabClass *sc = &rt->slab_classes[class_idx];
+        size_t block_size = js_slab_block_size(class_idx);
+        void *ptr;
+
+        if (sc->free_list) {
+            ptr = sc->free_list;
+            sc->free_list = sc->free_list->next;
+        } else {
+            if (unlikely(sc->ptr == sc->end)) {
+                if (js_slab_new_chunk(rt, sc, block_size))
+                    return NULL;
+            }
+            ptr = sc->ptr;
+            sc->ptr += block_size;
+        }
+        sc->used_count++;
+        rt->slab_free_size -= block_size;
+        return ptr;
+    }
+#endif
+    return js_malloc_rt(rt, size);
+}
+
+static inline void js_slab_free_rt(JSRuntime *rt, void *ptr, size_t size)
+{
+#ifdef CONFIG_SLAB_ALLOC
+    if (size <= JS_SLAB_MAX_SIZE) {
+        int class_idx = js_slab_class(size);
+        JSSlabClass *sc = &rt->slab_classes[class_idx];
+        JSSlabBlock *b = ptr;
+
+        b->next = sc->free_list;
+        sc->free_list = b;
+        sc->used_count--;
+        rt->slab_free_size += js_slab_block_size(class_idx);
+        return;
+    }
+#endif
+    js_free_rt(rt, ptr);
+}
+
+/* Throw out of memory in case of error */
+static inline void *js_slab_alloc(JSContext *ctx, size_t size)
+{
+    void *ptr;
+    ptr = js_slab_alloc_rt(ctx->rt, size);
+    if (unlikely(!ptr)) {
+        JS_ThrowOutOfMemory(ctx);
+        return NULL;
+    }
+    return ptr;
+}
+
 /* Throw out of memory exception in case of error */
 char *js_strndup(JSContext *ctx, const char *s, size_t n)
 {
@@ -1665,9 +2022,13 @@ JSRuntime *JS_NewRuntime2(const JSMallocFunctions *mf, void *opaque)
 
     init_list_head(&rt->context_list);
     init_list_head(&rt->gc_obj_list);
+    init_list_head(&rt->gc_young_obj_list);
     init_list_head(&rt->gc_zero_ref_count_list);
     rt->gc_phase = JS_GC_PHASE_NONE;
     init_list_head(&rt->weakref_list);
+#ifdef CONFIG_JIT
+    init_list_head(&rt->jit_code_list);
+#endif
 
 #ifdef DUMP_LEAKS
     init_list_head(&rt->string_list);
@@ -1794,11 +2155,244 @@ static const JSMallocFunctions def_malloc_funcs = {
     js_def_malloc_usable_size,
 };
 
+/* Return a block of 'size' bytes allocated with malloc() containing
+   the data of 'ptr' which was allocated with js_malloc_rt(). With the
+   default allocator, the block is just removed from the runtime
+   memory statistics. Return NULL if memory error ('ptr' is then
+   unchanged). */
+static void *js_release_to_malloc(JSRuntime *rt, void *ptr, size_t size)
+{
+    void *new_ptr;
+
+    if (rt->mf.js_malloc == js_def_malloc) {
+        rt->malloc_state.malloc_count--;
+        rt->malloc_state.malloc_size -=
+            js_def_malloc_usable_size(ptr) + MALLOC_OVERHEAD;
+        return ptr;
+    }
+    new_ptr = malloc(max_int(size, 1));
+    if (!new_ptr)
+        return NULL;
+    memcpy(new_ptr, ptr, size);
+    js_free_rt(rt, ptr);
+    return new_ptr;
+}
+
+/* Inverse of js_release_to_malloc(): return TRUE if the malloc()
+   block 'ptr' is now owned by 'rt' and can be freed with
+   js_free_rt(). Return FALSE if the block would exceed the memory
+   limit of 'rt'. */
+static BOOL js_adopt_from_malloc(JSRuntime *rt, void *ptr)
+{
+    JSMallocState *s = &rt->malloc_state;
+    size_t size;
+
+    if (rt->mf.js_malloc != js_def_malloc)
+        return FALSE;
+    size = js_def_malloc_usable_size(ptr) + MALLOC_OVERHEAD;
+    if (s->malloc_size + size > s->malloc_limit)
+        return FALSE;
+    s->malloc_count++;
+    s->malloc_size += size;
+    return TRUE;
+}
+
+/* used for the data shared by all the runtimes of the process */
+static void *js_shared_mallocz(size_t size)
+{
+    return calloc(1, max_int(size, 1));
+}
+
+static void *js_shared_malloc(size_t size)
+{
+    return malloc(max_int(size, 1));
+}
+
+static void js_shared_free(void *ptr)
+{
+    free(ptr);
+}
+
 JSRuntime *JS_NewRuntime(void)
 {
     return JS_NewRuntime2(&def_malloc_funcs, NULL);
 }
 
+/* Arena allocator: the blocks are carved from large chunks and are
+   recycled with one free list per power of two size. Each block is
+   preceded by its usable size. The large blocks are allocated with
+   malloc() and kept in a list. Everything is released at once by
+   js_arena_free_all(). */
+#define JS_ARENA_CHUNK_SIZE  (256 * 1024)
+#define JS_ARENA_HEADER_SIZE 16 /* keep the blocks aligned on 16 bytes */
+#define JS_ARENA_MIN_BITS    5
+#define JS_ARENA_MAX_BITS    16 /* larger blocks are allocated with malloc() */
+#define JS_ARENA_CLASS_COUNT (JS_ARENA_MAX_BITS - JS_ARENA_MIN_BITS + 1)
+
+typedef struct JSArenaChunk {
+    struct JSArenaChunk *next;
+} JSArenaChunk;
+
+typedef struct JSArenaLargeBlock {
+    struct list_head link;
+    size_t dummy;
+    size_t size; /* must be last */
+} JSArenaLargeBlock;
+
+typedef struct JSArena {
+    uint8_t *ptr, *end; /* free space in the current chunk */
+    JSArenaChunk *chunks;
+    void *free_lists[JS_ARENA_CLASS_COUNT];
+    struct list_head large_blocks; /* list of JSArenaLargeBlock.link */
+} JSArena;
+
+static size_t js_arena_malloc_usable_size(const void *ptr)
+{
+    return ((const size_t *)ptr)[-1];
+}
+
+static inline BOOL js_arena_is_large(size_t size)
+{
+    return size > (1 << JS_ARENA_MAX_BITS) - JS_ARENA_HEADER_SIZE;
+}
+
+static void *js_arena_malloc(JSMallocState *s, size_t size)
+{
+    JSArena *a = s->opaque;
+    uint8_t *ptr;
+    size_t block_size;
+    int class_idx;
+
+    assert(size != 0);
+    if (unlikely(s->malloc_size + size > s->malloc_limit))
+        return NULL;
+
+    if (js_arena_is_large(size)) {
+        JSArenaLargeBlock *lb;
+        lb = malloc(sizeof(*lb) + size);
+        if (!lb)
+            return NULL;
+        list_add_tail(&lb->link, &a->large_blocks);
+        lb->size = size;
+        ptr = (uint8_t *)(lb + 1);
+    } else {
+        class_idx = max_int(32 - clz32(size + JS_ARENA_HEADER_SIZE - 1),
+                            JS_ARENA_MIN_BITS) - JS_ARENA_MIN_BITS;
+        ptr = a->free_lists[class_idx];
+        if (ptr) {
+            a->free_lists[class_idx] = *(void **)ptr;
+        } else {
+            block_size = (size_t)1 << (class_idx + JS_ARENA_MIN_BITS);
+            if (unlikely(a->end - a->ptr < block_size)) {
+                JSArenaChunk *c;
+                /* the end of the previous chunk is lost */
+                c = malloc(JS_ARENA_CHUNK_SIZE);
+                if (!c)
+                    return NULL;
+                c->next = a->chunks;
+                a->chunks = c;
+                a->ptr = (uint8_t *)c + JS_ARENA_HEADER_SIZE;
+                a->end = (uint8_t *)c + JS_ARENA_CHUNK_SIZE;
+            }
+            ptr = a->ptr + JS_ARENA_HEADER_SIZE;
+            a->ptr += block_size;
+            ((size_t *)ptr)[-1] = block_size - JS_ARENA_HEADER_SIZE;
+        }
+    }
+    s->malloc_count++;
+    s->malloc_size += js_arena_malloc_usable_size(ptr) + JS_ARENA_HEADER_SIZE;
+    return ptr;
+}
+
+static void js_arena_free(JSMallocState *s, void *ptr)
+{
+    JSArena *a = s->opaque;
+    size_t size;
+    int class_idx;
+
+    if (!ptr)
+        return;
+    size = js_arena_malloc_usable_size(ptr);
+    s->malloc_count--;
+    s->malloc_size -= size + JS_ARENA_HEADER_SIZE;
+    if (js_arena_is_large(size)) {
+        JSArenaLargeBlock *lb = (JSArenaLargeBlock *)ptr - 1;
+        list_del(&lb->link);
+        free(lb);
+    } else {
+        class_idx = 32 - clz32(size + JS_ARENA_HEADER_SIZE - 1) -
+            JS_ARENA_MIN_BITS;
+        *(void **)ptr = a->free_lists[class_idx];
+        a->free_lists[class_idx] = ptr;
+    }
+}
+
+static void *js_arena_realloc(JSMallocState *s, void *ptr, size_t size)
+{
+    void *new_ptr;
+    size_t old_size;
+
+    if (!ptr) {
+        if (size == 0)
+            return NULL;
+        return js_arena_malloc(s, size);
+    }
+    if (size == 0) {
+        js_arena_free(s, ptr);
+        return NULL;
+    }
+    old_size = js_arena_malloc_usable_size(ptr);
+    if (size <= old_size)
+        return ptr;
+    new_ptr = js_arena_malloc(s, size);
+    if (!new_ptr)
+        return NULL;
+    memcpy(new_ptr, ptr, old_size);
+    js_arena_free(s, ptr);
+    return new_ptr;
+}
+
+static const JSMallocFunctions js_arena_malloc_funcs = {
+    js_arena_malloc,
+    js_arena_free,
+    js_arena_realloc,
+    js_arena_malloc_usable_size,
+};
+
+static void js_arena_free_all(JSArena *a)
+{
+    JSArenaChunk *c, *c_next;
+    struct list_head *el, *el1;
+
+    for(c = a->chunks; c != NULL; c = c_next) {
+        c_next = c->next;
+        free(c);
+    }
+    list_for_each_safe(el, el1, &a->large_blocks) {
+        free(list_entry(el, JSArenaLargeBlock, link));
+    }
+    free(a);
+}
+
+JSRuntime *JS_NewArenaRuntime(void)
+{
+    JSRuntime *rt;
+    JSArena *a;
+
+    a = malloc(sizeof(*a));
+    if (!a)
+        return NULL;
+    memset(a, 0, sizeof(*a));
+    init_list_head(&a->large_blocks);
+    rt = JS_NewRuntime2(&js_arena_malloc_funcs, a);
+    if (!rt) {
+        js_arena_free_all(a);
+        return NULL;
+    }
+    rt->is_arena = TRUE;
+    return rt;
+}
+
 void JS_SetMemoryLimit(JSRuntime *rt, size_t limit)
 {
     rt->malloc_state.malloc_limit = limit;
@@ -1810,6 +2404,56 @@ void JS_SetGCThreshold(JSRuntime *rt, size_t gc_threshold)
     rt->malloc_gc_threshold = gc_threshold;
 }
 
+/* move the young objects to gc_obj_list */
+static void gc_merge_young(JSRuntime *rt)
+{
+    list_splice_tail(&rt->gc_young_obj_list, &rt->gc_obj_list);
+    rt->gc_young_count = 0;
+}
+
+static void gc_update_young_limit(JSRuntime *rt)
+{
+    int n;
+    n = min_int((int64_t)rt->gc_pause_budget * 1000 / rt->gc_minor_cost,
+                INT32_MAX / 2);
+    if (rt->gc_major_remaining != 0) {
+        /* 3/4 of the budget is used to scan the old objects */
+        rt->gc_young_limit = max_int(n / 4, 256);
+        rt->gc_old_slice = n - n / 4;
+    } else {
+        /* 1/4 of the budget is used to scan the old objects */
+        rt->gc_young_limit = max_int(n - n / 4, 256);
+        rt->gc_old_slice = n / 4;
+    }
+}
+
+static int gc_count_old(JSRuntime *rt)
+{
+    struct list_head *el;
+    int count = 0;
+    list_for_each(el, &rt->gc_obj_list) {
+        count++;
+    }
+    return count;
+}
+
+/* use 0 to disable the generational GC */
+void JS_SetGCPauseBudget(JSRuntime *rt, int budget_us)
+{
+    rt->gc_pause_budget = max_int(budget_us, 0);
+    rt->gc_major_remaining = 0;
+    gc_merge_young(rt);
+    if (rt->gc_pause_budget != 0) {
+        if (rt->gc_minor_cost == 0)
+            rt->gc_minor_cost = 100; /* initial guess */
+        rt->gc_old_count = gc_count_old(rt);
+        rt->gc_full_threshold = js_get_used_size(rt) * 2;
+        if (rt->gc_full_threshold < rt->malloc_gc_threshold)
+            rt->gc_full_threshold = rt->malloc_gc_threshold;
+        gc_update_young_limit(rt);
+    }
+}
+
 #define malloc(s) malloc_is_forbidden(s)
 #define free(p) free_is_forbidden(p)
 #define realloc(p,s) realloc_is_forbidden(p,s)
@@ -1841,6 +2485,11 @@ int JS_GetStripInfo(JSRuntime *rt)
     return rt->strip_flags;
 }
 
+void JS_EnableTypeFeedback(JSRuntime *rt, BOOL enable)
+{
+    rt->type_feedback = enable;
+}
+
 /* return 0 if OK, < 0 if exception */
 int JS_EnqueueJob(JSContext *ctx, JSJobFunc *job_func,
                   int argc, JSValueConst *argv)
@@ -1923,15 +2572,25 @@ static inline JSAtomStruct *atom_set_free(uint32_t v)
     return (JSAtomStruct *)(((uintptr_t)v << 1) | 1);
 }
 
-/* Note: the string contents are uninitialized */
-static JSString *js_alloc_string_rt(JSRuntime *rt, int max_len, int is_wide_char)
+/* Note: the string contents are uninitialized. If 'is_resizable' is
+   TRUE, the string is not allocated in a slab block so that it can be
+   reallocated or shortened. */
+static JSString *js_alloc_string_rt2(JSRuntime *rt, int max_len,
+                                     int is_wide_char, BOOL is_resizable)
 {
     JSString *str;
-    str = js_malloc_rt(rt, sizeof(JSString) + (max_len << is_wide_char) + 1 - is_wide_char);
+    size_t size;
+
+    size = sizeof(JSString) + (max_len << is_wide_char) + 1 - is_wide_char;
+    if (is_resizable)
+        str = js_malloc_rt(rt, size);
+    else
+        str = js_slab_alloc_rt(rt, size);
     if (unlikely(!str))
         return NULL;
     str->header.ref_count = 1;
     str->is_wide_char = is_wide_char;
+    str->is_slab = !is_resizable && size <= JS_SLAB_MAX_SIZE;
     str->len = max_len;
     str->atom_type = 0;
     str->hash = 0;          /* optional but costless */
@@ -1942,10 +2601,16 @@ static JSString *js_alloc_string_rt(JSRuntime *rt, int max_len, int is_wide_char
     return str;
 }
 
-static JSString *js_alloc_string(JSContext *ctx, int max_len, int is_wide_char)
+static JSString *js_alloc_string_rt(JSRuntime *rt, int max_len, int is_wide_char)
+{
+    return js_alloc_string_rt2(rt, max_len, is_wide_char, FALSE);
+}
+
+static JSString *js_alloc_string2(JSContext *ctx, int max_len,
+                                  int is_wide_char, BOOL is_resizable)
 {
     JSString *p;
-    p = js_alloc_string_rt(ctx->rt, max_len, is_wide_char);
+    p = js_alloc_string_rt2(ctx->rt, max_len, is_wide_char, is_resizable);
     if (unlikely(!p)) {
         JS_ThrowOutOfMemory(ctx);
         return NULL;
@@ -1953,6 +2618,22 @@ static JSString *js_alloc_string(JSContext *ctx, int max_len, int is_wide_char)
     return p;
 }
 
+static JSString *js_alloc_string(JSContext *ctx, int max_len, int is_wide_char)
+{
+    return js_alloc_string2(ctx, max_len, is_wide_char, FALSE);
+}
+
+/* free the memory of the string structure */
+static void js_free_string_struct(JSRuntime *rt, JSString *str)
+{
+    if (str->is_slab) {
+        js_slab_free_rt(rt, str, sizeof(JSString) +
+                        (str->len << str->is_wide_char) + 1 - str->is_wide_char);
+    } else {
+        js_free_rt(rt, str);
+    }
+}
+
 /* same as JS_FreeValueRT() but faster */
 static inline void js_free_string(JSRuntime *rt, JSString *str)
 {
@@ -1963,7 +2644,7 @@ static inline void js_free_string(JSRuntime *rt, JSString *str)
 #ifdef DUMP_LEAKS
             list_del(&str->link);
 #endif
-            js_free_rt(rt, str);
+            js_free_string_struct(rt, str);
         }
     }
 }
@@ -1974,11 +2655,64 @@ void JS_SetRuntimeInfo(JSRuntime *rt, const char *s)
         rt->rt_info = s;
 }
 
+/* In an arena runtime, only the finalizers releasing resources outside
+   of the arena are called: those of the host classes (files, worker
+   ports...) and those of the array buffers whose data is not allocated
+   by js_array_buffer_free(). A reference is first taken to every GC
+   object so that the finalizers cannot free any of them. */
+static void js_arena_free_external(JSRuntime *rt)
+{
+    struct list_head *el;
+    JSGCObjectHeader *gp;
+    JSObject *p;
+    JSClassFinalizer *finalizer;
+    JSArrayBuffer *abuf;
+
+    gc_merge_young(rt);
+    list_for_each(el, &rt->gc_obj_list) {
+        gp = list_entry(el, JSGCObjectHeader, link);
+        gp->ref_count++;
+    }
+    list_for_each(el, &rt->gc_obj_list) {
+        gp = list_entry(el, JSGCObjectHeader, link);
+        if (gp->gc_obj_type != JS_GC_OBJ_TYPE_JS_OBJECT)
+            continue;
+        p = (JSObject *)gp;
+        if (p->class_id == JS_CLASS_ARRAY_BUFFER ||
+            p->class_id == JS_CLASS_SHARED_ARRAY_BUFFER) {
+            abuf = p->u.array_buffer;
+            if (!abuf || (!abuf->shared &&
+                          abuf->free_func == js_array_buffer_free))
+                continue;
+        } else if (p->class_id < JS_CLASS_INIT_COUNT) {
+            continue;
+        }
+        finalizer = rt->class_array[p->class_id].finalizer;
+        if (finalizer)
+            (*finalizer)(rt, JS_MKPTR(JS_TAG_OBJECT, p));
+    }
+}
+
 void JS_FreeRuntime(JSRuntime *rt)
 {
     struct list_head *el, *el1;
     int i;
 
+#ifdef DUMP_SUPER_INSTRUCTIONS
+    js_dump_super_instructions(rt);
+#endif
+    if (rt->is_arena) {
+        js_arena_free_external(rt);
+        js_free_shared_bytecode_tab(rt);
+#ifdef CONFIG_JIT
+        /* the native code is not in the arena */
+        js_jit_free_all(rt);
+#endif
+        /* the runtime structure is in the arena too */
+        js_arena_free_all(rt->malloc_state.opaque);
+        return;
+    }
+
     JS_FreeValueRT(rt, rt->current_exception);
 
     list_for_each_safe(el, el1, &rt->job_list) {
@@ -2110,7 +2844,7 @@ void JS_FreeRuntime(JSRuntime *rt)
 #ifdef DUMP_LEAKS
             list_del(&p->link);
 #endif
-            js_free_rt(rt, p);
+            js_free_string_struct(rt, p);
         }
     }
     js_free_rt(rt, rt->atom_array);
@@ -2139,11 +2873,21 @@ void JS_FreeRuntime(JSRuntime *rt)
                 printf("\n");
             }
             list_del(&str->link);
-            js_free_rt(rt, str);
+            js_free_string_struct(rt, str);
         }
         if (rt->rt_info)
             printf("\n");
     }
+#endif
+
+    /* no function references the shared bytecode anymore */
+    js_free_shared_bytecode_tab(rt);
+
+#ifdef CONFIG_SLAB_ALLOC
+    js_slab_free_all(rt);
+#endif
+
+#ifdef DUMP_LEAKS
     {
         JSMallocState *s = &rt->malloc_state;
         if (s->malloc_count > 1) {
@@ -2332,6 +3076,9 @@ static void JS_MarkContext(JSRuntime *rt, JSContext *ctx,
 
     if (ctx->regexp_result_shape)
         mark_func(rt, &ctx->regexp_result_shape->header);
+
+    if (ctx->snapshot_base)
+        js_snapshot_base_mark(rt, ctx->snapshot_base, mark_func);
 }
 
 void JS_FreeContext(JSContext *ctx)
@@ -2339,6 +3086,9 @@ void JS_FreeContext(JSContext *ctx)
     JSRuntime *rt = ctx->rt;
     int i;
 
+    /* the context is released with the runtime */
+    if (rt->is_arena)
+        return;
     if (--ctx->header.ref_count > 0)
         return;
     assert(ctx->header.ref_count == 0);
@@ -2355,6 +3105,7 @@ void JS_FreeContext(JSContext *ctx)
         JSGCObjectHeader *p;
         printf("JSObjects: {\n");
         JS_DumpObjectHeader(ctx->rt);
+        gc_merge_young(rt);
         list_for_each(el, &rt->gc_obj_list) {
             p = list_entry(el, JSGCObjectHeader, link);
             JS_DumpGCObject(rt, p);
@@ -2372,6 +3123,11 @@ void JS_FreeContext(JSContext *ctx)
 
     js_free_modules(ctx, JS_FREE_MODULE_ALL);
 
+    if (ctx->snapshot_base) {
+        js_snapshot_base_free(rt, ctx->snapshot_base);
+        ctx->snapshot_base = NULL;
+    }
+
     JS_FreeValue(ctx, ctx->global_obj);
     JS_FreeValue(ctx, ctx->global_var_obj);
 
@@ -2520,6 +3276,12 @@ static inline uint32_t hash_string8(const uint8_t *str, size_t len, uint32_t h)
     return h;
 }
 
+/* hash of a binary buffer (serialized objects, snapshots) */
+static uint32_t js_hash_buf(const uint8_t *buf, size_t len)
+{
+    return hash_string8(buf, len, (uint32_t)len);
+}
+
 static inline uint32_t hash_string16(const uint16_t *str,
                                      size_t len, uint32_t h)
 {
@@ -2847,31 +3609,18 @@ static JSAtom __JS_NewAtom(JSRuntime *rt, JSString *str, int atom_type)
             p = str;
             p->atom_type = atom_type;
         } else {
-            p = js_malloc_rt(rt, sizeof(JSString) +
-                             (str->len << str->is_wide_char) +
-                             1 - str->is_wide_char);
+            p = js_alloc_string_rt(rt, str->len, str->is_wide_char);
             if (unlikely(!p))
                 goto fail;
-            p->header.ref_count = 1;
-            p->is_wide_char = str->is_wide_char;
-            p->len = str->len;
-#ifdef DUMP_LEAKS
-            list_add_tail(&p->link, &rt->string_list);
-#endif
             memcpy(p->u.str8, str->u.str8, (str->len << str->is_wide_char) +
                    1 - str->is_wide_char);
             js_free_string(rt, str);
         }
     } else {
-        p = js_malloc_rt(rt, sizeof(JSAtomStruct)); /* empty wide string */
+        /* Hack to represent NULL as a JSString: empty wide string */
+        p = js_alloc_string_rt(rt, 0, 1);
         if (!p)
             return JS_ATOM_NULL;
-        p->header.ref_count = 1;
-        p->is_wide_char = 1;    /* Hack to represent NULL as a JSString */
-        p->len = 0;
-#ifdef DUMP_LEAKS
-        list_add_tail(&p->link, &rt->string_list);
-#endif
     }
 
     /* use an already free entry */
@@ -2986,7 +3735,7 @@ static void JS_FreeAtomStruct(JSRuntime *rt, JSAtomStruct *p)
         /* live weak references are still present on this object: keep
            it */
     } else {
-        js_free_rt(rt, p);
+        js_free_string_struct(rt, p);
     }
     rt->atom_count--;
     assert(rt->atom_count >= 0);
@@ -3583,7 +4332,7 @@ static int string_buffer_init2(JSContext *ctx, StringBuffer *s, int size,
     s->len = 0;
     s->is_wide_char = is_wide;
     s->error_status = 0;
-    s->str = js_alloc_string(ctx, size, is_wide);
+    s->str = js_alloc_string2(ctx, size, is_wide, TRUE);
     if (unlikely(!s->str)) {
         s->size = 0;
         return s->error_status = -1;
@@ -3619,7 +4368,6 @@ static no_inline int string_buffer_widen(StringBuffer *s, int size)
 {
     JSString *str;
     size_t slack;
-    int i;
 
     if (s->error_status)
         return -1;
@@ -3628,9 +4376,7 @@ static no_inline int string_buffer_widen(StringBuffer *s, int size)
     if (!str)
         return string_buffer_set_error(s);
     size += slack >> 1;
-    for(i = s->len; i-- > 0;) {
-        str->u.str16[i] = str->u.str8[i];
-    }
+    memcpy8to16(str->u.str16, str->u.str8, s->len);
     s->is_wide_char = 1;
     s->size = size;
     s->str = str;
@@ -3766,16 +4512,12 @@ static int string_getc(const JSString *p, int *pidx)
 
 static int string_buffer_write8(StringBuffer *s, const uint8_t *p, int len)
 {
-    int i;
-
     if (s->len + len > s->size) {
         if (string_buffer_realloc(s, s->len + len, 0))
             return -1;
     }
     if (s->is_wide_char) {
-        for (i = 0; i < len; i++) {
-            s->str->u.str16[s->len + i] = p[i];
-        }
+        memcpy8to16(s->str->u.str16 + s->len, p, len);
         s->len += len;
     } else {
         memcpy(&s->str->u.str8[s->len], p, len);
@@ -3896,6 +4638,9 @@ static int string_buffer_fill(StringBuffer *s, int c, int count)
 static JSValue string_buffer_end(StringBuffer *s)
 {
     JSString *str;
+#ifdef CONFIG_SLAB_ALLOC
+    size_t size;
+#endif
     str = s->str;
     if (s->error_status)
         return JS_EXCEPTION;
@@ -3904,6 +4649,23 @@ static JSValue string_buffer_end(StringBuffer *s)
         s->str = NULL;
         return JS_AtomToString(s->ctx, JS_ATOM_empty_string);
     }
+#ifdef CONFIG_SLAB_ALLOC
+    size = sizeof(JSString) + (s->len << s->is_wide_char) + 1 - s->is_wide_char;
+    if (size <= JS_SLAB_MAX_SIZE) {
+        /* copy the short strings to a slab block */
+        str = js_alloc_string_rt(s->ctx->rt, s->len, s->is_wide_char);
+        if (str) {
+            if (!s->is_wide_char)
+                s->str->u.str8[s->len] = 0;
+            memcpy(str->u.str8, s->str->u.str8, size - sizeof(JSString));
+            js_free(s->ctx, s->str);
+            s->str = NULL;
+            return JS_MKPTR(JS_TAG_STRING, str);
+        }
+        /* otherwise keep the buffer */
+        str = s->str;
+    } else
+#endif
     if (s->len < s->size) {
         /* smaller size so js_realloc should not fail, but OK if it does */
         /* XXX: should add some slack to avoid unnecessary calls */
@@ -4081,7 +4843,8 @@ const char *JS_ToCStringLen2(JSContext *ctx, size_t *plen, JSValueConst val1, BO
         /* Allocate 3 bytes per 16 bit code point. Surrogate pairs may
            produce 4 bytes but use 2 code points.
          */
-        str_new = js_alloc_string(ctx, len * 3, 0);
+        /* the length is updated at the end */
+        str_new = js_alloc_string2(ctx, len * 3, 0, TRUE);
         if (!str_new)
             goto fail;
         q = str_new->u.str8;
@@ -4133,28 +4896,6 @@ void JS_FreeCString(JSContext *ctx, const char *ptr)
     JS_FreeValue(ctx, JS_MKPTR(JS_TAG_STRING, p));
 }
 
-static int memcmp16_8(const uint16_t *src1, const uint8_t *src2, int len)
-{
-    int c, i;
-    for(i = 0; i < len; i++) {
-        c = src1[i] - src2[i];
-        if (c != 0)
-            return c;
-    }
-    return 0;
-}
-
-static int memcmp16(const uint16_t *src1, const uint16_t *src2, int len)
-{
-    int c, i;
-    for(i = 0; i < len; i++) {
-        c = src1[i] - src2[i];
-        if (c != 0)
-            return c;
-    }
-    return 0;
-}
-
 static int js_string_memcmp(const JSString *p1, int pos1, const JSString *p2,
                             int pos2, int len)
 {
@@ -4207,11 +4948,7 @@ static void copy_str16(uint16_t *dst, const JSString *p, int offset, int len)
     if (p->is_wide_char) {
         memcpy(dst, p->u.str16 + offset, len * 2);
     } else {
-        const uint8_t *src1 = p->u.str8 + offset;
-        int i;
-
-        for(i = 0; i < len; i++)
-            dst[i] = src1[i];
+        memcpy8to16(dst, p->u.str8 + offset, len);
     }
 }
 
@@ -4249,7 +4986,13 @@ static BOOL JS_ConcatStringInPlace(JSContext *ctx, JSString *p1, JSValueConst op
             return TRUE;
         if (p1->header.ref_count != 1)
             return FALSE;
-        size1 = js_malloc_usable_size(ctx, p1);
+        if (p1->is_slab) {
+            /* the string must stay in the same size class */
+            size1 = sizeof(*p1) + (p1->len << p1->is_wide_char) + 1 - p1->is_wide_char;
+            size1 = (size1 + (1 << JS_SLAB_SHIFT) - 1) & ~((1 << JS_SLAB_SHIFT) - 1);
+        } else {
+            size1 = js_malloc_usable_size(ctx, p1);
+        }
         if (p1->is_wide_char) {
             if (size1 >= sizeof(*p1) + ((p1->len + p2->len) << 1)) {
                 if (p2->is_wide_char) {
@@ -4257,10 +5000,8 @@ static BOOL JS_ConcatStringInPlace(JSContext *ctx, JSString *p1, JSValueConst op
                     p1->len += p2->len;
                     return TRUE;
                 } else {
-                    size_t i;
-                    for (i = 0; i < p2->len; i++) {
-                        p1->u.str16[p1->len++] = p2->u.str8[i];
-                    }
+                    memcpy8to16(p1->u.str16 + p1->len, p2->u.str8, p2->len);
+                    p1->len += p2->len;
                     return TRUE;
                 }
             }
@@ -4805,14 +5546,16 @@ static inline JSShape *js_new_shape_nohash(JSContext *ctx, JSObject *proto,
     void *sh_alloc;
     JSShape *sh;
 
-    sh_alloc = js_malloc(ctx, get_shape_size(hash_size, prop_size));
+    sh_alloc = js_slab_alloc(ctx, get_shape_size(hash_size, prop_size));
     if (!sh_alloc)
         return NULL;
     sh = get_shape_from_alloc(sh_alloc, hash_size);
     sh->header.ref_count = 1;
     add_gc_object(rt, &sh->header, JS_GC_OBJ_TYPE_SHAPE);
-    if (proto)
+    if (proto) {
         JS_DupValue(ctx, JS_MKPTR(JS_TAG_OBJECT, proto));
+        proto->is_prototype = TRUE;
+    }
     sh->proto = proto;
     memset(prop_hash_end(sh) - hash_size, 0, sizeof(prop_hash_end(sh)[0]) *
            hash_size);
@@ -4865,7 +5608,7 @@ static JSShape *js_clone_shape(JSContext *ctx, JSShape *sh1)
 
     hash_size = sh1->prop_hash_mask + 1;
     size = get_shape_size(hash_size, sh1->prop_size);
-    sh_alloc = js_malloc(ctx, size);
+    sh_alloc = js_slab_alloc(ctx, size);
     if (!sh_alloc)
         return NULL;
     sh_alloc1 = get_alloc_from_shape(sh1);
@@ -4889,6 +5632,13 @@ static JSShape *js_dup_shape(JSShape *sh)
     return sh;
 }
 
+/* free the memory of the shape structure */
+static void js_free_shape_struct(JSRuntime *rt, JSShape *sh)
+{
+    js_slab_free_rt(rt, get_alloc_from_shape(sh),
+                    get_shape_size(sh->prop_hash_mask + 1, sh->prop_size));
+}
+
 static void js_free_shape0(JSRuntime *rt, JSShape *sh)
 {
     uint32_t i;
@@ -4906,7 +5656,7 @@ static void js_free_shape0(JSRuntime *rt, JSShape *sh)
         pr++;
     }
     remove_gc_object(&sh->header);
-    js_free_rt(rt, get_alloc_from_shape(sh));
+    js_free_shape_struct(rt, sh);
 }
 
 static void js_free_shape(JSRuntime *rt, JSShape *sh)
@@ -4922,6 +5672,237 @@ static void js_free_shape_null(JSRuntime *rt, JSShape *sh)
         js_free_shape(rt, sh);
 }
 
+/* modification of the properties or of the prototype of 'p' */
+static inline void js_update_proto_epoch(JSRuntime *rt, JSObject *p)
+{
+    if (unlikely(p->is_prototype))
+        rt->proto_epoch++;
+}
+
+/* return the cached property of 'p' or NULL if none */
+static inline JSProperty *js_ic_find(JSRuntime *rt, JSFunctionBytecode *b,
+                                     int ic_idx, JSObject *p)
+{
+    JSInlineCache *ic;
+    JSInlineCacheEntry *e;
+    int i;
+
+    if (unlikely(!b->ic) || ic_idx >= b->ic_count)
+        return NULL;
+    ic = &b->ic[ic_idx];
+    for(i = 0; i < ic->count; i++) {
+        e = &ic->entries[i];
+        if (e->shape == p->shape) {
+            if (likely(!e->holder))
+                return &p->prop[e->prop_idx];
+            /* exotic objects may share the shape of ordinary ones */
+            if (e->proto_epoch == rt->proto_epoch && !p->is_exotic)
+                return &e->holder->prop[e->prop_idx];
+            break;
+        }
+    }
+    return NULL;
+}
+
+/* Only hashed shapes are cached. Once the cache is full, the slot is
+   megamorphic and no more entries are added. 'prs' is the property
+   of 'holder' or of an object of shape 'sh' if holder = NULL. */
+static no_inline void js_ic_add(JSRuntime *rt, JSFunctionBytecode *b,
+                                int ic_idx, JSShape *sh, JSObject *holder,
+                                JSShapeProperty *prs)
+{
+    JSInlineCache *ic;
+    JSInlineCacheEntry *e;
+    int i;
+
+    if (!sh->is_hashed || ic_idx >= b->ic_count)
+        return;
+    if (!b->ic) {
+        b->ic = js_mallocz_rt(rt, sizeof(b->ic[0]) * b->ic_count);
+        if (!b->ic)
+            return;
+    }
+    ic = &b->ic[ic_idx];
+    for(i = 0; i < ic->count; i++) {
+        e = &ic->entries[i];
+        if (e->shape == sh)
+            goto update; /* outdated prototype entry */
+    }
+    if (ic->count >= JS_IC_MAX_ENTRIES)
+        return;
+    e = &ic->entries[ic->count++];
+    e->shape = js_dup_shape(sh);
+ update:
+    e->holder = holder;
+    if (holder) {
+        e->prop_idx = prs - get_shape_prop(holder->shape);
+        e->proto_epoch = rt->proto_epoch;
+    } else {
+        e->prop_idx = prs - get_shape_prop(sh);
+    }
+}
+
+static void js_free_inline_caches(JSRuntime *rt, JSFunctionBytecode *b)
+{
+    JSInlineCache *ic;
+    int i, j;
+
+    for(i = 0; i < b->ic_count; i++) {
+        ic = &b->ic[i];
+        for(j = 0; j < ic->count; j++)
+            js_free_shape(rt, ic->entries[j].shape);
+    }
+    js_free_rt(rt, b->ic);
+    b->ic = NULL;
+}
+
+/* Type feedback: one slot per opcode recording the operand types,
+   accumulating the JS_FEEDBACK_x flags of the operands it has seen.
+   Only used for profiling, see JS_DumpTypeFeedback(). */
+enum {
+    JS_FEEDBACK_INT32       = (1 << 0),
+    JS_FEEDBACK_FLOAT64     = (1 << 1),
+    JS_FEEDBACK_STRING      = (1 << 2),
+    JS_FEEDBACK_OTHER       = (1 << 3), /* any other primitive type */
+    JS_FEEDBACK_OBJECT      = (1 << 4),
+    JS_FEEDBACK_FAST_ARRAY  = (1 << 5),
+    JS_FEEDBACK_TYPED_ARRAY = (1 << 6),
+    /* property access missing a full inline cache */
+    JS_FEEDBACK_MEGAMORPHIC = (1 << 7),
+};
+
+#define JS_FEEDBACK_TYPE_MASK (JS_FEEDBACK_MEGAMORPHIC - 1)
+
+typedef struct JSTypeFeedback {
+    int64_t call_count; /* calls and resumptions of the function */
+    int count; /* number of slots */
+    uint8_t *types; /* count elements, stored after 'pos' */
+    uint32_t pos[0]; /* bytecode position of each slot, sorted */
+} JSTypeFeedback;
+
+static inline int js_feedback_type(JSValueConst val)
+{
+    JSObject *p;
+
+    switch(JS_VALUE_GET_NORM_TAG(val)) {
+    case JS_TAG_INT:
+        return JS_FEEDBACK_INT32;
+    case JS_TAG_FLOAT64:
+        return JS_FEEDBACK_FLOAT64;
+    case JS_TAG_STRING:
+    case JS_TAG_STRING_ROPE:
+        return JS_FEEDBACK_STRING;
+    case JS_TAG_OBJECT:
+        p = JS_VALUE_GET_OBJ(val);
+        if (p->class_id == JS_CLASS_ARRAY && p->fast_array)
+            return JS_FEEDBACK_FAST_ARRAY;
+        if (p->class_id >= JS_CLASS_UINT8C_ARRAY &&
+            p->class_id <= JS_CLASS_FLOAT64_ARRAY)
+            return JS_FEEDBACK_TYPED_ARRAY;
+        return JS_FEEDBACK_OBJECT;
+    default:
+        return JS_FEEDBACK_OTHER;
+    }
+}
+
+/* the opcodes recording the type feedback */
+#define IS_FEEDBACK_OPCODE(op)                                          \
+    ((op) == OP_add || (op) == OP_add_loc || (op) == OP_sub ||          \
+     (op) == OP_mul || (op) == OP_div ||                                \
+     ((op) >= OP_lt && (op) <= OP_strict_neq) ||                        \
+     (op) == OP_get_array_el || (op) == OP_get_array_el2 ||             \
+     (op) == OP_put_array_el || (op) == OP_get_field ||                 \
+     (op) == OP_get_field2 || (op) == OP_get_length ||                  \
+     (op) == OP_put_field || (op) == OP_get_array_el_typed ||           \
+     (op) == OP_put_array_el_typed || (op) == OP_get_length_array ||    \
+     (op) == OP_get_length_string || (op) == OP_lt_if_false8 ||         \
+     (op) == OP_gt_if_false8)
+
+static JSTypeFeedback *js_feedback_new(JSRuntime *rt, JSFunctionBytecode *b);
+
+static no_inline void js_feedback_enter(JSRuntime *rt, JSFunctionBytecode *b)
+{
+    if (!b->feedback) {
+        b->feedback = js_feedback_new(rt, b);
+        if (!b->feedback)
+            return;
+    }
+    b->feedback->call_count++;
+}
+
+/* return the slot of the opcode at position 'pos' or -1 if none */
+static int js_feedback_find(const JSTypeFeedback *fb, uint32_t pos)
+{
+    int a, b, m;
+
+    a = 0;
+    b = fb->count - 1;
+    while (a <= b) {
+        m = (a + b) >> 1;
+        if (fb->pos[m] == pos)
+            return m;
+        if (fb->pos[m] < pos)
+            a = m + 1;
+        else
+            b = m - 1;
+    }
+    return -1;
+}
+
+/* record the operand types of the opcode at 'pc' before it is
+   executed. For the property accesses, also record if the inline
+   cache misses while it is full. */
+static no_inline void js_feedback_record(JSRuntime *rt, JSFunctionBytecode *b,
+                                         const uint8_t *pc, JSValue *sp,
+                                         JSValue *var_buf)
+{
+    JSValueConst obj, prop;
+    int op, flags, ic_idx, idx;
+
+    idx = js_feedback_find(b->feedback, pc - b->byte_code_buf);
+    if (idx < 0)
+        return;
+    op = js_unfuse_op(*pc);
+    switch(op) {
+    case OP_add_loc:
+        flags = js_feedback_type(var_buf[pc[1]]) | js_feedback_type(sp[-1]);
+        break;
+    case OP_get_array_el:
+    case OP_get_array_el2:
+    case OP_put_array_el:
+        if (op == OP_put_array_el) {
+            obj = sp[-3];
+            prop = sp[-2];
+        } else {
+            obj = sp[-2];
+            prop = sp[-1];
+        }
+        /* the int32 indexes are not recorded */
+        flags = js_feedback_type(obj);
+        if (JS_VALUE_GET_TAG(prop) != JS_TAG_INT)
+            flags |= js_feedback_type(prop);
+        break;
+    case OP_get_field:
+    case OP_get_field2:
+    case OP_get_length:
+    case OP_put_field:
+        obj = (op == OP_put_field) ? sp[-2] : sp[-1];
+        flags = js_feedback_type(obj);
+        if (op != OP_get_length && JS_VALUE_GET_TAG(obj) == JS_TAG_OBJECT) {
+            ic_idx = get_u16(pc + 5);
+            if (ic_idx >= b->ic_count ||
+                (b->ic && b->ic[ic_idx].count == JS_IC_MAX_ENTRIES &&
+                 !js_ic_find(rt, b, ic_idx, JS_VALUE_GET_OBJ(obj))))
+                flags |= JS_FEEDBACK_MEGAMORPHIC;
+        }
+        break;
+    default: /* binary operators */
+        flags = js_feedback_type(sp[-2]) | js_feedback_type(sp[-1]);
+        break;
+    }
+    b->feedback->types[idx] |= flags;
+}
+
 /* make space to hold at least 'count' properties */
 static no_inline int resize_properties(JSContext *ctx, JSShape **psh,
                                        JSObject *p, uint32_t count)
@@ -4950,7 +5931,7 @@ static no_inline int resize_properties(JSContext *ctx, JSShape **psh,
     /* resize the property shapes. Using js_realloc() is not possible in
        case the GC runs during the allocation */
     old_sh = sh;
-    sh_alloc = js_malloc(ctx, get_shape_size(new_hash_size, new_size));
+    sh_alloc = js_slab_alloc(ctx, get_shape_size(new_hash_size, new_size));
     if (!sh_alloc)
         return -1;
     sh = get_shape_from_alloc(sh_alloc, new_hash_size);
@@ -4978,7 +5959,7 @@ static no_inline int resize_properties(JSContext *ctx, JSShape **psh,
         memcpy(prop_hash_end(sh) - new_hash_size, prop_hash_end(old_sh) - new_hash_size,
                sizeof(prop_hash_end(sh)[0]) * new_hash_size);
     }
-    js_free(ctx, get_alloc_from_shape(old_sh));
+    js_free_shape_struct(ctx->rt, old_sh);
     *psh = sh;
     sh->prop_size = new_size;
     return 0;
@@ -5008,7 +5989,7 @@ static int compact_properties(JSContext *ctx, JSObject *p)
 
     /* resize the hash table and the properties */
     old_sh = sh;
-    sh_alloc = js_malloc(ctx, get_shape_size(new_hash_size, new_size));
+    sh_alloc = js_slab_alloc(ctx, get_shape_size(new_hash_size, new_size));
     if (!sh_alloc)
         return -1;
     sh = get_shape_from_alloc(sh_alloc, new_hash_size);
@@ -5043,7 +6024,7 @@ static int compact_properties(JSContext *ctx, JSObject *p)
     sh->prop_count = j;
 
     p->shape = sh;
-    js_free(ctx, get_alloc_from_shape(old_sh));
+    js_free_shape_struct(ctx->rt, old_sh);
 
     /* reduce the size of the object properties */
     new_prop = js_realloc(ctx, p->prop, sizeof(new_prop[0]) * new_size);
@@ -5180,6 +6161,7 @@ static __maybe_unused void JS_DumpShapes(JSRuntime *rt)
         }
     }
     /* dump non-hashed shapes */
+    gc_merge_young(rt);
     list_for_each(el, &rt->gc_obj_list) {
         gp = list_entry(el, JSGCObjectHeader, link);
         if (gp->gc_obj_type == JS_GC_OBJ_TYPE_JS_OBJECT) {
@@ -5201,7 +6183,7 @@ static JSValue JS_NewObjectFromShape(JSContext *ctx, JSShape *sh, JSClassID clas
     int i;
     
     js_trigger_gc(ctx->rt, sizeof(JSObject));
-    p = js_malloc(ctx, sizeof(JSObject));
+    p = js_slab_alloc(ctx, sizeof(JSObject));
     if (unlikely(!p))
         goto fail;
     p->class_id = class_id;
@@ -5219,7 +6201,7 @@ static JSValue JS_NewObjectFromShape(JSContext *ctx, JSShape *sh, JSClassID clas
     p->shape = sh;
     p->prop = js_malloc(ctx, sizeof(JSProperty) * sh->prop_size);
     if (unlikely(!p->prop)) {
-        js_free(ctx, p);
+        js_slab_free_rt(ctx->rt, p, sizeof(JSObject));
     fail:
         if (props) {
             JSShapeProperty *prs = get_shape_prop(sh);
@@ -5762,7 +6744,7 @@ static void free_var_ref(JSRuntime *rt, JSVarRef *var_ref)
                 }
             }
             remove_gc_object(&var_ref->header);
-            js_free_rt(rt, var_ref);
+            js_slab_free_rt(rt, var_ref, sizeof(JSVarRef));
         }
     }
 }
@@ -5959,7 +6941,7 @@ static void free_object(JSRuntime *rt, JSObject *p)
     remove_gc_object(&p->header);
     if (rt->gc_phase == JS_GC_PHASE_REMOVE_CYCLES) {
         if (p->header.ref_count == 0 && p->weakref_count == 0) {
-            js_free_rt(rt, p);
+            js_slab_free_rt(rt, p, sizeof(JSObject));
         } else {
             /* keep the object structure because there are may be
                references to it */
@@ -5968,13 +6950,29 @@ static void free_object(JSRuntime *rt, JSObject *p)
     } else {
         /* keep the object structure in case there are weak references to it */
         if (p->weakref_count == 0) {
-            js_free_rt(rt, p);
+            js_slab_free_rt(rt, p, sizeof(JSObject));
         } else {
             p->header.mark = 0; /* reset the mark so that the weakref can be freed */
         }
     }
 }
 
+/* free the memory of a GC object whose fields are already freed */
+static void free_gc_object_struct(JSRuntime *rt, JSGCObjectHeader *gp)
+{
+    switch(gp->gc_obj_type) {
+    case JS_GC_OBJ_TYPE_JS_OBJECT:
+        js_slab_free_rt(rt, gp, sizeof(JSObject));
+        break;
+    case JS_GC_OBJ_TYPE_ASYNC_FUNCTION:
+        js_slab_free_rt(rt, gp, ((JSAsyncFunctionState *)gp)->alloc_size);
+        break;
+    default:
+        js_free_rt(rt, gp);
+        break;
+    }
+}
+
 static void free_gc_object(JSRuntime *rt, JSGCObjectHeader *gp)
 {
     switch(gp->gc_obj_type) {
@@ -5995,6 +6993,20 @@ static void free_gc_object(JSRuntime *rt, JSGCObjectHeader *gp)
     }
 }
 
+/* called in JS_GC_PHASE_REMOVE_CYCLES when the ref_count of 'p'
+   reaches zero. The objects of the freed cycles have mark = 1. The
+   other ones can only be old objects which were not collected by a
+   minor GC and whose last reference came from a freed cycle. They are
+   freed by gc_free_cycles() with the cycles. */
+static void gc_free_outside_cycles(JSRuntime *rt, JSGCObjectHeader *p)
+{
+    if (p->mark == 0) {
+        list_del(&p->link);
+        list_add_tail(&p->link, &rt->tmp_obj_list);
+        p->mark = 1;
+    }
+}
+
 static void free_zero_refcount(JSRuntime *rt)
 {
     struct list_head *el;
@@ -6039,7 +7051,7 @@ void __JS_FreeValueRT(JSRuntime *rt, JSValue v)
 #ifdef DUMP_LEAKS
                 list_del(&p->link);
 #endif
-                js_free_rt(rt, p);
+                js_free_string_struct(rt, p);
             }
         }
         break;
@@ -6064,6 +7076,8 @@ void __JS_FreeValueRT(JSRuntime *rt, JSValue v)
                 if (rt->gc_phase == JS_GC_PHASE_NONE) {
                     free_zero_refcount(rt);
                 }
+            } else {
+                gc_free_outside_cycles(rt, p);
             }
         }
         break;
@@ -6125,8 +7139,14 @@ static void add_gc_object(JSRuntime *rt, JSGCObjectHeader *h,
                           JSGCObjectTypeEnum type)
 {
     h->mark = 0;
+    h->young = 0;
     h->gc_obj_type = type;
-    list_add_tail(&h->link, &rt->gc_obj_list);
+    if (rt->gc_pause_budget != 0) {
+        list_add_tail(&h->link, &rt->gc_young_obj_list);
+        rt->gc_young_count++;
+    } else {
+        list_add_tail(&h->link, &rt->gc_obj_list);
+    }
 }
 
 static void remove_gc_object(JSGCObjectHeader *h)
@@ -6202,6 +7222,14 @@ static void mark_children(JSRuntime *rt, JSGCObjectHeader *gp,
             for(i = 0; i < b->cpool_count; i++) {
                 JS_MarkValue(rt, b->cpool[i], mark_func);
             }
+            if (b->ic) {
+                int j;
+                for(i = 0; i < b->ic_count; i++) {
+                    JSInlineCache *ic = &b->ic[i];
+                    for(j = 0; j < ic->count; j++)
+                        mark_func(rt, &ic->entries[j].shape->header);
+                }
+            }
             if (b->realm)
                 mark_func(rt, &b->realm->header);
         }
@@ -6389,15 +7417,139 @@ static void gc_free_cycles(JSRuntime *rt)
             /* keep the object because there are weak references to it */
             p->mark = 0;
         } else {
-            js_free_rt(rt, p);
+            free_gc_object_struct(rt, p);
         }
     }
 
     init_list_head(&rt->gc_zero_ref_count_list);
 }
 
+/* Generational GC: the GC objects allocated since the last GC are in
+   gc_young_obj_list. A minor GC does the same trial deletion as a
+   full GC but only on the young objects and on the 'gc_old_slice'
+   oldest objects of gc_obj_list. The references coming from the
+   objects outside of this set are handled as external references, so
+   the collection is safe. The cycles going through objects outside of
+   the set are freed by a later minor GC or by a full GC. The
+   survivors are appended to gc_obj_list, so that the old objects are
+   scanned in a round robin way. */
+
+static void gc_decref_child_young(JSRuntime *rt, JSGCObjectHeader *p)
+{
+    if (p->young)
+        gc_decref_child(rt, p);
+}
+
+static void gc_scan_incref_child_young(JSRuntime *rt, JSGCObjectHeader *p)
+{
+    if (p->young) {
+        p->ref_count++;
+        if (p->ref_count == 1) {
+            list_del(&p->link);
+            list_add_tail(&p->link, &rt->gc_young_obj_list);
+            p->mark = 0;
+        }
+    }
+}
+
+static void gc_scan_incref_child2_young(JSRuntime *rt, JSGCObjectHeader *p)
+{
+    if (p->young)
+        p->ref_count++;
+}
+
+static int64_t gc_get_time_us(void)
+{
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return (int64_t)tv.tv_sec * 1000000 + tv.tv_usec;
+}
+
+static void gc_minor(JSRuntime *rt)
+{
+    struct list_head *el, *el1;
+    JSGCObjectHeader *p;
+    int64_t t;
+    int count, old_count, cost;
+
+    t = gc_get_time_us();
+    gc_remove_weak_objects(rt);
+
+    /* add the oldest objects */
+    old_count = 0;
+    list_for_each_safe(el, el1, &rt->gc_obj_list) {
+        if (old_count >= rt->gc_old_slice)
+            break;
+        list_del(el);
+        list_add_tail(el, &rt->gc_young_obj_list);
+        old_count++;
+    }
+
+    count = 0;
+    list_for_each(el, &rt->gc_young_obj_list) {
+        p = list_entry(el, JSGCObjectHeader, link);
+        p->young = 1;
+        count++;
+    }
+
+    init_list_head(&rt->tmp_obj_list);
+    list_for_each_safe(el, el1, &rt->gc_young_obj_list) {
+        p = list_entry(el, JSGCObjectHeader, link);
+        assert(p->mark == 0);
+        mark_children(rt, p, gc_decref_child_young);
+        p->mark = 1;
+        if (p->ref_count == 0) {
+            list_del(&p->link);
+            list_add_tail(&p->link, &rt->tmp_obj_list);
+        }
+    }
+
+    list_for_each(el, &rt->gc_young_obj_list) {
+        p = list_entry(el, JSGCObjectHeader, link);
+        assert(p->ref_count > 0);
+        p->mark = 0;
+        mark_children(rt, p, gc_scan_incref_child_young);
+    }
+    list_for_each(el, &rt->tmp_obj_list) {
+        p = list_entry(el, JSGCObjectHeader, link);
+        mark_children(rt, p, gc_scan_incref_child2_young);
+    }
+    list_for_each(el, &rt->tmp_obj_list) {
+        p = list_entry(el, JSGCObjectHeader, link);
+        p->young = 0;
+    }
+
+    gc_free_cycles(rt);
+
+    /* the survivors become old */
+    rt->gc_old_count -= old_count;
+    list_for_each(el, &rt->gc_young_obj_list) {
+        p = list_entry(el, JSGCObjectHeader, link);
+        p->young = 0;
+        rt->gc_old_count++;
+    }
+    list_splice_tail(&rt->gc_young_obj_list, &rt->gc_obj_list);
+    rt->gc_young_count = 0;
+
+    if (rt->gc_major_remaining != 0) {
+        rt->gc_major_remaining = max_int(rt->gc_major_remaining - old_count, 0);
+        if (rt->gc_major_remaining == 0) {
+            /* all the old objects have been scanned */
+            rt->malloc_gc_threshold = js_get_used_size(rt) +
+                (js_get_used_size(rt) >> 1);
+        }
+    }
+
+    /* adapt the size of the collected set to the pause budget */
+    cost = (gc_get_time_us() - t) * 1000 / max_int(count, 1);
+    rt->gc_minor_cost = max_int((rt->gc_minor_cost * 3 + cost) / 4, 1);
+    gc_update_young_limit(rt);
+}
+
 static void JS_RunGCInternal(JSRuntime *rt, BOOL remove_weak_objects)
 {
+    gc_merge_young(rt);
+
     if (remove_weak_objects) {
         /* free the weakly referenced object or symbol structures, delete
            the associated Map/Set entries and queue the finalization
@@ -6414,6 +7566,13 @@ static void JS_RunGCInternal(JSRuntime *rt, BOOL remove_weak_objects)
 
     /* free the GC objects in a cycle */
     gc_free_cycles(rt);
+
+    if (rt->gc_pause_budget != 0) {
+        rt->gc_major_remaining = 0;
+        rt->gc_old_count = gc_count_old(rt);
+        rt->gc_full_threshold = js_get_used_size(rt) * 2;
+        gc_update_young_limit(rt);
+    }
 }
 
 void JS_RunGC(JSRuntime *rt)
@@ -6421,6 +7580,16 @@ void JS_RunGC(JSRuntime *rt)
     JS_RunGCInternal(rt, TRUE);
 }
 
+/* collect the young objects and a slice of the old ones. Same as
+   JS_RunGC() if the generational GC is disabled. */
+void JS_RunMinorGC(JSRuntime *rt)
+{
+    if (rt->gc_pause_budget != 0)
+        gc_minor(rt);
+    else
+        JS_RunGC(rt);
+}
+
 /* Return false if not an object or if the object has already been
    freed (zombie objects are visible in finalizers when freeing
    cycles). */
@@ -6477,6 +7646,19 @@ static void compute_bytecode_size(JSFunctionBytecode *b, JSMemoryUsage_helper *h
     if (b->closure_var) {
         js_func_size += b->closure_var_count * sizeof(*b->closure_var);
     }
+    if (b->ic) {
+        memory_used_count++;
+        js_func_size += b->ic_count * sizeof(*b->ic);
+    }
+    if (b->global_var_cache) {
+        memory_used_count++;
+        js_func_size += b->closure_var_count * sizeof(*b->global_var_cache);
+    }
+    if (b->feedback) {
+        memory_used_count++;
+        js_func_size += sizeof(*b->feedback) +
+            b->feedback->count * (sizeof(b->feedback->pos[0]) + 1);
+    }
     if (!b->read_only_bytecode && b->byte_code_buf) {
         hp->js_func_code_size += b->byte_code_len;
     }
@@ -6520,6 +7702,20 @@ void JS_ComputeMemoryUsage(JSRuntime *rt, JSMemoryUsage *s)
     s->malloc_size = rt->malloc_state.malloc_size;
     s->malloc_limit = rt->malloc_state.malloc_limit;
 
+#ifdef CONFIG_SLAB_ALLOC
+    for(i = 0; i < JS_SLAB_CLASS_COUNT; i++) {
+        JSSlabClass *sc = &rt->slab_classes[i];
+        size_t block_size = js_slab_block_size(i);
+        s->slab_chunk_count += sc->chunk_count;
+        s->slab_block_size[i] = block_size;
+        s->slab_used_count[i] = sc->used_count;
+        s->slab_free_count[i] = (int64_t)sc->chunk_count *
+            ((JS_SLAB_CHUNK_SIZE - JS_SLAB_CHUNK_HEADER_SIZE) / block_size) -
+            sc->used_count;
+    }
+    s->slab_chunk_size = s->slab_chunk_count * JS_SLAB_CHUNK_SIZE;
+#endif
+
     s->memory_used_count = 2; /* rt + rt->class_array */
     s->memory_used_size = sizeof(JSRuntime) + sizeof(JSValue) * rt->class_count;
 
@@ -6571,6 +7767,7 @@ void JS_ComputeMemoryUsage(JSRuntime *rt, JSMemoryUsage *s)
         }
     }
 
+    gc_merge_young(rt);
     list_for_each(el, &rt->gc_obj_list) {
         JSGCObjectHeader *gp = list_entry(el, JSGCObjectHeader, link);
         JSObject *p;
@@ -6842,6 +8039,7 @@ void JS_DumpMemoryUsage(FILE *fp, const JSMemoryUsage *s, JSRuntime *rt)
             int obj_classes[JS_CLASS_INIT_COUNT + 1] = { 0 };
             int class_id;
             struct list_head *el;
+            gc_merge_young(rt);
             list_for_each(el, &rt->gc_obj_list) {
                 JSGCObjectHeader *gp = list_entry(el, JSGCObjectHeader, link);
                 JSObject *p;
@@ -6928,6 +8126,22 @@ void JS_DumpMemoryUsage(FILE *fp, const JSMemoryUsage *s, JSRuntime *rt)
         fprintf(fp, "%-20s %8"PRId64" %8"PRId64"\n",
                 "binary objects", s->binary_object_count, s->binary_object_size);
     }
+    if (s->slab_chunk_count) {
+        char buf[32];
+        int i;
+        fprintf(fp, "%-20s %8"PRId64" %8"PRId64"\n",
+                "slab chunks", s->slab_chunk_count, s->slab_chunk_size);
+        for(i = 0; i < JS_SLAB_CLASS_COUNT; i++) {
+            if (s->slab_used_count[i] == 0 && s->slab_free_count[i] == 0)
+                continue;
+            snprintf(buf, sizeof(buf), "  %d byte blocks",
+                     (int)s->slab_block_size[i]);
+            fprintf(fp, "%-20s %8"PRId64" %8"PRId64"  (%"PRId64" free)\n",
+                    buf, s->slab_used_count[i],
+                    s->slab_used_count[i] * s->slab_block_size[i],
+                    s->slab_free_count[i]);
+        }
+    }
 }
 
 JSValue JS_GetGlobalObject(JSContext *ctx)
@@ -7219,6 +8433,24 @@ JSValue JS_NewError(JSContext *ctx)
     return JS_NewObjectClass(ctx, JS_CLASS_ERROR);
 }
 
+/* Return a new error object with the prototype of the native error
+   'name' (e.g. "TypeError") of this context, or JS_UNDEFINED if
+   'name' is not a native error name. */
+JSValue JS_NewNativeError(JSContext *ctx, const char *name)
+{
+    char buf[ATOM_GET_STR_BUF_SIZE];
+    int i;
+
+    for(i = 0; i < JS_NATIVE_ERROR_COUNT; i++) {
+        if (!strcmp(name, JS_AtomGetStr(ctx, buf, sizeof(buf),
+                                        JS_ATOM_EvalError + i))) {
+            return JS_NewObjectProtoClass(ctx, ctx->native_error_proto[i],
+                                          JS_CLASS_ERROR);
+        }
+    }
+    return JS_UNDEFINED;
+}
+
 static JSValue JS_ThrowError2(JSContext *ctx, JSErrorEnum error_num,
                               const char *fmt, va_list ap, BOOL add_backtrace)
 {
@@ -7557,6 +8789,7 @@ static int JS_SetPrototypeInternal(JSContext *ctx, JSValueConst obj,
             p1 = p1->shape->proto;
         } while (p1 != NULL);
         JS_DupValue(ctx, proto_val);
+        proto->is_prototype = TRUE;
     }
 
     if (js_shape_prepare_update(ctx, p, NULL))
@@ -8786,6 +10019,7 @@ static JSProperty *add_property(JSContext *ctx,
             }
         }
     }
+    js_update_proto_epoch(ctx->rt, p);
     sh = p->shape;
     if (sh->is_hashed) {
         /* try to find an existing shape */
@@ -9648,6 +10882,108 @@ static int JS_SetPropertyValue(JSContext *ctx, JSValueConst this_obj,
     }
 }
 
+/* fast paths of JS_GetPropertyValue() and JS_SetPropertyValue() used
+   by the quickened typed array opcodes. They return FALSE without
+   side effect if the access needs the generic code, i.e. if 'p' is
+   not a typed array, if 'idx' is out of bounds, if the element is a
+   BigInt or if the value is not a number. */
+static inline BOOL js_get_typed_array_el(JSContext *ctx, JSValue *pval,
+                                         JSObject *p, uint32_t idx)
+{
+    if (unlikely(p->class_id < JS_CLASS_UINT8C_ARRAY ||
+                 p->class_id > JS_CLASS_FLOAT64_ARRAY))
+        return FALSE;
+    if (unlikely(idx >= p->u.array.count))
+        return FALSE;
+    switch(p->class_id) {
+    case JS_CLASS_INT8_ARRAY:
+        *pval = JS_NewInt32(ctx, p->u.array.u.int8_ptr[idx]);
+        break;
+    case JS_CLASS_UINT8C_ARRAY:
+    case JS_CLASS_UINT8_ARRAY:
+        *pval = JS_NewInt32(ctx, p->u.array.u.uint8_ptr[idx]);
+        break;
+    case JS_CLASS_INT16_ARRAY:
+        *pval = JS_NewInt32(ctx, p->u.array.u.int16_ptr[idx]);
+        break;
+    case JS_CLASS_UINT16_ARRAY:
+        *pval = JS_NewInt32(ctx, p->u.array.u.uint16_ptr[idx]);
+        break;
+    case JS_CLASS_INT32_ARRAY:
+        *pval = JS_NewInt32(ctx, p->u.array.u.int32_ptr[idx]);
+        break;
+    case JS_CLASS_UINT32_ARRAY:
+        *pval = JS_NewUint32(ctx, p->u.array.u.uint32_ptr[idx]);
+        break;
+    case JS_CLASS_FLOAT16_ARRAY:
+        *pval = __JS_NewFloat64(ctx, fromfp16(p->u.array.u.fp16_ptr[idx]));
+        break;
+    case JS_CLASS_FLOAT32_ARRAY:
+        *pval = __JS_NewFloat64(ctx, p->u.array.u.float_ptr[idx]);
+        break;
+    case JS_CLASS_FLOAT64_ARRAY:
+        *pval = __JS_NewFloat64(ctx, p->u.array.u.double_ptr[idx]);
+        break;
+    default: /* BigInt arrays */
+        return FALSE;
+    }
+    return TRUE;
+}
+
+static inline BOOL js_put_typed_array_el(JSContext *ctx, JSObject *p,
+                                         uint32_t idx, JSValue val)
+{
+    uint32_t tag;
+    int32_t v;
+    double d;
+
+    tag = JS_VALUE_GET_NORM_TAG(val);
+    if (unlikely(tag != JS_TAG_INT && tag != JS_TAG_FLOAT64))
+        return FALSE;
+    if (unlikely(p->class_id < JS_CLASS_UINT8C_ARRAY ||
+                 p->class_id > JS_CLASS_FLOAT64_ARRAY))
+        return FALSE;
+    if (unlikely(idx >= p->u.array.count))
+        return FALSE;
+    /* the conversions of numbers cannot fail */
+    switch(p->class_id) {
+    case JS_CLASS_UINT8C_ARRAY:
+        JS_ToUint8ClampFree(ctx, &v, val);
+        p->u.array.u.uint8_ptr[idx] = v;
+        break;
+    case JS_CLASS_INT8_ARRAY:
+    case JS_CLASS_UINT8_ARRAY:
+        JS_ToInt32Free(ctx, &v, val);
+        p->u.array.u.uint8_ptr[idx] = v;
+        break;
+    case JS_CLASS_INT16_ARRAY:
+    case JS_CLASS_UINT16_ARRAY:
+        JS_ToInt32Free(ctx, &v, val);
+        p->u.array.u.uint16_ptr[idx] = v;
+        break;
+    case JS_CLASS_INT32_ARRAY:
+    case JS_CLASS_UINT32_ARRAY:
+        JS_ToInt32Free(ctx, &v, val);
+        p->u.array.u.uint32_ptr[idx] = v;
+        break;
+    case JS_CLASS_FLOAT16_ARRAY:
+        JS_ToFloat64Free(ctx, &d, val);
+        p->u.array.u.fp16_ptr[idx] = tofp16(d);
+        break;
+    case JS_CLASS_FLOAT32_ARRAY:
+        JS_ToFloat64Free(ctx, &d, val);
+        p->u.array.u.float_ptr[idx] = d;
+        break;
+    case JS_CLASS_FLOAT64_ARRAY:
+        JS_ToFloat64Free(ctx, &d, val);
+        p->u.array.u.double_ptr[idx] = d;
+        break;
+    default: /* BigInt arrays */
+        return FALSE;
+    }
+    return TRUE;
+}
+
 int JS_SetPropertyUint32(JSContext *ctx, JSValueConst this_obj,
                          uint32_t idx, JSValue val)
 {
@@ -9884,6 +11220,7 @@ static int js_shape_prepare_update(JSContext *ctx, JSObject *p,
     JSShape *sh;
     uint32_t idx = 0;    /* prevent warning */
 
+    js_update_proto_epoch(ctx->rt, p);
     sh = p->shape;
     if (sh->is_hashed) {
         if (sh->header.ref_count != 1) {
@@ -16509,6 +17846,63 @@ exception:
     return -1;
 }
 
+/* return TRUE if iterating 'obj' with the array iterator is known to
+   return its elements without side effects, so that it can be used
+   instead of a copy made by the spread syntax */
+static BOOL js_is_fast_array_iterable(JSContext *ctx, JSValueConst obj)
+{
+    JSObject *p, *p1;
+    JSShapeProperty *prs;
+    JSProperty *pr;
+    JSValueConst len;
+    JSCFunctionType ft;
+
+    if (!js_is_fast_array(ctx, obj))
+        return FALSE;
+    p = JS_VALUE_GET_OBJ(obj);
+    len = p->prop[0].u.value;
+    if (JS_VALUE_GET_TAG(len) != JS_TAG_INT ||
+        JS_VALUE_GET_INT(len) != p->u.array.count)
+        return FALSE;
+    p1 = JS_VALUE_GET_OBJ(ctx->class_proto[JS_CLASS_ARRAY]);
+    if (p->shape->proto != p1 ||
+        find_own_property(&pr, p, JS_ATOM_Symbol_iterator))
+        return FALSE;
+    prs = find_own_property(&pr, p1, JS_ATOM_Symbol_iterator);
+    if (!prs || (prs->flags & JS_PROP_TMASK) != JS_PROP_NORMAL ||
+        JS_VALUE_GET_TAG(pr->u.value) != JS_TAG_OBJECT ||
+        JS_VALUE_GET_OBJ(pr->u.value) != JS_VALUE_GET_OBJ(ctx->array_proto_values))
+        return FALSE;
+    p1 = JS_VALUE_GET_OBJ(ctx->class_proto[JS_CLASS_ARRAY_ITERATOR]);
+    prs = find_own_property(&pr, p1, JS_ATOM_next);
+    if (!prs || (prs->flags & JS_PROP_TMASK) != JS_PROP_NORMAL)
+        return FALSE;
+    ft.iterator_next = js_array_iterator_next;
+    return JS_IsCFunction(ctx, pr->u.value, ft.generic, 0);
+}
+
+/* replace sp[-1] by an array containing the values it iterates, unless
+   it can be used directly */
+static __exception int js_spread_array(JSContext *ctx, JSValue *sp)
+{
+    JSValue tab[3];
+
+    if (js_is_fast_array_iterable(ctx, sp[-1]))
+        return 0;
+    tab[0] = JS_NewArray(ctx);
+    if (JS_IsException(tab[0]))
+        return -1;
+    tab[1] = JS_NewInt32(ctx, 0);
+    tab[2] = sp[-1];
+    if (js_append_enumerate(ctx, tab + 3)) {
+        JS_FreeValue(ctx, tab[0]);
+        return -1;
+    }
+    JS_FreeValue(ctx, sp[-1]);
+    sp[-1] = tab[0];
+    return 0;
+}
+
 static __exception int JS_CopyDataProperties(JSContext *ctx,
                                              JSValueConst target,
                                              JSValueConst source,
@@ -16593,7 +17987,7 @@ static JSValueConst JS_GetActiveFunction(JSContext *ctx)
 static JSVarRef *js_create_var_ref(JSContext *ctx, BOOL is_lexical)
 {
     JSVarRef *var_ref;
-    var_ref = js_malloc(ctx, sizeof(JSVarRef));
+    var_ref = js_slab_alloc(ctx, sizeof(JSVarRef));
     if (!var_ref)
         return NULL;
     var_ref->header.ref_count = 1;
@@ -16641,7 +18035,7 @@ static JSVarRef *get_var_ref(JSContext *ctx, JSStackFrame *sf, int var_idx,
     }
 
     /* create a new one */
-    var_ref = js_malloc(ctx, sizeof(JSVarRef));
+    var_ref = js_slab_alloc(ctx, sizeof(JSVarRef));
     if (!var_ref)
         return NULL;
     var_ref->header.ref_count = 1;
@@ -17336,6 +18730,111 @@ static JSValue js_call_bound_function(JSContext *ctx, JSValueConst func_obj,
     }
 }
 
+static JSGlobalVarCache *js_get_global_var_cache(JSContext *ctx,
+                                                 JSFunctionBytecode *b,
+                                                 int idx)
+{
+    JSGlobalVarCache *gc;
+    JSObject *p;
+    JSProperty *pr;
+    JSShapeProperty *prs;
+
+    if (!b->global_var_cache) {
+        b->global_var_cache = js_mallocz_rt(ctx->rt, sizeof(b->global_var_cache[0]) *
+                                            b->closure_var_count);
+        if (!b->global_var_cache)
+            return NULL;
+    }
+    gc = &b->global_var_cache[idx];
+    if (gc->is_valid && gc->proto_epoch == ctx->rt->proto_epoch)
+        return gc;
+    gc->is_valid = FALSE;
+    p = JS_VALUE_GET_OBJ(ctx->global_obj);
+    for(;;) {
+        prs = find_own_property(&pr, p, b->closure_var[idx].var_name);
+        if (prs) {
+            if ((prs->flags & JS_PROP_TMASK) == JS_PROP_GETSET) {
+                gc->is_getset = TRUE;
+            } else if ((prs->flags & JS_PROP_TMASK) == 0) {
+                gc->is_getset = FALSE;
+            } else {
+                return NULL;
+            }
+            gc->prop_idx = prs - get_shape_prop(p->shape);
+            break;
+        }
+        if (p->is_exotic)
+            return NULL;
+        p = p->shape->proto;
+        if (!p)
+            break;
+    }
+    gc->holder = p;
+    gc->proto_epoch = ctx->rt->proto_epoch;
+    gc->is_valid = TRUE;
+    return gc;
+}
+
+/* get_var when the global variable 'idx' is not bound to a variable
+   reference */
+static no_inline JSValue js_get_global_var_slow(JSContext *ctx,
+                                                JSFunctionBytecode *b, int idx,
+                                                BOOL throw_ref_error)
+{
+    JSGlobalVarCache *gc;
+    JSProperty *pr;
+    JSAtom var_name = b->closure_var[idx].var_name;
+
+    gc = js_get_global_var_cache(ctx, b, idx);
+    if (!gc)
+        return JS_GetPropertyInternal(ctx, ctx->global_obj, var_name,
+                                      ctx->global_obj, throw_ref_error);
+    if (!gc->holder) {
+        if (throw_ref_error)
+            return JS_ThrowReferenceErrorNotDefined(ctx, var_name);
+        return JS_UNDEFINED;
+    }
+    pr = &gc->holder->prop[gc->prop_idx];
+    if (gc->is_getset) {
+        if (!pr->u.getset.getter)
+            return JS_UNDEFINED;
+        return JS_CallFree(ctx, JS_DupValue(ctx, JS_MKPTR(JS_TAG_OBJECT, pr->u.getset.getter)),
+                           ctx->global_obj, 0, NULL);
+    } else {
+        return JS_DupValue(ctx, pr->u.value);
+    }
+}
+
+/* put_var when the global variable 'idx' is not bound to a variable
+   reference. Only the setters are handled without a lookup. 'val' is
+   freed. */
+static no_inline int js_put_global_var_slow(JSContext *ctx,
+                                            JSFunctionBytecode *b, int idx,
+                                            JSValue val)
+{
+    JSGlobalVarCache *gc;
+    JSAtom var_name = b->closure_var[idx].var_name;
+    int ret;
+
+    gc = js_get_global_var_cache(ctx, b, idx);
+    if (gc && gc->holder && gc->is_getset) {
+        return call_setter(ctx, gc->holder->prop[gc->prop_idx].u.getset.setter,
+                           ctx->global_obj, val, JS_PROP_THROW_STRICT);
+    }
+    ret = JS_HasProperty(ctx, ctx->global_obj, var_name);
+    if (ret < 0) {
+        JS_FreeValue(ctx, val);
+        return -1;
+    }
+    if (ret == 0 && is_strict_mode(ctx)) {
+        JS_FreeValue(ctx, val);
+        JS_ThrowReferenceErrorNotDefined(ctx, var_name);
+        return -1;
+    }
+    return JS_SetPropertyInternal(ctx, ctx->global_obj, var_name, val,
+                                  ctx->global_obj, JS_PROP_THROW_STRICT);
+}
+
 /* argument of OP_special_object */
 typedef enum {
     OP_SPECIAL_OBJECT_ARGUMENTS,
@@ -17352,7 +18851,38 @@ typedef enum {
 #define FUNC_RET_YIELD_STAR    2
 #define FUNC_RET_INITIAL_YIELD 3
 
+/* ES2015 proper tail call: a call in tail position from a strict mode
+   function to a bytecode function reuses the caller stack frame */
+static inline BOOL js_is_proper_tail_call(JSFunctionBytecode *b,
+                                          JSValueConst func_obj)
+{
+    JSObject *p;
+    if (!(b->js_mode & JS_MODE_STRICT) || b->func_kind != JS_FUNC_NORMAL)
+        return FALSE;
+    if (JS_VALUE_GET_TAG(func_obj) != JS_TAG_OBJECT)
+        return FALSE;
+    p = JS_VALUE_GET_OBJ(func_obj);
+    return p->class_id == JS_CLASS_BYTECODE_FUNCTION;
+}
+
 /* argv[] is modified if (flags & JS_CALL_FLAG_COPY_ARGV) = 0. */
+#ifdef CONFIG_JIT
+/* run the native code if the function is hot */
+#define JIT_ENTER()                                                     \
+    do {                                                                \
+        if (b->jit_code || js_jit_tier_up(ctx, b))                      \
+            sp = js_jit_run(ctx, b, sp, var_buf, arg_buf, &pc);         \
+    } while (0)
+#define JIT_BACKWARD_JUMP(diff)                 \
+    do {                                        \
+        if ((diff) < 0)                         \
+            JIT_ENTER();                        \
+    } while (0)
+#else
+#define JIT_ENTER() do { } while (0)
+#define JIT_BACKWARD_JUMP(diff) do { } while (0)
+#endif
+
 static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
                                JSValueConst this_obj, JSValueConst new_target,
                                int argc, JSValue *argv, int flags)
@@ -17369,10 +18899,17 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
     size_t alloca_size;
 
 #if !DIRECT_DISPATCH
-#define SWITCH(pc)      switch (opcode = *pc++)
+#define SWITCH(pc)                                                      \
+    opcode = *pc++;                                                     \
+    if (unlikely(b->feedback) && IS_FEEDBACK_OPCODE(opcode))            \
+        js_feedback_record(rt, b, pc - 1, sp, var_buf);                 \
+  redispatch:                                                           \
+    switch (opcode)
 #define CASE(op)        case op
 #define DEFAULT         default
 #define BREAK           break
+#define GOTO_CASE(op)   { opcode = op; goto redispatch; }
+#define FUSE_NEXT(op)   BREAK
 #else
     static const void * const dispatch_table[256] = {
 #define DEF(id, size, n_pop, n_push, f) && case_OP_ ## id,
@@ -17384,10 +18921,39 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
 #include "quickjs-opcode.h"
         [ OP_COUNT ... 255 ] = &&case_default
     };
-#define SWITCH(pc)      goto *dispatch_table[opcode = *pc++];
+    /* used when the function records the type feedback so that the
+       other functions are not slowed down */
+    static const void * const feedback_dispatch_table[256] = {
+#define DEF(id, size, n_pop, n_push, f)                                 \
+        IS_FEEDBACK_OPCODE(OP_ ## id) ? && case_feedback : && case_OP_ ## id,
+#if SHORT_OPCODES
+#define def(id, size, n_pop, n_push, f)
+#else
+#define def(id, size, n_pop, n_push, f) && case_default,
+#endif
+#include "quickjs-opcode.h"
+        [ OP_COUNT ... 255 ] = &&case_default
+    };
+    const void * const *dispatch = dispatch_table;
+#define SWITCH(pc)      goto *dispatch[opcode = *pc++];
 #define CASE(op)        case_ ## op
 #define DEFAULT         case_default
 #define BREAK           SWITCH(pc)
+/* execute the opcode 'op' with the operands at 'pc' */
+#define GOTO_CASE(op)   { opcode = op; goto case_ ## op; }
+/* execute the second opcode 'op' of a super-instruction without
+   dispatching, except when the type feedback is recorded */
+#define FUSE_NEXT(op)                                                   \
+    if (likely(dispatch == dispatch_table)) {                           \
+        pc++;                                                           \
+        GOTO_CASE(op);                                                  \
+    }                                                                   \
+    BREAK
+#endif
+#ifdef DUMP_SUPER_INSTRUCTIONS
+#define SUPER_INSN_COUNT() rt->super_insn_count[opcode]++
+#else
+#define SUPER_INSN_COUNT() do { } while (0)
 #endif
 
     if (js_poll_interrupts(caller_ctx))
@@ -17405,6 +18971,7 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
             local_buf = arg_buf = sf->arg_buf;
             var_buf = sf->var_buf;
             stack_buf = sf->var_buf + b->var_count;
+            alloca_size = 0;
             sp = sf->cur_sp;
             sf->cur_sp = NULL; /* cur_sp is NULL if the function is running */
             pc = sf->cur_pc;
@@ -17475,13 +19042,25 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
     sf->prev_frame = rt->current_stack_frame;
     rt->current_stack_frame = sf;
     ctx = b->realm; /* set the current realm */
+    JIT_ENTER();
 
  restart:
+    if (unlikely(rt->type_feedback))
+        js_feedback_enter(rt, b);
+#if DIRECT_DISPATCH
+    if (unlikely(b->feedback))
+        dispatch = feedback_dispatch_table;
+#endif
     for(;;) {
         int call_argc;
         JSValue *call_argv;
 
         SWITCH(pc) {
+#if DIRECT_DISPATCH
+        case_feedback:
+            js_feedback_record(rt, b, pc - 1, sp, var_buf);
+            goto *dispatch_table[opcode];
+#endif
         CASE(OP_push_i32):
             *sp++ = JS_NewInt32(ctx, get_u32(pc));
             pc += 4;
@@ -17793,6 +19372,9 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
                 goto has_call_argc;
             has_call_argc:
                 call_argv = sp - call_argc;
+                if (opcode == OP_tail_call &&
+                    js_is_proper_tail_call(b, call_argv[-1]))
+                    goto tail_call;
                 sf->cur_pc = pc;
                 ret_val = JS_CallInternal(ctx, call_argv[-1], JS_UNDEFINED,
                                           JS_UNDEFINED, call_argc, call_argv, 0);
@@ -17829,6 +19411,9 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
                 call_argc = get_u16(pc);
                 pc += 2;
                 call_argv = sp - call_argc;
+                if (opcode == OP_tail_call_method &&
+                    js_is_proper_tail_call(b, call_argv[-1]))
+                    goto tail_call;
                 sf->cur_pc = pc;
                 ret_val = JS_CallInternal(ctx, call_argv[-1], call_argv[-2],
                                           JS_UNDEFINED, call_argc, call_argv, 0);
@@ -17842,6 +19427,86 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
                 *sp++ = ret_val;
             }
             BREAK;
+        tail_call:
+            /* the frame of the current function is replaced by the
+               frame of the called function. Its layout is: function
+               object, 'this', arguments, variables, stack and
+               variable references. They are all freed at 'done'. */
+            {
+                JSValue *first, func_obj1, this_obj1;
+                JSObject *p1;
+                JSFunctionBytecode *b1;
+                int arg_count1;
+                size_t size;
+
+                if (opcode == OP_tail_call_method) {
+                    this_obj1 = call_argv[-2];
+                    first = call_argv - 2;
+                } else {
+                    this_obj1 = JS_UNDEFINED;
+                    first = call_argv - 1;
+                }
+                func_obj1 = call_argv[-1];
+                p1 = JS_VALUE_GET_OBJ(func_obj1);
+                b1 = p1->u.func.function_bytecode;
+                arg_count1 = max_int(call_argc, b1->arg_count);
+                size = sizeof(JSValue) * (2 + arg_count1 + b1->var_count +
+                                          b1->stack_size) +
+                    sizeof(JSVarRef *) * b1->var_ref_count;
+                if (size > alloca_size && js_check_stack_overflow(rt, size)) {
+                    JS_ThrowStackOverflow(ctx);
+                    goto exception;
+                }
+                if (js_poll_interrupts(ctx))
+                    goto exception;
+
+                /* free the frame of the current function */
+                if (b->var_ref_count != 0)
+                    close_var_refs(rt, b, sf);
+                for(pval = local_buf; pval < first; pval++)
+                    JS_FreeValue(ctx, *pval);
+                if (size > alloca_size) {
+                    /* the previous frame is lost until the function
+                       returns, so the frame only grows a few times */
+                    alloca_size = size;
+                    local_buf = alloca(alloca_size);
+                }
+                memmove(local_buf + 2, call_argv, sizeof(JSValue) * call_argc);
+                local_buf[0] = func_obj1;
+                local_buf[1] = this_obj1;
+
+                p = p1;
+                b = b1;
+                func_obj = func_obj1;
+                this_obj = this_obj1;
+                new_target = JS_UNDEFINED;
+                argc = call_argc;
+                argv = local_buf + 2;
+                arg_buf = argv;
+                for(i = call_argc; i < arg_count1; i++)
+                    arg_buf[i] = JS_UNDEFINED;
+                sf->js_mode = b->js_mode;
+                sf->arg_count = arg_count1;
+                sf->cur_func = (JSValue)func_obj;
+                var_refs = p->u.func.var_refs;
+                var_buf = arg_buf + arg_count1;
+                sf->var_buf = var_buf;
+                sf->arg_buf = arg_buf;
+                for(i = 0; i < b->var_count; i++)
+                    var_buf[i] = JS_UNDEFINED;
+                stack_buf = var_buf + b->var_count;
+                sf->var_refs = (JSVarRef **)(stack_buf + b->stack_size);
+                for(i = 0; i < b->var_ref_count; i++)
+                    sf->var_refs[i] = NULL;
+                sp = stack_buf;
+                pc = b->byte_code_buf;
+                ctx = b->realm;
+#if DIRECT_DISPATCH
+                dispatch = dispatch_table;
+#endif
+                JIT_ENTER();
+                goto restart;
+            }
         CASE(OP_array_from):
             call_argc = get_u16(pc);
             pc += 2;
@@ -17859,7 +19524,9 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
                 pc += 2;
                 sf->cur_pc = pc;
 
-                ret_val = js_function_apply(ctx, sp[-3], 2, (JSValueConst *)&sp[-2], magic);
+                if ((magic & 2) && js_spread_array(ctx, sp))
+                    goto exception;
+                ret_val = js_function_apply(ctx, sp[-3], 2, (JSValueConst *)&sp[-2], magic & 1);
                 if (unlikely(JS_IsException(ret_val)))
                     goto exception;
                 JS_FreeValue(ctx, sp[-3]);
@@ -18079,9 +19746,7 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
                         goto exception;
                     } else {
                         sf->cur_pc = pc;
-                        sp[0] = JS_GetPropertyInternal(ctx, ctx->global_obj,
-                                                       cv->var_name,
-                                                       ctx->global_obj,
+                        sp[0] = js_get_global_var_slow(ctx, b, idx,
                                                        opcode - OP_get_var_undef);
                         if (JS_IsException(sp[0]))
                             goto exception;
@@ -18114,15 +19779,7 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
                         goto exception;
                     } else {
                         sf->cur_pc = pc;
-                        ret = JS_HasProperty(ctx, ctx->global_obj, cv->var_name);
-                        if (ret < 0)
-                            goto exception;
-                        if (ret == 0 && is_strict_mode(ctx)) {
-                            JS_ThrowReferenceErrorNotDefined(ctx, cv->var_name);
-                            goto exception;
-                        }
-                        ret = JS_SetPropertyInternal(ctx, ctx->global_obj, cv->var_name, sp[-1],
-                                                     ctx->global_obj, JS_PROP_THROW_STRICT);
+                        ret = js_put_global_var_slow(ctx, b, idx, sp[-1]);
                         sp--;
                         if (ret < 0)
                             goto exception;
@@ -18426,20 +20083,32 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
             BREAK;
 
         CASE(OP_goto):
-            pc += (int32_t)get_u32(pc);
-            if (unlikely(js_poll_interrupts(ctx)))
-                goto exception;
+            {
+                int32_t diff = get_u32(pc);
+                pc += diff;
+                if (unlikely(js_poll_interrupts(ctx)))
+                    goto exception;
+                JIT_BACKWARD_JUMP(diff);
+            }
             BREAK;
 #if SHORT_OPCODES
         CASE(OP_goto16):
-            pc += (int16_t)get_u16(pc);
-            if (unlikely(js_poll_interrupts(ctx)))
-                goto exception;
+            {
+                int diff = (int16_t)get_u16(pc);
+                pc += diff;
+                if (unlikely(js_poll_interrupts(ctx)))
+                    goto exception;
+                JIT_BACKWARD_JUMP(diff);
+            }
             BREAK;
         CASE(OP_goto8):
-            pc += (int8_t)pc[0];
-            if (unlikely(js_poll_interrupts(ctx)))
-                goto exception;
+            {
+                int diff = (int8_t)pc[0];
+                pc += diff;
+                if (unlikely(js_poll_interrupts(ctx)))
+                    goto exception;
+                JIT_BACKWARD_JUMP(diff);
+            }
             BREAK;
 #endif
         CASE(OP_if_true):
@@ -18456,7 +20125,9 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
                 }
                 sp--;
                 if (res) {
-                    pc += (int32_t)get_u32(pc - 4) - 4;
+                    int32_t diff = get_u32(pc - 4);
+                    pc += diff - 4;
+                    JIT_BACKWARD_JUMP(diff);
                 }
                 if (unlikely(js_poll_interrupts(ctx)))
                     goto exception;
@@ -18498,7 +20169,9 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
                 }
                 sp--;
                 if (res) {
-                    pc += (int8_t)pc[-1] - 1;
+                    int diff = (int8_t)pc[-1];
+                    pc += diff - 1;
+                    JIT_BACKWARD_JUMP(diff);
                 }
                 if (unlikely(js_poll_interrupts(ctx)))
                     goto exception;
@@ -18717,17 +20390,27 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
                 JSObject *p;                                            \
                 JSProperty *pr;                                         \
                 JSShapeProperty *prs;                                   \
+                int ic_idx;                                             \
                                                                         \
                 if (is_length) {                                        \
                     atom = JS_ATOM_length;                              \
+                    ic_idx = JS_IC_MAX_COUNT;                           \
                 } else {                                                \
                     atom = get_u32(pc);                                 \
-                    pc += 4;                                            \
+                    ic_idx = get_u16(pc + 4);                           \
+                    pc += 6;                                            \
                 }                                                       \
                                                                         \
                 obj = sp[-1];                                           \
                 if (likely(JS_VALUE_GET_TAG(obj) == JS_TAG_OBJECT)) {   \
                     p = JS_VALUE_GET_OBJ(obj);                          \
+                    if (!is_length) {                                   \
+                        pr = js_ic_find(rt, b, ic_idx, p);              \
+                        if (likely(pr != NULL)) {                       \
+                            val = JS_DupValue(ctx, pr->u.value);        \
+                            goto name ## _done;                         \
+                        }                                               \
+                    }                                                   \
                     for(;;) {                                           \
                         prs = find_own_property(&pr, p, atom);          \
                         if (prs) {                                      \
@@ -18735,6 +20418,11 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
                             if (unlikely(prs->flags & JS_PROP_TMASK))   \
                                     goto name ## _slow_path;            \
                             val = JS_DupValue(ctx, pr->u.value);        \
+                            if (!is_length) {                           \
+                                JSObject *p1 = JS_VALUE_GET_OBJ(obj);   \
+                                js_ic_add(rt, b, ic_idx, p1->shape,     \
+                                          p == p1 ? NULL : p, prs);     \
+                            }                                           \
                             break;                                      \
                         }                                               \
                         if (unlikely(p->is_exotic)) {                   \
@@ -18757,6 +20445,7 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
                     if (unlikely(JS_IsException(val)))                  \
                         goto exception;                                 \
                 }                                                       \
+            name ## _done:                                              \
                 if (keep) {                                             \
                     *sp++ = val;                                        \
                 } else {                                                \
@@ -18776,8 +20465,44 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
 
 #if SHORT_OPCODES
         CASE(OP_get_length):
+            if (JS_VALUE_GET_TAG(sp[-1]) == JS_TAG_STRING) {
+                js_quicken_op(b, pc, OP_get_length_string);
+            } else if (JS_VALUE_GET_TAG(sp[-1]) == JS_TAG_OBJECT &&
+                       JS_VALUE_GET_OBJ(sp[-1])->class_id == JS_CLASS_ARRAY) {
+                js_quicken_op(b, pc, OP_get_length_array);
+            }
             GET_FIELD_INLINE(get_length, 0, 1);
             BREAK;
+
+        CASE(OP_get_length_array):
+            {
+                JSValue val;
+                JSObject *p;
+
+                if (unlikely(JS_VALUE_GET_TAG(sp[-1]) != JS_TAG_OBJECT))
+                    goto deoptimize;
+                p = JS_VALUE_GET_OBJ(sp[-1]);
+                if (unlikely(p->class_id != JS_CLASS_ARRAY))
+                    goto deoptimize;
+                /* the length is the first property of the arrays and
+                   it is always a number */
+                val = p->prop[0].u.value;
+                JS_FreeValue(ctx, sp[-1]);
+                sp[-1] = val;
+            }
+            BREAK;
+
+        CASE(OP_get_length_string):
+            {
+                uint32_t len;
+
+                if (unlikely(JS_VALUE_GET_TAG(sp[-1]) != JS_TAG_STRING))
+                    goto deoptimize;
+                len = JS_VALUE_GET_STRING(sp[-1])->len;
+                JS_FreeValue(ctx, sp[-1]);
+                sp[-1] = JS_NewInt32(ctx, len);
+            }
+            BREAK;
 #endif
             
         CASE(OP_put_field):
@@ -18788,13 +20513,23 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
                 JSObject *p;
                 JSProperty *pr;
                 JSShapeProperty *prs;
+                int ic_idx;
 
                 atom = get_u32(pc);
-                pc += 4;
+                ic_idx = get_u16(pc + 4);
+                pc += 6;
 
                 obj = sp[-2];
                 if (likely(JS_VALUE_GET_TAG(obj) == JS_TAG_OBJECT)) {
                     p = JS_VALUE_GET_OBJ(obj);
+                    /* only own properties are cached for put_field */
+                    pr = js_ic_find(rt, b, ic_idx, p);
+                    if (likely(pr != NULL)) {
+                        set_value(ctx, &pr->u.value, sp[-1]);
+                        JS_FreeValue(ctx, obj);
+                        sp -= 2;
+                        BREAK;
+                    }
                     prs = find_own_property(&pr, p, atom);
                     if (!prs)
                         goto put_field_slow_path;
@@ -18802,6 +20537,7 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
                                               JS_PROP_LENGTH)) == JS_PROP_WRITABLE)) {
                         /* fast path */
                         set_value(ctx, &pr->u.value, sp[-1]);
+                        js_ic_add(rt, b, ic_idx, p->shape, NULL, prs);
                     } else {
                         goto put_field_slow_path;
                     }
@@ -18999,7 +20735,7 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
             }
             BREAK;
 
-#define GET_ARRAY_EL_INLINE(name, keep)                                 \
+#define GET_ARRAY_EL_INLINE(name, keep, quick_op)                       \
             {                                                           \
                 JSValue val, obj, prop;                                 \
                 JSObject *p;                                            \
@@ -19011,11 +20747,16 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
                            JS_VALUE_GET_TAG(prop) == JS_TAG_INT)) {     \
                     p = JS_VALUE_GET_OBJ(obj);                          \
                     idx = JS_VALUE_GET_INT(prop);                       \
-                    if (unlikely(p->class_id != JS_CLASS_ARRAY))        \
-                        goto name ## _slow_path;                        \
-                    if (unlikely(idx >= p->u.array.count))              \
-                        goto name ## _slow_path;                        \
-                    val = JS_DupValue(ctx, p->u.array.u.values[idx]);   \
+                    if (unlikely(p->class_id != JS_CLASS_ARRAY)) {      \
+                        if (quick_op == OP_invalid ||                   \
+                            !js_get_typed_array_el(ctx, &val, p, idx))  \
+                            goto name ## _slow_path;                    \
+                        js_quicken_op(b, pc, quick_op);                 \
+                    } else {                                            \
+                        if (unlikely(idx >= p->u.array.count))          \
+                            goto name ## _slow_path;                    \
+                        val = JS_DupValue(ctx, p->u.array.u.values[idx]); \
+                    }                                                   \
                 } else {                                                \
                     name ## _slow_path:                                 \
                     sf->cur_pc = pc;                                    \
@@ -19038,11 +20779,11 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
             }
             
         CASE(OP_get_array_el):
-            GET_ARRAY_EL_INLINE(get_array_el, 0);
+            GET_ARRAY_EL_INLINE(get_array_el, 0, OP_get_array_el_typed);
             BREAK;
 
         CASE(OP_get_array_el2):
-            GET_ARRAY_EL_INLINE(get_array_el2, 1);
+            GET_ARRAY_EL_INLINE(get_array_el2, 1, OP_invalid);
             BREAK;
 
         CASE(OP_get_array_el3):
@@ -19159,9 +20900,11 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
                            JS_VALUE_GET_TAG(sp[-2]) == JS_TAG_INT)) {
                     p = JS_VALUE_GET_OBJ(sp[-3]);
                     idx = JS_VALUE_GET_INT(sp[-2]);
-                    if (unlikely(p->class_id != JS_CLASS_ARRAY))
-                        goto put_array_el_slow_path;
-                    if (unlikely(idx >= (uint32_t)p->u.array.count)) {
+                    if (unlikely(p->class_id != JS_CLASS_ARRAY)) {
+                        if (!js_put_typed_array_el(ctx, p, idx, sp[-1]))
+                            goto put_array_el_slow_path;
+                        js_quicken_op(b, pc, OP_put_array_el_typed);
+                    } else if (unlikely(idx >= (uint32_t)p->u.array.count)) {
                         uint32_t new_len, array_len;
                         if (unlikely(idx != (uint32_t)p->u.array.count ||
                                      !p->fast_array ||
@@ -19199,6 +20942,45 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
             }
             BREAK;
 
+        CASE(OP_get_array_el_typed):
+            {
+                JSValue val;
+
+                if (unlikely(JS_VALUE_GET_TAG(sp[-2]) != JS_TAG_OBJECT ||
+                             JS_VALUE_GET_TAG(sp[-1]) != JS_TAG_INT ||
+                             !js_get_typed_array_el(ctx, &val,
+                                                    JS_VALUE_GET_OBJ(sp[-2]),
+                                                    JS_VALUE_GET_INT(sp[-1]))))
+                    goto deoptimize;
+                JS_FreeValue(ctx, sp[-2]);
+                sp[-2] = val;
+                sp--;
+            }
+            BREAK;
+
+        CASE(OP_put_array_el_typed):
+            {
+                /* the index and the value are numbers */
+                if (unlikely(JS_VALUE_GET_TAG(sp[-3]) != JS_TAG_OBJECT ||
+                             JS_VALUE_GET_TAG(sp[-2]) != JS_TAG_INT ||
+                             !js_put_typed_array_el(ctx, JS_VALUE_GET_OBJ(sp[-3]),
+                                                    JS_VALUE_GET_INT(sp[-2]),
+                                                    sp[-1])))
+                    goto deoptimize;
+                JS_FreeValue(ctx, sp[-3]);
+                sp -= 3;
+            }
+            BREAK;
+
+        deoptimize:
+            /* the guard of a quickened opcode failed: revert it to its
+               generic opcode and execute it */
+            if (b->deopt_count < JS_QUICKEN_MAX_DEOPT)
+                b->deopt_count++;
+            pc--;
+            *(uint8_t *)pc = js_unquicken_op(*pc);
+            BREAK;
+
         CASE(OP_put_ref_value):
             {
                 int ret;
@@ -20068,6 +21850,56 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
             JS_FreeValue(ctx, sp[-1]);
             sp[-1] = JS_FALSE;
             BREAK;
+
+#if SHORT_OPCODES
+            /* super-instructions: 'pc' points to the second opcode */
+#define OP_CMP_IF_FALSE8(opcode, cmp_opcode, binary_op)                 \
+            CASE(opcode):                                               \
+                SUPER_INSN_COUNT();                                     \
+                if (likely(JS_VALUE_IS_BOTH_INT(sp[-2], sp[-1]))) {     \
+                    int res;                                            \
+                    res = JS_VALUE_GET_INT(sp[-2]) binary_op JS_VALUE_GET_INT(sp[-1]); \
+                    sp -= 2;                                            \
+                    if (res)                                            \
+                        pc += 2;                                        \
+                    else                                                \
+                        pc += 1 + (int8_t)pc[1];                        \
+                    if (unlikely(js_poll_interrupts(ctx)))              \
+                        goto exception;                                 \
+                    BREAK;                                              \
+                }                                                       \
+                GOTO_CASE(cmp_opcode)
+
+            OP_CMP_IF_FALSE8(OP_lt_if_false8, OP_lt, <);
+            OP_CMP_IF_FALSE8(OP_gt_if_false8, OP_gt, >);
+
+        CASE(OP_inc_loc_goto8):
+            {
+                JSValue op1;
+                int idx;
+
+                SUPER_INSN_COUNT();
+                idx = *pc;
+                op1 = var_buf[idx];
+                if (unlikely(JS_VALUE_GET_TAG(op1) != JS_TAG_INT ||
+                             JS_VALUE_GET_INT(op1) == INT32_MAX))
+                    GOTO_CASE(OP_inc_loc);
+                var_buf[idx] = JS_NewInt32(ctx, JS_VALUE_GET_INT(op1) + 1);
+                pc += 1;
+                FUSE_NEXT(OP_goto8);
+            }
+        CASE(OP_get_loc0_loc1):
+            SUPER_INSN_COUNT();
+            sp[0] = JS_DupValue(ctx, var_buf[0]);
+            sp[1] = JS_DupValue(ctx, var_buf[1]);
+            sp += 2;
+            pc++;
+            BREAK;
+        CASE(OP_get_loc0_get_field2):
+            SUPER_INSN_COUNT();
+            *sp++ = JS_DupValue(ctx, var_buf[0]);
+            FUSE_NEXT(OP_get_field2);
+#endif
         CASE(OP_invalid):
         DEFAULT:
             JS_ThrowInternalError(ctx, "invalid opcode: pc=%u opcode=0x%02x",
@@ -20310,15 +22142,17 @@ static JSAsyncFunctionState *async_func_init(JSContext *ctx,
     JSObject *p;
     JSFunctionBytecode *b;
     JSStackFrame *sf;
-    int i, arg_buf_len, n;
+    int i, arg_buf_len, n, alloc_size;
 
     p = JS_VALUE_GET_OBJ(func_obj);
     b = p->u.func.function_bytecode;
     arg_buf_len = max_int(b->arg_count, argc);
-    s = js_malloc(ctx, sizeof(*s) + sizeof(JSValue) * (arg_buf_len + b->var_count + b->stack_size) + sizeof(JSVarRef *) * b->var_ref_count);
+    alloc_size = sizeof(*s) + sizeof(JSValue) * (arg_buf_len + b->var_count + b->stack_size) + sizeof(JSVarRef *) * b->var_ref_count;
+    s = js_slab_alloc(ctx, alloc_size);
     if (!s)
         return NULL;
     memset(s, 0, sizeof(*s));
+    s->alloc_size = alloc_size;
     s->header.ref_count = 1;
     add_gc_object(ctx->rt, &s->header, JS_GC_OBJ_TYPE_ASYNC_FUNCTION);
 
@@ -20412,7 +22246,7 @@ static void __async_func_free(JSRuntime *rt, JSAsyncFunctionState *s)
     if (rt->gc_phase == JS_GC_PHASE_REMOVE_CYCLES && s->header.ref_count != 0) {
         list_add_tail(&s->header.link, &rt->gc_zero_ref_count_list);
     } else {
-        js_free_rt(rt, s);
+        js_slab_free_rt(rt, s, s->alloc_size);
     }
 }
 
@@ -20425,6 +22259,8 @@ static void async_func_free(JSRuntime *rt, JSAsyncFunctionState *s)
             if (rt->gc_phase == JS_GC_PHASE_NONE) {
                 free_zero_refcount(rt);
             }
+        } else {
+            gc_free_outside_cycles(rt, &s->header);
         }
     }
 }
@@ -21563,7 +23399,7 @@ typedef struct JSParseState {
 } JSParseState;
 
 typedef struct JSOpCode {
-#ifdef DUMP_BYTECODE
+#if defined(DUMP_BYTECODE) || defined(DUMP_SUPER_INSTRUCTIONS)
     const char *name;
 #endif
     uint8_t size; /* in bytes */
@@ -21576,7 +23412,7 @@ typedef struct JSOpCode {
 
 static const JSOpCode opcode_info[OP_COUNT + (OP_TEMP_END - OP_TEMP_START)] = {
 #define FMT(f)
-#ifdef DUMP_BYTECODE
+#if defined(DUMP_BYTECODE) || defined(DUMP_SUPER_INSTRUCTIONS)
 #define DEF(id, size, n_pop, n_push, f) { #id, size, n_pop, n_push, OP_FMT_ ## f },
 #else
 #define DEF(id, size, n_pop, n_push, f) { size, n_pop, n_push, OP_FMT_ ## f },
@@ -22719,14 +24555,40 @@ static int json_parse_string(JSParseState *s, const uint8_t **pp, int sep)
 {
     const uint8_t *p, *p_next;
     int i;
+    size_t len;
     uint32_t c;
     StringBuffer b_s, *b = &b_s;
 
+    p = *pp;
+    /* fast case: no escape sequence and only ASCII characters */
+    len = json_plain_string_len(p, s->buf_end - p, sep);
+    if (p[len] == sep && p + len < s->buf_end) {
+        if (len > JS_STRING_LEN_MAX)
+            return js_parse_error(s, "string too long");
+        s->token.u.str.str = js_new_string8_len(s->ctx, (const char *)p, len);
+        if (JS_IsException(s->token.u.str.str))
+            return -1;
+        s->token.val = TOK_STRING;
+        s->token.u.str.sep = sep;
+        *pp = p + len + 1;
+        return 0;
+    }
+
     if (string_buffer_init(s->ctx, b, 32))
         goto fail;
 
-    p = *pp;
     for(;;) {
+        /* copy the characters which need no decoding */
+        len = json_plain_string_len(p, s->buf_end - p, sep);
+        if (len != 0) {
+            if (len > JS_STRING_LEN_MAX) {
+                js_parse_error(s, "string too long");
+                goto fail;
+            }
+            if (string_buffer_write8(b, p, len))
+                goto fail;
+            p += len;
+        }
         if (p >= s->buf_end) {
             goto end_of_input;
         }
@@ -22922,13 +24784,11 @@ static __exception int json_next_token(JSParseState *s)
         if (json_parse_string(s, &p, c))
             goto fail;
         break;
-    case '\r':  /* accept DOS and MAC newline sequences */
-        if (p[1] == '\n') {
-            p++;
-        }
-        /* fall thru */
+    case '\r':
     case '\n':
-        p++;
+    case ' ':
+    case '\t':
+        p += json_space_len(p, s->buf_end - p);
         goto redo;
     case '\f':
     case '\v':
@@ -22936,9 +24796,6 @@ static __exception int json_next_token(JSParseState *s)
             /* JSONWhitespace does not match <VT>, nor <FF> */
             goto def_token;
         }
-        /* fall through */
-    case ' ':
-    case '\t':
         p++;
         goto redo;
     case '/':
@@ -23292,6 +25149,13 @@ static void emit_atom(JSParseState *s, JSAtom name)
     bc->size += 4;
 }
 
+/* placeholder for the inline cache slot of get_field, get_field2 and
+   put_field. The slots are numbered once the final bytecode is known. */
+static void emit_ic(JSParseState *s)
+{
+    emit_u16(s, 0);
+}
+
 static int update_label(JSFunctionDef *s, int label, int delta)
 {
     LabelSlot *ls;
@@ -23409,6 +25273,262 @@ static __exception int emit_push_const(JSParseState *s, JSValueConst val,
     return 0;
 }
 
+/* Constant folding. The operands are folded only if they are primitive
+   values for which the operators cannot have side effects or throw
+   exceptions. */
+
+/* return the size of the instruction at 'pos' if it pushes such a
+   constant and store its value in '*pval'. Return 0 otherwise. */
+static int js_parse_get_const(JSParseState *s, int pos, JSValue *pval)
+{
+    JSFunctionDef *fd = s->cur_func;
+    const uint8_t *bc_buf = fd->byte_code.buf;
+    JSValue val;
+    int op;
+
+    if (pos >= fd->byte_code.size)
+        return 0;
+    op = bc_buf[pos];
+    switch(op) {
+    case OP_push_i32:
+        val = JS_NewInt32(s->ctx, get_i32(bc_buf + pos + 1));
+        break;
+    case OP_push_const:
+        val = fd->cpool[get_u32(bc_buf + pos + 1)];
+        switch(JS_VALUE_GET_NORM_TAG(val)) {
+        case JS_TAG_INT:
+        case JS_TAG_FLOAT64:
+        case JS_TAG_STRING:
+            break;
+        default:
+            return 0;
+        }
+        val = JS_DupValue(s->ctx, val);
+        break;
+    case OP_push_atom_value:
+        val = JS_AtomToString(s->ctx, get_u32(bc_buf + pos + 1));
+        if (JS_IsException(val))
+            return 0;
+        break;
+    case OP_undefined:
+        val = JS_UNDEFINED;
+        break;
+    case OP_null:
+        val = JS_NULL;
+        break;
+    case OP_push_false:
+    case OP_push_true:
+        val = JS_NewBool(s->ctx, op == OP_push_true);
+        break;
+    default:
+        return 0;
+    }
+    *pval = val;
+    return opcode_info[op].size;
+}
+
+/* remove the code from 'pos' to the end of the bytecode. It contains
+   only constant pushes and field accesses. */
+static void js_parse_remove_code(JSParseState *s, int pos)
+{
+    JSFunctionDef *fd = s->cur_func;
+    const uint8_t *bc_buf = fd->byte_code.buf;
+    int op, idx, cpool_first, cpool_count, i;
+
+    cpool_first = fd->cpool_count;
+    cpool_count = 0;
+    for(i = pos; i < fd->byte_code.size; i += opcode_info[op].size) {
+        op = bc_buf[i];
+        if (op == OP_push_atom_value || op == OP_get_field2) {
+            JS_FreeAtom(s->ctx, get_u32(bc_buf + i + 1));
+        } else if (op == OP_push_const) {
+            idx = get_u32(bc_buf + i + 1);
+            cpool_first = min_int(cpool_first, idx);
+            cpool_count++;
+        }
+    }
+    /* the constant pool entries can be removed if no other code
+       references them */
+    if (cpool_count == fd->cpool_count - cpool_first) {
+        for(i = cpool_first; i < fd->cpool_count; i++)
+            JS_FreeValue(s->ctx, fd->cpool[i]);
+        fd->cpool_count = cpool_first;
+    }
+    fd->byte_code.size = pos;
+}
+
+/* emit the push of the constant 'val' and free it */
+static int emit_push_value(JSParseState *s, JSValue val)
+{
+    int ret;
+    double d;
+
+    switch(JS_VALUE_GET_NORM_TAG(val)) {
+    case JS_TAG_INT:
+        emit_op(s, OP_push_i32);
+        emit_u32(s, JS_VALUE_GET_INT(val));
+        return 0;
+    case JS_TAG_BOOL:
+        emit_op(s, JS_VALUE_GET_BOOL(val) ? OP_push_true : OP_push_false);
+        return 0;
+    case JS_TAG_FLOAT64:
+        d = JS_VALUE_GET_FLOAT64(val);
+        if (d >= INT32_MIN && d <= INT32_MAX && d == (int32_t)d &&
+            !(d == 0 && signbit(d))) {
+            emit_op(s, OP_push_i32);
+            emit_u32(s, (int32_t)d);
+            return 0;
+        }
+        ret = emit_push_const(s, val, FALSE);
+        break;
+    case JS_TAG_STRING_ROPE:
+        val = js_linearize_string_rope(s->ctx, val);
+        if (JS_IsException(val))
+            return -1;
+        /* fall through */
+    default:
+        ret = emit_push_const(s, val, TRUE);
+        break;
+    }
+    JS_FreeValue(s->ctx, val);
+    return ret;
+}
+
+/* Try to replace the constant operand(s) of 'op' located at 'pos1' (and
+   'pos2' for a binary operator) by the result. Return 1 if done, 0 if
+   'op' must be emitted and -1 if exception. */
+static int js_parse_fold_const(JSParseState *s, OPCodeEnum op,
+                               int pos1, int pos2)
+{
+    JSValue tab[2];
+    int n_pop, len, ret;
+
+    if (!OPTIMIZE)
+        return 0;
+    n_pop = opcode_info[op].n_pop;
+    len = js_parse_get_const(s, pos1, &tab[0]);
+    if (len == 0)
+        return 0;
+    if (n_pop == 2) {
+        if (pos1 + len != pos2) {
+            JS_FreeValue(s->ctx, tab[0]);
+            return 0;
+        }
+        len = js_parse_get_const(s, pos2, &tab[1]);
+        if (len == 0) {
+            JS_FreeValue(s->ctx, tab[0]);
+            return 0;
+        }
+    } else {
+        pos2 = pos1;
+    }
+    if (pos2 + len != s->cur_func->byte_code.size) {
+        JS_FreeValue(s->ctx, tab[0]);
+        if (n_pop == 2)
+            JS_FreeValue(s->ctx, tab[1]);
+        return 0;
+    }
+    switch(op) {
+    case OP_neg:
+    case OP_plus:
+        ret = js_unary_arith_slow(s->ctx, tab + 1, op);
+        break;
+    case OP_not:
+        ret = js_not_slow(s->ctx, tab + 1);
+        break;
+    case OP_lnot:
+        tab[0] = JS_NewBool(s->ctx, !JS_ToBoolFree(s->ctx, tab[0]));
+        ret = 0;
+        break;
+    case OP_add:
+        ret = js_add_slow(s->ctx, tab + 2);
+        break;
+    case OP_sub:
+    case OP_mul:
+    case OP_div:
+    case OP_mod:
+    case OP_pow:
+        ret = js_binary_arith_slow(s->ctx, tab + 2, op);
+        break;
+    case OP_shl:
+    case OP_sar:
+    case OP_and:
+    case OP_or:
+    case OP_xor:
+        ret = js_binary_logic_slow(s->ctx, tab + 2, op);
+        break;
+    case OP_shr:
+        ret = js_shr_slow(s->ctx, tab + 2);
+        break;
+    case OP_lt:
+    case OP_lte:
+    case OP_gt:
+    case OP_gte:
+        ret = js_relational_slow(s->ctx, tab + 2, op);
+        break;
+    case OP_eq:
+    case OP_neq:
+        ret = js_eq_slow(s->ctx, tab + 2, op == OP_neq);
+        break;
+    case OP_strict_eq:
+    case OP_strict_neq:
+        ret = js_strict_eq_slow(s->ctx, tab + 2, op == OP_strict_neq);
+        break;
+    default:
+        JS_FreeValue(s->ctx, tab[0]);
+        if (n_pop == 2)
+            JS_FreeValue(s->ctx, tab[1]);
+        return 0;
+    }
+    if (ret)
+        return -1;
+    js_parse_remove_code(s, pos1);
+    if (emit_push_value(s, tab[0]))
+        return -1;
+    return 1;
+}
+
+/* Try to replace the template literal at 'pos', emitted as
+   str.concat(v1, ..., vn), by a string if the values are constants.
+   Return 1 if done, 0 if the call must be emitted and -1 if
+   exception. */
+static int js_parse_fold_template(JSParseState *s, int pos, int argc)
+{
+    JSFunctionDef *fd = s->cur_func;
+    JSValue tab[2];
+    int len, i, start;
+
+    if (!OPTIMIZE)
+        return 0;
+    start = pos;
+    len = js_parse_get_const(s, pos, &tab[0]);
+    if (len == 0)
+        return 0;
+    pos += len;
+    if (pos >= fd->byte_code.size || fd->byte_code.buf[pos] != OP_get_field2)
+        goto fail;
+    pos += opcode_info[OP_get_field2].size;
+    for(i = 0; i < argc; i++) {
+        len = js_parse_get_const(s, pos, &tab[1]);
+        if (len == 0)
+            goto fail;
+        pos += len;
+        /* same result as concat() since tab[0] is a string and
+           tab[1] a primitive */
+        if (js_add_slow(s->ctx, tab + 2))
+            return -1;
+    }
+    if (pos != fd->byte_code.size)
+        goto fail;
+    js_parse_remove_code(s, start);
+    if (emit_push_value(s, tab[0]))
+        return -1;
+    return 1;
+ fail:
+    JS_FreeValue(s->ctx, tab[0]);
+    return 0;
+}
+
 /* return the variable index or -1 if not found,
    add ARGUMENT_VAR_OFFSET for argument variables */
 static int find_arg(JSContext *ctx, JSFunctionDef *fd, JSAtom name)
@@ -23906,8 +26026,9 @@ static __exception int js_parse_template(JSParseState *s, int call, int *argc)
     JSContext *ctx = s->ctx;
     JSValue raw_array, template_object;
     JSToken cooked;
-    int depth, ret;
+    int depth, ret, pos;
 
+    pos = s->cur_func->byte_code.size;
     raw_array = JS_UNDEFINED; /* avoid warning */
     template_object = JS_UNDEFINED; /* avoid warning */
     if (call) {
@@ -23971,6 +26092,7 @@ static __exception int js_parse_template(JSParseState *s, int call, int *argc)
                         goto done1;
                     emit_op(s, OP_get_field2);
                     emit_atom(s, JS_ATOM_concat);
+                    emit_ic(s);
                 }
                 depth++;
             } else {
@@ -24004,8 +26126,13 @@ static __exception int js_parse_template(JSParseState *s, int call, int *argc)
         seal_template_obj(ctx, template_object);
         *argc = depth + 1;
     } else {
-        emit_op(s, OP_call_method);
-        emit_u16(s, depth - 1);
+        ret = js_parse_fold_template(s, pos, depth - 1);
+        if (ret < 0)
+            return -1;
+        if (!ret) {
+            emit_op(s, OP_call_method);
+            emit_u16(s, depth - 1);
+        }
     }
  done1:
     return next_token(s);
@@ -25251,6 +27378,7 @@ static __exception int js_parse_array_literal(JSParseState *s)
             emit_u32(s, idx);
             emit_op(s, OP_put_field);
             emit_atom(s, JS_ATOM_length);
+            emit_ic(s);
         }
         goto done;
     }
@@ -25315,6 +27443,7 @@ static __exception int js_parse_array_literal(JSParseState *s)
         emit_op(s, OP_dup1);    /* array length - array array length */
         emit_op(s, OP_put_field);
         emit_atom(s, JS_ATOM_length);
+        emit_ic(s);
     } else {
         emit_op(s, OP_drop);    /* array length - array */
     }
@@ -25428,6 +27557,7 @@ static __exception int get_lvalue(JSParseState *s, int *popcode, int *pscope,
         case OP_get_field:
             emit_op(s, OP_get_field2);
             emit_atom(s, name);
+            emit_ic(s);
             break;
         case OP_scope_get_private_field:
             emit_op(s, OP_scope_get_private_field2);
@@ -25585,6 +27715,7 @@ static void put_lvalue(JSParseState *s, int opcode, int scope,
     case OP_get_field:
         emit_op(s, OP_put_field);
         emit_u32(s, name);  /* name has refcount */
+        emit_ic(s);
         break;
     case OP_scope_get_private_field:
         emit_op(s, OP_scope_put_private_field);
@@ -25870,6 +28001,7 @@ static int js_parse_destructuring_element(JSParseState *s, int tok, int is_arg,
                         /* get the named property from the source object */
                         emit_op(s, OP_get_field2);
                         emit_u32(s, prop_name);
+                        emit_ic(s);
                     }
                     if (js_parse_destructuring_element(s, tok, is_arg, TRUE, -1, TRUE, export_flag) < 0)
                         return -1;
@@ -25981,6 +28113,7 @@ static int js_parse_destructuring_element(JSParseState *s, int tok, int is_arg,
                     /* source -- val */
                     emit_op(s, OP_get_field);
                     emit_u32(s, prop_name);
+                    emit_ic(s);
                 }
             } else {
                 /* prop_type = PROP_TYPE_VAR, cannot be a computed property */
@@ -26018,6 +28151,7 @@ static int js_parse_destructuring_element(JSParseState *s, int tok, int is_arg,
                     /* source -- source val */
                     emit_op(s, OP_get_field2);
                     emit_u32(s, prop_name);
+                    emit_ic(s);
                 }
             }
         set_val:
@@ -26559,10 +28693,10 @@ static __exception int js_parse_postfix_expr(JSParseState *s, int parse_flags)
                     {
                         int opt_chain_label, next_label;
                         opt_chain_label = get_u32(fd->byte_code.buf +
-                                                  fd->last_opcode_pos + 1 + 4 + 1);
+                                                  fd->last_opcode_pos + 1 + 4 + 2 + 1);
                         /* keep the object on the stack */
                         fd->byte_code.buf[fd->last_opcode_pos] = OP_get_field2;
-                        fd->byte_code.size = fd->last_opcode_pos + 1 + 4;
+                        fd->byte_code.size = fd->last_opcode_pos + 1 + 4 + 2;
                         next_label = emit_goto(s, OP_goto, -1);
                         emit_label(s, opt_chain_label);
                         /* need an additional undefined value for the
@@ -26684,10 +28818,37 @@ static __exception int js_parse_postfix_expr(JSParseState *s, int parse_flags)
                     return -1;
             }
             if (s->token.val == TOK_ELLIPSIS) {
-                emit_op(s, OP_array_from);
-                emit_u16(s, arg_count);
-                emit_op(s, OP_push_i32);
-                emit_u32(s, arg_count);
+                /* bit 0: constructor call, bit 1: the array is the
+                   spread iterable itself */
+                int apply_flags = 0;
+
+                if (arg_count == 0 && opcode != OP_eval) {
+                    /* f(...a): 'a' is given to OP_apply which iterates it
+                       only if it is not a plain array */
+                    if (next_token(s))
+                        return -1;
+                    if (js_parse_assign_expr(s))
+                        return -1;
+                    if (s->token.val == ')') {
+                        apply_flags = 2;
+                    } else {
+                        /* val -> array idx val */
+                        emit_op(s, OP_array_from);
+                        emit_u16(s, 0);
+                        emit_op(s, OP_push_i32);
+                        emit_u32(s, 0);
+                        emit_op(s, OP_rot3l);
+                        emit_op(s, OP_append);
+                        /* accept a trailing comma before the ')' */
+                        if (js_parse_expect(s, ','))
+                            return -1;
+                    }
+                } else {
+                    emit_op(s, OP_array_from);
+                    emit_u16(s, arg_count);
+                    emit_op(s, OP_push_i32);
+                    emit_u32(s, arg_count);
+                }
 
                 /* on stack: array idx */
                 while (s->token.val != ')') {
@@ -26739,8 +28900,10 @@ static __exception int js_parse_postfix_expr(JSParseState *s, int parse_flags)
                 }
                 if (next_token(s))
                     return -1;
-                /* drop the index */
-                emit_op(s, OP_drop);
+                if (!(apply_flags & 2)) {
+                    /* drop the index */
+                    emit_op(s, OP_drop);
+                }
 
                 emit_source_pos(s, op_token_ptr);
                 /* apply function call */
@@ -26752,7 +28915,7 @@ static __exception int js_parse_postfix_expr(JSParseState *s, int parse_flags)
                     /* obj func array -> func obj array */
                     emit_op(s, OP_perm3);
                     emit_op(s, OP_apply);
-                    emit_u16(s, call_type == FUNC_CALL_NEW);
+                    emit_u16(s, apply_flags | (call_type == FUNC_CALL_NEW));
                     break;
                 case OP_eval:
                     emit_op(s, OP_apply_eval);
@@ -26762,7 +28925,7 @@ static __exception int js_parse_postfix_expr(JSParseState *s, int parse_flags)
                 default:
                     if (call_type == FUNC_CALL_SUPER_CTOR) {
                         emit_op(s, OP_apply);
-                        emit_u16(s, 1);
+                        emit_u16(s, apply_flags | 1);
                         /* set the 'this' value */
                         emit_op(s, OP_dup);
                         emit_op(s, OP_scope_put_var_init);
@@ -26774,13 +28937,13 @@ static __exception int js_parse_postfix_expr(JSParseState *s, int parse_flags)
                         /* obj func array -> func obj array */
                         emit_op(s, OP_perm3);
                         emit_op(s, OP_apply);
-                        emit_u16(s, 1);
+                        emit_u16(s, apply_flags | 1);
                     } else {
                         /* func array -> func undef array */
                         emit_op(s, OP_undefined);
                         emit_op(s, OP_swap);
                         emit_op(s, OP_apply);
-                        emit_u16(s, 0);
+                        emit_u16(s, apply_flags);
                     }
                     break;
                 }
@@ -26862,6 +29025,7 @@ static __exception int js_parse_postfix_expr(JSParseState *s, int parse_flags)
                     }
                     emit_op(s, OP_get_field);
                     emit_atom(s, s->token.u.ident.atom);
+                    emit_ic(s);
                 }
             }
             if (next_token(s))
@@ -26928,7 +29092,7 @@ static __exception int js_parse_delete(JSParseState *s)
             int ret, opt_chain_label, next_label;
             if (opcode == OP_get_field_opt_chain) {
                 opt_chain_label = get_u32(fd->byte_code.buf +
-                                          fd->last_opcode_pos + 1 + 4 + 1);
+                                          fd->last_opcode_pos + 1 + 4 + 2 + 1);
             } else {
                 opt_chain_label = -1;
             }
@@ -27005,9 +29169,10 @@ static __exception int js_parse_delete(JSParseState *s)
 /* allowed parse_flags: PF_POW_ALLOWED, PF_POW_FORBIDDEN */
 static __exception int js_parse_unary(JSParseState *s, int parse_flags)
 {
-    int op;
+    int op, pos, pos2, ret;
     const uint8_t *op_token_ptr;
 
+    pos = s->cur_func->byte_code.size;
     switch(s->token.val) {
     case '+':
     case '-':
@@ -27020,28 +29185,35 @@ static __exception int js_parse_unary(JSParseState *s, int parse_flags)
             return -1;
         if (js_parse_unary(s, PF_POW_FORBIDDEN))
             return -1;
-        switch(op) {
-        case '-':
-            emit_source_pos(s, op_token_ptr);
-            emit_op(s, OP_neg);
-            break;
-        case '+':
-            emit_source_pos(s, op_token_ptr);
-            emit_op(s, OP_plus);
-            break;
-        case '!':
-            emit_op(s, OP_lnot);
-            break;
-        case '~':
-            emit_source_pos(s, op_token_ptr);
-            emit_op(s, OP_not);
-            break;
-        case TOK_VOID:
+        if (op == TOK_VOID) {
             emit_op(s, OP_drop);
             emit_op(s, OP_undefined);
-            break;
-        default:
-            abort();
+        } else {
+            int opcode;
+            switch(op) {
+            case '-':
+                opcode = OP_neg;
+                break;
+            case '+':
+                opcode = OP_plus;
+                break;
+            case '!':
+                opcode = OP_lnot;
+                break;
+            case '~':
+                opcode = OP_not;
+                break;
+            default:
+                abort();
+            }
+            ret = js_parse_fold_const(s, opcode, pos, -1);
+            if (ret < 0)
+                return -1;
+            if (!ret) {
+                if (opcode != OP_lnot)
+                    emit_source_pos(s, op_token_ptr);
+                emit_op(s, opcode);
+            }
         }
         parse_flags = 0;
         break;
@@ -27133,10 +29305,16 @@ static __exception int js_parse_unary(JSParseState *s, int parse_flags)
             op_token_ptr = s->token.ptr;
             if (next_token(s))
                 return -1;
+            pos2 = s->cur_func->byte_code.size;
             if (js_parse_unary(s, PF_POW_ALLOWED))
                 return -1;
-            emit_source_pos(s, op_token_ptr);
-            emit_op(s, OP_pow);
+            ret = js_parse_fold_const(s, OP_pow, pos, pos2);
+            if (ret < 0)
+                return -1;
+            if (!ret) {
+                emit_source_pos(s, op_token_ptr);
+                emit_op(s, OP_pow);
+            }
         }
     }
     return 0;
@@ -27146,9 +29324,10 @@ static __exception int js_parse_unary(JSParseState *s, int parse_flags)
 static __exception int js_parse_expr_binary(JSParseState *s, int level,
                                             int parse_flags)
 {
-    int op, opcode;
+    int op, opcode, pos, pos2, ret;
     const uint8_t *op_token_ptr;
-    
+
+    pos = s->cur_func->byte_code.size;
     if (level == 0) {
         return js_parse_unary(s, PF_POW_ALLOWED);
     } else if (s->token.val == TOK_PRIVATE_NAME &&
@@ -27301,10 +29480,16 @@ static __exception int js_parse_expr_binary(JSParseState *s, int level,
         }
         if (next_token(s))
             return -1;
+        pos2 = s->cur_func->byte_code.size;
         if (js_parse_expr_binary(s, level - 1, parse_flags))
             return -1;
-        emit_source_pos(s, op_token_ptr);
-        emit_op(s, opcode);
+        ret = js_parse_fold_const(s, opcode, pos, pos2);
+        if (ret < 0)
+            return -1;
+        if (!ret) {
+            emit_source_pos(s, op_token_ptr);
+            emit_op(s, opcode);
+        }
     }
     return 0;
 }
@@ -27465,12 +29650,14 @@ static __exception int js_parse_assign_expr2(JSParseState *s, int parse_flags)
             emit_op(s, OP_iterator_check_object);
             emit_op(s, OP_get_field2);
             emit_atom(s, JS_ATOM_done);
+            emit_ic(s);
             label_next = emit_goto(s, OP_if_true, -1); /* end of loop */
             emit_label(s, label_yield);
             if (is_async) {
                 /* OP_async_yield_star takes the value as parameter */
                 emit_op(s, OP_get_field);
                 emit_atom(s, JS_ATOM_value);
+                emit_ic(s);
                 emit_op(s, OP_async_yield_star);
             } else {
                 /* OP_yield_star takes (value, done) as parameter */
@@ -27498,10 +29685,12 @@ static __exception int js_parse_assign_expr2(JSParseState *s, int parse_flags)
             emit_op(s, OP_iterator_check_object);
             emit_op(s, OP_get_field2);
             emit_atom(s, JS_ATOM_done);
+            emit_ic(s);
             emit_goto(s, OP_if_false, label_yield);
 
             emit_op(s, OP_get_field);
             emit_atom(s, JS_ATOM_value);
+            emit_ic(s);
 
             emit_label(s, label_return1);
             emit_op(s, OP_nip);
@@ -27519,6 +29708,7 @@ static __exception int js_parse_assign_expr2(JSParseState *s, int parse_flags)
             emit_op(s, OP_iterator_check_object);
             emit_op(s, OP_get_field2);
             emit_atom(s, JS_ATOM_done);
+            emit_ic(s);
             emit_goto(s, OP_if_false, label_yield);
             emit_goto(s, OP_goto, label_next);
             /* close the iterator and throw a type error exception */
@@ -27537,6 +29727,7 @@ static __exception int js_parse_assign_expr2(JSParseState *s, int parse_flags)
             emit_label(s, label_next);
             emit_op(s, OP_get_field);
             emit_atom(s, JS_ATOM_value);
+            emit_ic(s);
             emit_op(s, OP_nip); /* keep the value associated with
                                    done = true */
             emit_op(s, OP_nip);
@@ -27838,6 +30029,7 @@ static void emit_return(JSParseState *s, BOOL hasval)
                     emit_op(s, OP_swap);
                     emit_op(s, OP_get_field2);
                     emit_atom(s, JS_ATOM_return);
+                    emit_ic(s);
                     /* stack: iter_obj return_func */
                     emit_op(s, OP_dup);
                     emit_op(s, OP_is_undefined_or_null);
@@ -33907,6 +36099,7 @@ static __exception int resolve_variables(JSContext *ctx, JSFunctionDef *s)
                 JSAtom name = get_u32(bc_buf + pos + 1);
                 dbuf_putc(&bc_out, OP_get_field);
                 dbuf_put_u32(&bc_out, name);
+                dbuf_put_u16(&bc_out, 0);
             }
             break;
         case OP_get_array_el_opt_chain: /* equivalent to OP_get_array_el */
@@ -33942,6 +36135,175 @@ static __exception int resolve_variables(JSContext *ctx, JSFunctionDef *s)
     return -1;
 }
 
+/* Share the local variable slots between the variables of disjoint
+   block scopes. A block scoped variable is reinitialized by the
+   enter_scope of its scope and is dead after it is left, so two of
+   them can only be live at the same time if the scope of one
+   contains the scope of the other. The scopes are numbered in
+   preorder, hence the slots are allocated with a stack of scopes and
+   the slots of a scope are released when the following scopes are no
+   longer its descendants. Captured variables keep their slot because
+   a closure may still reference it when an exception leaves the
+   scope. If the debug info is kept, only the variables of the same
+   name share a slot so that vardefs[] still gives the right name. */
+static __exception int reuse_var_slots(JSContext *ctx, JSFunctionDef *s)
+{
+    int *fixed_idx[] = {
+        &s->var_object_idx, &s->arg_var_object_idx,
+        &s->arguments_var_idx, &s->arguments_arg_idx,
+        &s->func_var_idx, &s->eval_ret_idx, &s->this_var_idx,
+        &s->new_target_var_idx, &s->this_active_func_var_idx,
+        &s->home_object_var_idx,
+    };
+    int var_count, scope_count, new_count, i, j, scope, slot, pos, op;
+    int stack_len, alloc_len, free_len;
+    int *remap, *var_next, *scope_head, *scope_stack, *scope_alloc;
+    int *alloc_slots, *free_slots;
+    JSAtom *slot_names;
+    JSVarDef *vars;
+    uint8_t *bc_buf;
+
+    var_count = s->var_count;
+    scope_count = s->scope_count;
+    /* eval() compiles its closure variables from vardefs[] */
+    if (s->has_eval_call || s->body_scope < 0 || var_count < 2)
+        return 0;
+    remap = js_malloc(ctx, sizeof(remap[0]) * (var_count * 5 + scope_count * 3));
+    if (!remap)
+        return -1;
+    var_next = remap + var_count;
+    alloc_slots = var_next + var_count;
+    free_slots = alloc_slots + var_count;
+    slot_names = (JSAtom *)(free_slots + var_count);
+    scope_head = (int *)(slot_names + var_count);
+    scope_stack = scope_head + scope_count;
+    scope_alloc = scope_stack + scope_count;
+
+    /* the variables of the function scopes and the special variables
+       keep a slot of their own, in their original order */
+    for(i = 0; i < var_count; i++) {
+        JSVarDef *vd = &s->vars[i];
+        remap[i] = (vd->scope_level > s->body_scope && !vd->is_captured);
+    }
+    for(j = 0; j < countof(fixed_idx); j++) {
+        if (*fixed_idx[j] >= 0)
+            remap[*fixed_idx[j]] = 0;
+    }
+    for(scope = 0; scope < scope_count; scope++)
+        scope_head[scope] = -1;
+    new_count = 0;
+    for(i = var_count - 1; i >= 0; i--) {
+        if (remap[i]) {
+            scope = s->vars[i].scope_level;
+            var_next[i] = scope_head[scope];
+            scope_head[scope] = i;
+        } else {
+            new_count++;
+        }
+    }
+    j = 0;
+    for(i = 0; i < var_count; i++) {
+        if (remap[i])
+            remap[i] = -1;
+        else
+            remap[i] = j++;
+    }
+
+    stack_len = 0;
+    alloc_len = 0;
+    free_len = 0;
+    scope_stack[stack_len] = s->body_scope;
+    scope_alloc[stack_len++] = 0;
+    for(scope = s->body_scope + 1; scope < scope_count; scope++) {
+        int parent = s->scopes[scope].parent;
+        while (stack_len > 1 && scope_stack[stack_len - 1] != parent) {
+            stack_len--;
+            while (alloc_len > scope_alloc[stack_len])
+                free_slots[free_len++] = alloc_slots[--alloc_len];
+        }
+        if (scope_stack[stack_len - 1] != parent)
+            goto done; /* not inside the body scope: should not happen */
+        scope_stack[stack_len] = scope;
+        scope_alloc[stack_len++] = alloc_len;
+        for(i = scope_head[scope]; i >= 0; i = var_next[i]) {
+            for(j = free_len - 1; j >= 0; j--) {
+                if (s->strip_debug ||
+                    slot_names[free_slots[j]] == s->vars[i].var_name)
+                    break;
+            }
+            if (j >= 0) {
+                slot = free_slots[j];
+                free_slots[j] = free_slots[--free_len];
+            } else {
+                slot = new_count++;
+                slot_names[slot] = s->vars[i].var_name;
+            }
+            remap[i] = slot;
+            alloc_slots[alloc_len++] = slot;
+        }
+    }
+    if (new_count == var_count)
+        goto done;
+
+    vars = js_malloc(ctx, sizeof(vars[0]) * new_count);
+    if (!vars) {
+        js_free(ctx, remap);
+        return -1;
+    }
+    /* the first variable of a slot gives its definition */
+    for(slot = 0; slot < new_count; slot++)
+        var_next[slot] = 0;
+    for(i = 0; i < var_count; i++) {
+        slot = remap[i];
+        if (!var_next[slot]) {
+            var_next[slot] = 1;
+            vars[slot] = s->vars[i];
+            if (vars[slot].scope_next >= 0)
+                vars[slot].scope_next = remap[vars[slot].scope_next];
+        } else {
+            JS_FreeAtom(ctx, s->vars[i].var_name);
+        }
+    }
+    js_free(ctx, s->vars);
+    s->vars = vars;
+    s->var_count = new_count;
+    s->var_size = new_count;
+
+    for(scope = 0; scope < scope_count; scope++) {
+        if (s->scopes[scope].first >= 0)
+            s->scopes[scope].first = remap[s->scopes[scope].first];
+    }
+    for(j = 0; j < countof(fixed_idx); j++) {
+        if (*fixed_idx[j] >= 0)
+            *fixed_idx[j] = remap[*fixed_idx[j]];
+    }
+
+    bc_buf = s->byte_code.buf;
+    for(pos = 0; pos < s->byte_code.size; pos += opcode_info[op].size) {
+        op = bc_buf[pos];
+        if (opcode_info[op].fmt == OP_FMT_loc)
+            put_u16(bc_buf + pos + 1, remap[get_u16(bc_buf + pos + 1)]);
+        else if (op == OP_make_loc_ref)
+            put_u16(bc_buf + pos + 5, remap[get_u16(bc_buf + pos + 5)]);
+    }
+
+    /* the child functions reference the captured variables by index */
+    for(i = 0; i < s->cpool_count; i++) {
+        JSValueConst val = s->cpool[i];
+        if (JS_VALUE_GET_TAG(val) == JS_TAG_FUNCTION_BYTECODE) {
+            JSFunctionBytecode *b = JS_VALUE_GET_PTR(val);
+            for(j = 0; j < b->closure_var_count; j++) {
+                JSClosureVar *cv = &b->closure_var[j];
+                if (cv->closure_type == JS_CLOSURE_LOCAL)
+                    cv->var_idx = remap[cv->var_idx];
+            }
+        }
+    }
+ done:
+    js_free(ctx, remap);
+    return 0;
+}
+
 /* the pc2line table gives a source position for each PC value */
 static void add_pc2line_info(JSFunctionDef *s, uint32_t pc, uint32_t source_pos)
 {
@@ -34341,7 +36703,7 @@ static __exception int resolve_labels(JSContext *ctx, JSFunctionDef *s)
         case OP_call_method:
             {
                 /* detect and transform tail calls */
-                int argc;
+                int argc, pos1;
                 argc = get_u16(bc_buf + pos + 1);
                 if (code_match(&cc, pos_next, OP_return, -1)) {
                     if (cc.line_num >= 0) line_num = cc.line_num;
@@ -34350,6 +36712,28 @@ static __exception int resolve_labels(JSContext *ctx, JSFunctionDef *s)
                     pos_next = skip_dead_code(s, bc_buf, bc_len, cc.pos, &line_num);
                     break;
                 }
+                if (OPTIMIZE) {
+                    /* return after a label or a jump, e.g. in
+                       'return a ? f() : g()' */
+                    pos1 = pos_next;
+                    while (code_match(&cc, pos1, OP_label, -1))
+                        pos1 = cc.pos;
+                    op1 = OP_invalid;
+                    if (code_match(&cc, pos1, OP_goto, -1)) {
+                        label = find_jump_target(s, cc.label, &op1, NULL);
+                        /* the goto is resolved when it is reached */
+                        update_label(s, label, -1);
+                        update_label(s, cc.label, +1);
+                    } else if (code_match(&cc, pos1, OP_return, -1)) {
+                        op1 = OP_return;
+                    }
+                    if (op1 == OP_return) {
+                        add_pc2line_info(s, bc_out.size, line_num);
+                        put_short_code(&bc_out, op + 1, argc);
+                        pos_next = skip_dead_code(s, bc_buf, bc_len, pos_next, &line_num);
+                        break;
+                    }
+                }
                 add_pc2line_info(s, bc_out.size, line_num);
                 put_short_code(&bc_out, op, argc);
                 break;
@@ -34682,6 +37066,11 @@ static __exception int resolve_labels(JSContext *ctx, JSFunctionDef *s)
                     pos_next = cc.pos;
                     break;
                 }
+                /* transformation: push_atom_value(x) to_propkey -> push_atom_value(x) */
+                if (code_match(&cc, pos_next, OP_to_propkey, -1)) {
+                    if (cc.line_num >= 0) line_num = cc.line_num;
+                    pos_next = cc.pos;
+                }
 #if SHORT_OPCODES
                 if (atom == JS_ATOM_empty_string) {
                     JS_FreeAtom(ctx, atom);
@@ -34758,6 +37147,7 @@ static __exception int resolve_labels(JSContext *ctx, JSFunctionDef *s)
                     add_pc2line_info(s, bc_out.size, line_num);
                     dbuf_putc(&bc_out, OP_put_field);
                     dbuf_put_u32(&bc_out, cc.atom);
+                    dbuf_put_u16(&bc_out, 0);
                     pos_next = cc.pos;
                     break;
                 }
@@ -34768,6 +37158,14 @@ static __exception int resolve_labels(JSContext *ctx, JSFunctionDef *s)
             if (OPTIMIZE) {
                 /* Transformation: dup put_x(n) drop -> put_x(n) */
                 int op1, line2 = -1;
+                if (code_match(&cc, pos_next, OP_put_var, -1, OP_drop, -1)) {
+                    if (cc.line_num >= 0) line_num = cc.line_num;
+                    add_pc2line_info(s, bc_out.size, line_num);
+                    dbuf_putc(&bc_out, OP_put_var);
+                    dbuf_put_u16(&bc_out, cc.idx);
+                    pos_next = cc.pos;
+                    break;
+                }
                 /* Transformation: dup put_x(n) -> set_x(n) */
                 if (code_match(&cc, pos_next, M4(OP_put_loc, OP_put_loc_check, OP_put_arg, OP_put_var_ref), -1, -1)) {
                     if (cc.line_num >= 0) line_num = cc.line_num;
@@ -34881,10 +37279,13 @@ static __exception int resolve_labels(JSContext *ctx, JSFunctionDef *s)
         case OP_put_arg:
         case OP_put_var_ref:
             if (OPTIMIZE) {
-                /* transformation: put_x(n) get_x(n) -> set_x(n) */
+                /* transformation: put_x(n) get_x(n) -> set_x(n)
+                   put_loc(n) get_loc_check(n) -> set_loc(n) */
                 int idx;
                 idx = get_u16(bc_buf + pos + 1);
-                if (code_match(&cc, pos_next, op - 1, idx, -1)) {
+                if (code_match(&cc, pos_next, op - 1, idx, -1) ||
+                    (op == OP_put_loc &&
+                     code_match(&cc, pos_next, OP_get_loc_check, idx, -1))) {
                     if (cc.line_num >= 0) line_num = cc.line_num;
                     add_pc2line_info(s, bc_out.size, line_num);
                     put_short_code(&bc_out, op + 1, idx);
@@ -34927,6 +37328,7 @@ static __exception int resolve_labels(JSContext *ctx, JSFunctionDef *s)
                     dbuf_putc(&bc_out, OP_dec + (op - OP_post_dec));
                     dbuf_putc(&bc_out, OP_put_field);
                     dbuf_put_u32(&bc_out, cc.atom);
+                    dbuf_put_u16(&bc_out, 0);
                     pos_next = cc.pos;
                     break;
                 }
@@ -35350,6 +37752,244 @@ static __exception int compute_stack_size(JSContext *ctx,
     return -1;
 }
 
+#if SHORT_OPCODES
+/* replace the first opcode of the frequent opcode pairs with a
+   super-instruction. The opcode sizes are not modified, so the jumps
+   to the second opcode of a pair are still valid. */
+static void fuse_opcodes(JSContext *ctx, uint8_t *bc_buf, int bc_len)
+{
+    int pos, pos_next, op, op1;
+
+    for (pos = 0; pos < bc_len; pos = pos_next) {
+        op = bc_buf[pos];
+        pos_next = pos + short_opcode_info(op).size;
+        if (pos_next >= bc_len)
+            break;
+        op1 = bc_buf[pos_next];
+        switch(op) {
+        case OP_lt:
+            if (op1 == OP_if_false8)
+                op = OP_lt_if_false8;
+            break;
+        case OP_gt:
+            if (op1 == OP_if_false8)
+                op = OP_gt_if_false8;
+            break;
+        case OP_inc_loc:
+            if (op1 == OP_goto8)
+                op = OP_inc_loc_goto8;
+            break;
+        case OP_get_loc0:
+            if (op1 == OP_get_loc1)
+                op = OP_get_loc0_loc1;
+            else if (op1 == OP_get_field2)
+                op = OP_get_loc0_get_field2;
+            break;
+        default:
+            break;
+        }
+#ifdef DUMP_SUPER_INSTRUCTIONS
+        if (op != bc_buf[pos])
+            ctx->rt->super_insn_sites[op]++;
+#endif
+        bc_buf[pos] = op;
+    }
+}
+#endif
+
+#ifdef DUMP_SUPER_INSTRUCTIONS
+static void js_dump_super_instructions(JSRuntime *rt)
+{
+    int op;
+
+    printf("%-20s %8s %14s\n", "SUPER-INSTRUCTION", "SITES", "EXECUTIONS");
+    for(op = OP_lt_if_false8; op <= OP_get_loc0_get_field2; op++) {
+        printf("%-20s %8u %14" PRIu64 "\n", short_opcode_info(op).name,
+               rt->super_insn_sites[op], rt->super_insn_count[op]);
+    }
+}
+#endif
+
+/* Number the inline cache slots of the final bytecode. If 'renumber'
+   is FALSE, only return the number of slots used by 'bc_buf'. */
+static int compute_ic_slots(uint8_t *bc_buf, int bc_len, BOOL renumber)
+{
+    int pos, op, ic_count, ic_idx;
+
+    ic_count = 0;
+    for (pos = 0; pos < bc_len; pos += short_opcode_info(op).size) {
+        op = bc_buf[pos];
+        switch(op) {
+        case OP_get_field:
+        case OP_get_field2:
+        case OP_put_field:
+            if (renumber) {
+                if (ic_count >= JS_IC_MAX_COUNT) {
+                    ic_idx = JS_IC_MAX_COUNT;
+                } else {
+                    ic_idx = ic_count++;
+                }
+                put_u16(bc_buf + pos + 5, ic_idx);
+            } else {
+                ic_idx = get_u16(bc_buf + pos + 5);
+                if (ic_idx != JS_IC_MAX_COUNT)
+                    ic_count = max_int(ic_count, ic_idx + 1);
+            }
+            break;
+        default:
+            break;
+        }
+    }
+    return ic_count;
+}
+
+/* allocate one slot per opcode recording the type feedback */
+static JSTypeFeedback *js_feedback_new(JSRuntime *rt, JSFunctionBytecode *b)
+{
+    JSTypeFeedback *fb;
+    int pos, op, count;
+
+    /* the fused and quickened opcodes are at the position of the
+       opcode they replace */
+    count = 0;
+    for(pos = 0; pos < b->byte_code_len; pos += short_opcode_info(op).size) {
+        op = js_unfuse_op(b->byte_code_buf[pos]);
+        if (IS_FEEDBACK_OPCODE(op))
+            count++;
+    }
+    fb = js_mallocz_rt(rt, sizeof(*fb) + count * (sizeof(fb->pos[0]) + 1));
+    if (!fb)
+        return NULL;
+    fb->types = (uint8_t *)(fb->pos + count);
+    for(pos = 0; pos < b->byte_code_len; pos += short_opcode_info(op).size) {
+        op = js_unfuse_op(b->byte_code_buf[pos]);
+        if (IS_FEEDBACK_OPCODE(op))
+            fb->pos[fb->count++] = pos;
+    }
+    return fb;
+}
+
+static const char *js_feedback_op_name(int op)
+{
+    switch(op) {
+    case OP_add: return "add";
+    case OP_add_loc: return "add_loc";
+    case OP_sub: return "sub";
+    case OP_mul: return "mul";
+    case OP_div: return "div";
+    case OP_lt: return "lt";
+    case OP_lte: return "lte";
+    case OP_gt: return "gt";
+    case OP_gte: return "gte";
+    case OP_eq: return "eq";
+    case OP_neq: return "neq";
+    case OP_strict_eq: return "strict_eq";
+    case OP_strict_neq: return "strict_neq";
+    case OP_instanceof: return "instanceof";
+    case OP_in: return "in";
+    case OP_get_array_el: return "get_array_el";
+    case OP_get_array_el2: return "get_array_el2";
+    case OP_put_array_el: return "put_array_el";
+    case OP_get_field: return "get_field";
+    case OP_get_field2: return "get_field2";
+    case OP_get_length: return "get_length";
+    case OP_put_field: return "put_field";
+    default: return "?";
+    }
+}
+
+static int js_feedback_cmp(const void *a, const void *b, void *opaque)
+{
+    JSFunctionBytecode *b1 = *(JSFunctionBytecode **)a;
+    JSFunctionBytecode *b2 = *(JSFunctionBytecode **)b;
+    int64_t c1 = b1->feedback->call_count;
+    int64_t c2 = b2->feedback->call_count;
+    return (c1 < c2) - (c1 > c2);
+}
+
+/* dump the type feedback of the live functions, most called first */
+void JS_DumpTypeFeedback(FILE *fp, JSRuntime *rt)
+{
+    static const char flag_names[8][12] = {
+        "int32", "float64", "string", "other", "object", "array",
+        "typed_array", "megamorphic",
+    };
+    struct list_head *el;
+    JSFunctionBytecode *b, **tab;
+    JSTypeFeedback *fb;
+    char buf[ATOM_GET_STR_BUF_SIZE];
+    int count, i, j, k, pos, op, flags, line_num, col_num, n;
+    BOOL is_poly;
+
+    gc_merge_young(rt);
+    count = 0;
+    list_for_each(el, &rt->gc_obj_list) {
+        JSGCObjectHeader *gp = list_entry(el, JSGCObjectHeader, link);
+        if (gp->gc_obj_type == JS_GC_OBJ_TYPE_FUNCTION_BYTECODE &&
+            ((JSFunctionBytecode *)gp)->feedback)
+            count++;
+    }
+    if (count == 0)
+        return;
+    tab = js_malloc_rt(rt, sizeof(tab[0]) * count);
+    if (!tab)
+        return;
+    i = 0;
+    list_for_each(el, &rt->gc_obj_list) {
+        JSGCObjectHeader *gp = list_entry(el, JSGCObjectHeader, link);
+        if (gp->gc_obj_type == JS_GC_OBJ_TYPE_FUNCTION_BYTECODE &&
+            ((JSFunctionBytecode *)gp)->feedback)
+            tab[i++] = (JSFunctionBytecode *)gp;
+    }
+    rqsort(tab, count, sizeof(tab[0]), js_feedback_cmp, NULL);
+
+    for(i = 0; i < count; i++) {
+        b = tab[i];
+        fprintf(fp, "%s", b->func_name != JS_ATOM_NULL ?
+                JS_AtomGetStrRT(rt, buf, sizeof(buf), b->func_name) : "<anonymous>");
+        if (b->has_debug) {
+            line_num = find_line_num(b->realm, b, -1, &col_num);
+            fprintf(fp, " (%s:%d:%d)",
+                    JS_AtomGetStrRT(rt, buf, sizeof(buf), b->debug.filename),
+                    line_num, col_num);
+        }
+        fb = b->feedback;
+        fprintf(fp, " calls=%" PRId64 "\n", fb->call_count);
+        for(k = 0; k < fb->count; k++) {
+            pos = fb->pos[k];
+            op = js_unfuse_op(b->byte_code_buf[pos]);
+            flags = fb->types[k];
+            if (!flags)
+                continue;
+            line_num = find_line_num(b->realm, b, pos, &col_num);
+            fprintf(fp, "  %5d %5d:%-3d %-13s", pos, line_num, col_num,
+                    js_feedback_op_name(op));
+            for(j = 0; j < 8; j++) {
+                if (flags & (1 << j))
+                    fprintf(fp, " %s", flag_names[j]);
+            }
+            n = 0;
+            if ((op == OP_get_field || op == OP_get_field2 ||
+                 op == OP_put_field) && b->ic) {
+                int ic_idx = get_u16(b->byte_code_buf + pos + 5);
+                if (ic_idx < b->ic_count) {
+                    n = b->ic[ic_idx].count;
+                    fprintf(fp, " shapes=%d", n);
+                }
+            }
+            if (js_unquicken_op(b->byte_code_buf[pos]) != b->byte_code_buf[pos])
+                fprintf(fp, " QUICKENED");
+            flags &= JS_FEEDBACK_TYPE_MASK;
+            is_poly = (flags & (flags - 1)) != 0 || n > 1 ||
+                (fb->types[k] & JS_FEEDBACK_MEGAMORPHIC);
+            if (is_poly)
+                fprintf(fp, " POLYMORPHIC");
+            fprintf(fp, "\n");
+        }
+    }
+    js_free_rt(rt, tab);
+}
+
 static int add_global_variables(JSContext *ctx, JSFunctionDef *fd)
 {
     int i, idx;
@@ -35499,6 +38139,9 @@ static JSValue js_create_function(JSContext *ctx, JSFunctionDef *fd)
     if (resolve_variables(ctx, fd))
         goto fail;
 
+    if (OPTIMIZE && reuse_var_slots(ctx, fd))
+        goto fail;
+
 #if defined(DUMP_BYTECODE) && (DUMP_BYTECODE & 2)
     if (!fd->strip_debug) {
         printf("pass 2\n");
@@ -35517,6 +38160,11 @@ static JSValue js_create_function(JSContext *ctx, JSFunctionDef *fd)
     if (compute_stack_size(ctx, fd, &stack_size) < 0)
         goto fail;
 
+#if SHORT_OPCODES
+    if (OPTIMIZE)
+        fuse_opcodes(ctx, fd->byte_code.buf, fd->byte_code.size);
+#endif
+
     if (fd->strip_debug) {
         function_size = offsetof(JSFunctionBytecode, debug);
     } else {
@@ -35541,6 +38189,7 @@ static JSValue js_create_function(JSContext *ctx, JSFunctionDef *fd)
     memcpy(b->byte_code_buf, fd->byte_code.buf, fd->byte_code.size);
     js_free(ctx, fd->byte_code.buf);
     fd->byte_code.buf = NULL;
+    b->ic_count = compute_ic_slots(b->byte_code_buf, b->byte_code_len, TRUE);
 
     strip_var_debug = fd->strip_debug && !fd->has_eval_call; /* XXX: check */
     b->func_name = fd->func_name;
@@ -35679,6 +38328,1148 @@ static JSValue js_create_function(JSContext *ctx, JSFunctionDef *fd)
     return JS_EXCEPTION;
 }
 
+#ifdef CONFIG_JIT
+
+/* Baseline JIT compiler for x86-64.
+
+   The bytecode of the hot functions is translated by stitching one
+   machine code template per opcode. The templates use the same stack
+   frame as the interpreter and only contain the fast paths (int32 and
+   float64 arithmetic, comparisons, local variables, fast array
+   accesses and jumps). Any other opcode or failed fast path exits to
+   the interpreter at the pc of the opcode, so that the native code
+   never raises exceptions. The interpreter enters the native code at
+   the function start and at the targets of the backward jumps.
+
+   Register usage in the native code:
+   rbx: JSContext, r12: var_buf, r13: arg_buf, r14: sp, r15: JSJitFrame
+*/
+
+#define JS_JIT_THRESHOLD 500 /* number of calls and loop iterations */
+
+typedef struct JSJitFrame {
+    JSValue *sp;
+    JSValue *var_buf;
+    JSValue *arg_buf;
+    JSContext *ctx;
+} JSJitFrame;
+
+/* return the pc offset where the interpreter must continue */
+typedef int JSJitEntryFunc(JSJitFrame *f, const uint8_t *native_pc);
+
+typedef struct JSJitCode {
+    struct list_head link; /* JSRuntime.jit_code_list */
+    uint8_t *code; /* mapped executable memory */
+    size_t code_size;
+    /* byte_code_len elements: native offset of the opcodes, -1 if no
+       opcode, -2 - offset if the opcode immediately exits */
+    int32_t pc_to_native[0];
+} JSJitCode;
+
+typedef struct JSJitFixup {
+    uint32_t pos; /* position of the rel32 field */
+    uint32_t pc; /* target bytecode offset */
+} JSJitFixup;
+
+typedef struct JSJitState {
+    JSContext *ctx;
+    JSFunctionBytecode *b;
+    DynBuf dbuf;
+    int32_t *pc_to_native;
+    JSJitFixup *jumps; /* jumps to bytecode labels */
+    int jump_count;
+    int jump_size;
+    JSJitFixup *exits; /* jumps to the exit stubs */
+    int exit_count;
+    int exit_size;
+    int exit_pos; /* position of the common exit code */
+} JSJitState;
+
+enum {
+    R_AX, R_CX, R_DX, R_BX, R_SP, R_BP, R_SI, R_DI,
+    R_8, R_9, R_10, R_11, R_12, R_13, R_14, R_15,
+};
+
+#define R_CTX   R_BX
+#define R_VAR   R_12
+#define R_ARG   R_13
+#define R_STK   R_14
+#define R_FRAME R_15
+
+enum {
+    CC_O = 0x0, CC_NO = 0x1, CC_B = 0x2, CC_AE = 0x3,
+    CC_E = 0x4, CC_NE = 0x5, CC_BE = 0x6, CC_A = 0x7,
+    CC_S = 0x8, CC_NS = 0x9, CC_L = 0xc, CC_GE = 0xd,
+    CC_LE = 0xe, CC_G = 0xf,
+};
+
+/* group 1 opcodes (ALU operations) */
+enum {
+    ALU_ADD = 0, ALU_OR = 1, ALU_AND = 4, ALU_SUB = 5, ALU_XOR = 6, ALU_CMP = 7,
+};
+
+/* offsets of the JSValue fields */
+#define JV_U(n)   ((n) * (int)sizeof(JSValue))
+#define JV_TAG(n) ((n) * (int)sizeof(JSValue) + (int)offsetof(JSValue, tag))
+
+static void jit_put8(JSJitState *s, int v)
+{
+    dbuf_putc(&s->dbuf, v);
+}
+
+static void jit_put32(JSJitState *s, uint32_t v)
+{
+    dbuf_put_u32(&s->dbuf, v);
+}
+
+static void jit_put64(JSJitState *s, uint64_t v)
+{
+    dbuf_put_u32(&s->dbuf, v);
+    dbuf_put_u32(&s->dbuf, v >> 32);
+}
+
+static void jit_rex(JSJitState *s, int w, int reg, int base)
+{
+    int rex = 0x40 | (w << 3) | ((reg >> 3) << 2) | (base >> 3);
+    if (rex != 0x40)
+        jit_put8(s, rex);
+}
+
+/* 'op' is up to 2 opcode bytes (0x0f prefixed opcodes) */
+static void jit_op(JSJitState *s, int op)
+{
+    if (op > 0xff)
+        jit_put8(s, op >> 8);
+    jit_put8(s, op & 0xff);
+}
+
+/* op reg, [base + disp]. 'prefix' is the optional mandatory prefix
+   of the SSE instructions. */
+static void jit_mem(JSJitState *s, int prefix, int w, int op, int reg,
+                    int base, int32_t disp)
+{
+    if (prefix)
+        jit_put8(s, prefix);
+    jit_rex(s, w, reg, base);
+    jit_op(s, op);
+    jit_put8(s, 0x80 | ((reg & 7) << 3) | (base & 7));
+    if ((base & 7) == R_SP)
+        jit_put8(s, 0x24);
+    jit_put32(s, disp);
+}
+
+/* op reg, rm */
+static void jit_reg(JSJitState *s, int prefix, int w, int op, int reg, int rm)
+{
+    if (prefix)
+        jit_put8(s, prefix);
+    jit_rex(s, w, reg, rm);
+    jit_op(s, op);
+    jit_put8(s, 0xc0 | ((reg & 7) << 3) | (rm & 7));
+}
+
+static void jit_load64(JSJitState *s, int reg, int base, int32_t disp)
+{
+    jit_mem(s, 0, 1, 0x8b, reg, base, disp);
+}
+
+static void jit_store64(JSJitState *s, int reg, int base, int32_t disp)
+{
+    jit_mem(s, 0, 1, 0x89, reg, base, disp);
+}
+
+static void jit_load32(JSJitState *s, int reg, int base, int32_t disp)
+{
+    jit_mem(s, 0, 0, 0x8b, reg, base, disp);
+}
+
+/* mov qword [base + disp], sign extended imm */
+static void jit_store_imm64(JSJitState *s, int base, int32_t disp, int32_t imm)
+{
+    jit_mem(s, 0, 1, 0xc7, 0, base, disp);
+    jit_put32(s, imm);
+}
+
+static void jit_mov_imm64(JSJitState *s, int reg, uint64_t imm)
+{
+    jit_rex(s, 1, 0, reg);
+    jit_put8(s, 0xb8 + (reg & 7));
+    jit_put64(s, imm);
+}
+
+/* zero extended to 64 bits */
+static void jit_mov_imm32(JSJitState *s, int reg, uint32_t imm)
+{
+    jit_rex(s, 0, 0, reg);
+    jit_put8(s, 0xb8 + (reg & 7));
+    jit_put32(s, imm);
+}
+
+static void jit_mov(JSJitState *s, int dst, int src)
+{
+    jit_reg(s, 0, 1, 0x89, src, dst);
+}
+
+/* alu dst, src */
+static void jit_alu(JSJitState *s, int alu_op, int w, int dst, int src)
+{
+    jit_reg(s, 0, w, (alu_op << 3) | 0x01, src, dst);
+}
+
+/* alu reg, [base + disp] */
+static void jit_alu_mem(JSJitState *s, int alu_op, int w, int reg,
+                        int base, int32_t disp)
+{
+    jit_mem(s, 0, w, (alu_op << 3) | 0x03, reg, base, disp);
+}
+
+static void jit_alu_imm(JSJitState *s, int alu_op, int w, int reg, int32_t imm)
+{
+    jit_reg(s, 0, w, 0x81, alu_op, reg);
+    jit_put32(s, imm);
+}
+
+static void jit_alu_mem_imm(JSJitState *s, int alu_op, int w,
+                            int base, int32_t disp, int32_t imm)
+{
+    jit_mem(s, 0, w, 0x81, alu_op, base, disp);
+    jit_put32(s, imm);
+}
+
+/* inc/dec dword [base + disp] */
+static void jit_inc_mem32(JSJitState *s, int base, int32_t disp)
+{
+    jit_mem(s, 0, 0, 0xff, 0, base, disp);
+}
+
+static void jit_dec_mem32(JSJitState *s, int base, int32_t disp)
+{
+    jit_mem(s, 0, 0, 0xff, 1, base, disp);
+}
+
+static void jit_push(JSJitState *s, int reg)
+{
+    jit_rex(s, 0, 0, reg);
+    jit_put8(s, 0x50 + (reg & 7));
+}
+
+static void jit_pop(JSJitState *s, int reg)
+{
+    jit_rex(s, 0, 0, reg);
+    jit_put8(s, 0x58 + (reg & 7));
+}
+
+static void jit_call_func(JSJitState *s, void *func)
+{
+    jit_mov_imm64(s, R_AX, (uintptr_t)func);
+    jit_reg(s, 0, 0, 0xff, 2, R_AX);
+}
+
+/* setcc al; movzx eax, al */
+static void jit_setcc(JSJitState *s, int cc)
+{
+    jit_put8(s, 0x0f);
+    jit_put8(s, 0x90 + cc);
+    jit_put8(s, 0xc0);
+    jit_reg(s, 0, 0, 0x0fb6, R_AX, R_AX);
+}
+
+/* forward jcc with 8 bit displacement, patched with jit_patch8() */
+static int jit_jcc8(JSJitState *s, int cc)
+{
+    jit_put8(s, 0x70 + cc);
+    jit_put8(s, 0);
+    return s->dbuf.size;
+}
+
+static int jit_jmp8(JSJitState *s)
+{
+    jit_put8(s, 0xeb);
+    jit_put8(s, 0);
+    return s->dbuf.size;
+}
+
+static void jit_patch8(JSJitState *s, int pos)
+{
+    int d = s->dbuf.size - pos;
+    assert(d < 128);
+    s->dbuf.buf[pos - 1] = d;
+}
+
+static int jit_add_fixup(JSJitState *s, JSJitFixup **ptab, int *pcount,
+                         int *psize, uint32_t pc)
+{
+    JSJitFixup *f;
+    if (js_resize_array(s->ctx, (void **)ptab, sizeof(**ptab), psize,
+                        *pcount + 1))
+        return -1;
+    f = &(*ptab)[(*pcount)++];
+    f->pos = s->dbuf.size;
+    f->pc = pc;
+    return 0;
+}
+
+/* jump to the native code of bytecode offset 'pc' */
+static int jit_jcc_label(JSJitState *s, int cc, uint32_t pc)
+{
+    if (cc < 0) {
+        jit_put8(s, 0xe9);
+    } else {
+        jit_put8(s, 0x0f);
+        jit_put8(s, 0x80 + cc);
+    }
+    if (jit_add_fixup(s, &s->jumps, &s->jump_count, &s->jump_size, pc))
+        return -1;
+    jit_put32(s, 0);
+    return 0;
+}
+
+/* exit to the interpreter at bytecode offset 'pc' ('cc' < 0 for an
+   unconditional exit) */
+static int jit_exit(JSJitState *s, int cc, uint32_t pc)
+{
+    if (cc < 0) {
+        jit_put8(s, 0xe9);
+    } else {
+        jit_put8(s, 0x0f);
+        jit_put8(s, 0x80 + cc);
+    }
+    if (jit_add_fixup(s, &s->exits, &s->exit_count, &s->exit_size, pc))
+        return -1;
+    jit_put32(s, 0);
+    return 0;
+}
+
+static void jit_free_value(JSRuntime *rt, int64_t tag, void *ptr)
+{
+    __JS_FreeValueRT(rt, JS_MKPTR(tag, ptr));
+}
+
+/* increment the reference count of the value (ptr_reg, tag_reg) */
+static void jit_dup(JSJitState *s, int ptr_reg, int tag_reg)
+{
+    int l;
+    jit_alu(s, ALU_OR, 1, tag_reg, tag_reg);
+    l = jit_jcc8(s, CC_NS);
+    jit_inc_mem32(s, ptr_reg, 0);
+    jit_patch8(s, l);
+}
+
+/* free the value (rdx = ptr, rsi = tag). All the caller saved registers
+   are modified. */
+static void jit_free(JSJitState *s)
+{
+    int l1, l2;
+    jit_alu(s, ALU_OR, 1, R_SI, R_SI);
+    l1 = jit_jcc8(s, CC_NS);
+    jit_dec_mem32(s, R_DX, 0);
+    l2 = jit_jcc8(s, CC_NE);
+    jit_load64(s, R_DI, R_CTX, offsetof(JSContext, rt));
+    jit_call_func(s, jit_free_value);
+    jit_patch8(s, l1);
+    jit_patch8(s, l2);
+}
+
+/* push the value at [base + disp] */
+static void jit_push_value(JSJitState *s, int base, int32_t disp)
+{
+    jit_load64(s, R_AX, base, disp);
+    jit_load64(s, R_DX, base, disp + offsetof(JSValue, tag));
+    jit_store64(s, R_AX, R_STK, JV_U(0));
+    jit_store64(s, R_DX, R_STK, JV_TAG(0));
+    jit_dup(s, R_AX, R_DX);
+    jit_alu_imm(s, ALU_ADD, 1, R_STK, sizeof(JSValue));
+}
+
+static void jit_push_int32(JSJitState *s, int tag, int32_t v)
+{
+    jit_mov_imm32(s, R_AX, v);
+    jit_store64(s, R_AX, R_STK, JV_U(0));
+    jit_store_imm64(s, R_STK, JV_TAG(0), tag);
+    jit_alu_imm(s, ALU_ADD, 1, R_STK, sizeof(JSValue));
+}
+
+/* store the top of the stack to [base + disp] and free the previous
+   value. If 'keep', the value is duplicated and stays on the stack. */
+static void jit_put_value(JSJitState *s, int base, int32_t disp, BOOL keep)
+{
+    jit_load64(s, R_DX, base, disp);
+    jit_load64(s, R_SI, base, disp + offsetof(JSValue, tag));
+    jit_load64(s, R_AX, R_STK, JV_U(-1));
+    jit_load64(s, R_CX, R_STK, JV_TAG(-1));
+    jit_store64(s, R_AX, base, disp);
+    jit_store64(s, R_CX, base, disp + offsetof(JSValue, tag));
+    if (keep) {
+        jit_dup(s, R_AX, R_CX);
+    } else {
+        jit_alu_imm(s, ALU_SUB, 1, R_STK, sizeof(JSValue));
+    }
+    jit_free(s);
+}
+
+/* load the number at [base + disp] into xmm 'xreg' or exit if it is
+   not a number */
+static int jit_load_number(JSJitState *s, int xreg, int base, int32_t disp,
+                           uint32_t pc)
+{
+    int l1, l2;
+    jit_load64(s, R_AX, base, disp + offsetof(JSValue, tag));
+    jit_alu(s, ALU_OR, 1, R_AX, R_AX);
+    l1 = jit_jcc8(s, CC_NE);
+    jit_mem(s, 0xf2, 0, 0x0f2a, xreg, base, disp); /* cvtsi2sd */
+    l2 = jit_jmp8(s);
+    jit_patch8(s, l1);
+    jit_alu_imm(s, ALU_CMP, 1, R_AX, JS_TAG_FLOAT64);
+    if (jit_exit(s, CC_NE, pc))
+        return -1;
+    jit_mem(s, 0xf2, 0, 0x0f10, xreg, base, disp); /* movsd */
+    jit_patch8(s, l2);
+    return 0;
+}
+
+/* rax = tag(sp[-2]) | tag(sp[-1]), zero if both are int32 */
+static void jit_or_tags(JSJitState *s)
+{
+    jit_load64(s, R_AX, R_STK, JV_TAG(-2));
+    jit_alu_mem(s, ALU_OR, 1, R_AX, R_STK, JV_TAG(-1));
+}
+
+static int jit_binary_arith(JSJitState *s, int op, uint32_t pc)
+{
+    int l_float, l_done, l_ok, sse_op;
+
+    jit_or_tags(s);
+    l_float = jit_jcc8(s, CC_NE);
+    jit_load32(s, R_AX, R_STK, JV_U(-2));
+    switch(op) {
+    case OP_add:
+        jit_alu_mem(s, ALU_ADD, 0, R_AX, R_STK, JV_U(-1));
+        break;
+    case OP_sub:
+        jit_alu_mem(s, ALU_SUB, 0, R_AX, R_STK, JV_U(-1));
+        break;
+    default: /* OP_mul */
+        jit_mem(s, 0, 0, 0x0faf, R_AX, R_STK, JV_U(-1)); /* imul */
+        break;
+    }
+    if (jit_exit(s, CC_O, pc))
+        return -1;
+    if (op == OP_mul) {
+        /* -0 result */
+        jit_alu(s, ALU_OR, 0, R_AX, R_AX);
+        l_ok = jit_jcc8(s, CC_NE);
+        jit_load32(s, R_CX, R_STK, JV_U(-2));
+        jit_alu_mem(s, ALU_OR, 0, R_CX, R_STK, JV_U(-1));
+        if (jit_exit(s, CC_S, pc))
+            return -1;
+        jit_patch8(s, l_ok);
+    }
+    jit_store64(s, R_AX, R_STK, JV_U(-2));
+    l_done = jit_jmp8(s);
+
+    jit_patch8(s, l_float);
+    if (jit_load_number(s, 0, R_STK, JV_U(-2), pc) ||
+        jit_load_number(s, 1, R_STK, JV_U(-1), pc))
+        return -1;
+    switch(op) {
+    case OP_add:
+        sse_op = 0x0f58;
+        break;
+    case OP_sub:
+        sse_op = 0x0f5c;
+        break;
+    default:
+        sse_op = 0x0f59;
+        break;
+    }
+    jit_reg(s, 0xf2, 0, sse_op, 0, 1);
+    jit_mem(s, 0xf2, 0, 0x0f11, 0, R_STK, JV_U(-2)); /* movsd */
+    jit_store_imm64(s, R_STK, JV_TAG(-2), JS_TAG_FLOAT64);
+
+    jit_patch8(s, l_done);
+    jit_alu_imm(s, ALU_SUB, 1, R_STK, sizeof(JSValue));
+    return 0;
+}
+
+static int jit_relational(JSJitState *s, int op, uint32_t pc)
+{
+    int l_float, l_done, cc;
+
+    jit_or_tags(s);
+    l_float = jit_jcc8(s, CC_NE);
+    jit_load32(s, R_AX, R_STK, JV_U(-2));
+    jit_alu_mem(s, ALU_CMP, 0, R_AX, R_STK, JV_U(-1));
+    switch(op) {
+    case OP_lt:
+        cc = CC_L;
+        break;
+    case OP_lte:
+        cc = CC_LE;
+        break;
+    case OP_gt:
+        cc = CC_G;
+        break;
+    default:
+        cc = CC_GE;
+        break;
+    }
+    jit_setcc(s, cc);
+    l_done = jit_jmp8(s);
+
+    jit_patch8(s, l_float);
+    if (jit_load_number(s, 0, R_STK, JV_U(-2), pc) ||
+        jit_load_number(s, 1, R_STK, JV_U(-1), pc))
+        return -1;
+    /* the unordered case (NaN) sets CF and ZF */
+    if (op == OP_lt || op == OP_lte)
+        jit_reg(s, 0x66, 0, 0x0f2e, 1, 0); /* ucomisd xmm1, xmm0 */
+    else
+        jit_reg(s, 0x66, 0, 0x0f2e, 0, 1); /* ucomisd xmm0, xmm1 */
+    jit_setcc(s, (op == OP_lt || op == OP_gt) ? CC_A : CC_AE);
+
+    jit_patch8(s, l_done);
+    jit_store64(s, R_AX, R_STK, JV_U(-2));
+    jit_store_imm64(s, R_STK, JV_TAG(-2), JS_TAG_BOOL);
+    jit_alu_imm(s, ALU_SUB, 1, R_STK, sizeof(JSValue));
+    return 0;
+}
+
+/* int32 only operations */
+static int jit_binary_int(JSJitState *s, int op, uint32_t pc)
+{
+    jit_or_tags(s);
+    if (jit_exit(s, CC_NE, pc))
+        return -1;
+    jit_load32(s, R_AX, R_STK, JV_U(-2));
+    switch(op) {
+    case OP_and:
+        jit_alu_mem(s, ALU_AND, 0, R_AX, R_STK, JV_U(-1));
+        break;
+    case OP_or:
+        jit_alu_mem(s, ALU_OR, 0, R_AX, R_STK, JV_U(-1));
+        break;
+    case OP_xor:
+        jit_alu_mem(s, ALU_XOR, 0, R_AX, R_STK, JV_U(-1));
+        break;
+    case OP_shl:
+    case OP_sar:
+    case OP_shr:
+        jit_load32(s, R_CX, R_STK, JV_U(-1));
+        /* shl/sar/shr eax, cl */
+        jit_reg(s, 0, 0, 0xd3, op == OP_shl ? 4 : (op == OP_sar ? 7 : 5), R_AX);
+        if (op == OP_shr) {
+            /* the result is not an int32 */
+            jit_alu(s, ALU_OR, 0, R_AX, R_AX);
+            if (jit_exit(s, CC_S, pc))
+                return -1;
+        }
+        break;
+    default: /* strict_eq, strict_neq, eq, neq */
+        jit_alu_mem(s, ALU_CMP, 0, R_AX, R_STK, JV_U(-1));
+        jit_setcc(s, (op == OP_eq || op == OP_strict_eq) ? CC_E : CC_NE);
+        jit_store_imm64(s, R_STK, JV_TAG(-2), JS_TAG_BOOL);
+        break;
+    }
+    jit_store64(s, R_AX, R_STK, JV_U(-2));
+    jit_alu_imm(s, ALU_SUB, 1, R_STK, sizeof(JSValue));
+    return 0;
+}
+
+/* add 'v' to the int32 at [base + disp] */
+static int jit_inc_int(JSJitState *s, int base, int32_t disp, int v,
+                       uint32_t pc)
+{
+    jit_alu_mem_imm(s, ALU_CMP, 1, base, disp + offsetof(JSValue, tag),
+                    JS_TAG_INT);
+    if (jit_exit(s, CC_NE, pc))
+        return -1;
+    jit_load32(s, R_AX, base, disp);
+    jit_alu_imm(s, ALU_ADD, 0, R_AX, v);
+    if (jit_exit(s, CC_O, pc))
+        return -1;
+    jit_store64(s, R_AX, base, disp);
+    return 0;
+}
+
+/* var_buf[idx] += sp[-1] for numbers */
+static int jit_add_loc(JSJitState *s, int idx, uint32_t pc)
+{
+    int l_float, l_done;
+
+    jit_load64(s, R_AX, R_VAR, JV_TAG(idx));
+    jit_alu_mem(s, ALU_OR, 1, R_AX, R_STK, JV_TAG(-1));
+    l_float = jit_jcc8(s, CC_NE);
+    jit_load32(s, R_AX, R_VAR, JV_U(idx));
+    jit_alu_mem(s, ALU_ADD, 0, R_AX, R_STK, JV_U(-1));
+    if (jit_exit(s, CC_O, pc))
+        return -1;
+    jit_store64(s, R_AX, R_VAR, JV_U(idx));
+    l_done = jit_jmp8(s);
+
+    jit_patch8(s, l_float);
+    if (jit_load_number(s, 0, R_VAR, JV_U(idx), pc) ||
+        jit_load_number(s, 1, R_STK, JV_U(-1), pc))
+        return -1;
+    jit_reg(s, 0xf2, 0, 0x0f58, 0, 1); /* addsd */
+    jit_mem(s, 0xf2, 0, 0x0f11, 0, R_VAR, JV_U(idx)); /* movsd */
+    jit_store_imm64(s, R_VAR, JV_TAG(idx), JS_TAG_FLOAT64);
+
+    jit_patch8(s, l_done);
+    jit_alu_imm(s, ALU_SUB, 1, R_STK, sizeof(JSValue));
+    return 0;
+}
+
+/* conditional jump: 'is_true' is the jump condition */
+static int jit_if(JSJitState *s, BOOL is_true, uint32_t pc, uint32_t target)
+{
+    if (target <= pc) {
+        /* poll the interrupts in the interpreter */
+        jit_dec_mem32(s, R_CTX, offsetof(JSContext, interrupt_counter));
+        if (jit_exit(s, CC_LE, pc))
+            return -1;
+    }
+    /* int32, bool, null and undefined */
+    jit_alu_mem_imm(s, ALU_CMP, 1, R_STK, JV_TAG(-1), JS_TAG_UNDEFINED);
+    if (jit_exit(s, CC_A, pc))
+        return -1;
+    jit_load32(s, R_AX, R_STK, JV_U(-1));
+    jit_alu_imm(s, ALU_SUB, 1, R_STK, sizeof(JSValue));
+    jit_alu(s, ALU_OR, 0, R_AX, R_AX);
+    return jit_jcc_label(s, is_true ? CC_NE : CC_E, target);
+}
+
+static int jit_goto(JSJitState *s, uint32_t pc, uint32_t target)
+{
+    if (target <= pc) {
+        jit_dec_mem32(s, R_CTX, offsetof(JSContext, interrupt_counter));
+        if (jit_exit(s, CC_LE, pc))
+            return -1;
+    }
+    return jit_jcc_label(s, -1, target);
+}
+
+/* r8 = JSObject of sp[n], ecx = index sp[n + 1] for a fast array
+   access */
+static int jit_array_index(JSJitState *s, int n, uint32_t pc)
+{
+    jit_alu_mem_imm(s, ALU_CMP, 1, R_STK, JV_TAG(n), JS_TAG_OBJECT);
+    if (jit_exit(s, CC_NE, pc))
+        return -1;
+    jit_alu_mem_imm(s, ALU_CMP, 1, R_STK, JV_TAG(n + 1), JS_TAG_INT);
+    if (jit_exit(s, CC_NE, pc))
+        return -1;
+    jit_load64(s, R_8, R_STK, JV_U(n));
+    jit_mem(s, 0, 0, 0x0fb7, R_AX, R_8, offsetof(JSObject, class_id)); /* movzx */
+    jit_alu_imm(s, ALU_CMP, 0, R_AX, JS_CLASS_ARRAY);
+    if (jit_exit(s, CC_NE, pc))
+        return -1;
+    jit_load32(s, R_CX, R_STK, JV_U(n + 1));
+    jit_alu_mem(s, ALU_CMP, 0, R_CX, R_8, offsetof(JSObject, u.array.count));
+    if (jit_exit(s, CC_AE, pc))
+        return -1;
+    /* r9 = &p->u.array.u.values[idx] */
+    jit_load64(s, R_9, R_8, offsetof(JSObject, u.array.u.values));
+    jit_reg(s, 0, 1, 0xc1, 4, R_CX); /* shl rcx, 4 */
+    jit_put8(s, 4);
+    jit_alu(s, ALU_ADD, 1, R_9, R_CX);
+    return 0;
+}
+
+/* free the object in r8 */
+static void jit_free_object_r8(JSJitState *s)
+{
+    jit_mov(s, R_DX, R_8);
+    jit_mov_imm64(s, R_SI, (uint64_t)(int64_t)JS_TAG_OBJECT);
+    jit_free(s);
+}
+
+static int jit_get_array_el(JSJitState *s, uint32_t pc)
+{
+    if (jit_array_index(s, -2, pc))
+        return -1;
+    jit_load64(s, R_AX, R_9, 0);
+    jit_load64(s, R_DX, R_9, offsetof(JSValue, tag));
+    jit_dup(s, R_AX, R_DX);
+    jit_store64(s, R_AX, R_STK, JV_U(-2));
+    jit_store64(s, R_DX, R_STK, JV_TAG(-2));
+    jit_alu_imm(s, ALU_SUB, 1, R_STK, sizeof(JSValue));
+    jit_free_object_r8(s);
+    return 0;
+}
+
+static int jit_put_array_el(JSJitState *s, uint32_t pc)
+{
+    if (jit_array_index(s, -3, pc))
+        return -1;
+    /* the object is saved in the spill slot */
+    jit_store64(s, R_8, R_SP, 0);
+    jit_load64(s, R_DX, R_9, 0);
+    jit_load64(s, R_SI, R_9, offsetof(JSValue, tag));
+    jit_load64(s, R_AX, R_STK, JV_U(-1));
+    jit_load64(s, R_CX, R_STK, JV_TAG(-1));
+    jit_store64(s, R_AX, R_9, 0);
+    jit_store64(s, R_CX, R_9, offsetof(JSValue, tag));
+    jit_alu_imm(s, ALU_SUB, 1, R_STK, 3 * sizeof(JSValue));
+    jit_free(s);
+    jit_load64(s, R_8, R_SP, 0);
+    jit_free_object_r8(s);
+    return 0;
+}
+
+/* length of an array */
+static int jit_get_length(JSJitState *s, uint32_t pc)
+{
+    jit_alu_mem_imm(s, ALU_CMP, 1, R_STK, JV_TAG(-1), JS_TAG_OBJECT);
+    if (jit_exit(s, CC_NE, pc))
+        return -1;
+    jit_load64(s, R_8, R_STK, JV_U(-1));
+    jit_mem(s, 0, 0, 0x0fb7, R_AX, R_8, offsetof(JSObject, class_id)); /* movzx */
+    jit_alu_imm(s, ALU_CMP, 0, R_AX, JS_CLASS_ARRAY);
+    if (jit_exit(s, CC_NE, pc))
+        return -1;
+    /* the length is the first property and it is an int32 or a float64 */
+    jit_load64(s, R_CX, R_8, offsetof(JSObject, prop));
+    jit_load64(s, R_AX, R_CX, offsetof(JSProperty, u.value));
+    jit_load64(s, R_DX, R_CX, offsetof(JSProperty, u.value) + offsetof(JSValue, tag));
+    jit_store64(s, R_AX, R_STK, JV_U(-1));
+    jit_store64(s, R_DX, R_STK, JV_TAG(-1));
+    jit_free_object_r8(s);
+    return 0;
+}
+
+/* return the local variable or argument index of the opcode or -1 */
+static int jit_get_var_index(const uint8_t *bc, int op, int base_op)
+{
+    switch(short_opcode_info(op).fmt) {
+    case OP_FMT_none_loc:
+    case OP_FMT_none_arg:
+        return op - base_op;
+    case OP_FMT_loc8:
+        return bc[1];
+    default:
+        return get_u16(bc + 1);
+    }
+}
+
+/* emit the code of one opcode. Return 1 if not supported. */
+static int jit_emit_op(JSJitState *s, uint32_t pc)
+{
+    JSFunctionBytecode *b = s->b;
+    const uint8_t *bc = b->byte_code_buf + pc;
+    int op = js_unfuse_op(bc[0]), idx, ret;
+    JSValue val;
+
+    ret = 0;
+    switch(op) {
+    case OP_push_i32:
+        jit_push_int32(s, JS_TAG_INT, get_u32(bc + 1));
+        break;
+    case OP_push_minus1:
+    case OP_push_0:
+    case OP_push_1:
+    case OP_push_2:
+    case OP_push_3:
+    case OP_push_4:
+    case OP_push_5:
+    case OP_push_6:
+    case OP_push_7:
+        jit_push_int32(s, JS_TAG_INT, op - OP_push_0);
+        break;
+    case OP_push_i8:
+        jit_push_int32(s, JS_TAG_INT, get_i8(bc + 1));
+        break;
+    case OP_push_i16:
+        jit_push_int32(s, JS_TAG_INT, get_i16(bc + 1));
+        break;
+    case OP_push_false:
+    case OP_push_true:
+        jit_push_int32(s, JS_TAG_BOOL, op == OP_push_true);
+        break;
+    case OP_undefined:
+        jit_push_int32(s, JS_TAG_UNDEFINED, 0);
+        break;
+    case OP_null:
+        jit_push_int32(s, JS_TAG_NULL, 0);
+        break;
+    case OP_push_const:
+    case OP_push_const8:
+        idx = (op == OP_push_const) ? get_u32(bc + 1) : bc[1];
+        /* the constant pool is kept alive by the function */
+        val = b->cpool[idx];
+        jit_mov_imm64(s, R_AX, (uintptr_t)JS_VALUE_GET_PTR(val));
+        jit_mov_imm64(s, R_DX, JS_VALUE_GET_TAG(val));
+        jit_store64(s, R_AX, R_STK, JV_U(0));
+        jit_store64(s, R_DX, R_STK, JV_TAG(0));
+        if (JS_VALUE_HAS_REF_COUNT(val))
+            jit_inc_mem32(s, R_AX, 0);
+        jit_alu_imm(s, ALU_ADD, 1, R_STK, sizeof(JSValue));
+        break;
+    case OP_get_loc:
+    case OP_get_loc8:
+    case OP_get_loc0:
+    case OP_get_loc1:
+    case OP_get_loc2:
+    case OP_get_loc3:
+        idx = jit_get_var_index(bc, op, OP_get_loc0);
+        jit_push_value(s, R_VAR, JV_U(idx));
+        break;
+    case OP_get_loc_check:
+        idx = get_u16(bc + 1);
+        jit_alu_mem_imm(s, ALU_CMP, 1, R_VAR, JV_TAG(idx), JS_TAG_UNINITIALIZED);
+        if (jit_exit(s, CC_E, pc))
+            return -1;
+        jit_push_value(s, R_VAR, JV_U(idx));
+        break;
+    case OP_put_loc:
+    case OP_put_loc8:
+    case OP_put_loc0:
+    case OP_put_loc1:
+    case OP_put_loc2:
+    case OP_put_loc3:
+        idx = jit_get_var_index(bc, op, OP_put_loc0);
+        jit_put_value(s, R_VAR, JV_U(idx), FALSE);
+        break;
+    case OP_set_loc:
+    case OP_set_loc8:
+    case OP_set_loc0:
+    case OP_set_loc1:
+    case OP_set_loc2:
+    case OP_set_loc3:
+        idx = jit_get_var_index(bc, op, OP_set_loc0);
+        jit_put_value(s, R_VAR, JV_U(idx), TRUE);
+        break;
+    case OP_put_loc_check:
+    case OP_set_loc_check:
+        idx = get_u16(bc + 1);
+        jit_alu_mem_imm(s, ALU_CMP, 1, R_VAR, JV_TAG(idx), JS_TAG_UNINITIALIZED);
+        if (jit_exit(s, CC_E, pc))
+            return -1;
+        jit_put_value(s, R_VAR, JV_U(idx), op == OP_set_loc_check);
+        break;
+    case OP_get_arg:
+    case OP_get_arg0:
+    case OP_get_arg1:
+    case OP_get_arg2:
+    case OP_get_arg3:
+        idx = jit_get_var_index(bc, op, OP_get_arg0);
+        jit_push_value(s, R_ARG, JV_U(idx));
+        break;
+    case OP_put_arg:
+    case OP_put_arg0:
+    case OP_put_arg1:
+    case OP_put_arg2:
+    case OP_put_arg3:
+        idx = jit_get_var_index(bc, op, OP_put_arg0);
+        jit_put_value(s, R_ARG, JV_U(idx), FALSE);
+        break;
+    case OP_set_arg:
+    case OP_set_arg0:
+    case OP_set_arg1:
+    case OP_set_arg2:
+    case OP_set_arg3:
+        idx = jit_get_var_index(bc, op, OP_set_arg0);
+        jit_put_value(s, R_ARG, JV_U(idx), TRUE);
+        break;
+    case OP_drop:
+        jit_load64(s, R_DX, R_STK, JV_U(-1));
+        jit_load64(s, R_SI, R_STK, JV_TAG(-1));
+        jit_alu_imm(s, ALU_SUB, 1, R_STK, sizeof(JSValue));
+        jit_free(s);
+        break;
+    case OP_nip:
+        jit_load64(s, R_DX, R_STK, JV_U(-2));
+        jit_load64(s, R_SI, R_STK, JV_TAG(-2));
+        jit_load64(s, R_AX, R_STK, JV_U(-1));
+        jit_load64(s, R_CX, R_STK, JV_TAG(-1));
+        jit_store64(s, R_AX, R_STK, JV_U(-2));
+        jit_store64(s, R_CX, R_STK, JV_TAG(-2));
+        jit_alu_imm(s, ALU_SUB, 1, R_STK, sizeof(JSValue));
+        jit_free(s);
+        break;
+    case OP_dup:
+        jit_push_value(s, R_STK, JV_U(-1));
+        break;
+    case OP_swap:
+        jit_load64(s, R_AX, R_STK, JV_U(-2));
+        jit_load64(s, R_CX, R_STK, JV_TAG(-2));
+        jit_load64(s, R_DX, R_STK, JV_U(-1));
+        jit_load64(s, R_SI, R_STK, JV_TAG(-1));
+        jit_store64(s, R_DX, R_STK, JV_U(-2));
+        jit_store64(s, R_SI, R_STK, JV_TAG(-2));
+        jit_store64(s, R_AX, R_STK, JV_U(-1));
+        jit_store64(s, R_CX, R_STK, JV_TAG(-1));
+        break;
+    case OP_add:
+    case OP_sub:
+    case OP_mul:
+        ret = jit_binary_arith(s, op, pc);
+        break;
+    case OP_lt:
+    case OP_lte:
+    case OP_gt:
+    case OP_gte:
+        ret = jit_relational(s, op, pc);
+        break;
+    case OP_eq:
+    case OP_neq:
+    case OP_strict_eq:
+    case OP_strict_neq:
+    case OP_and:
+    case OP_or:
+    case OP_xor:
+    case OP_shl:
+    case OP_sar:
+    case OP_shr:
+        ret = jit_binary_int(s, op, pc);
+        break;
+    case OP_inc:
+    case OP_dec:
+        ret = jit_inc_int(s, R_STK, JV_U(-1), op == OP_inc ? 1 : -1, pc);
+        break;
+    case OP_post_inc:
+    case OP_post_dec:
+        /* a -> a a+1 */
+        jit_alu_mem_imm(s, ALU_CMP, 1, R_STK, JV_TAG(-1), JS_TAG_INT);
+        if (jit_exit(s, CC_NE, pc))
+            return -1;
+        jit_load32(s, R_AX, R_STK, JV_U(-1));
+        jit_alu_imm(s, ALU_ADD, 0, R_AX, op == OP_post_inc ? 1 : -1);
+        if (jit_exit(s, CC_O, pc))
+            return -1;
+        jit_store64(s, R_AX, R_STK, JV_U(0));
+        jit_store_imm64(s, R_STK, JV_TAG(0), JS_TAG_INT);
+        jit_alu_imm(s, ALU_ADD, 1, R_STK, sizeof(JSValue));
+        break;
+    case OP_inc_loc:
+    case OP_dec_loc:
+        ret = jit_inc_int(s, R_VAR, JV_U(bc[1]), op == OP_inc_loc ? 1 : -1, pc);
+        break;
+    case OP_add_loc:
+        ret = jit_add_loc(s, bc[1], pc);
+        break;
+    case OP_get_array_el:
+        ret = jit_get_array_el(s, pc);
+        break;
+    case OP_put_array_el:
+        ret = jit_put_array_el(s, pc);
+        break;
+    case OP_get_length:
+        ret = jit_get_length(s, pc);
+        break;
+    case OP_if_false:
+    case OP_if_true:
+        ret = jit_if(s, op == OP_if_true, pc, pc + 1 + (int32_t)get_u32(bc + 1));
+        break;
+    case OP_if_false8:
+    case OP_if_true8:
+        ret = jit_if(s, op == OP_if_true8, pc, pc + 1 + get_i8(bc + 1));
+        break;
+    case OP_goto:
+        ret = jit_goto(s, pc, pc + 1 + (int32_t)get_u32(bc + 1));
+        break;
+    case OP_goto16:
+        ret = jit_goto(s, pc, pc + 1 + get_i16(bc + 1));
+        break;
+    case OP_goto8:
+        ret = jit_goto(s, pc, pc + 1 + get_i8(bc + 1));
+        break;
+    case OP_nop:
+        break;
+    default:
+        return 1;
+    }
+    return ret;
+}
+
+static void jit_state_free(JSJitState *s)
+{
+    dbuf_free(&s->dbuf);
+    js_free(s->ctx, s->jumps);
+    js_free(s->ctx, s->exits);
+}
+
+static JSJitCode *js_jit_compile(JSContext *ctx, JSFunctionBytecode *b)
+{
+    JSJitState ss, *s = &ss;
+    JSJitCode *jc;
+    uint32_t pc, last_exit_pc;
+    int i, ret, last_exit_pos, len;
+    BOOL supported;
+    uint8_t *code;
+    size_t code_size;
+
+    jc = js_malloc(ctx, sizeof(*jc) + sizeof(jc->pc_to_native[0]) * b->byte_code_len);
+    if (!jc)
+        return NULL;
+    memset(s, 0, sizeof(*s));
+    s->ctx = ctx;
+    s->b = b;
+    s->pc_to_native = jc->pc_to_native;
+    js_dbuf_init(ctx, &s->dbuf);
+    for(i = 0; i < b->byte_code_len; i++)
+        s->pc_to_native[i] = -1;
+
+    /* entry: rdi = JSJitFrame, rsi = native pc */
+    jit_push(s, R_BX);
+    jit_push(s, R_BP);
+    jit_push(s, R_12);
+    jit_push(s, R_13);
+    jit_push(s, R_14);
+    jit_push(s, R_15);
+    /* align the stack. [rsp] is used as spill slot. */
+    jit_alu_imm(s, ALU_SUB, 1, R_SP, 8);
+    jit_mov(s, R_FRAME, R_DI);
+    jit_load64(s, R_STK, R_FRAME, offsetof(JSJitFrame, sp));
+    jit_load64(s, R_VAR, R_FRAME, offsetof(JSJitFrame, var_buf));
+    jit_load64(s, R_ARG, R_FRAME, offsetof(JSJitFrame, arg_buf));
+    jit_load64(s, R_CTX, R_FRAME, offsetof(JSJitFrame, ctx));
+    jit_reg(s, 0, 0, 0xff, 4, R_SI); /* jmp rsi */
+
+    /* common exit: eax = pc */
+    s->exit_pos = s->dbuf.size;
+    jit_store64(s, R_STK, R_FRAME, offsetof(JSJitFrame, sp));
+    jit_alu_imm(s, ALU_ADD, 1, R_SP, 8);
+    jit_pop(s, R_15);
+    jit_pop(s, R_14);
+    jit_pop(s, R_13);
+    jit_pop(s, R_12);
+    jit_pop(s, R_BP);
+    jit_pop(s, R_BX);
+    jit_put8(s, 0xc3); /* ret */
+
+    supported = FALSE;
+    for(pc = 0; pc < b->byte_code_len; pc += len) {
+        len = short_opcode_info(b->byte_code_buf[pc]).size;
+        s->pc_to_native[pc] = s->dbuf.size;
+        ret = jit_emit_op(s, pc);
+        if (ret < 0)
+            goto fail;
+        if (ret > 0) {
+            /* not an entry point, but the jumps to this pc exit here */
+            s->pc_to_native[pc] = -2 - s->pc_to_native[pc];
+            if (jit_exit(s, -1, pc))
+                goto fail;
+        } else {
+            supported = TRUE;
+        }
+    }
+    if (!supported)
+        goto fail;
+
+    /* exit stubs */
+    last_exit_pc = -1;
+    last_exit_pos = 0;
+    for(i = 0; i < s->exit_count; i++) {
+        JSJitFixup *f = &s->exits[i];
+        if (f->pc != last_exit_pc) {
+            last_exit_pc = f->pc;
+            last_exit_pos = s->dbuf.size;
+            jit_mov_imm32(s, R_AX, f->pc);
+            jit_put8(s, 0xe9);
+            jit_put32(s, s->exit_pos - (s->dbuf.size + 4));
+        }
+        put_u32(s->dbuf.buf + f->pos, last_exit_pos - (f->pos + 4));
+    }
+    if (dbuf_error(&s->dbuf))
+        goto fail;
+
+    /* jumps to bytecode labels */
+    for(i = 0; i < s->jump_count; i++) {
+        JSJitFixup *f = &s->jumps[i];
+        int32_t target;
+        target = s->pc_to_native[f->pc];
+        if (target < 0)
+            target = -2 - target;
+        put_u32(s->dbuf.buf + f->pos, target - (f->pos + 4));
+    }
+
+    code_size = s->dbuf.size;
+    code = mmap(NULL, code_size, PROT_READ | PROT_WRITE,
+                MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (code == MAP_FAILED)
+        goto fail;
+    memcpy(code, s->dbuf.buf, code_size);
+    if (mprotect(code, code_size, PROT_READ | PROT_EXEC) < 0) {
+        munmap(code, code_size);
+        goto fail;
+    }
+    jc->code = code;
+    jc->code_size = code_size;
+    list_add_tail(&jc->link, &ctx->rt->jit_code_list);
+    jit_state_free(s);
+    return jc;
+ fail:
+    jit_state_free(s);
+    js_free(ctx, jc);
+    return NULL;
+}
+
+static void js_jit_free(JSRuntime *rt, JSFunctionBytecode *b)
+{
+    JSJitCode *jc = b->jit_code;
+    if (jc) {
+        list_del(&jc->link);
+        munmap(jc->code, jc->code_size);
+        js_free_rt(rt, jc);
+        b->jit_code = NULL;
+    }
+}
+
+/* only unmap the native code: the rest is released with the arena */
+static void js_jit_free_all(JSRuntime *rt)
+{
+    struct list_head *el;
+    list_for_each(el, &rt->jit_code_list) {
+        JSJitCode *jc = list_entry(el, JSJitCode, link);
+        munmap(jc->code, jc->code_size);
+    }
+}
+
+/* count the calls and the loop iterations. Return TRUE if the
+   function has native code. */
+static BOOL js_jit_tier_up(JSContext *ctx, JSFunctionBytecode *b)
+{
+    /* the native code does not record the type feedback */
+    if (b->jit_counter < 0 || b->feedback)
+        return FALSE;
+    if (++b->jit_counter < JS_JIT_THRESHOLD)
+        return FALSE;
+    b->jit_counter = -1;
+    b->jit_code = js_jit_compile(ctx, b);
+    if (!b->jit_code) {
+        /* ignore the memory errors. Nothing is thrown if the function
+           is not supported. */
+        if (JS_HasException(ctx))
+            JS_FreeValue(ctx, JS_GetException(ctx));
+        return FALSE;
+    }
+    return TRUE;
+}
+
+/* run the native code from '*ppc' if it is an entry point. Return the
+   new stack pointer and update '*ppc'. */
+static JSValue *js_jit_run(JSContext *ctx, JSFunctionBytecode *b,
+                           JSValue *sp, JSValue *var_buf, JSValue *arg_buf,
+                           const uint8_t **ppc)
+{
+    JSJitCode *jc = b->jit_code;
+    JSJitFrame f;
+    int32_t native_pos;
+
+    native_pos = jc->pc_to_native[*ppc - b->byte_code_buf];
+    if (native_pos < 0) /* no entry point */
+        return sp;
+    f.sp = sp;
+    f.var_buf = var_buf;
+    f.arg_buf = arg_buf;
+    f.ctx = ctx;
+    *ppc = b->byte_code_buf +
+        ((JSJitEntryFunc *)jc->code)(&f, jc->code + native_pos);
+    return f.sp;
+}
+
+#endif /* CONFIG_JIT */
+
 static void free_function_bytecode(JSRuntime *rt, JSFunctionBytecode *b)
 {
     int i;
@@ -35705,13 +39496,21 @@ static void free_function_bytecode(JSRuntime *rt, JSFunctionBytecode *b)
         JSClosureVar *cv = &b->closure_var[i];
         JS_FreeAtomRT(rt, cv->var_name);
     }
+    if (b->ic)
+        js_free_inline_caches(rt, b);
+    js_free_rt(rt, b->feedback);
+#ifdef CONFIG_JIT
+    js_jit_free(rt, b);
+#endif
+    js_free_rt(rt, b->global_var_cache);
     if (b->realm)
         JS_FreeContext(b->realm);
 
     JS_FreeAtomRT(rt, b->func_name);
     if (b->has_debug) {
         JS_FreeAtomRT(rt, b->debug.filename);
-        js_free_rt(rt, b->debug.pc2line_buf);
+        if (!b->read_only_bytecode)
+            js_free_rt(rt, b->debug.pc2line_buf);
         js_free_rt(rt, b->debug.source);
     }
 
@@ -36514,6 +40313,7 @@ static __exception int js_parse_program(JSParseState *s)
 
             emit_op(s, OP_put_field);
             emit_atom(s, JS_ATOM_value);
+            emit_ic(s);
         } else {
             emit_op(s, OP_get_loc);
             emit_u16(s, fd->eval_ret_idx);
@@ -36877,6 +40677,44 @@ static void js_object_list_end(JSContext *ctx, JSObjectList *s)
     js_free(ctx, s->hash_table);
 }
 
+/* state of the snapshot base (see JS_EnableSnapshot()) */
+
+typedef struct JSSnapshotProp {
+    JSAtom atom;
+    int flags;
+    JSProperty u; /* the values are duplicated */
+} JSSnapshotProp;
+
+typedef struct JSSnapshotObject {
+    JSObject *obj;
+    /* recorded state, only used by the writer */
+    JSObject *proto;
+    BOOL extensible;
+    int prop_count;
+    JSSnapshotProp *props;
+} JSSnapshotObject;
+
+typedef struct JSSnapshotVarRef {
+    JSVarRef *var_ref;
+    /* recorded state, only used by the writer */
+    JSValue value;
+    BOOL is_lexical : 8;
+    BOOL is_const : 8;
+} JSSnapshotVarRef;
+
+typedef struct JSSnapshotBase {
+    JSSnapshotObject *objects;
+    int object_count;
+    int object_size;
+    JSObjectList object_list;
+    JSSnapshotVarRef *var_refs;
+    int var_ref_count;
+    int var_ref_size;
+    /* the variable references are stored as JSObject pointers */
+    JSObjectList var_ref_list;
+    uint32_t hash;
+} JSSnapshotBase;
+
 /*******************************************************************/
 /* binary object writer & reader */
 
@@ -36900,9 +40738,15 @@ typedef enum BCTagEnum {
     BC_TAG_DATE,
     BC_TAG_OBJECT_VALUE,
     BC_TAG_OBJECT_REFERENCE,
+    /* only used in snapshots */
+    BC_TAG_SNAPSHOT_OBJECT,
+    BC_TAG_SNAPSHOT_BASE,
+    BC_TAG_SYMBOL,
+    BC_TAG_FUNCTION_BYTECODE_REFERENCE,
+    BC_TAG_ARRAY_BUFFER_TRANSFER,
 } BCTagEnum;
 
-#define BC_VERSION 5
+#define BC_VERSION 8
 
 typedef struct BCWriterState {
     JSContext *ctx;
@@ -36919,8 +40763,15 @@ typedef struct BCWriterState {
     uint8_t **sab_tab;
     int sab_tab_len;
     int sab_tab_size;
+    /* ArrayBuffers whose data is transferred */
+    JSValueConst *transfer_tab;
+    int transfer_len;
     /* list of referenced objects (used if allow_reference = TRUE) */
     JSObjectList object_list;
+    /* only used in snapshots */
+    JSSnapshotBase *snapshot_base;
+    JSObjectList var_ref_list;
+    JSObjectList bytecode_list;
 } BCWriterState;
 
 #ifdef DUMP_READ_OBJECT
@@ -36945,6 +40796,11 @@ static const char * const bc_tag_str[] = {
     "Date",
     "ObjectValue",
     "ObjectReference",
+    "SnapshotObject",
+    "SnapshotBase",
+    "Symbol",
+    "FunctionBytecodeReference",
+    "ArrayBufferTransfer",
 };
 #endif
 
@@ -37129,7 +40985,9 @@ static int JS_WriteFunctionBytecode(BCWriterState *s,
 
     pos = 0;
     while (pos < bc_len) {
-        op = bc_buf[pos];
+        /* the quickened opcodes are saved as their generic opcode */
+        op = js_unquicken_op(bc_buf[pos]);
+        bc_buf[pos] = op;
         len = short_opcode_info(op).size;
         switch(short_opcode_info(op).fmt) {
         case OP_FMT_atom:
@@ -37501,10 +41359,22 @@ static int JS_WriteArrayBuffer(BCWriterState *s, JSValueConst obj)
 {
     JSObject *p = JS_VALUE_GET_OBJ(obj);
     JSArrayBuffer *abuf = p->u.array_buffer;
+    int i;
+
     if (abuf->detached) {
         JS_ThrowTypeErrorDetachedArrayBuffer(s->ctx);
         return -1;
     }
+    for(i = 0; i < s->transfer_len; i++) {
+        if (JS_VALUE_GET_OBJ(s->transfer_tab[i]) == p) {
+            /* only the index in the transfer list is written */
+            bc_put_u8(s, BC_TAG_ARRAY_BUFFER_TRANSFER);
+            bc_put_leb128(s, abuf->byte_length);
+            bc_put_leb128(s, abuf->max_byte_length);
+            bc_put_leb128(s, i);
+            return 0;
+        }
+    }
     bc_put_u8(s, BC_TAG_ARRAY_BUFFER);
     bc_put_leb128(s, abuf->byte_length);
     bc_put_leb128(s, abuf->max_byte_length);
@@ -37529,6 +41399,221 @@ static int JS_WriteSharedArrayBuffer(BCWriterState *s, JSValueConst obj)
     return 0;
 }
 
+static int JS_WriteSnapshotVarRefValue(BCWriterState *s, JSVarRef *var_ref)
+{
+    uint32_t flags;
+    int idx;
+    BOOL is_uninitialized;
+
+    is_uninitialized = JS_IsUninitialized(*var_ref->pvalue);
+    flags = idx = 0;
+    bc_set_flags(&flags, &idx, var_ref->is_lexical, 1);
+    bc_set_flags(&flags, &idx, var_ref->is_const, 1);
+    bc_set_flags(&flags, &idx, is_uninitialized, 1);
+    bc_put_u8(s, flags);
+    if (is_uninitialized)
+        return 0;
+    return JS_WriteObjectRec(s, *var_ref->pvalue);
+}
+
+/* the variable references are shared between the closures and the
+   global objects. A new reference is followed by its value. */
+static int bc_put_var_ref(BCWriterState *s, JSVarRef *var_ref)
+{
+    int idx;
+
+    idx = js_object_list_find(s->ctx, &s->var_ref_list, (JSObject *)var_ref);
+    if (idx >= 0) {
+        bc_put_leb128(s, idx);
+        return 0;
+    }
+    if (!var_ref->is_detached) {
+        JS_ThrowTypeError(s->ctx, "snapshot: cannot save the variables of a running function");
+        return -1;
+    }
+    idx = s->var_ref_list.object_count;
+    if (js_object_list_add(s->ctx, &s->var_ref_list, (JSObject *)var_ref))
+        return -1;
+    bc_put_leb128(s, idx);
+    return JS_WriteSnapshotVarRefValue(s, var_ref);
+}
+
+static int JS_WriteSnapshotProperty(BCWriterState *s, JSShapeProperty *prs,
+                                    JSProperty *pr)
+{
+    JSObject *p1;
+
+    bc_put_atom(s, prs->atom);
+    bc_put_leb128(s, prs->flags);
+    switch(prs->flags & JS_PROP_TMASK) {
+    case JS_PROP_GETSET:
+        p1 = pr->u.getset.getter;
+        if (JS_WriteObjectRec(s, p1 ? JS_MKPTR(JS_TAG_OBJECT, p1) : JS_UNDEFINED))
+            return -1;
+        p1 = pr->u.getset.setter;
+        if (JS_WriteObjectRec(s, p1 ? JS_MKPTR(JS_TAG_OBJECT, p1) : JS_UNDEFINED))
+            return -1;
+        break;
+    case JS_PROP_VARREF:
+        if (bc_put_var_ref(s, pr->u.var_ref))
+            return -1;
+        break;
+    case JS_PROP_AUTOINIT:
+        /* only the lazy 'prototype' property of the functions is
+           expected here: the other ones were instantiated in the base */
+        if (js_autoinit_get_id(pr) != JS_AUTOINIT_ID_PROTOTYPE ||
+            js_autoinit_get_realm(pr) != s->ctx) {
+            JS_ThrowTypeError(s->ctx, "snapshot: unsupported property");
+            return -1;
+        }
+        break;
+    default:
+        if (JS_WriteObjectRec(s, pr->u.value))
+            return -1;
+        break;
+    }
+    return 0;
+}
+
+static int JS_WriteSnapshotClosure(BCWriterState *s, JSObject *p)
+{
+    JSFunctionBytecode *b = p->u.func.function_bytecode;
+    JSObject *home_object = p->u.func.home_object;
+    int i;
+
+    bc_put_u8(s, p->is_constructor);
+    if (JS_WriteObjectRec(s, JS_MKPTR(JS_TAG_FUNCTION_BYTECODE, b)))
+        return -1;
+    for(i = 0; i < b->closure_var_count; i++) {
+        /* module variables are not supported */
+        if (!p->u.func.var_refs[i]) {
+            JS_ThrowTypeError(s->ctx, "snapshot: unsupported module variable");
+            return -1;
+        }
+        if (bc_put_var_ref(s, p->u.func.var_refs[i]))
+            return -1;
+    }
+    return JS_WriteObjectRec(s, home_object ?
+                             JS_MKPTR(JS_TAG_OBJECT, home_object) : JS_NULL);
+}
+
+/* all the objects which are not in the snapshot base. The object
+   reference is allocated before the prototype is written so that
+   cycles going through the prototype chain are supported. */
+static int JS_WriteSnapshotObject(BCWriterState *s, JSValueConst obj)
+{
+    JSContext *ctx = s->ctx;
+    JSObject *p = JS_VALUE_GET_OBJ(obj);
+    JSShape *sh;
+    JSShapeProperty *prs;
+    uint32_t i, prop_count;
+
+    if (p->class_id == JS_CLASS_ARRAY_BUFFER)
+        return JS_WriteArrayBuffer(s, obj);
+    if (p->class_id >= JS_CLASS_UINT8C_ARRAY &&
+        p->class_id <= JS_CLASS_FLOAT64_ARRAY)
+        return JS_WriteTypedArray(s, obj);
+
+    bc_put_u8(s, BC_TAG_SNAPSHOT_OBJECT);
+    bc_put_leb128(s, p->class_id);
+    switch(p->class_id) {
+    case JS_CLASS_OBJECT:
+    case JS_CLASS_ERROR:
+        break;
+    case JS_CLASS_ARRAY:
+        bc_put_u8(s, p->fast_array);
+        if (p->fast_array) {
+            bc_put_leb128(s, p->u.array.count);
+            for(i = 0; i < p->u.array.count; i++) {
+                if (JS_WriteObjectRec(s, p->u.array.u.values[i]))
+                    return -1;
+            }
+        }
+        break;
+    case JS_CLASS_BYTECODE_FUNCTION:
+    case JS_CLASS_GENERATOR_FUNCTION:
+    case JS_CLASS_ASYNC_FUNCTION:
+    case JS_CLASS_ASYNC_GENERATOR_FUNCTION:
+        if (JS_WriteSnapshotClosure(s, p))
+            return -1;
+        break;
+    case JS_CLASS_BOUND_FUNCTION:
+        {
+            JSBoundFunction *bf = p->u.bound_function;
+            bc_put_u8(s, p->is_constructor);
+            bc_put_leb128(s, bf->argc);
+            if (JS_WriteObjectRec(s, bf->func_obj) ||
+                JS_WriteObjectRec(s, bf->this_val))
+                return -1;
+            for(i = 0; i < bf->argc; i++) {
+                if (JS_WriteObjectRec(s, bf->argv[i]))
+                    return -1;
+            }
+        }
+        break;
+    case JS_CLASS_NUMBER:
+    case JS_CLASS_STRING:
+    case JS_CLASS_BOOLEAN:
+    case JS_CLASS_SYMBOL:
+    case JS_CLASS_DATE:
+    case JS_CLASS_BIG_INT:
+        if (JS_WriteObjectRec(s, p->u.object_data))
+            return -1;
+        break;
+    case JS_CLASS_REGEXP:
+        JS_WriteString(s, p->u.regexp.pattern);
+        JS_WriteString(s, p->u.regexp.bytecode);
+        break;
+    case JS_CLASS_MAP:
+    case JS_CLASS_SET:
+        {
+            JSMapState *ms = p->u.map_state;
+            struct list_head *el;
+            JSMapRecord *mr;
+
+            bc_put_leb128(s, ms->record_count);
+            list_for_each(el, &ms->records) {
+                mr = list_entry(el, JSMapRecord, link);
+                if (mr->empty)
+                    continue;
+                if (JS_WriteObjectRec(s, mr->key))
+                    return -1;
+                if (p->class_id == JS_CLASS_MAP &&
+                    JS_WriteObjectRec(s, mr->value))
+                    return -1;
+            }
+        }
+        break;
+    default:
+        {
+            char buf[ATOM_GET_STR_BUF_SIZE];
+            JS_ThrowTypeError(ctx, "snapshot: unsupported object class '%s'",
+                              JS_AtomGetStr(ctx, buf, sizeof(buf),
+                                            ctx->rt->class_array[p->class_id].class_name));
+        }
+        return -1;
+    }
+
+    sh = p->shape;
+    if (JS_WriteObjectRec(s, sh->proto ? JS_MKPTR(JS_TAG_OBJECT, sh->proto) : JS_NULL))
+        return -1;
+    prop_count = 0;
+    for(i = 0, prs = get_shape_prop(sh); i < sh->prop_count; i++, prs++) {
+        if (prs->atom != JS_ATOM_NULL)
+            prop_count++;
+    }
+    bc_put_leb128(s, prop_count);
+    /* the shape cannot be modified while writing */
+    for(i = 0, prs = get_shape_prop(sh); i < sh->prop_count; i++, prs++) {
+        if (prs->atom != JS_ATOM_NULL) {
+            if (JS_WriteSnapshotProperty(s, prs, &p->prop[i]))
+                return -1;
+        }
+    }
+    bc_put_u8(s, p->extensible);
+    return 0;
+}
+
 static int JS_WriteObjectRec(BCWriterState *s, JSValueConst obj)
 {
     uint32_t tag;
@@ -37581,6 +41666,19 @@ static int JS_WriteObjectRec(BCWriterState *s, JSValueConst obj)
     case JS_TAG_FUNCTION_BYTECODE:
         if (!s->allow_bytecode)
             goto invalid_tag;
+        if (s->snapshot_base) {
+            /* the function bytecode can be shared by several closures */
+            JSObject *p = JS_VALUE_GET_PTR(obj);
+            int idx;
+            idx = js_object_list_find(s->ctx, &s->bytecode_list, p);
+            if (idx >= 0) {
+                bc_put_u8(s, BC_TAG_FUNCTION_BYTECODE_REFERENCE);
+                bc_put_leb128(s, idx);
+                break;
+            }
+            if (js_object_list_add(s->ctx, &s->bytecode_list, p))
+                goto fail;
+        }
         if (JS_WriteFunctionTag(s, obj))
             goto fail;
         break;
@@ -37590,11 +41688,26 @@ static int JS_WriteObjectRec(BCWriterState *s, JSValueConst obj)
         if (JS_WriteModule(s, obj))
             goto fail;
         break;
+    case JS_TAG_SYMBOL:
+        if (!s->snapshot_base)
+            goto invalid_tag;
+        bc_put_u8(s, BC_TAG_SYMBOL);
+        if (bc_put_atom(s, js_get_atom_index(s->ctx->rt, JS_VALUE_GET_PTR(obj))))
+            goto fail;
+        break;
     case JS_TAG_OBJECT:
         {
             JSObject *p = JS_VALUE_GET_OBJ(obj);
             int ret, idx;
 
+            if (s->snapshot_base) {
+                idx = js_object_list_find(s->ctx, &s->snapshot_base->object_list, p);
+                if (idx >= 0) {
+                    bc_put_u8(s, BC_TAG_SNAPSHOT_BASE);
+                    bc_put_leb128(s, idx);
+                    break;
+                }
+            }
             if (s->allow_reference) {
                 idx = js_object_list_find(s->ctx, &s->object_list, p);
                 if (idx >= 0) {
@@ -37612,6 +41725,12 @@ static int JS_WriteObjectRec(BCWriterState *s, JSValueConst obj)
                 }
                 p->tmp_mark = 1;
             }
+            if (s->snapshot_base) {
+                /* always used with allow_reference = TRUE */
+                if (JS_WriteSnapshotObject(s, obj))
+                    goto fail;
+                break;
+            }
             switch(p->class_id) {
             case JS_CLASS_ARRAY:
                 ret = JS_WriteArray(s, obj);
@@ -37683,6 +41802,20 @@ static int JS_WriteObjectAtoms(BCWriterState *s)
     bc_put_leb128(s, s->idx_to_atom_count);
     for(i = 0; i < s->idx_to_atom_count; i++) {
         JSAtomStruct *p = rt->atom_array[s->idx_to_atom[i]];
+        if (s->snapshot_base) {
+            /* the symbols are also saved in snapshots */
+            int atom_type = p->atom_type;
+            if (atom_type == JS_ATOM_TYPE_SYMBOL) {
+                if (p->hash == JS_ATOM_HASH_PRIVATE) {
+                    atom_type = JS_ATOM_TYPE_PRIVATE;
+                } else if (p->len == 0 && p->is_wide_char != 0) {
+                    /* no description */
+                    bc_put_u8(s, 0);
+                    continue;
+                }
+            }
+            bc_put_u8(s, atom_type);
+        }
         JS_WriteString(s, p);
     }
     /* XXX: should check for OOM in above phase */
@@ -37704,13 +41837,17 @@ static int JS_WriteObjectAtoms(BCWriterState *s)
     return -1;
 }
 
-uint8_t *JS_WriteObject2(JSContext *ctx, size_t *psize, JSValueConst obj,
-                         int flags, uint8_t ***psab_tab, size_t *psab_tab_len)
+static uint8_t *js_write_object(JSContext *ctx, size_t *psize,
+                                JSValueConst obj, int flags,
+                                uint8_t ***psab_tab, size_t *psab_tab_len,
+                                JSValueConst *transfer_tab, int transfer_len)
 {
     BCWriterState ss, *s = &ss;
 
     memset(s, 0, sizeof(*s));
     s->ctx = ctx;
+    s->transfer_tab = transfer_tab;
+    s->transfer_len = transfer_len;
     s->allow_bytecode = ((flags & JS_WRITE_OBJ_BYTECODE) != 0);
     s->allow_sab = ((flags & JS_WRITE_OBJ_SAB) != 0);
     s->allow_reference = ((flags & JS_WRITE_OBJ_REFERENCE) != 0);
@@ -37748,12 +41885,84 @@ uint8_t *JS_WriteObject2(JSContext *ctx, size_t *psize, JSValueConst obj,
     return NULL;
 }
 
+uint8_t *JS_WriteObject2(JSContext *ctx, size_t *psize, JSValueConst obj,
+                         int flags, uint8_t ***psab_tab, size_t *psab_tab_len)
+{
+    return js_write_object(ctx, psize, obj, flags, psab_tab, psab_tab_len,
+                           NULL, 0);
+}
+
 uint8_t *JS_WriteObject(JSContext *ctx, size_t *psize, JSValueConst obj,
                         int flags)
 {
     return JS_WriteObject2(ctx, psize, obj, flags, NULL, NULL);
 }
 
+uint8_t *JS_WriteObject3(JSContext *ctx, size_t *psize, JSValueConst obj,
+                         int flags, uint8_t ***psab_tab, size_t *psab_tab_len,
+                         JSValueConst *transfer_tab, int transfer_len,
+                         uint8_t **transfer_data)
+{
+    JSArrayBuffer *abuf;
+    uint8_t *buf, *buf1;
+    size_t size;
+    int i, j;
+
+    for(i = 0; i < transfer_len; i++) {
+        abuf = JS_GetOpaque(transfer_tab[i], JS_CLASS_ARRAY_BUFFER);
+        if (!abuf) {
+            JS_ThrowTypeError(ctx, "ArrayBuffer expected in transfer list");
+            goto fail;
+        }
+        if (abuf->detached) {
+            JS_ThrowTypeErrorDetachedArrayBuffer(ctx);
+            goto fail;
+        }
+        for(j = 0; j < i; j++) {
+            if (JS_VALUE_GET_OBJ(transfer_tab[j]) ==
+                JS_VALUE_GET_OBJ(transfer_tab[i])) {
+                JS_ThrowTypeError(ctx, "duplicate ArrayBuffer in transfer list");
+                goto fail;
+            }
+        }
+    }
+
+    buf = js_write_object(ctx, &size, obj, flags, psab_tab, psab_tab_len,
+                          transfer_tab, transfer_len);
+    if (!buf)
+        goto fail;
+    buf1 = js_release_to_malloc(ctx->rt, buf, size);
+    if (!buf1) {
+        js_free(ctx, buf);
+        goto fail_oom;
+    }
+    /* XXX: the ArrayBuffers already detached are lost if there is a
+       memory error. It cannot happen with the default allocator. */
+    for(i = 0; i < transfer_len; i++) {
+        abuf = JS_GetOpaque(transfer_tab[i], JS_CLASS_ARRAY_BUFFER);
+        transfer_data[i] = js_array_buffer_release(ctx, abuf);
+        if (!transfer_data[i]) {
+            while (--i >= 0)
+                js_shared_free(transfer_data[i]);
+            js_shared_free(buf1);
+            goto fail_oom;
+        }
+    }
+    *psize = size;
+    return buf1;
+ fail_oom:
+    JS_ThrowOutOfMemory(ctx);
+    if (psab_tab) {
+        js_free(ctx, *psab_tab);
+        *psab_tab = NULL;
+    }
+    if (psab_tab_len)
+        *psab_tab_len = 0;
+ fail:
+    *psize = 0;
+    return NULL;
+}
+
 typedef struct BCReaderState {
     JSContext *ctx;
     const uint8_t *buf_start, *ptr, *buf_end;
@@ -37764,11 +41973,25 @@ typedef struct BCReaderState {
     BOOL allow_sab : 8;
     BOOL allow_bytecode : 8;
     BOOL is_rom_data : 8;
+    /* TRUE if the bytecode is relocated in place in a new shared buffer */
+    BOOL is_shared_init : 8;
     BOOL allow_reference : 8;
+    /* data of the transferred ArrayBuffers. The entries are set to
+       NULL when they are used. */
+    uint8_t **transfer_data;
+    int transfer_len;
     /* object references */
     JSObject **objects;
     int objects_count;
     int objects_size;
+    /* only used in snapshots */
+    JSSnapshotBase *snapshot_base;
+    JSVarRef **var_refs;
+    int var_refs_count;
+    int var_refs_size;
+    JSFunctionBytecode **bytecodes;
+    int bytecodes_count;
+    int bytecodes_size;
 
 #ifdef DUMP_READ_OBJECT
     const uint8_t *ptr_last;
@@ -38017,7 +42240,7 @@ static int JS_ReadFunctionBytecode(BCReaderState *s, JSFunctionBytecode *b,
     JSAtom atom;
     uint32_t idx;
 
-    if (s->is_rom_data) {
+    if (s->is_rom_data || s->is_shared_init) {
         /* directly use the input buffer */
         if (unlikely(s->buf_end - s->ptr < bc_len))
             return bc_read_error_end(s);
@@ -38064,6 +42287,7 @@ static int JS_ReadFunctionBytecode(BCReaderState *s, JSFunctionBytecode *b,
         }
         pos += len;
     }
+    b->ic_count = compute_ic_slots(bc_buf, bc_len, FALSE);
     return 0;
 }
 
@@ -38167,7 +42391,7 @@ static JSValue JS_ReadFunctionTag(BCReaderState *s)
     bc.arguments_allowed = bc_get_flags(v16, &idx, 1);
     bc.has_debug = bc_get_flags(v16, &idx, 1);
     bc.is_direct_or_indirect_eval = bc_get_flags(v16, &idx, 1);
-    bc.read_only_bytecode = s->is_rom_data;
+    bc.read_only_bytecode = s->is_rom_data || s->is_shared_init;
     if (bc_get_u8(s, &v8))
         goto fail;
     bc.js_mode = v8;
@@ -38228,6 +42452,13 @@ static JSValue JS_ReadFunctionTag(BCReaderState *s)
 
     obj = JS_MKPTR(JS_TAG_FUNCTION_BYTECODE, b);
 
+    if (s->snapshot_base) {
+        if (js_resize_array(ctx, (void *)&s->bytecodes, sizeof(s->bytecodes[0]),
+                            &s->bytecodes_size, s->bytecodes_count + 1))
+            goto fail;
+        s->bytecodes[s->bytecodes_count++] = b;
+    }
+
 #ifdef DUMP_READ_OBJECT
     bc_read_trace(s, "name: "); print_atom(s->ctx, b->func_name); printf("\n");
 #endif
@@ -38302,11 +42533,20 @@ static JSValue JS_ReadFunctionTag(BCReaderState *s)
         if (bc_get_leb128_int(s, &b->debug.pc2line_len))
             goto fail;
         if (b->debug.pc2line_len) {
-            b->debug.pc2line_buf = js_mallocz(ctx, b->debug.pc2line_len);
-            if (!b->debug.pc2line_buf)
-                goto fail;
-            if (bc_get_buf(s, b->debug.pc2line_buf, b->debug.pc2line_len))
-                goto fail;
+            if (b->read_only_bytecode) {
+                if (unlikely(s->buf_end - s->ptr < b->debug.pc2line_len)) {
+                    bc_read_error_end(s);
+                    goto fail;
+                }
+                b->debug.pc2line_buf = (uint8_t *)s->ptr;
+                s->ptr += b->debug.pc2line_len;
+            } else {
+                b->debug.pc2line_buf = js_mallocz(ctx, b->debug.pc2line_len);
+                if (!b->debug.pc2line_buf)
+                    goto fail;
+                if (bc_get_buf(s, b->debug.pc2line_buf, b->debug.pc2line_len))
+                    goto fail;
+            }
         }
         if (bc_get_leb128_int(s, &b->debug.source_len))
             goto fail;
@@ -38619,6 +42859,60 @@ static JSValue JS_ReadArrayBuffer(BCReaderState *s)
     return JS_EXCEPTION;
 }
 
+static JSValue JS_ReadArrayBufferTransfer(BCReaderState *s)
+{
+    JSContext *ctx = s->ctx;
+    uint32_t byte_length, max_byte_length, idx;
+    uint64_t max_byte_length_u64, *pmax_byte_length = NULL;
+    uint8_t *data;
+    JSValue obj;
+
+    if (bc_get_leb128(s, &byte_length))
+        return JS_EXCEPTION;
+    if (bc_get_leb128(s, &max_byte_length))
+        return JS_EXCEPTION;
+    if (bc_get_leb128(s, &idx))
+        return JS_EXCEPTION;
+    if (max_byte_length < byte_length ||
+        idx >= s->transfer_len || !s->transfer_data[idx])
+        return JS_ThrowTypeError(ctx, "invalid array buffer");
+    if (max_byte_length != UINT32_MAX) {
+        max_byte_length_u64 = max_byte_length;
+        pmax_byte_length = &max_byte_length_u64;
+    }
+    data = s->transfer_data[idx];
+    if (js_adopt_from_malloc(ctx->rt, data)) {
+        obj = js_array_buffer_constructor3(ctx, JS_UNDEFINED,
+                                           byte_length, pmax_byte_length,
+                                           JS_CLASS_ARRAY_BUFFER,
+                                           data, js_array_buffer_free, NULL,
+                                           FALSE);
+        if (JS_IsException(obj)) {
+            /* the data is still owned by the message */
+            js_release_to_malloc(ctx->rt, data, byte_length);
+            goto fail;
+        }
+        s->transfer_data[idx] = NULL;
+    } else {
+        /* the data cannot be freed by the runtime allocator or it
+           exceeds the memory limit: copy it so that the memory limit
+           is enforced */
+        obj = js_array_buffer_constructor3(ctx, JS_UNDEFINED,
+                                           byte_length, pmax_byte_length,
+                                           JS_CLASS_ARRAY_BUFFER,
+                                           data, js_array_buffer_free, NULL,
+                                           TRUE);
+        if (JS_IsException(obj))
+            goto fail;
+    }
+    if (BC_add_object_ref(s, obj))
+        goto fail;
+    return obj;
+ fail:
+    JS_FreeValue(ctx, obj);
+    return JS_EXCEPTION;
+}
+
 static JSValue JS_ReadSharedArrayBuffer(BCReaderState *s)
 {
     JSContext *ctx = s->ctx;
@@ -38704,6 +42998,375 @@ static JSValue JS_ReadObjectValue(BCReaderState *s)
     return JS_EXCEPTION;
 }
 
+static int JS_ReadSnapshotVarRefValue(BCReaderState *s, JSVarRef *var_ref)
+{
+    JSValue val;
+    uint8_t v8;
+    int idx;
+
+    if (bc_get_u8(s, &v8))
+        return -1;
+    idx = 0;
+    var_ref->is_lexical = bc_get_flags(v8, &idx, 1);
+    var_ref->is_const = bc_get_flags(v8, &idx, 1);
+    if (bc_get_flags(v8, &idx, 1)) {
+        val = JS_UNINITIALIZED;
+    } else {
+        val = JS_ReadObjectRec(s);
+        if (JS_IsException(val))
+            return -1;
+    }
+    set_value(s->ctx, var_ref->pvalue, val);
+    return 0;
+}
+
+/* return a new reference to the variable or NULL if error */
+static JSVarRef *bc_get_var_ref(BCReaderState *s)
+{
+    JSContext *ctx = s->ctx;
+    JSVarRef *var_ref;
+    uint32_t idx;
+
+    if (bc_get_leb128(s, &idx))
+        return NULL;
+    if (idx < s->var_refs_count) {
+        var_ref = s->var_refs[idx];
+        var_ref->header.ref_count++;
+        return var_ref;
+    }
+    if (idx != s->var_refs_count) {
+        JS_ThrowSyntaxError(ctx, "invalid variable reference (%u)", idx);
+        return NULL;
+    }
+    var_ref = js_create_var_ref(ctx, FALSE);
+    if (!var_ref)
+        return NULL;
+    if (js_resize_array(ctx, (void *)&s->var_refs, sizeof(s->var_refs[0]),
+                        &s->var_refs_size, s->var_refs_count + 1))
+        goto fail;
+    s->var_refs[s->var_refs_count++] = var_ref;
+    if (JS_ReadSnapshotVarRefValue(s, var_ref))
+        goto fail;
+    return var_ref;
+ fail:
+    free_var_ref(ctx->rt, var_ref);
+    return NULL;
+}
+
+/* return an object or NULL. 'val' is freed. */
+static int bc_get_object_or_null(BCReaderState *s, JSObject **pp, JSValue val)
+{
+    if (JS_IsException(val))
+        return -1;
+    if (JS_VALUE_GET_TAG(val) == JS_TAG_OBJECT) {
+        *pp = JS_VALUE_GET_OBJ(val);
+    } else if (JS_IsNull(val) || JS_IsUndefined(val)) {
+        *pp = NULL;
+    } else {
+        JS_FreeValue(s->ctx, val);
+        JS_ThrowSyntaxError(s->ctx, "object expected");
+        return -1;
+    }
+    return 0;
+}
+
+/* define or replace the property of 'p'. The existing properties
+   keep their position in the shape. */
+static int JS_ReadSnapshotProperty(BCReaderState *s, JSObject *p)
+{
+    JSContext *ctx = s->ctx;
+    JSShapeProperty *prs;
+    JSProperty *pr, new_pr, old_pr;
+    JSAtom atom;
+    uint32_t flags;
+    int old_flags;
+
+    if (bc_get_atom(s, &atom))
+        return -1;
+    if (bc_get_leb128(s, &flags))
+        goto fail;
+#ifdef DUMP_READ_OBJECT
+    bc_read_trace(s, "propname: "); print_atom(s->ctx, atom); printf("\n");
+#endif
+    flags &= JS_PROP_C_W_E | JS_PROP_LENGTH | JS_PROP_TMASK;
+    switch(flags & JS_PROP_TMASK) {
+    case JS_PROP_GETSET:
+        new_pr.u.getset.setter = NULL;
+        if (bc_get_object_or_null(s, &new_pr.u.getset.getter, JS_ReadObjectRec(s)))
+            goto fail;
+        if (bc_get_object_or_null(s, &new_pr.u.getset.setter, JS_ReadObjectRec(s)))
+            goto fail_free;
+        break;
+    case JS_PROP_VARREF:
+        new_pr.u.var_ref = bc_get_var_ref(s);
+        if (!new_pr.u.var_ref)
+            goto fail;
+        break;
+    case JS_PROP_AUTOINIT:
+        new_pr.u.init.realm_and_id = (uintptr_t)JS_DupContext(ctx) |
+            JS_AUTOINIT_ID_PROTOTYPE;
+        new_pr.u.init.opaque = NULL;
+        break;
+    default:
+        new_pr.u.value = JS_ReadObjectRec(s);
+        if (JS_IsException(new_pr.u.value))
+            goto fail;
+        break;
+    }
+
+    if (__JS_AtomIsTaggedInt(atom) && p->fast_array) {
+        if (convert_fast_array_to_array(ctx, p))
+            goto fail_free;
+    }
+    prs = find_own_property(&pr, p, atom);
+    if (prs) {
+        old_flags = prs->flags;
+        old_pr = *pr;
+        if (js_update_property_flags(ctx, p, &prs, flags))
+            goto fail_free;
+        *pr = new_pr;
+        free_property(ctx->rt, &old_pr, old_flags);
+    } else {
+        pr = add_property(ctx, p, atom, flags);
+        if (!pr)
+            goto fail_free;
+        *pr = new_pr;
+    }
+    JS_FreeAtom(ctx, atom);
+    return 0;
+ fail_free:
+    free_property(ctx->rt, &new_pr, flags);
+ fail:
+    JS_FreeAtom(ctx, atom);
+    return -1;
+}
+
+static int JS_ReadSnapshotClosure(BCReaderState *s, JSObject *p)
+{
+    JSFunctionBytecode *b;
+    JSValue bfunc;
+    uint8_t v8;
+    int i;
+
+    if (bc_get_u8(s, &v8))
+        return -1;
+    p->is_constructor = v8;
+    bfunc = JS_ReadObjectRec(s);
+    if (JS_IsException(bfunc))
+        return -1;
+    if (JS_VALUE_GET_TAG(bfunc) != JS_TAG_FUNCTION_BYTECODE) {
+        JS_FreeValue(s->ctx, bfunc);
+        JS_ThrowSyntaxError(s->ctx, "function bytecode expected");
+        return -1;
+    }
+    b = JS_VALUE_GET_PTR(bfunc);
+    p->u.func.function_bytecode = b;
+    if (b->closure_var_count) {
+        p->u.func.var_refs = js_mallocz(s->ctx, sizeof(p->u.func.var_refs[0]) *
+                                        b->closure_var_count);
+        if (!p->u.func.var_refs)
+            return -1;
+        for(i = 0; i < b->closure_var_count; i++) {
+            p->u.func.var_refs[i] = bc_get_var_ref(s);
+            if (!p->u.func.var_refs[i])
+                return -1;
+        }
+    }
+    return bc_get_object_or_null(s, &p->u.func.home_object, JS_ReadObjectRec(s));
+}
+
+static JSValue JS_ReadSnapshotObject(BCReaderState *s)
+{
+    JSContext *ctx = s->ctx;
+    JSValue obj, val;
+    JSObject *p, *proto;
+    uint32_t class_id, count, i;
+    uint8_t v8;
+
+    if (bc_get_leb128(s, &class_id))
+        return JS_EXCEPTION;
+    switch(class_id) {
+    case JS_CLASS_OBJECT:
+    case JS_CLASS_ERROR:
+    case JS_CLASS_ARRAY:
+    case JS_CLASS_BYTECODE_FUNCTION:
+    case JS_CLASS_GENERATOR_FUNCTION:
+    case JS_CLASS_ASYNC_FUNCTION:
+    case JS_CLASS_ASYNC_GENERATOR_FUNCTION:
+    case JS_CLASS_BOUND_FUNCTION:
+    case JS_CLASS_NUMBER:
+    case JS_CLASS_STRING:
+    case JS_CLASS_BOOLEAN:
+    case JS_CLASS_SYMBOL:
+    case JS_CLASS_DATE:
+    case JS_CLASS_BIG_INT:
+        /* the prototype is set once the object reference is known */
+        obj = JS_NewObjectProtoClass(ctx, JS_NULL, class_id);
+        break;
+    case JS_CLASS_REGEXP:
+        {
+            JSString *pattern, *bc;
+            pattern = JS_ReadString(s);
+            if (!pattern)
+                return JS_EXCEPTION;
+            bc = JS_ReadString(s);
+            if (!bc) {
+                js_free_string(ctx->rt, pattern);
+                return JS_EXCEPTION;
+            }
+            obj = JS_NewRegexp(ctx, JS_MKPTR(JS_TAG_STRING, pattern),
+                               JS_MKPTR(JS_TAG_STRING, bc));
+        }
+        break;
+    case JS_CLASS_MAP:
+    case JS_CLASS_SET:
+        obj = js_map_constructor(ctx, JS_UNDEFINED, 0, NULL,
+                                 class_id - JS_CLASS_MAP);
+        break;
+    default:
+        return JS_ThrowSyntaxError(ctx, "invalid object class (%u)", class_id);
+    }
+    if (JS_IsException(obj))
+        return obj;
+    p = JS_VALUE_GET_OBJ(obj);
+    if (BC_add_object_ref(s, obj))
+        goto fail;
+
+    switch(class_id) {
+    case JS_CLASS_ARRAY:
+        if (bc_get_u8(s, &v8))
+            goto fail;
+        if (v8) {
+            if (bc_get_leb128(s, &count))
+                goto fail;
+            /* each element uses at least one byte */
+            if (count > s->buf_end - s->ptr) {
+                JS_ThrowSyntaxError(ctx, "invalid array length");
+                goto fail;
+            }
+            if (count != 0 && expand_fast_array(ctx, p, count))
+                goto fail;
+            for(i = 0; i < count; i++) {
+                val = JS_ReadObjectRec(s);
+                if (JS_IsException(val))
+                    goto fail;
+                p->u.array.u.values[i] = val;
+                p->u.array.count++;
+            }
+        } else {
+            if (convert_fast_array_to_array(ctx, p))
+                goto fail;
+        }
+        break;
+    case JS_CLASS_BYTECODE_FUNCTION:
+    case JS_CLASS_GENERATOR_FUNCTION:
+    case JS_CLASS_ASYNC_FUNCTION:
+    case JS_CLASS_ASYNC_GENERATOR_FUNCTION:
+        p->u.func.function_bytecode = NULL;
+        p->u.func.var_refs = NULL;
+        p->u.func.home_object = NULL;
+        if (JS_ReadSnapshotClosure(s, p))
+            goto fail;
+        break;
+    case JS_CLASS_BOUND_FUNCTION:
+        {
+            JSBoundFunction *bf;
+            if (bc_get_u8(s, &v8))
+                goto fail;
+            p->is_constructor = v8;
+            if (bc_get_leb128(s, &count))
+                goto fail;
+            if (count > s->buf_end - s->ptr) {
+                JS_ThrowSyntaxError(ctx, "invalid bound function");
+                goto fail;
+            }
+            bf = js_malloc(ctx, sizeof(*bf) + count * sizeof(JSValue));
+            if (!bf)
+                goto fail;
+            bf->func_obj = JS_UNDEFINED;
+            bf->this_val = JS_UNDEFINED;
+            bf->argc = count;
+            for(i = 0; i < count; i++)
+                bf->argv[i] = JS_UNDEFINED;
+            p->u.bound_function = bf;
+            bf->func_obj = JS_ReadObjectRec(s);
+            if (JS_IsException(bf->func_obj))
+                goto fail;
+            bf->this_val = JS_ReadObjectRec(s);
+            if (JS_IsException(bf->this_val))
+                goto fail;
+            for(i = 0; i < count; i++) {
+                bf->argv[i] = JS_ReadObjectRec(s);
+                if (JS_IsException(bf->argv[i]))
+                    goto fail;
+            }
+        }
+        break;
+    case JS_CLASS_NUMBER:
+    case JS_CLASS_STRING:
+    case JS_CLASS_BOOLEAN:
+    case JS_CLASS_SYMBOL:
+    case JS_CLASS_DATE:
+    case JS_CLASS_BIG_INT:
+        val = JS_ReadObjectRec(s);
+        if (JS_IsException(val))
+            goto fail;
+        p->u.object_data = val;
+        break;
+    case JS_CLASS_MAP:
+    case JS_CLASS_SET:
+        if (bc_get_leb128(s, &count))
+            goto fail;
+        for(i = 0; i < count; i++) {
+            JSMapRecord *mr;
+            JSValue key;
+            key = JS_ReadObjectRec(s);
+            if (JS_IsException(key))
+                goto fail;
+            mr = map_add_record(ctx, p->u.map_state, key);
+            JS_FreeValue(ctx, key);
+            if (!mr)
+                goto fail;
+            if (class_id == JS_CLASS_MAP) {
+                val = JS_ReadObjectRec(s);
+                if (JS_IsException(val))
+                    goto fail;
+                mr->value = val;
+            } else {
+                mr->value = JS_UNDEFINED;
+            }
+        }
+        break;
+    default:
+        break;
+    }
+
+    if (bc_get_object_or_null(s, &proto, JS_ReadObjectRec(s)))
+        goto fail;
+    if (proto) {
+        int ret;
+        ret = JS_SetPrototypeInternal(ctx, obj, JS_MKPTR(JS_TAG_OBJECT, proto),
+                                      FALSE);
+        JS_FreeValue(ctx, JS_MKPTR(JS_TAG_OBJECT, proto));
+        if (ret < 0)
+            goto fail;
+    }
+    if (bc_get_leb128(s, &count))
+        goto fail;
+    for(i = 0; i < count; i++) {
+        if (JS_ReadSnapshotProperty(s, p))
+            goto fail;
+    }
+    if (bc_get_u8(s, &v8))
+        goto fail;
+    if (!v8 && JS_PreventExtensions(ctx, obj) < 0)
+        goto fail;
+    return obj;
+ fail:
+    JS_FreeValue(ctx, obj);
+    return JS_EXCEPTION;
+}
+
 static JSValue JS_ReadObjectRec(BCReaderState *s)
 {
     JSContext *ctx = s->ctx;
@@ -38784,6 +43447,11 @@ static JSValue JS_ReadObjectRec(BCReaderState *s)
             goto invalid_tag;
         obj = JS_ReadSharedArrayBuffer(s);
         break;
+    case BC_TAG_ARRAY_BUFFER_TRANSFER:
+        if (!s->transfer_data)
+            goto invalid_tag;
+        obj = JS_ReadArrayBufferTransfer(s);
+        break;
     case BC_TAG_DATE:
         obj = JS_ReadDate(s);
         break;
@@ -38793,6 +43461,56 @@ static JSValue JS_ReadObjectRec(BCReaderState *s)
     case BC_TAG_BIG_INT:
         obj = JS_ReadBigInt(s);
         break;
+    case BC_TAG_SNAPSHOT_OBJECT:
+        if (!s->snapshot_base)
+            goto invalid_tag;
+        obj = JS_ReadSnapshotObject(s);
+        break;
+    case BC_TAG_SNAPSHOT_BASE:
+        {
+            uint32_t val;
+            if (!s->snapshot_base)
+                goto invalid_tag;
+            if (bc_get_leb128(s, &val))
+                return JS_EXCEPTION;
+            bc_read_trace(s, "%u\n", val);
+            if (val >= s->snapshot_base->object_count) {
+                return JS_ThrowSyntaxError(ctx, "invalid base object (%u >= %u)",
+                                           val, s->snapshot_base->object_count);
+            }
+            obj = JS_DupValue(ctx, JS_MKPTR(JS_TAG_OBJECT, s->snapshot_base->objects[val].obj));
+        }
+        break;
+    case BC_TAG_SYMBOL:
+        {
+            JSAtom atom;
+            if (!s->snapshot_base)
+                goto invalid_tag;
+            if (bc_get_atom(s, &atom))
+                return JS_EXCEPTION;
+            if (__JS_AtomIsTaggedInt(atom) ||
+                JS_AtomGetKind(ctx, atom) == JS_ATOM_KIND_STRING) {
+                JS_FreeAtom(ctx, atom);
+                return JS_ThrowSyntaxError(ctx, "symbol expected");
+            }
+            obj = JS_AtomToValue(ctx, atom);
+            JS_FreeAtom(ctx, atom);
+        }
+        break;
+    case BC_TAG_FUNCTION_BYTECODE_REFERENCE:
+        {
+            uint32_t val;
+            if (!s->snapshot_base)
+                goto invalid_tag;
+            if (bc_get_leb128(s, &val))
+                return JS_EXCEPTION;
+            if (val >= s->bytecodes_count) {
+                return JS_ThrowSyntaxError(ctx, "invalid function reference (%u >= %u)",
+                                           val, s->bytecodes_count);
+            }
+            obj = JS_DupValue(ctx, JS_MKPTR(JS_TAG_FUNCTION_BYTECODE, s->bytecodes[val]));
+        }
+        break;
     case BC_TAG_OBJECT_REFERENCE:
         {
             uint32_t val;
@@ -38817,6 +43535,32 @@ static JSValue JS_ReadObjectRec(BCReaderState *s)
     return obj;
 }
 
+/* the symbols are also saved in snapshots. Return JS_ATOM_NULL if
+   error. */
+static JSAtom JS_ReadSnapshotAtom(BCReaderState *s)
+{
+    JSString *p;
+    uint8_t atom_type;
+
+    if (bc_get_u8(s, &atom_type))
+        return JS_ATOM_NULL;
+    if (atom_type > JS_ATOM_TYPE_PRIVATE) {
+        JS_ThrowSyntaxError(s->ctx, "invalid atom type");
+        return JS_ATOM_NULL;
+    }
+    if (atom_type == 0) {
+        /* symbol without description */
+        return __JS_NewAtom(s->ctx->rt, NULL, JS_ATOM_TYPE_SYMBOL);
+    }
+    p = JS_ReadString(s);
+    if (!p)
+        return JS_ATOM_NULL;
+    if (atom_type == JS_ATOM_TYPE_STRING)
+        return JS_NewAtomStr(s->ctx, p);
+    else
+        return __JS_NewAtom(s->ctx->rt, p, atom_type);
+}
+
 static int JS_ReadObjectAtoms(BCReaderState *s)
 {
     uint8_t v8;
@@ -38843,10 +43587,14 @@ static int JS_ReadObjectAtoms(BCReaderState *s)
             return s->error_state = -1;
     }
     for(i = 0; i < s->idx_to_atom_count; i++) {
-        p = JS_ReadString(s);
-        if (!p)
-            return -1;
-        atom = JS_NewAtomStr(s->ctx, p);
+        if (s->snapshot_base) {
+            atom = JS_ReadSnapshotAtom(s);
+        } else {
+            p = JS_ReadString(s);
+            if (!p)
+                return -1;
+            atom = JS_NewAtomStr(s->ctx, p);
+        }
         if (atom == JS_ATOM_NULL)
             return s->error_state = -1;
         s->idx_to_atom[i] = atom;
@@ -38867,10 +43615,216 @@ static void bc_reader_free(BCReaderState *s)
         js_free(s->ctx, s->idx_to_atom);
     }
     js_free(s->ctx, s->objects);
+    js_free(s->ctx, s->var_refs);
+    js_free(s->ctx, s->bytecodes);
+}
+
+/* Process-wide cache of the bytecode read with JS_READ_OBJ_SHARED.
+   The bytecode contains the atom values of the runtime which read
+   it, so a relocated copy of the input can be shared by the runtimes
+   which map the atoms of the input to the same values. It is the case
+   of the worker runtimes initialized in the same way before they load
+   the same module. The constant pools and the other GC objects are
+   still allocated in each runtime. */
+typedef struct JSSharedBytecode {
+    struct list_head link; /* in js_shared_bytecode_list if cached */
+    int ref_count; /* number of references from the runtimes */
+    BOOL is_cached;
+    BOOL is_loading; /* the first runtime is relocating the bytecode */
+    uint32_t hash;
+    size_t buf_len;
+    uint8_t *orig_buf; /* content before relocation */
+    int atom_count;
+    JSAtom *atoms; /* atom values used by the relocated bytecode */
+    uint8_t *buf; /* relocated copy, never modified once cached */
+} JSSharedBytecode;
+
+static struct list_head js_shared_bytecode_list =
+    LIST_HEAD_INIT(js_shared_bytecode_list);
+
+#ifdef CONFIG_ATOMICS
+static pthread_mutex_t js_shared_bytecode_mutex = PTHREAD_MUTEX_INITIALIZER;
+/* signaled when a buffer is no longer loading */
+static pthread_cond_t js_shared_bytecode_cond = PTHREAD_COND_INITIALIZER;
+#endif
+
+static void js_shared_bytecode_lock(void)
+{
+#ifdef CONFIG_ATOMICS
+    pthread_mutex_lock(&js_shared_bytecode_mutex);
+#endif
 }
 
-JSValue JS_ReadObject(JSContext *ctx, const uint8_t *buf, size_t buf_len,
-                       int flags)
+static void js_shared_bytecode_unlock(void)
+{
+#ifdef CONFIG_ATOMICS
+    pthread_mutex_unlock(&js_shared_bytecode_mutex);
+#endif
+}
+
+static void js_shared_bytecode_release(JSSharedBytecode *sb)
+{
+    BOOL is_free;
+
+    js_shared_bytecode_lock();
+    is_free = (--sb->ref_count == 0);
+    if (is_free && sb->is_cached)
+        list_del(&sb->link);
+    js_shared_bytecode_unlock();
+    if (is_free) {
+        js_shared_free(sb->orig_buf);
+        js_shared_free(sb->atoms);
+        js_shared_free(sb->buf);
+        js_shared_free(sb);
+    }
+}
+
+static void js_free_shared_bytecode_tab(JSRuntime *rt)
+{
+    int i;
+    for(i = 0; i < rt->shared_bytecode_count; i++)
+        js_shared_bytecode_release(rt->shared_bytecode_tab[i]);
+    js_free_rt(rt, rt->shared_bytecode_tab);
+    rt->shared_bytecode_tab = NULL;
+    rt->shared_bytecode_count = 0;
+    rt->shared_bytecode_size = 0;
+}
+
+static JSSharedBytecode *js_shared_bytecode_new(const uint8_t *buf, size_t buf_len,
+                                                uint32_t hash,
+                                                const JSAtom *atoms, int atom_count)
+{
+    JSSharedBytecode *sb;
+
+    sb = js_shared_mallocz(sizeof(*sb));
+    if (!sb)
+        return NULL;
+    sb->ref_count = 1;
+    sb->hash = hash;
+    sb->buf_len = buf_len;
+    sb->atom_count = atom_count;
+    sb->buf = js_shared_mallocz(buf_len);
+    sb->atoms = js_shared_mallocz(sizeof(atoms[0]) * atom_count);
+    sb->orig_buf = js_shared_mallocz(buf_len);
+    if (!sb->buf || !sb->atoms || !sb->orig_buf) {
+        js_shared_free(sb->orig_buf);
+        js_shared_free(sb->atoms);
+        js_shared_free(sb->buf);
+        js_shared_free(sb);
+        return NULL;
+    }
+    memcpy(sb->buf, buf, buf_len);
+    memcpy(sb->orig_buf, buf, buf_len);
+    memcpy(sb->atoms, atoms, sizeof(atoms[0]) * atom_count);
+    return sb;
+}
+
+/* Called once the atoms are read. Continue reading from a shared
+   relocated buffer, which is created if no cached one matches. */
+static int js_shared_bytecode_attach(BCReaderState *s)
+{
+    JSContext *ctx = s->ctx;
+    JSRuntime *rt = ctx->rt;
+    JSSharedBytecode *sb;
+    struct list_head *el;
+    size_t buf_len, pos;
+    uint32_t hash;
+
+    buf_len = s->buf_end - s->buf_start;
+    pos = s->ptr - s->buf_start;
+    hash = js_hash_buf(s->buf_start, buf_len);
+
+    if (js_resize_array(ctx, (void **)&rt->shared_bytecode_tab,
+                        sizeof(rt->shared_bytecode_tab[0]),
+                        &rt->shared_bytecode_size,
+                        rt->shared_bytecode_count + 1))
+        return -1;
+
+    js_shared_bytecode_lock();
+ retry:
+    list_for_each(el, &js_shared_bytecode_list) {
+        sb = list_entry(el, JSSharedBytecode, link);
+        if (sb->hash == hash && sb->buf_len == buf_len &&
+            sb->atom_count == s->idx_to_atom_count &&
+            !memcmp(sb->atoms, s->idx_to_atom,
+                    sizeof(sb->atoms[0]) * sb->atom_count) &&
+            !memcmp(sb->orig_buf, s->buf_start, buf_len)) {
+            if (sb->is_loading) {
+#ifdef CONFIG_ATOMICS
+                /* wait instead of doing the same relocation */
+                pthread_cond_wait(&js_shared_bytecode_cond,
+                                  &js_shared_bytecode_mutex);
+                goto retry;
+#else
+                continue;
+#endif
+            }
+            sb->ref_count++;
+            js_shared_bytecode_unlock();
+            /* the bytecode is already relocated for this runtime */
+            s->is_rom_data = TRUE;
+            goto done;
+        }
+    }
+
+    sb = js_shared_bytecode_new(s->buf_start, buf_len, hash,
+                                s->idx_to_atom, s->idx_to_atom_count);
+    if (!sb) {
+        js_shared_bytecode_unlock();
+        JS_ThrowOutOfMemory(ctx);
+        return -1;
+    }
+    sb->is_cached = TRUE;
+    sb->is_loading = TRUE;
+    list_add(&sb->link, &js_shared_bytecode_list);
+    js_shared_bytecode_unlock();
+    s->is_rom_data = FALSE;
+    s->is_shared_init = TRUE;
+ done:
+    rt->shared_bytecode_tab[rt->shared_bytecode_count++] = sb;
+    s->buf_start = sb->buf;
+    s->buf_end = sb->buf + buf_len;
+    s->ptr = sb->buf + pos;
+    return 0;
+}
+
+/* Called after the bytecode is relocated. It can be used by the other
+   runtimes if it was fully read. */
+static void js_shared_bytecode_end_loading(BCReaderState *s, BOOL is_ok)
+{
+    JSRuntime *rt = s->ctx->rt;
+    JSSharedBytecode *sb;
+
+    sb = rt->shared_bytecode_tab[rt->shared_bytecode_count - 1];
+    js_shared_bytecode_lock();
+    sb->is_loading = FALSE;
+    if (!is_ok) {
+        /* partially relocated: only used by this runtime */
+        list_del(&sb->link);
+        sb->is_cached = FALSE;
+    }
+#ifdef CONFIG_ATOMICS
+    pthread_cond_broadcast(&js_shared_bytecode_cond);
+#endif
+    js_shared_bytecode_unlock();
+}
+
+int JS_GetSharedBytecodeCount(void)
+{
+    struct list_head *el;
+    int count;
+
+    count = 0;
+    js_shared_bytecode_lock();
+    list_for_each(el, &js_shared_bytecode_list) {
+        count++;
+    }
+    js_shared_bytecode_unlock();
+    return count;
+}
+
+JSValue JS_ReadObject2(JSContext *ctx, const uint8_t *buf, size_t buf_len,
+                       int flags, uint8_t **transfer_data, int transfer_len)
 {
     BCReaderState ss, *s = &ss;
     JSValue obj;
@@ -38887,6 +43841,8 @@ JSValue JS_ReadObject(JSContext *ctx, const uint8_t *buf, size_t buf_len,
     s->is_rom_data = ((flags & JS_READ_OBJ_ROM_DATA) != 0);
     s->allow_sab = ((flags & JS_READ_OBJ_SAB) != 0);
     s->allow_reference = ((flags & JS_READ_OBJ_REFERENCE) != 0);
+    s->transfer_data = transfer_data;
+    s->transfer_len = transfer_len;
     if (s->allow_bytecode)
         s->first_atom = JS_ATOM_END;
     else
@@ -38894,12 +43850,674 @@ JSValue JS_ReadObject(JSContext *ctx, const uint8_t *buf, size_t buf_len,
     if (JS_ReadObjectAtoms(s)) {
         obj = JS_EXCEPTION;
     } else {
+        /* nothing to share if the input buffer can be used directly */
+        if ((flags & JS_READ_OBJ_SHARED) && s->allow_bytecode &&
+            !s->is_rom_data && !is_be()) {
+            if (js_shared_bytecode_attach(s)) {
+                obj = JS_EXCEPTION;
+                goto done;
+            }
+        }
         obj = JS_ReadObjectRec(s);
+        if (s->is_shared_init)
+            js_shared_bytecode_end_loading(s, !JS_IsException(obj));
     }
+ done:
     bc_reader_free(s);
     return obj;
 }
 
+JSValue JS_ReadObject(JSContext *ctx, const uint8_t *buf, size_t buf_len,
+                      int flags)
+{
+    return JS_ReadObject2(ctx, buf, buf_len, flags, NULL, 0);
+}
+
+JSValue JS_CopyValue(JSContext *dst_ctx, JSContext *src_ctx, JSValueConst val)
+{
+    uint8_t *buf;
+    size_t len;
+    JSValue ret;
+
+    buf = JS_WriteObject(src_ctx, &len, val, JS_WRITE_OBJ_REFERENCE);
+    if (!buf) {
+        if (dst_ctx->rt != src_ctx->rt) {
+            JS_FreeValue(src_ctx, JS_GetException(src_ctx));
+            JS_ThrowTypeError(dst_ctx, "cannot copy the value");
+        }
+        return JS_EXCEPTION;
+    }
+    ret = JS_ReadObject(dst_ctx, buf, len, JS_READ_OBJ_REFERENCE);
+    js_free(src_ctx, buf);
+    return ret;
+}
+
+/*******************************************************************/
+/* context snapshots */
+
+/* A snapshot contains the difference between the state of a context
+   and its base state recorded by JS_EnableSnapshot(). The objects
+   reachable from the context roots at that time (intrinsic objects,
+   host functions) are numbered by a deterministic walk. The same walk
+   is done by JS_ReadSnapshot() in a context initialized in the same
+   way, so that these objects are referenced by index and only their
+   modified properties are saved. The other objects are serialized
+   with their class, prototype and properties, including the closures
+   with their bytecode and their variable references. */
+
+typedef enum {
+    SNAPSHOT_OP_END,
+    SNAPSHOT_OP_DEFINE,
+    SNAPSHOT_OP_DELETE,
+    SNAPSHOT_OP_PROTO,
+    SNAPSHOT_OP_PREVENT_EXTENSIONS,
+} JSSnapshotOpEnum;
+
+static int js_snapshot_base_add_object(JSContext *ctx, JSSnapshotBase *b,
+                                       JSObject *p)
+{
+    JSSnapshotObject *so;
+
+    if (js_object_list_find(ctx, &b->object_list, p) >= 0)
+        return 0;
+    if (js_resize_array(ctx, (void **)&b->objects, sizeof(b->objects[0]),
+                        &b->object_size, b->object_count + 1))
+        return -1;
+    if (js_object_list_add(ctx, &b->object_list, p))
+        return -1;
+    so = &b->objects[b->object_count++];
+    memset(so, 0, sizeof(*so));
+    so->obj = p;
+    p->header.ref_count++;
+    return 0;
+}
+
+static int js_snapshot_base_add_value(JSContext *ctx, JSSnapshotBase *b,
+                                      JSValueConst val)
+{
+    if (JS_VALUE_GET_TAG(val) != JS_TAG_OBJECT)
+        return 0;
+    return js_snapshot_base_add_object(ctx, b, JS_VALUE_GET_OBJ(val));
+}
+
+static int js_snapshot_base_add_var_ref(JSContext *ctx, JSSnapshotBase *b,
+                                        JSVarRef *var_ref)
+{
+    JSSnapshotVarRef *sv;
+
+    if (js_object_list_find(ctx, &b->var_ref_list, (JSObject *)var_ref) >= 0)
+        return 0;
+    if (js_resize_array(ctx, (void **)&b->var_refs, sizeof(b->var_refs[0]),
+                        &b->var_ref_size, b->var_ref_count + 1))
+        return -1;
+    if (js_object_list_add(ctx, &b->var_ref_list, (JSObject *)var_ref))
+        return -1;
+    sv = &b->var_refs[b->var_ref_count++];
+    memset(sv, 0, sizeof(*sv));
+    sv->var_ref = var_ref;
+    sv->value = JS_UNDEFINED;
+    var_ref->header.ref_count++;
+    return js_snapshot_base_add_value(ctx, b, *var_ref->pvalue);
+}
+
+static int js_snapshot_base_scan(JSContext *ctx, JSSnapshotBase *b,
+                                 JSObject *p)
+{
+    JSShapeProperty *prs;
+    JSProperty *pr;
+    int i;
+
+    for(i = 0; i < p->shape->prop_count; i++) {
+        prs = get_shape_prop(p->shape) + i;
+        pr = &p->prop[i];
+        if (prs->atom == JS_ATOM_NULL)
+            continue;
+        if ((prs->flags & JS_PROP_TMASK) == JS_PROP_AUTOINIT) {
+            /* the lazy properties are instantiated so that the base
+               does not depend on the properties which were accessed */
+            if (JS_AutoInitProperty(ctx, p, prs->atom, pr, prs))
+                return -1;
+            prs = get_shape_prop(p->shape) + i;
+        }
+        switch(prs->flags & JS_PROP_TMASK) {
+        case JS_PROP_GETSET:
+            if (pr->u.getset.getter &&
+                js_snapshot_base_add_object(ctx, b, pr->u.getset.getter))
+                return -1;
+            if (pr->u.getset.setter &&
+                js_snapshot_base_add_object(ctx, b, pr->u.getset.setter))
+                return -1;
+            break;
+        case JS_PROP_VARREF:
+            if (js_snapshot_base_add_var_ref(ctx, b, pr->u.var_ref))
+                return -1;
+            break;
+        case JS_PROP_NORMAL:
+            if (js_snapshot_base_add_value(ctx, b, pr->u.value))
+                return -1;
+            break;
+        default:
+            break;
+        }
+    }
+    if (p->shape->proto)
+        return js_snapshot_base_add_object(ctx, b, p->shape->proto);
+    return 0;
+}
+
+static void js_snapshot_dup_property(JSContext *ctx, JSProperty *dst,
+                                     JSProperty *pr, int flags)
+{
+    *dst = *pr;
+    switch(flags & JS_PROP_TMASK) {
+    case JS_PROP_GETSET:
+        if (pr->u.getset.getter)
+            pr->u.getset.getter->header.ref_count++;
+        if (pr->u.getset.setter)
+            pr->u.getset.setter->header.ref_count++;
+        break;
+    case JS_PROP_VARREF:
+        pr->u.var_ref->header.ref_count++;
+        break;
+    case JS_PROP_AUTOINIT:
+        JS_DupContext(js_autoinit_get_realm(pr));
+        break;
+    default:
+        JS_DupValue(ctx, pr->u.value);
+        break;
+    }
+}
+
+/* record the state of the base objects which is compared with their
+   state when the snapshot is written */
+static int js_snapshot_base_record(JSContext *ctx, JSSnapshotBase *b)
+{
+    JSSnapshotObject *so;
+    JSSnapshotVarRef *sv;
+    JSSnapshotProp *sp;
+    JSShapeProperty *prs;
+    JSObject *p;
+    int i, j;
+
+    for(i = 0; i < b->object_count; i++) {
+        so = &b->objects[i];
+        p = so->obj;
+        so->proto = p->shape->proto;
+        so->extensible = p->extensible;
+        if (p->shape->prop_count == 0)
+            continue;
+        so->props = js_malloc(ctx, sizeof(so->props[0]) * p->shape->prop_count);
+        if (!so->props)
+            return -1;
+        for(j = 0, prs = get_shape_prop(p->shape); j < p->shape->prop_count; j++, prs++) {
+            if (prs->atom == JS_ATOM_NULL)
+                continue;
+            sp = &so->props[so->prop_count++];
+            sp->atom = JS_DupAtom(ctx, prs->atom);
+            sp->flags = prs->flags;
+            js_snapshot_dup_property(ctx, &sp->u, &p->prop[j], prs->flags);
+        }
+    }
+    for(i = 0; i < b->var_ref_count; i++) {
+        sv = &b->var_refs[i];
+        sv->value = JS_DupValue(ctx, *sv->var_ref->pvalue);
+        sv->is_lexical = sv->var_ref->is_lexical;
+        sv->is_const = sv->var_ref->is_const;
+    }
+    return 0;
+}
+
+static void js_snapshot_base_free(JSRuntime *rt, JSSnapshotBase *b)
+{
+    JSSnapshotObject *so;
+    int i, j;
+
+    for(i = 0; i < b->object_count; i++) {
+        so = &b->objects[i];
+        for(j = 0; j < so->prop_count; j++) {
+            JS_FreeAtomRT(rt, so->props[j].atom);
+            free_property(rt, &so->props[j].u, so->props[j].flags);
+        }
+        js_free_rt(rt, so->props);
+        JS_FreeValueRT(rt, JS_MKPTR(JS_TAG_OBJECT, so->obj));
+    }
+    for(i = 0; i < b->var_ref_count; i++) {
+        JS_FreeValueRT(rt, b->var_refs[i].value);
+        free_var_ref(rt, b->var_refs[i].var_ref);
+    }
+    js_free_rt(rt, b->objects);
+    js_free_rt(rt, b->var_refs);
+    js_free_rt(rt, b->object_list.object_tab);
+    js_free_rt(rt, b->object_list.hash_table);
+    js_free_rt(rt, b->var_ref_list.object_tab);
+    js_free_rt(rt, b->var_ref_list.hash_table);
+    js_free_rt(rt, b);
+}
+
+static void js_snapshot_base_mark(JSRuntime *rt, JSSnapshotBase *b,
+                                  JS_MarkFunc *mark_func)
+{
+    JSSnapshotObject *so;
+    JSSnapshotProp *sp;
+    int i, j;
+
+    for(i = 0; i < b->object_count; i++) {
+        so = &b->objects[i];
+        mark_func(rt, &so->obj->header);
+        for(j = 0; j < so->prop_count; j++) {
+            sp = &so->props[j];
+            switch(sp->flags & JS_PROP_TMASK) {
+            case JS_PROP_GETSET:
+                if (sp->u.u.getset.getter)
+                    mark_func(rt, &sp->u.u.getset.getter->header);
+                if (sp->u.u.getset.setter)
+                    mark_func(rt, &sp->u.u.getset.setter->header);
+                break;
+            case JS_PROP_VARREF:
+                mark_func(rt, &sp->u.u.var_ref->header);
+                break;
+            case JS_PROP_AUTOINIT:
+                js_autoinit_mark(rt, &sp->u, mark_func);
+                break;
+            default:
+                JS_MarkValue(rt, sp->u.u.value, mark_func);
+                break;
+            }
+        }
+    }
+    for(i = 0; i < b->var_ref_count; i++) {
+        mark_func(rt, &b->var_refs[i].var_ref->header);
+        JS_MarkValue(rt, b->var_refs[i].value, mark_func);
+    }
+}
+
+/* walk the objects reachable from the context roots. If 'record' is
+   TRUE, their state is recorded. */
+static JSSnapshotBase *js_snapshot_base_new(JSContext *ctx, BOOL record)
+{
+    JSSnapshotBase *b;
+    JSObject *p;
+    uint32_t h;
+    int i, pass;
+
+    b = js_mallocz(ctx, sizeof(*b));
+    if (!b)
+        return NULL;
+    js_object_list_init(&b->object_list);
+    js_object_list_init(&b->var_ref_list);
+
+    if (js_snapshot_base_add_value(ctx, b, ctx->global_obj) ||
+        js_snapshot_base_add_value(ctx, b, ctx->global_var_obj) ||
+        js_snapshot_base_add_value(ctx, b, JS_VALUE_GET_OBJ(ctx->global_obj)->u.global_object.uninitialized_vars) ||
+        js_snapshot_base_add_value(ctx, b, ctx->function_proto) ||
+        js_snapshot_base_add_value(ctx, b, ctx->function_ctor) ||
+        js_snapshot_base_add_value(ctx, b, ctx->array_ctor) ||
+        js_snapshot_base_add_value(ctx, b, ctx->regexp_ctor) ||
+        js_snapshot_base_add_value(ctx, b, ctx->promise_ctor) ||
+        js_snapshot_base_add_value(ctx, b, ctx->iterator_ctor) ||
+        js_snapshot_base_add_value(ctx, b, ctx->async_iterator_proto) ||
+        js_snapshot_base_add_value(ctx, b, ctx->array_proto_values) ||
+        js_snapshot_base_add_value(ctx, b, ctx->throw_type_error) ||
+        js_snapshot_base_add_value(ctx, b, ctx->eval_obj))
+        goto fail;
+    for(i = 0; i < JS_NATIVE_ERROR_COUNT; i++) {
+        if (js_snapshot_base_add_value(ctx, b, ctx->native_error_proto[i]))
+            goto fail;
+    }
+    for(i = 0; i < ctx->rt->class_count; i++) {
+        if (js_snapshot_base_add_value(ctx, b, ctx->class_proto[i]))
+            goto fail;
+    }
+    /* the instantiation of the lazy properties may add properties to
+       the objects which were already scanned, hence the second pass */
+    for(pass = 0; pass < 2; pass++) {
+        for(i = 0; i < b->object_count; i++) {
+            if (js_snapshot_base_scan(ctx, b, b->objects[i].obj))
+                goto fail;
+        }
+    }
+
+    /* used to check that the snapshot is read in a compatible context */
+    h = b->object_count;
+    h = h * 263 + b->var_ref_count;
+    for(i = 0; i < b->object_count; i++) {
+        p = b->objects[i].obj;
+        h = h * 263 + p->class_id;
+        h = h * 263 + p->shape->prop_count;
+    }
+    b->hash = h;
+
+    if (record && js_snapshot_base_record(ctx, b))
+        goto fail;
+    return b;
+ fail:
+    js_snapshot_base_free(ctx->rt, b);
+    return NULL;
+}
+
+/* the length of the arrays of the base is not tracked */
+static BOOL js_snapshot_is_skipped_prop(JSObject *p, int flags)
+{
+    return p->class_id == JS_CLASS_ARRAY && (flags & JS_PROP_LENGTH);
+}
+
+static BOOL js_snapshot_same_prop(JSContext *ctx, JSSnapshotProp *sp,
+                                  JSShapeProperty *prs, JSProperty *pr)
+{
+    if (sp->flags != prs->flags)
+        return FALSE;
+    switch(prs->flags & JS_PROP_TMASK) {
+    case JS_PROP_GETSET:
+        return (sp->u.u.getset.getter == pr->u.getset.getter &&
+                sp->u.u.getset.setter == pr->u.getset.setter);
+    case JS_PROP_VARREF:
+        return sp->u.u.var_ref == pr->u.var_ref;
+    case JS_PROP_AUTOINIT:
+        return sp->u.u.init.realm_and_id == pr->u.init.realm_and_id;
+    default:
+        return js_same_value(ctx, sp->u.u.value, pr->u.value);
+    }
+}
+
+static int JS_WriteSnapshotObjectPatch(BCWriterState *s, int idx)
+{
+    JSContext *ctx = s->ctx;
+    JSSnapshotObject *so = &s->snapshot_base->objects[idx];
+    JSObject *p = so->obj;
+    JSShapeProperty *prs;
+    JSProperty *pr;
+    JSSnapshotProp *sp;
+    BOOL modified;
+    int i, j;
+
+    modified = FALSE;
+#define SNAPSHOT_PATCH_START()                  \
+    do {                                        \
+        if (!modified) {                        \
+            bc_put_leb128(s, idx + 1);          \
+            modified = TRUE;                    \
+        }                                       \
+    } while (0)
+
+    for(i = 0; i < so->prop_count; i++) {
+        sp = &so->props[i];
+        if (js_snapshot_is_skipped_prop(p, sp->flags))
+            continue;
+        if (!find_own_property(&pr, p, sp->atom)) {
+            SNAPSHOT_PATCH_START();
+            bc_put_u8(s, SNAPSHOT_OP_DELETE);
+            bc_put_atom(s, sp->atom);
+        }
+    }
+    /* the shape of 'p' may be modified while writing the values */
+    for(i = 0; i < p->shape->prop_count; i++) {
+        prs = get_shape_prop(p->shape) + i;
+        pr = &p->prop[i];
+        if (prs->atom == JS_ATOM_NULL ||
+            js_snapshot_is_skipped_prop(p, prs->flags))
+            continue;
+        for(j = 0; j < so->prop_count; j++) {
+            if (so->props[j].atom == prs->atom)
+                break;
+        }
+        if (j < so->prop_count &&
+            js_snapshot_same_prop(ctx, &so->props[j], prs, pr))
+            continue;
+        SNAPSHOT_PATCH_START();
+        bc_put_u8(s, SNAPSHOT_OP_DEFINE);
+        if (JS_WriteSnapshotProperty(s, prs, pr))
+            return -1;
+    }
+    if (p->shape->proto != so->proto) {
+        SNAPSHOT_PATCH_START();
+        bc_put_u8(s, SNAPSHOT_OP_PROTO);
+        if (JS_WriteObjectRec(s, p->shape->proto ?
+                              JS_MKPTR(JS_TAG_OBJECT, p->shape->proto) : JS_NULL))
+            return -1;
+    }
+    if (so->extensible && !p->extensible) {
+        SNAPSHOT_PATCH_START();
+        bc_put_u8(s, SNAPSHOT_OP_PREVENT_EXTENSIONS);
+    }
+#undef SNAPSHOT_PATCH_START
+    if (modified)
+        bc_put_u8(s, SNAPSHOT_OP_END);
+    return 0;
+}
+
+static int JS_WriteSnapshotPatches(BCWriterState *s)
+{
+    JSSnapshotBase *b = s->snapshot_base;
+    JSSnapshotVarRef *sv;
+    JSVarRef *var_ref;
+    int i;
+
+    /* the variables of the base are written first */
+    for(i = 0; i < b->var_ref_count; i++) {
+        sv = &b->var_refs[i];
+        var_ref = sv->var_ref;
+        if (var_ref->is_lexical != sv->is_lexical ||
+            var_ref->is_const != sv->is_const ||
+            !js_same_value(s->ctx, *var_ref->pvalue, sv->value)) {
+            bc_put_leb128(s, i + 1);
+            if (JS_WriteSnapshotVarRefValue(s, var_ref))
+                return -1;
+        }
+    }
+    bc_put_leb128(s, 0);
+    for(i = 0; i < b->object_count; i++) {
+        if (JS_WriteSnapshotObjectPatch(s, i))
+            return -1;
+    }
+    bc_put_leb128(s, 0);
+    return 0;
+}
+
+static int JS_ReadSnapshotPatches(BCReaderState *s)
+{
+    JSContext *ctx = s->ctx;
+    JSSnapshotBase *b = s->snapshot_base;
+    JSObject *p;
+    JSAtom atom;
+    JSValue val;
+    uint32_t idx;
+    uint8_t op;
+    int ret;
+
+    for(;;) {
+        if (bc_get_leb128(s, &idx))
+            return -1;
+        if (idx == 0)
+            break;
+        if (--idx >= b->var_ref_count)
+            goto invalid;
+        if (JS_ReadSnapshotVarRefValue(s, b->var_refs[idx].var_ref))
+            return -1;
+    }
+    for(;;) {
+        if (bc_get_leb128(s, &idx))
+            return -1;
+        if (idx == 0)
+            break;
+        if (--idx >= b->object_count)
+            goto invalid;
+        p = b->objects[idx].obj;
+        for(;;) {
+            if (bc_get_u8(s, &op))
+                return -1;
+            if (op == SNAPSHOT_OP_END)
+                break;
+            switch(op) {
+            case SNAPSHOT_OP_DEFINE:
+                if (JS_ReadSnapshotProperty(s, p))
+                    return -1;
+                break;
+            case SNAPSHOT_OP_DELETE:
+                if (bc_get_atom(s, &atom))
+                    return -1;
+                ret = delete_property(ctx, p, atom);
+                JS_FreeAtom(ctx, atom);
+                if (ret < 0)
+                    return -1;
+                break;
+            case SNAPSHOT_OP_PROTO:
+                val = JS_ReadObjectRec(s);
+                if (JS_IsException(val))
+                    return -1;
+                ret = JS_SetPrototypeInternal(ctx, JS_MKPTR(JS_TAG_OBJECT, p),
+                                              val, FALSE);
+                JS_FreeValue(ctx, val);
+                if (ret < 0)
+                    return -1;
+                break;
+            case SNAPSHOT_OP_PREVENT_EXTENSIONS:
+                if (JS_PreventExtensions(ctx, JS_MKPTR(JS_TAG_OBJECT, p)) < 0)
+                    return -1;
+                break;
+            default:
+                goto invalid;
+            }
+        }
+    }
+    return 0;
+ invalid:
+    JS_ThrowSyntaxError(ctx, "invalid snapshot");
+    return -1;
+}
+
+int JS_EnableSnapshot(JSContext *ctx)
+{
+    JSSnapshotBase *b;
+
+    b = js_snapshot_base_new(ctx, TRUE);
+    if (!b)
+        return -1;
+    if (ctx->snapshot_base)
+        js_snapshot_base_free(ctx->rt, ctx->snapshot_base);
+    ctx->snapshot_base = b;
+    return 0;
+}
+
+uint8_t *JS_WriteSnapshot(JSContext *ctx, size_t *psize)
+{
+    BCWriterState ss, *s = &ss;
+    JSSnapshotBase *b = ctx->snapshot_base;
+    int i;
+
+    if (!b) {
+        JS_ThrowTypeError(ctx, "snapshots are not enabled");
+        *psize = 0;
+        return NULL;
+    }
+    memset(s, 0, sizeof(*s));
+    s->ctx = ctx;
+    s->allow_bytecode = TRUE;
+    s->allow_reference = TRUE;
+    s->snapshot_base = b;
+    s->first_atom = JS_ATOM_END;
+    js_dbuf_init(ctx, &s->dbuf);
+    js_object_list_init(&s->object_list);
+    js_object_list_init(&s->var_ref_list);
+    js_object_list_init(&s->bytecode_list);
+
+    /* the variables of the base have the first indexes */
+    for(i = 0; i < b->var_ref_count; i++) {
+        if (js_object_list_add(ctx, &s->var_ref_list,
+                               (JSObject *)b->var_refs[i].var_ref))
+            goto fail;
+    }
+    bc_put_leb128(s, b->object_count);
+    bc_put_leb128(s, b->var_ref_count);
+    bc_put_u32(s, b->hash);
+    if (JS_WriteSnapshotPatches(s))
+        goto fail;
+    if (JS_WriteObjectAtoms(s))
+        goto fail;
+    /* the bytecode is not checked when it is read, so a checksum
+       detects the truncated or corrupted images */
+    bc_put_u32(s, js_hash_buf(s->dbuf.buf, s->dbuf.size));
+    if (dbuf_error(&s->dbuf)) {
+        JS_ThrowOutOfMemory(ctx);
+        goto fail;
+    }
+    js_object_list_end(ctx, &s->object_list);
+    js_object_list_end(ctx, &s->var_ref_list);
+    js_object_list_end(ctx, &s->bytecode_list);
+    js_free(ctx, s->atom_to_idx);
+    js_free(ctx, s->idx_to_atom);
+    *psize = s->dbuf.size;
+    return s->dbuf.buf;
+ fail:
+    js_object_list_end(ctx, &s->object_list);
+    js_object_list_end(ctx, &s->var_ref_list);
+    js_object_list_end(ctx, &s->bytecode_list);
+    js_free(ctx, s->atom_to_idx);
+    js_free(ctx, s->idx_to_atom);
+    dbuf_free(&s->dbuf);
+    *psize = 0;
+    return NULL;
+}
+
+int JS_ReadSnapshot(JSContext *ctx, const uint8_t *buf, size_t buf_len,
+                    int flags)
+{
+    BCReaderState ss, *s = &ss;
+    JSSnapshotBase *b;
+    uint32_t object_count, var_ref_count, hash;
+    int i, ret;
+
+    if (buf_len < 4)
+        goto invalid;
+    buf_len -= 4;
+    hash = get_u32(buf + buf_len);
+    if (is_be())
+        hash = bswap32(hash);
+    if (hash != js_hash_buf(buf, buf_len))
+        goto invalid;
+
+    b = js_snapshot_base_new(ctx, FALSE);
+    if (!b)
+        return -1;
+    memset(s, 0, sizeof(*s));
+    s->ctx = ctx;
+    s->buf_start = buf;
+    s->buf_end = buf + buf_len;
+    s->ptr = buf;
+    s->allow_bytecode = TRUE;
+    s->allow_reference = TRUE;
+    s->is_rom_data = ((flags & JS_READ_OBJ_ROM_DATA) != 0);
+    s->first_atom = JS_ATOM_END;
+    s->snapshot_base = b;
+
+    ret = -1;
+    if (JS_ReadObjectAtoms(s))
+        goto done;
+    if (bc_get_leb128(s, &object_count) ||
+        bc_get_leb128(s, &var_ref_count) ||
+        bc_get_u32(s, &hash))
+        goto done;
+    if (object_count != b->object_count ||
+        var_ref_count != b->var_ref_count ||
+        hash != b->hash) {
+        JS_ThrowTypeError(ctx, "the snapshot was created in an incompatible context");
+        goto done;
+    }
+    if (js_resize_array(ctx, (void *)&s->var_refs, sizeof(s->var_refs[0]),
+                        &s->var_refs_size, b->var_ref_count))
+        goto done;
+    for(i = 0; i < b->var_ref_count; i++)
+        s->var_refs[i] = b->var_refs[i].var_ref;
+    s->var_refs_count = b->var_ref_count;
+    ret = JS_ReadSnapshotPatches(s);
+ done:
+    bc_reader_free(s);
+    js_snapshot_base_free(ctx->rt, b);
+    return ret;
+ invalid:
+    JS_ThrowSyntaxError(ctx, "invalid snapshot");
+    return -1;
+}
+
 /*******************************************************************/
 /* runtime functions & objects */
 
@@ -40603,6 +46221,40 @@ static JSValue *build_arg_list(JSContext *ctx, uint32_t *plen,
     return tab;
 }
 
+/* return the elements of the array or unmapped arguments object
+   'array_arg' if reading its length and elements has no side effect */
+static BOOL js_get_fast_arg_list(JSContext *ctx, JSValueConst array_arg,
+                                 JSValue **arrpp, uint32_t *countp)
+{
+    JSObject *p;
+    JSShapeProperty *prs;
+    JSProperty *pr;
+    JSValueConst len;
+
+    if (JS_VALUE_GET_TAG(array_arg) != JS_TAG_OBJECT)
+        return FALSE;
+    p = JS_VALUE_GET_OBJ(array_arg);
+    if (!p->fast_array)
+        return FALSE;
+    if (p->class_id == JS_CLASS_ARRAY) {
+        len = p->prop[0].u.value;
+    } else if (p->class_id == JS_CLASS_ARGUMENTS) {
+        prs = find_own_property(&pr, p, JS_ATOM_length);
+        if (!prs || (prs->flags & JS_PROP_TMASK) != JS_PROP_NORMAL)
+            return FALSE;
+        len = pr->u.value;
+    } else {
+        return FALSE;
+    }
+    if (JS_VALUE_GET_TAG(len) != JS_TAG_INT ||
+        JS_VALUE_GET_INT(len) != p->u.array.count ||
+        p->u.array.count > JS_MAX_LOCAL_VARS)
+        return FALSE;
+    *arrpp = p->u.array.u.values;
+    *countp = p->u.array.count;
+    return TRUE;
+}
+
 /* magic value: 0 = normal apply, 1 = apply for constructor, 2 =
    Reflect.apply */
 static JSValue js_function_apply(JSContext *ctx, JSValueConst this_val,
@@ -40611,6 +46263,7 @@ static JSValue js_function_apply(JSContext *ctx, JSValueConst this_val,
     JSValueConst this_arg, array_arg;
     uint32_t len;
     JSValue *tab, ret;
+    JSObject *p;
 
     if (check_function(ctx, this_val))
         return JS_EXCEPTION;
@@ -40620,6 +46273,17 @@ static JSValue js_function_apply(JSContext *ctx, JSValueConst this_val,
          JS_VALUE_GET_TAG(array_arg) == JS_TAG_NULL) && magic != 2) {
         return JS_Call(ctx, this_val, this_arg, 0, NULL);
     }
+    /* A bytecode function copies its arguments to its frame and builds
+       its 'arguments' object before running any code, so the array
+       elements can be passed without a copy. A C function may modify
+       the array while it still uses them. */
+    p = JS_VALUE_GET_OBJ(this_val);
+    if (!(magic & 1) && p->class_id == JS_CLASS_BYTECODE_FUNCTION &&
+        p->u.func.function_bytecode->has_simple_parameter_list &&
+        js_get_fast_arg_list(ctx, array_arg, &tab, &len)) {
+        return JS_CallInternal(ctx, this_val, this_arg, JS_UNDEFINED,
+                               len, tab, JS_CALL_FLAG_COPY_ARGV);
+    }
     tab = build_arg_list(ctx, &len, array_arg);
     if (!tab)
         return JS_EXCEPTION;
@@ -42714,26 +48378,77 @@ static int js_array_cmp_generic(const void *a, const void *b, void *opaque) {
         }
         cmp = js_string_compare(ctx, ap->str, bp->str);
     }
-    if (cmp != 0)
-        return cmp;
+    return cmp;
 cmp_same:
-    /* make sort stable: compare array offsets */
-    return (ap->pos > bp->pos) - (ap->pos < bp->pos);
+    /* the sort is stable: no need to compare array offsets */
+    return 0;
 
 exception:
     psc->exception = 1;
     return 0;
 }
 
+static int js_uint32_digits(uint32_t v)
+{
+    int n = 1;
+    while (v >= 10) {
+        v /= 10;
+        n++;
+    }
+    return n;
+}
+
+/* compare the decimal representations of two int32 values without
+   converting them to strings */
+static int js_array_cmp_int32(const void *a, const void *b, void *opaque) {
+    static const uint32_t pow10[10] = {
+        1, 10, 100, 1000, 10000, 100000, 1000000, 10000000,
+        100000000, 1000000000,
+    };
+    int32_t v1 = JS_VALUE_GET_INT(((const ValueSlot *)a)->val);
+    int32_t v2 = JS_VALUE_GET_INT(((const ValueSlot *)b)->val);
+    uint32_t x, y;
+    uint64_t x1, y1;
+    int dx, dy;
+
+    if (v1 == v2)
+        return 0;
+    /* '-' is before the digits */
+    if ((v1 < 0) != (v2 < 0))
+        return v1 < 0 ? -1 : 1;
+    x = v1 < 0 ? -(uint32_t)v1 : v1;
+    y = v2 < 0 ? -(uint32_t)v2 : v2;
+    dx = js_uint32_digits(x);
+    dy = js_uint32_digits(y);
+    /* align the digits, the shortest string is first if it is a prefix */
+    x1 = x;
+    y1 = y;
+    if (dx < dy)
+        x1 *= pow10[dy - dx];
+    else
+        y1 *= pow10[dx - dy];
+    if (x1 != y1)
+        return x1 < y1 ? -1 : 1;
+    return dx < dy ? -1 : 1;
+}
+
+/* compare the precomputed string representations */
+static int js_array_cmp_string(const void *a, const void *b, void *opaque) {
+    struct array_sort_context *psc = opaque;
+    return js_string_compare(psc->ctx, ((const ValueSlot *)a)->str,
+                             ((const ValueSlot *)b)->str);
+}
+
 static JSValue js_array_sort(JSContext *ctx, JSValueConst this_val,
                              int argc, JSValueConst *argv)
 {
     struct array_sort_context asc = { ctx, 0, 0, argv[0] };
     JSValue obj = JS_UNDEFINED;
     ValueSlot *array = NULL;
-    size_t array_size = 0, pos = 0, n = 0;
+    size_t array_size = 0, pos = 0, n = 0, j;
     int64_t i, len, undefined_count = 0;
-    int present;
+    int present, all_int, all_prim;
+    int (*cmpfun)(const void *a, const void *b, void *opaque);
 
     if (!JS_IsUndefined(asc.method)) {
         if (check_function(ctx, asc.method))
@@ -42744,6 +48459,7 @@ static JSValue js_array_sort(JSContext *ctx, JSValueConst this_val,
     if (js_get_length64(ctx, &len, obj))
         goto exception;
 
+    all_int = all_prim = TRUE;
     /* XXX: should special case fast arrays */
     for (i = 0; i < len; i++) {
         if (pos >= array_size) {
@@ -42766,13 +48482,44 @@ static JSValue js_array_sort(JSContext *ctx, JSValueConst this_val,
             undefined_count++;
             continue;
         }
+        all_int &= JS_VALUE_GET_TAG(array[pos].val) == JS_TAG_INT;
+        all_prim &= JS_VALUE_GET_TAG(array[pos].val) != JS_TAG_OBJECT;
         array[pos].str = NULL;
         array[pos].pos = i;
         pos++;
     }
-    rqsort(array, pos, sizeof(*array), js_array_cmp_generic, &asc);
-    if (asc.exception)
-        goto exception;
+    if (pos > 1) {
+        /* the merge sort needs room for pos / 2 elements after the
+           sorted ones */
+        if (array_size < pos + pos / 2) {
+            ValueSlot *new_array;
+            new_array = js_realloc(ctx, array,
+                                   (pos + pos / 2) * sizeof(*array));
+            if (new_array == NULL)
+                goto exception;
+            array = new_array;
+            array_size = pos + pos / 2;
+        }
+        cmpfun = js_array_cmp_generic;
+        if (!asc.has_method) {
+            if (all_int) {
+                cmpfun = js_array_cmp_int32;
+            } else if (all_prim) {
+                /* ToString() has no side effect: convert all the
+                   values once */
+                for (j = 0; j < pos; j++) {
+                    JSValue str = JS_ToString(ctx, array[j].val);
+                    if (JS_IsException(str))
+                        goto exception;
+                    array[j].str = JS_VALUE_GET_STRING(str);
+                }
+                cmpfun = js_array_cmp_string;
+            }
+        }
+        rmergesort(array, pos, sizeof(*array), cmpfun, &asc, array + pos);
+        if (asc.exception)
+            goto exception;
+    }
 
     /* XXX: should special case fast arrays */
     while (n < pos) {
@@ -44852,29 +50599,22 @@ static JSValue js_string_concat(JSContext *ctx, JSValueConst this_val,
 
 static int string_cmp(JSString *p1, JSString *p2, int x1, int x2, int len)
 {
-    int i, c1, c2;
-    for (i = 0; i < len; i++) {
-        if ((c1 = string_get(p1, x1 + i)) != (c2 = string_get(p2, x2 + i)))
-            return c1 - c2;
-    }
-    return 0;
+    return js_string_memcmp(p1, x1, p2, x2, len);
 }
 
 static int string_indexof_char(JSString *p, int c, int from)
 {
     /* assuming 0 <= from <= p->len */
-    int i, len = p->len;
+    int len = p->len;
     if (p->is_wide_char) {
-        for (i = from; i < len; i++) {
-            if (p->u.str16[i] == c)
-                return i;
-        }
+        const uint16_t *q = memchr16(p->u.str16 + from, c, len - from);
+        if (q)
+            return q - p->u.str16;
     } else {
         if ((c & ~0xff) == 0) {
-            for (i = from; i < len; i++) {
-                if (p->u.str8[i] == (uint8_t)c)
-                    return i;
-            }
+            const uint8_t *q = memchr(p->u.str8 + from, c, len - from);
+            if (q)
+                return q - p->u.str8;
         }
     }
     return -1;
@@ -44886,6 +50626,21 @@ static int string_indexof(JSString *p1, JSString *p2, int from)
     int c, i, j, len1 = p1->len, len2 = p2->len;
     if (len2 == 0)
         return from;
+    if (!p2->is_wide_char) {
+        if (!p1->is_wide_char) {
+            const uint8_t *q = memmem8(p1->u.str8 + from, len1 - from,
+                                       p2->u.str8, len2);
+            return q ? q - p1->u.str8 : -1;
+        } else {
+            const uint16_t *q = memmem16_8(p1->u.str16 + from, len1 - from,
+                                           p2->u.str8, len2);
+            return q ? q - p1->u.str16 : -1;
+        }
+    } else if (p1->is_wide_char) {
+        const uint16_t *q = memmem16(p1->u.str16 + from, len1 - from,
+                                     p2->u.str16, len2);
+        return q ? q - p1->u.str16 : -1;
+    }
     for (i = from, c = string_get(p2, 0); i + len2 <= len1; i = j + 1) {
         j = string_indexof_char(p1, c, i);
         if (j < 0 || j + len2 > len1)
@@ -44896,6 +50651,20 @@ static int string_indexof(JSString *p1, JSString *p2, int from)
     return -1;
 }
 
+static int string_lastindexof(JSString *p1, JSString *p2, int from)
+{
+    /* assuming 0 <= from <= p1->len - p2->len */
+    int c, i, len2 = p2->len;
+    if (len2 == 0)
+        return from;
+    c = string_get(p2, 0);
+    for (i = from; i >= 0; i--) {
+        if (string_get(p1, i) == c && !string_cmp(p1, p2, i + 1, 1, len2 - 1))
+            return i;
+    }
+    return -1;
+}
+
 static int64_t string_advance_index(JSString *p, int64_t index, BOOL unicode)
 {
     if (!unicode || index >= p->len || !p->is_wide_char) {
@@ -44986,7 +50755,7 @@ static JSValue js_string_indexOf(JSContext *ctx, JSValueConst this_val,
                                  int argc, JSValueConst *argv, int lastIndexOf)
 {
     JSValue str, v;
-    int i, len, v_len, pos, start, stop, ret, inc;
+    int len, v_len, pos, start, stop, ret, inc;
     JSString *p;
     JSString *p1;
 
@@ -45028,14 +50797,10 @@ static JSValue js_string_indexOf(JSContext *ctx, JSValueConst this_val,
     }
     ret = -1;
     if (len >= v_len && inc * (stop - start) >= 0) {
-        for (i = start;; i += inc) {
-            if (!string_cmp(p, p1, i, 0, v_len)) {
-                ret = i;
-                break;
-            }
-            if (i == stop)
-                break;
-        }
+        if (inc > 0)
+            ret = string_indexof(p, p1, start);
+        else
+            ret = string_lastindexof(p, p1, start);
     }
     JS_FreeValue(ctx, str);
     JS_FreeValue(ctx, v);
@@ -45054,7 +50819,7 @@ static JSValue js_string_includes(JSContext *ctx, JSValueConst this_val,
                                   int argc, JSValueConst *argv, int magic)
 {
     JSValue str, v = JS_UNDEFINED;
-    int i, len, v_len, pos, start, stop, ret;
+    int len, v_len, pos, start, stop, ret;
     JSString *p;
     JSString *p1;
 
@@ -45094,13 +50859,10 @@ static JSValue js_string_includes(JSContext *ctx, JSValueConst this_val,
         start = stop = pos;
     }
     if (start >= 0 && start <= stop) {
-        for (i = start;; i++) {
-            if (!string_cmp(p, p1, i, 0, v_len)) {
-                ret = 1;
-                break;
-            }
-            if (i == stop)
-                break;
+        if (start < stop) {
+            ret = string_indexof(p, p1, start) >= 0;
+        } else {
+            ret = !string_cmp(p, p1, start, 0, v_len);
         }
     }
  done:
@@ -48794,6 +54556,24 @@ JSValue JS_ParseJSON(JSContext *ctx, const char *buf, size_t buf_len,
     return JS_ParseJSON2(ctx, buf, buf_len, filename, 0);
 }
 
+/* same as JS_ParseJSON2() for a UTF-8 buffer which is not necessarily
+   zero terminated */
+JSValue JS_ParseJSONBuffer(JSContext *ctx, const uint8_t *buf, size_t buf_len,
+                           const char *filename, int flags)
+{
+    char *buf1;
+    JSValue val;
+
+    buf1 = js_malloc(ctx, buf_len + 1);
+    if (!buf1)
+        return JS_EXCEPTION;
+    memcpy(buf1, buf, buf_len);
+    buf1[buf_len] = '\0';
+    val = JS_ParseJSON2(ctx, buf1, buf_len, filename, flags);
+    js_free(ctx, buf1);
+    return val;
+}
+
 static JSValue internalize_json_property(JSContext *ctx, JSValueConst holder,
                                          JSAtom name, JSValueConst reviver)
 {
@@ -50698,7 +56478,7 @@ static void js_weakref_free(JSRuntime *rt, JSValue val)
            free_zero_refcount() */
         if (p->weakref_count == 0 && p->header.ref_count == 0 &&
             p->header.mark == 0) {
-            js_free_rt(rt, p);
+            js_slab_free_rt(rt, p, sizeof(JSObject));
         }
     } else if (JS_VALUE_GET_TAG(val) == JS_TAG_SYMBOL) {
         JSString *p = JS_VALUE_GET_STRING(val);
@@ -50706,7 +56486,7 @@ static void js_weakref_free(JSRuntime *rt, JSValue val)
         p->hash--;
         if (p->hash == 0 && p->header.ref_count == 0) {
             /* can remove the dummy structure */
-            js_free_rt(rt, p);
+            js_free_string_struct(rt, p);
         }
     }
 }
@@ -50997,7 +56777,7 @@ static JSMapRecord *map_add_record(JSContext *ctx, JSMapState *s,
     uint32_t h;
     JSMapRecord *mr;
 
-    mr = js_malloc(ctx, sizeof(*mr));
+    mr = js_slab_alloc(ctx, sizeof(*mr));
     if (!mr)
         return NULL;
     mr->ref_count = 1;
@@ -51043,7 +56823,7 @@ static void map_delete_record_internal(JSRuntime *rt, JSMapState *s, JSMapRecord
     JS_FreeValueRT(rt, mr->value);
     if (--mr->ref_count == 0) {
         list_del(&mr->link);
-        js_free_rt(rt, mr);
+        js_slab_free_rt(rt, mr, sizeof(*mr));
     } else {
         /* keep a zombie record for iterators */
         mr->empty = TRUE;
@@ -51059,7 +56839,7 @@ static void map_decref_record(JSRuntime *rt, JSMapRecord *mr)
         /* the record can be safely removed */
         assert(mr->empty);
         list_del(&mr->link);
-        js_free_rt(rt, mr);
+        js_slab_free_rt(rt, mr, sizeof(*mr));
     }
 }
 
@@ -51444,7 +57224,7 @@ static void js_map_finalizer(JSRuntime *rt, JSValue val)
                     JS_FreeValueRT(rt, mr->key);
                 JS_FreeValueRT(rt, mr->value);
             }
-            js_free_rt(rt, mr);
+            js_slab_free_rt(rt, mr, sizeof(*mr));
         }
         js_free_rt(rt, s->hash_table);
         if (s->is_weak) {
@@ -55375,6 +61155,9 @@ static int JS_AddIntrinsicBasicObjects(JSContext *ctx)
         obj = JS_NewObjectProtoClassAlloc(ctx, JS_NULL, JS_CLASS_OBJECT, 4);
         p = JS_VALUE_GET_OBJ(ctx->global_obj);
         p->u.global_object.uninitialized_vars = obj;
+        /* the modifications of the global object invalidate the
+           JSGlobalVarCache entries */
+        p->is_prototype = TRUE;
     }
     ctx->global_var_obj = JS_NewObjectProtoClassAlloc(ctx, JS_NULL,
                                                       JS_CLASS_OBJECT, 16);
@@ -56028,6 +61811,31 @@ static void js_array_buffer_update_typed_arrays(JSArrayBuffer *abuf)
     
 }
 
+/* detach 'abuf' and return its data in a block allocated with
+   malloc(). Return NULL if memory error. */
+static uint8_t *js_array_buffer_release(JSContext *ctx, JSArrayBuffer *abuf)
+{
+    uint8_t *data;
+
+    if (abuf->free_func == js_array_buffer_free) {
+        data = js_release_to_malloc(ctx->rt, abuf->data, abuf->byte_length);
+        if (!data)
+            return NULL;
+    } else {
+        data = js_shared_malloc(abuf->byte_length);
+        if (!data)
+            return NULL;
+        memcpy(data, abuf->data, abuf->byte_length);
+        if (abuf->free_func)
+            abuf->free_func(ctx->rt, abuf->opaque, abuf->data);
+    }
+    abuf->data = NULL;
+    abuf->byte_length = 0;
+    abuf->detached = TRUE;
+    js_array_buffer_update_typed_arrays(abuf);
+    return data;
+}
+
 void JS_DetachArrayBuffer(JSContext *ctx, JSValueConst obj)
 {
     JSArrayBuffer *abuf = JS_GetOpaque(obj, JS_CLASS_ARRAY_BUFFER);
@@ -56447,6 +62255,21 @@ JSValue JS_NewTypedArray(JSContext *ctx, int argc, JSValueConst *argv,
                                       JS_CLASS_UINT8C_ARRAY + type);
 }
 
+/* Return the JSTypedArrayEnum type of the typed array or -1 if 'obj'
+   is not a typed array */
+int JS_GetTypedArrayType(JSValueConst obj)
+{
+    JSObject *p;
+    if (JS_VALUE_GET_TAG(obj) != JS_TAG_OBJECT)
+        return -1;
+    p = JS_VALUE_GET_OBJ(obj);
+    if (p->class_id >= JS_CLASS_UINT8C_ARRAY &&
+        p->class_id <= JS_CLASS_FLOAT64_ARRAY)
+        return p->class_id - JS_CLASS_UINT8C_ARRAY;
+    else
+        return -1;
+}
+
 /* Return the buffer associated to the typed array or an exception if
    it is not a typed array or if the buffer is detached. pbyte_offset,
    pbyte_length or pbytes_per_element can be NULL. */
@@ -57745,10 +63568,6 @@ static int js_TA_cmp_generic(const void *a, const void *b, void *opaque) {
                 cmp = (val > 0) - (val < 0);
             }
         }
-        if (cmp == 0) {
-            /* make sort stable: compare array offsets */
-            cmp = (a_idx > b_idx) - (a_idx < b_idx);
-        }
     done:
         JS_FreeValue(ctx, (JSValue)argv[0]);
         JS_FreeValue(ctx, (JSValue)argv[1]);
@@ -57756,6 +63575,171 @@ static int js_TA_cmp_generic(const void *a, const void *b, void *opaque) {
     return cmp;
 }
 
+/* below this length, the comparison sort is faster */
+#define TA_RADIX_SORT_MIN_LEN 64
+
+/* Convert the elements to unsigned integers with the same order as
+   the default sort order. NaNs are mapped to the largest value. The
+   conversion is reversed if 'inverse' is TRUE and NaNs become the
+   canonical NaN. */
+static void js_TA_radix_key(void *ptr, size_t len, int class_id,
+                            BOOL inverse)
+{
+    size_t i;
+
+    switch(class_id) {
+    case JS_CLASS_INT8_ARRAY:
+        for(i = 0; i < len; i++)
+            ((uint8_t *)ptr)[i] ^= 0x80;
+        break;
+    case JS_CLASS_INT16_ARRAY:
+        for(i = 0; i < len; i++)
+            ((uint16_t *)ptr)[i] ^= 0x8000;
+        break;
+    case JS_CLASS_INT32_ARRAY:
+        for(i = 0; i < len; i++)
+            ((uint32_t *)ptr)[i] ^= 0x80000000;
+        break;
+    case JS_CLASS_BIG_INT64_ARRAY:
+        for(i = 0; i < len; i++)
+            ((uint64_t *)ptr)[i] ^= (uint64_t)1 << 63;
+        break;
+    case JS_CLASS_FLOAT16_ARRAY:
+        {
+            uint16_t *tab = ptr, v;
+            for(i = 0; i < len; i++) {
+                v = tab[i];
+                if (inverse) {
+                    if (v == 0xffff)
+                        v = 0x7e00;
+                    else
+                        v = (v & 0x8000) ? v ^ 0x8000 : ~v;
+                } else {
+                    if ((v & 0x7fff) > 0x7c00)
+                        v = 0xffff;
+                    else
+                        v = (v & 0x8000) ? ~v : v ^ 0x8000;
+                }
+                tab[i] = v;
+            }
+        }
+        break;
+    case JS_CLASS_FLOAT32_ARRAY:
+        {
+            uint32_t *tab = ptr, v;
+            for(i = 0; i < len; i++) {
+                v = tab[i];
+                if (inverse) {
+                    if (v == 0xffffffff)
+                        v = 0x7fc00000;
+                    else
+                        v = (v & 0x80000000) ? v ^ 0x80000000 : ~v;
+                } else {
+                    if ((v & 0x7fffffff) > 0x7f800000)
+                        v = 0xffffffff;
+                    else
+                        v = (v & 0x80000000) ? ~v : v ^ 0x80000000;
+                }
+                tab[i] = v;
+            }
+        }
+        break;
+    case JS_CLASS_FLOAT64_ARRAY:
+        {
+            uint64_t *tab = ptr, v, sgn = (uint64_t)1 << 63;
+            for(i = 0; i < len; i++) {
+                v = tab[i];
+                if (inverse) {
+                    if (v == UINT64_MAX)
+                        v = 0x7ff8000000000000;
+                    else
+                        v = (v & sgn) ? v ^ sgn : ~v;
+                } else {
+                    if ((v & ~sgn) > 0x7ff0000000000000)
+                        v = UINT64_MAX;
+                    else
+                        v = (v & sgn) ? ~v : v ^ sgn;
+                }
+                tab[i] = v;
+            }
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+/* LSD radix sort of the typed array elements with the default sort
+   order. Return -1 if memory allocation failed. */
+static int js_TA_radix_sort(JSContext *ctx, void *ptr, size_t len,
+                            int class_id)
+{
+    int size_log2 = typed_array_size_log2(class_id);
+    int elt_size = 1 << size_log2;
+    uint32_t count[8][256], pos[256], c;
+    uint8_t *src, *dst, *tmp;
+    size_t i, j, k;
+    int d, b;
+
+    tmp = js_malloc(ctx, len << size_log2);
+    if (!tmp)
+        return -1;
+    js_TA_radix_key(ptr, len, class_id, FALSE);
+    /* count the digits of all the passes at once */
+    memset(count, 0, sizeof(count[0]) * elt_size);
+    src = ptr;
+    for(i = 0; i < len; i++) {
+        for(d = 0; d < elt_size; d++)
+            count[d][src[(i << size_log2) + d]]++;
+    }
+    dst = tmp;
+    for(d = 0; d < elt_size; d++) {
+        /* byte 'd' of the key in memory order */
+        b = is_be() ? elt_size - 1 - d : d;
+        /* skip the passes where all the elements have the same digit */
+        if (count[b][src[b]] == len)
+            continue;
+        c = 0;
+        for(j = 0; j < 256; j++) {
+            pos[j] = c;
+            c += count[b][j];
+        }
+        switch(size_log2) {
+        case 0:
+            for(i = 0; i < len; i++)
+                dst[pos[src[i]]++] = src[i];
+            break;
+        case 1:
+            for(i = 0; i < len; i++) {
+                k = pos[src[(i << 1) + b]]++;
+                ((uint16_t *)dst)[k] = ((uint16_t *)src)[i];
+            }
+            break;
+        case 2:
+            for(i = 0; i < len; i++) {
+                k = pos[src[(i << 2) + b]]++;
+                ((uint32_t *)dst)[k] = ((uint32_t *)src)[i];
+            }
+            break;
+        case 3:
+            for(i = 0; i < len; i++) {
+                k = pos[src[(i << 3) + b]]++;
+                ((uint64_t *)dst)[k] = ((uint64_t *)src)[i];
+            }
+            break;
+        default:
+            abort();
+        }
+        dst = src;
+        src = (src == tmp) ? ptr : tmp;
+    }
+    if (src != ptr)
+        memcpy(ptr, src, len << size_log2);
+    js_TA_radix_key(ptr, len, class_id, TRUE);
+    js_free(ctx, tmp);
+    return 0;
+}
+
 static JSValue js_typed_array_sort(JSContext *ctx, JSValueConst this_val,
                                    int argc, JSValueConst *argv)
 {
@@ -57833,15 +63817,15 @@ static JSValue js_typed_array_sort(JSContext *ctx, JSValueConst this_val,
             void *array_tmp;
             size_t i, j;
 
-            /* XXX: a stable sort would use less memory */
-            array_idx = js_malloc(ctx, len * sizeof(array_idx[0]));
+            /* the merge sort uses the len / 2 last entries */
+            array_idx = js_malloc(ctx, (len + len / 2) * sizeof(array_idx[0]));
             if (!array_idx)
                 return JS_EXCEPTION;
             for(i = 0; i < len; i++)
                 array_idx[i] = i;
             tsc.elt_size = elt_size;
-            rqsort(array_idx, len, sizeof(array_idx[0]),
-                   js_TA_cmp_generic, &tsc);
+            rmergesort(array_idx, len, sizeof(array_idx[0]),
+                       js_TA_cmp_generic, &tsc, array_idx + len);
             if (tsc.exception) {
                 if (tsc.exception == 1)
                     goto fail;
@@ -57889,6 +63873,9 @@ static JSValue js_typed_array_sort(JSContext *ctx, JSValueConst this_val,
                 }
             }
             js_free(ctx, array_idx);
+        } else if (len >= TA_RADIX_SORT_MIN_LEN) {
+            if (js_TA_radix_sort(ctx, p->u.array.u.ptr, len, p->class_id))
+                return JS_EXCEPTION;
         } else {
             rqsort(p->u.array.u.ptr, len, elt_size, cmpfun, &tsc);
             if (tsc.exception)
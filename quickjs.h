@@ -368,18 +368,30 @@ JSRuntime *JS_NewRuntime(void);
 void JS_SetRuntimeInfo(JSRuntime *rt, const char *info);
 void JS_SetMemoryLimit(JSRuntime *rt, size_t limit);
 void JS_SetGCThreshold(JSRuntime *rt, size_t gc_threshold);
+/* enable the generational GC: the automatic collections of the new
+   objects try to last at most 'budget_us' microseconds. Use 0 to
+   disable it (default). */
+void JS_SetGCPauseBudget(JSRuntime *rt, int budget_us);
 /* use 0 to disable maximum stack size check */
 void JS_SetMaxStackSize(JSRuntime *rt, size_t stack_size);
 /* should be called when changing thread to update the stack top value
    used to check stack overflow. */
 void JS_UpdateStackTop(JSRuntime *rt);
 JSRuntime *JS_NewRuntime2(const JSMallocFunctions *mf, void *opaque);
+/* The memory of an arena runtime comes from a region which is released
+   at once by JS_FreeRuntime(): the objects are not freed one by one
+   and only the finalizers of the host classes and of the array
+   buffers with external data are called. JS_FreeContext() does
+   nothing on such a runtime. The values needed after JS_FreeRuntime()
+   must be copied before (see JS_CopyValue()). */
+JSRuntime *JS_NewArenaRuntime(void);
 void JS_FreeRuntime(JSRuntime *rt);
 void *JS_GetRuntimeOpaque(JSRuntime *rt);
 void JS_SetRuntimeOpaque(JSRuntime *rt, void *opaque);
 typedef void JS_MarkFunc(JSRuntime *rt, JSGCObjectHeader *gp);
 void JS_MarkValue(JSRuntime *rt, JSValueConst val, JS_MarkFunc *mark_func);
 void JS_RunGC(JSRuntime *rt);
+void JS_RunMinorGC(JSRuntime *rt);
 JS_BOOL JS_IsLiveObject(JSRuntime *rt, JSValueConst obj);
 
 JSContext *JS_NewContext(JSRuntime *rt);
@@ -425,6 +437,8 @@ void *js_mallocz(JSContext *ctx, size_t size);
 char *js_strdup(JSContext *ctx, const char *str);
 char *js_strndup(JSContext *ctx, const char *s, size_t n);
 
+#define JS_SLAB_CLASS_COUNT 16
+
 typedef struct JSMemoryUsage {
     int64_t malloc_size, malloc_limit, memory_used_size;
     int64_t malloc_count;
@@ -439,11 +453,27 @@ typedef struct JSMemoryUsage {
     int64_t c_func_count, array_count;
     int64_t fast_array_count, fast_array_elements;
     int64_t binary_object_count, binary_object_size;
+    /* slab allocator: number and size of the chunks, then for each
+       size class the block size and the number of used and free
+       blocks */
+    int64_t slab_chunk_count, slab_chunk_size;
+    int64_t slab_block_size[JS_SLAB_CLASS_COUNT];
+    int64_t slab_used_count[JS_SLAB_CLASS_COUNT];
+    int64_t slab_free_count[JS_SLAB_CLASS_COUNT];
 } JSMemoryUsage;
 
 void JS_ComputeMemoryUsage(JSRuntime *rt, JSMemoryUsage *s);
 void JS_DumpMemoryUsage(FILE *fp, const JSMemoryUsage *s, JSRuntime *rt);
 
+/* Type feedback (profiling): when enabled, the interpreter records the
+   operand types seen by the arithmetic, comparison and property access
+   opcodes of the functions called afterwards. It is disabled by
+   default and the recording functions are not JIT compiled. */
+void JS_EnableTypeFeedback(JSRuntime *rt, JS_BOOL enable);
+/* dump the feedback of the live functions, most called first. The
+   sites seeing several types or shapes are marked POLYMORPHIC. */
+void JS_DumpTypeFeedback(FILE *fp, JSRuntime *rt);
+
 /* atom support */
 #define JS_ATOM_NULL 0
 
@@ -667,6 +697,8 @@ JSValue JS_GetException(JSContext *ctx);
 JS_BOOL JS_HasException(JSContext *ctx);
 JS_BOOL JS_IsError(JSContext *ctx, JSValueConst val);
 JSValue JS_NewError(JSContext *ctx);
+/* return JS_UNDEFINED if 'name' is not a native error name */
+JSValue JS_NewNativeError(JSContext *ctx, const char *name);
 JSValue __js_printf_like(2, 3) JS_ThrowSyntaxError(JSContext *ctx, const char *fmt, ...);
 JSValue __js_printf_like(2, 3) JS_ThrowTypeError(JSContext *ctx, const char *fmt, ...);
 JSValue __js_printf_like(2, 3) JS_ThrowReferenceError(JSContext *ctx, const char *fmt, ...);
@@ -855,6 +887,9 @@ JSValue JS_ParseJSON(JSContext *ctx, const char *buf, size_t buf_len,
 #define JS_PARSE_JSON_EXT (1 << 0) /* allow extended JSON */
 JSValue JS_ParseJSON2(JSContext *ctx, const char *buf, size_t buf_len,
                       const char *filename, int flags);
+/* 'buf' is UTF-8 encoded and does not need to be zero terminated */
+JSValue JS_ParseJSONBuffer(JSContext *ctx, const uint8_t *buf, size_t buf_len,
+                           const char *filename, int flags);
 JSValue JS_JSONStringify(JSContext *ctx, JSValueConst obj,
                          JSValueConst replacer, JSValueConst space0);
 
@@ -883,6 +918,8 @@ typedef enum JSTypedArrayEnum {
 
 JSValue JS_NewTypedArray(JSContext *ctx, int argc, JSValueConst *argv,
                          JSTypedArrayEnum array_type);
+/* return -1 if 'obj' is not a typed array */
+int JS_GetTypedArrayType(JSValueConst obj);
 JSValue JS_GetTypedArrayBuffer(JSContext *ctx, JSValueConst obj,
                                size_t *pbyte_offset,
                                size_t *pbyte_length,
@@ -978,13 +1015,48 @@ uint8_t *JS_WriteObject(JSContext *ctx, size_t *psize, JSValueConst obj,
                         int flags);
 uint8_t *JS_WriteObject2(JSContext *ctx, size_t *psize, JSValueConst obj,
                          int flags, uint8_t ***psab_tab, size_t *psab_tab_len);
+/* same as JS_WriteObject2() but the data of the ArrayBuffers of
+   'transfer_tab' is moved to 'transfer_data' instead of being copied
+   and they are detached. The returned buffer and the 'transfer_data'
+   entries are allocated with malloc(). The 'transfer_data' entries
+   must be given to JS_ReadObject2() which takes the ones it uses. */
+uint8_t *JS_WriteObject3(JSContext *ctx, size_t *psize, JSValueConst obj,
+                         int flags, uint8_t ***psab_tab, size_t *psab_tab_len,
+                         JSValueConst *transfer_tab, int transfer_len,
+                         uint8_t **transfer_data);
 
 #define JS_READ_OBJ_BYTECODE  (1 << 0) /* allow function/module */
 #define JS_READ_OBJ_ROM_DATA  (1 << 1) /* avoid duplicating 'buf' data */
 #define JS_READ_OBJ_SAB       (1 << 2) /* allow SharedArrayBuffer */
 #define JS_READ_OBJ_REFERENCE (1 << 3) /* allow object references */
+/* share the bytecode buffers with the other runtimes reading the same
+   data (see JS_ReadObject()). The shared bytecode is read-only, so it
+   is not quickened. */
+#define JS_READ_OBJ_SHARED    (1 << 4)
 JSValue JS_ReadObject(JSContext *ctx, const uint8_t *buf, size_t buf_len,
                       int flags);
+/* the used 'transfer_data' entries are set to NULL. The remaining ones
+   must be freed with free(). */
+JSValue JS_ReadObject2(JSContext *ctx, const uint8_t *buf, size_t buf_len,
+                       int flags, uint8_t **transfer_data, int transfer_len);
+/* number of bytecode buffers currently cached for JS_READ_OBJ_SHARED
+   in the process */
+int JS_GetSharedBytecodeCount(void);
+/* copy 'val' from 'src_ctx' to 'dst_ctx' which may belong to another
+   runtime. Only the values supported by JS_WriteObject() are
+   accepted. */
+JSValue JS_CopyValue(JSContext *dst_ctx, JSContext *src_ctx, JSValueConst val);
+/* record the current state of the context as the base of the
+   snapshots. Must be called after the context and its host objects
+   are initialized and before any script is evaluated. */
+int JS_EnableSnapshot(JSContext *ctx);
+/* save the modifications of the context since JS_EnableSnapshot() */
+uint8_t *JS_WriteSnapshot(JSContext *ctx, size_t *psize);
+/* restore a snapshot in a context initialized exactly as the one
+   where it was written. 'flags' can be JS_READ_OBJ_ROM_DATA. A
+   truncated or corrupted image raises a SyntaxError. */
+int JS_ReadSnapshot(JSContext *ctx, const uint8_t *buf, size_t buf_len,
+                    int flags);
 /* instantiate and evaluate a bytecode function. Only used when
    reading a script or module with JS_ReadObject() */
 JSValue JS_EvalFunction(JSContext *ctx, JSValue fun_obj);
@@ -0,0 +1,1833 @@
+/* File generated automatically by the QuickJS compiler. */
+
+#include <inttypes.h>
+
+const uint32_t qjsc_repl_size = 14586;
+
+const uint8_t qjsc_repl[14586] = {
+ 0x08, 0xca, 0x02, 0x0e, 0x72, 0x65, 0x70, 0x6c,
+ 0x2e, 0x6a, 0x73, 0x06, 0x73, 0x74, 0x64, 0x04,
+ 0x6f, 0x73, 0x0a, 0x69, 0x73, 0x4e, 0x61, 0x4e,
+ 0x10, 0x69, 0x73, 0x46, 0x69, 0x6e, 0x69, 0x74,
+ 0x65, 0x14, 0x70, 0x61, 0x72, 0x73, 0x65, 0x46,
+ 0x6c, 0x6f, 0x61, 0x74, 0x08, 0x1b, 0x5b, 0x30,
+ 0x6d, 0x08, 0x6e, 0x6f, 0x6e, 0x65, 0x0a, 0x1b,
+ 0x5b, 0x33, 0x30, 0x6d, 0x0a, 0x62, 0x6c, 0x61,
+ 0x63, 0x6b, 0x0a, 0x1b, 0x5b, 0x33, 0x31, 0x6d,
+ 0x06, 0x72, 0x65, 0x64, 0x0a, 0x1b, 0x5b, 0x33,
+ 0x32, 0x6d, 0x0a, 0x67, 0x72, 0x65, 0x65, 0x6e,
+ 0x0a, 0x1b, 0x5b, 0x33, 0x33, 0x6d, 0x0c, 0x79,
+ 0x65, 0x6c, 0x6c, 0x6f, 0x77, 0x0a, 0x1b, 0x5b,
+ 0x33, 0x34, 0x6d, 0x08, 0x62, 0x6c, 0x75, 0x65,
+ 0x0a, 0x1b, 0x5b, 0x33, 0x35, 0x6d, 0x0e, 0x6d,
+ 0x61, 0x67, 0x65, 0x6e, 0x74, 0x61, 0x0a, 0x1b,
+ 0x5b, 0x33, 0x36, 0x6d, 0x08, 0x63, 0x79, 0x61,
+ 0x6e, 0x0a, 0x1b, 0x5b, 0x33, 0x37, 0x6d, 0x0a,
+ 0x77, 0x68, 0x69, 0x74, 0x65, 0x0e, 0x1b, 0x5b,
+ 0x33, 0x30, 0x3b, 0x31, 0x6d, 0x08, 0x67, 0x72,
+ 0x61, 0x79, 0x08, 0x67, 0x72, 0x65, 0x79, 0x0e,
+ 0x1b, 0x5b, 0x33, 0x31, 0x3b, 0x31, 0x6d, 0x14,
+ 0x62, 0x72, 0x69, 0x67, 0x68, 0x74, 0x5f, 0x72,
+ 0x65, 0x64, 0x0e, 0x1b, 0x5b, 0x33, 0x32, 0x3b,
+ 0x31, 0x6d, 0x18, 0x62, 0x72, 0x69, 0x67, 0x68,
+ 0x74, 0x5f, 0x67, 0x72, 0x65, 0x65, 0x6e, 0x0e,
+ 0x1b, 0x5b, 0x33, 0x33, 0x3b, 0x31, 0x6d, 0x1a,
+ 0x62, 0x72, 0x69, 0x67, 0x68, 0x74, 0x5f, 0x79,
+ 0x65, 0x6c, 0x6c, 0x6f, 0x77, 0x0e, 0x1b, 0x5b,
+ 0x33, 0x34, 0x3b, 0x31, 0x6d, 0x16, 0x62, 0x72,
+ 0x69, 0x67, 0x68, 0x74, 0x5f, 0x62, 0x6c, 0x75,
+ 0x65, 0x0e, 0x1b, 0x5b, 0x33, 0x35, 0x3b, 0x31,
+ 0x6d, 0x1c, 0x62, 0x72, 0x69, 0x67, 0x68, 0x74,
+ 0x5f, 0x6d, 0x61, 0x67, 0x65, 0x6e, 0x74, 0x61,
+ 0x0e, 0x1b, 0x5b, 0x33, 0x36, 0x3b, 0x31, 0x6d,
+ 0x16, 0x62, 0x72, 0x69, 0x67, 0x68, 0x74, 0x5f,
+ 0x63, 0x79, 0x61, 0x6e, 0x0e, 0x1b, 0x5b, 0x33,
+ 0x37, 0x3b, 0x31, 0x6d, 0x18, 0x62, 0x72, 0x69,
+ 0x67, 0x68, 0x74, 0x5f, 0x77, 0x68, 0x69, 0x74,
+ 0x65, 0x0e, 0x63, 0x6f, 0x6d, 0x6d, 0x65, 0x6e,
+ 0x74, 0x0a, 0x72, 0x65, 0x67, 0x65, 0x78, 0x0e,
+ 0x6b, 0x65, 0x79, 0x77, 0x6f, 0x72, 0x64, 0x08,
+ 0x74, 0x79, 0x70, 0x65, 0x14, 0x69, 0x64, 0x65,
+ 0x6e, 0x74, 0x69, 0x66, 0x69, 0x65, 0x72, 0x0a,
+ 0x65, 0x72, 0x72, 0x6f, 0x72, 0x0c, 0x72, 0x65,
+ 0x73, 0x75, 0x6c, 0x74, 0x12, 0x65, 0x72, 0x72,
+ 0x6f, 0x72, 0x5f, 0x6d, 0x73, 0x67, 0x0c, 0x71,
+ 0x6a, 0x73, 0x20, 0x3e, 0x20, 0x0c, 0x20, 0x20,
+ 0x2e, 0x2e, 0x2e, 0x20, 0x02, 0x01, 0x02, 0x02,
+ 0x02, 0x03, 0x02, 0x04, 0x02, 0x05, 0x02, 0x06,
+ 0x02, 0x07, 0x02, 0x08, 0x02, 0x09, 0x02, 0x0a,
+ 0x02, 0x0b, 0x02, 0x0d, 0x02, 0x0e, 0x02, 0x10,
+ 0x02, 0x11, 0x02, 0x12, 0x02, 0x13, 0x02, 0x14,
+ 0x02, 0x18, 0x02, 0x19, 0x06, 0x1b, 0x4f, 0x41,
+ 0x06, 0x1b, 0x4f, 0x42, 0x06, 0x1b, 0x4f, 0x43,
+ 0x06, 0x1b, 0x4f, 0x44, 0x06, 0x1b, 0x4f, 0x46,
+ 0x06, 0x1b, 0x4f, 0x48, 0x0c, 0x1b, 0x5b, 0x31,
+ 0x3b, 0x35, 0x43, 0x0c, 0x1b, 0x5b, 0x31, 0x3b,
+ 0x35, 0x44, 0x08, 0x1b, 0x5b, 0x31, 0x7e, 0x08,
+ 0x1b, 0x5b, 0x33, 0x7e, 0x08, 0x1b, 0x5b, 0x34,
+ 0x7e, 0x08, 0x1b, 0x5b, 0x35, 0x7e, 0x08, 0x1b,
+ 0x5b, 0x36, 0x7e, 0x06, 0x1b, 0x5b, 0x41, 0x06,
+ 0x1b, 0x5b, 0x42, 0x06, 0x1b, 0x5b, 0x43, 0x06,
+ 0x1b, 0x5b, 0x44, 0x06, 0x1b, 0x5b, 0x46, 0x06,
+ 0x1b, 0x5b, 0x48, 0x04, 0x1b, 0x7f, 0x04, 0x1b,
+ 0x62, 0x04, 0x1b, 0x64, 0x04, 0x1b, 0x66, 0x04,
+ 0x1b, 0x6b, 0x04, 0x1b, 0x6c, 0x04, 0x1b, 0x74,
+ 0x04, 0x1b, 0x75, 0x02, 0x7f, 0x10, 0x74, 0x65,
+ 0x72, 0x6d, 0x49, 0x6e, 0x69, 0x74, 0x0c, 0x66,
+ 0x69, 0x6c, 0x65, 0x6e, 0x6f, 0x0c, 0x69, 0x73,
+ 0x61, 0x74, 0x74, 0x79, 0x1a, 0x74, 0x74, 0x79,
+ 0x47, 0x65, 0x74, 0x57, 0x69, 0x6e, 0x53, 0x69,
+ 0x7a, 0x65, 0x12, 0x74, 0x74, 0x79, 0x53, 0x65,
+ 0x74, 0x52, 0x61, 0x77, 0x0c, 0x73, 0x69, 0x67,
+ 0x6e, 0x61, 0x6c, 0x0c, 0x53, 0x49, 0x47, 0x49,
+ 0x4e, 0x54, 0x1c, 0x73, 0x65, 0x74, 0x52, 0x65,
+ 0x61, 0x64, 0x48, 0x61, 0x6e, 0x64, 0x6c, 0x65,
+ 0x72, 0x1c, 0x73, 0x69, 0x67, 0x69, 0x6e, 0x74,
+ 0x5f, 0x68, 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x72,
+ 0x22, 0x74, 0x65, 0x72, 0x6d, 0x5f, 0x72, 0x65,
+ 0x61, 0x64, 0x5f, 0x68, 0x61, 0x6e, 0x64, 0x6c,
+ 0x65, 0x72, 0x08, 0x72, 0x65, 0x61, 0x64, 0x0c,
+ 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x16, 0x68,
+ 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x5f, 0x62, 0x79,
+ 0x74, 0x65, 0x10, 0x69, 0x73, 0x5f, 0x61, 0x6c,
+ 0x70, 0x68, 0x61, 0x02, 0x41, 0x02, 0x5a, 0x02,
+ 0x61, 0x02, 0x7a, 0x10, 0x69, 0x73, 0x5f, 0x64,
+ 0x69, 0x67, 0x69, 0x74, 0x0e, 0x69, 0x73, 0x5f,
+ 0x77, 0x6f, 0x72, 0x64, 0x02, 0x5f, 0x02, 0x24,
+ 0x14, 0x75, 0x63, 0x73, 0x5f, 0x6c, 0x65, 0x6e,
+ 0x67, 0x74, 0x68, 0x14, 0x63, 0x68, 0x61, 0x72,
+ 0x43, 0x6f, 0x64, 0x65, 0x41, 0x74, 0x2a, 0x69,
+ 0x73, 0x5f, 0x74, 0x72, 0x61, 0x69, 0x6c, 0x69,
+ 0x6e, 0x67, 0x5f, 0x73, 0x75, 0x72, 0x72, 0x6f,
+ 0x67, 0x61, 0x74, 0x65, 0x16, 0x63, 0x6f, 0x64,
+ 0x65, 0x50, 0x6f, 0x69, 0x6e, 0x74, 0x41, 0x74,
+ 0x16, 0x69, 0x73, 0x5f, 0x62, 0x61, 0x6c, 0x61,
+ 0x6e, 0x63, 0x65, 0x64, 0x04, 0x28, 0x29, 0x04,
+ 0x5b, 0x5d, 0x04, 0x7b, 0x7d, 0x20, 0x70, 0x72,
+ 0x69, 0x6e, 0x74, 0x5f, 0x63, 0x6f, 0x6c, 0x6f,
+ 0x72, 0x5f, 0x74, 0x65, 0x78, 0x74, 0x08, 0x70,
+ 0x75, 0x74, 0x73, 0x12, 0x73, 0x75, 0x62, 0x73,
+ 0x74, 0x72, 0x69, 0x6e, 0x67, 0x12, 0x70, 0x72,
+ 0x69, 0x6e, 0x74, 0x5f, 0x63, 0x73, 0x69, 0x04,
+ 0x1b, 0x5b, 0x16, 0x6d, 0x6f, 0x76, 0x65, 0x5f,
+ 0x63, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x06, 0x6d,
+ 0x69, 0x6e, 0x02, 0x43, 0x02, 0x44, 0x0c, 0x75,
+ 0x70, 0x64, 0x61, 0x74, 0x65, 0x04, 0x20, 0x08,
+ 0x06, 0x1b, 0x5b, 0x4a, 0x06, 0x6f, 0x75, 0x74,
+ 0x0a, 0x66, 0x6c, 0x75, 0x73, 0x68, 0x0c, 0x69,
+ 0x6e, 0x73, 0x65, 0x72, 0x74, 0x1a, 0x71, 0x75,
+ 0x6f, 0x74, 0x65, 0x64, 0x5f, 0x69, 0x6e, 0x73,
+ 0x65, 0x72, 0x74, 0x0a, 0x61, 0x62, 0x6f, 0x72,
+ 0x74, 0x0a, 0x61, 0x6c, 0x65, 0x72, 0x74, 0x22,
+ 0x62, 0x65, 0x67, 0x69, 0x6e, 0x6e, 0x69, 0x6e,
+ 0x67, 0x5f, 0x6f, 0x66, 0x5f, 0x6c, 0x69, 0x6e,
+ 0x65, 0x16, 0x65, 0x6e, 0x64, 0x5f, 0x6f, 0x66,
+ 0x5f, 0x6c, 0x69, 0x6e, 0x65, 0x18, 0x66, 0x6f,
+ 0x72, 0x77, 0x61, 0x72, 0x64, 0x5f, 0x63, 0x68,
+ 0x61, 0x72, 0x0c, 0x63, 0x68, 0x61, 0x72, 0x41,
+ 0x74, 0x1a, 0x62, 0x61, 0x63, 0x6b, 0x77, 0x61,
+ 0x72, 0x64, 0x5f, 0x63, 0x68, 0x61, 0x72, 0x22,
+ 0x73, 0x6b, 0x69, 0x70, 0x5f, 0x77, 0x6f, 0x72,
+ 0x64, 0x5f, 0x66, 0x6f, 0x72, 0x77, 0x61, 0x72,
+ 0x64, 0x24, 0x73, 0x6b, 0x69, 0x70, 0x5f, 0x77,
+ 0x6f, 0x72, 0x64, 0x5f, 0x62, 0x61, 0x63, 0x6b,
+ 0x77, 0x61, 0x72, 0x64, 0x18, 0x66, 0x6f, 0x72,
+ 0x77, 0x61, 0x72, 0x64, 0x5f, 0x77, 0x6f, 0x72,
+ 0x64, 0x1a, 0x62, 0x61, 0x63, 0x6b, 0x77, 0x61,
+ 0x72, 0x64, 0x5f, 0x77, 0x6f, 0x72, 0x64, 0x16,
+ 0x61, 0x63, 0x63, 0x65, 0x70, 0x74, 0x5f, 0x6c,
+ 0x69, 0x6e, 0x65, 0x16, 0x68, 0x69, 0x73, 0x74,
+ 0x6f, 0x72, 0x79, 0x5f, 0x61, 0x64, 0x64, 0x08,
+ 0x70, 0x75, 0x73, 0x68, 0x20, 0x70, 0x72, 0x65,
+ 0x76, 0x69, 0x6f, 0x75, 0x73, 0x5f, 0x68, 0x69,
+ 0x73, 0x74, 0x6f, 0x72, 0x79, 0x18, 0x6e, 0x65,
+ 0x78, 0x74, 0x5f, 0x68, 0x69, 0x73, 0x74, 0x6f,
+ 0x72, 0x79, 0x1c, 0x68, 0x69, 0x73, 0x74, 0x6f,
+ 0x72, 0x79, 0x5f, 0x73, 0x65, 0x61, 0x72, 0x63,
+ 0x68, 0x2e, 0x68, 0x69, 0x73, 0x74, 0x6f, 0x72,
+ 0x79, 0x5f, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68,
+ 0x5f, 0x62, 0x61, 0x63, 0x6b, 0x77, 0x61, 0x72,
+ 0x64, 0x2c, 0x68, 0x69, 0x73, 0x74, 0x6f, 0x72,
+ 0x79, 0x5f, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68,
+ 0x5f, 0x66, 0x6f, 0x72, 0x77, 0x61, 0x72, 0x64,
+ 0x1e, 0x64, 0x65, 0x6c, 0x65, 0x74, 0x65, 0x5f,
+ 0x63, 0x68, 0x61, 0x72, 0x5f, 0x64, 0x69, 0x72,
+ 0x16, 0x64, 0x65, 0x6c, 0x65, 0x74, 0x65, 0x5f,
+ 0x63, 0x68, 0x61, 0x72, 0x12, 0x63, 0x6f, 0x6e,
+ 0x74, 0x72, 0x6f, 0x6c, 0x5f, 0x64, 0x28, 0x62,
+ 0x61, 0x63, 0x6b, 0x77, 0x61, 0x72, 0x64, 0x5f,
+ 0x64, 0x65, 0x6c, 0x65, 0x74, 0x65, 0x5f, 0x63,
+ 0x68, 0x61, 0x72, 0x1e, 0x74, 0x72, 0x61, 0x6e,
+ 0x73, 0x70, 0x6f, 0x73, 0x65, 0x5f, 0x63, 0x68,
+ 0x61, 0x72, 0x73, 0x1e, 0x74, 0x72, 0x61, 0x6e,
+ 0x73, 0x70, 0x6f, 0x73, 0x65, 0x5f, 0x77, 0x6f,
+ 0x72, 0x64, 0x73, 0x16, 0x75, 0x70, 0x63, 0x61,
+ 0x73, 0x65, 0x5f, 0x77, 0x6f, 0x72, 0x64, 0x16,
+ 0x74, 0x6f, 0x55, 0x70, 0x70, 0x65, 0x72, 0x43,
+ 0x61, 0x73, 0x65, 0x1a, 0x64, 0x6f, 0x77, 0x6e,
+ 0x63, 0x61, 0x73, 0x65, 0x5f, 0x77, 0x6f, 0x72,
+ 0x64, 0x16, 0x74, 0x6f, 0x4c, 0x6f, 0x77, 0x65,
+ 0x72, 0x43, 0x61, 0x73, 0x65, 0x16, 0x6b, 0x69,
+ 0x6c, 0x6c, 0x5f, 0x72, 0x65, 0x67, 0x69, 0x6f,
+ 0x6e, 0x12, 0x6b, 0x69, 0x6c, 0x6c, 0x5f, 0x6c,
+ 0x69, 0x6e, 0x65, 0x24, 0x62, 0x61, 0x63, 0x6b,
+ 0x77, 0x61, 0x72, 0x64, 0x5f, 0x6b, 0x69, 0x6c,
+ 0x6c, 0x5f, 0x6c, 0x69, 0x6e, 0x65, 0x12, 0x6b,
+ 0x69, 0x6c, 0x6c, 0x5f, 0x77, 0x6f, 0x72, 0x64,
+ 0x24, 0x62, 0x61, 0x63, 0x6b, 0x77, 0x61, 0x72,
+ 0x64, 0x5f, 0x6b, 0x69, 0x6c, 0x6c, 0x5f, 0x77,
+ 0x6f, 0x72, 0x64, 0x08, 0x79, 0x61, 0x6e, 0x6b,
+ 0x12, 0x63, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c,
+ 0x5f, 0x63, 0x08, 0x65, 0x78, 0x69, 0x74, 0x3c,
+ 0x0a, 0x28, 0x50, 0x72, 0x65, 0x73, 0x73, 0x20,
+ 0x43, 0x74, 0x72, 0x6c, 0x2d, 0x43, 0x20, 0x61,
+ 0x67, 0x61, 0x69, 0x6e, 0x20, 0x74, 0x6f, 0x20,
+ 0x71, 0x75, 0x69, 0x74, 0x29, 0x0a, 0x0a, 0x72,
+ 0x65, 0x73, 0x65, 0x74, 0x20, 0x67, 0x65, 0x74,
+ 0x5f, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x78, 0x74,
+ 0x5f, 0x77, 0x6f, 0x72, 0x64, 0x24, 0x67, 0x65,
+ 0x74, 0x5f, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x78,
+ 0x74, 0x5f, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74,
+ 0x08, 0x6c, 0x69, 0x6e, 0x65, 0x06, 0x70, 0x6f,
+ 0x73, 0x06, 0x6f, 0x62, 0x6a, 0x08, 0x62, 0x61,
+ 0x73, 0x65, 0x02, 0x63, 0x02, 0x67, 0x0c, 0x63,
+ 0x6f, 0x6c, 0x6f, 0x72, 0x73, 0x0c, 0x73, 0x74,
+ 0x79, 0x6c, 0x65, 0x73, 0x0e, 0x68, 0x69, 0x73,
+ 0x74, 0x6f, 0x72, 0x79, 0x14, 0x63, 0x6c, 0x69,
+ 0x70, 0x5f, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x08,
+ 0x70, 0x72, 0x65, 0x63, 0x0e, 0x65, 0x78, 0x70,
+ 0x42, 0x69, 0x74, 0x73, 0x0e, 0x6c, 0x6f, 0x67,
+ 0x32, 0x5f, 0x31, 0x30, 0x0c, 0x70, 0x73, 0x74,
+ 0x61, 0x74, 0x65, 0x0c, 0x70, 0x72, 0x6f, 0x6d,
+ 0x70, 0x74, 0x08, 0x70, 0x6c, 0x65, 0x6e, 0x06,
+ 0x70, 0x73, 0x31, 0x06, 0x70, 0x73, 0x32, 0x08,
+ 0x75, 0x74, 0x66, 0x38, 0x12, 0x73, 0x68, 0x6f,
+ 0x77, 0x5f, 0x74, 0x69, 0x6d, 0x65, 0x16, 0x73,
+ 0x68, 0x6f, 0x77, 0x5f, 0x63, 0x6f, 0x6c, 0x6f,
+ 0x72, 0x73, 0x1e, 0x65, 0x76, 0x61, 0x6c, 0x5f,
+ 0x73, 0x74, 0x61, 0x72, 0x74, 0x5f, 0x74, 0x69,
+ 0x6d, 0x65, 0x12, 0x65, 0x76, 0x61, 0x6c, 0x5f,
+ 0x74, 0x69, 0x6d, 0x65, 0x0a, 0x6d, 0x65, 0x78,
+ 0x70, 0x72, 0x0a, 0x6c, 0x65, 0x76, 0x65, 0x6c,
+ 0x06, 0x63, 0x6d, 0x64, 0x14, 0x63, 0x75, 0x72,
+ 0x73, 0x6f, 0x72, 0x5f, 0x70, 0x6f, 0x73, 0x10,
+ 0x6c, 0x61, 0x73, 0x74, 0x5f, 0x63, 0x6d, 0x64,
+ 0x1e, 0x6c, 0x61, 0x73, 0x74, 0x5f, 0x63, 0x75,
+ 0x72, 0x73, 0x6f, 0x72, 0x5f, 0x70, 0x6f, 0x73,
+ 0x1a, 0x68, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79,
+ 0x5f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x10, 0x74,
+ 0x68, 0x69, 0x73, 0x5f, 0x66, 0x75, 0x6e, 0x10,
+ 0x6c, 0x61, 0x73, 0x74, 0x5f, 0x66, 0x75, 0x6e,
+ 0x14, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x5f, 0x66,
+ 0x6c, 0x61, 0x67, 0x14, 0x75, 0x74, 0x66, 0x38,
+ 0x5f, 0x73, 0x74, 0x61, 0x74, 0x65, 0x10, 0x75,
+ 0x74, 0x66, 0x38, 0x5f, 0x76, 0x61, 0x6c, 0x0e,
+ 0x74, 0x65, 0x72, 0x6d, 0x5f, 0x66, 0x64, 0x1a,
+ 0x74, 0x65, 0x72, 0x6d, 0x5f, 0x72, 0x65, 0x61,
+ 0x64, 0x5f, 0x62, 0x75, 0x66, 0x14, 0x74, 0x65,
+ 0x72, 0x6d, 0x5f, 0x77, 0x69, 0x64, 0x74, 0x68,
+ 0x1a, 0x74, 0x65, 0x72, 0x6d, 0x5f, 0x63, 0x75,
+ 0x72, 0x73, 0x6f, 0x72, 0x5f, 0x78, 0x1e, 0x67,
+ 0x65, 0x74, 0x5f, 0x63, 0x6f, 0x6d, 0x70, 0x6c,
+ 0x65, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x14, 0x63,
+ 0x6f, 0x6d, 0x70, 0x6c, 0x65, 0x74, 0x69, 0x6f,
+ 0x6e, 0x10, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x6e,
+ 0x64, 0x73, 0x0c, 0x64, 0x75, 0x70, 0x73, 0x74,
+ 0x72, 0x1a, 0x72, 0x65, 0x61, 0x64, 0x6c, 0x69,
+ 0x6e, 0x65, 0x5f, 0x6b, 0x65, 0x79, 0x73, 0x1c,
+ 0x72, 0x65, 0x61, 0x64, 0x6c, 0x69, 0x6e, 0x65,
+ 0x5f, 0x73, 0x74, 0x61, 0x74, 0x65, 0x16, 0x72,
+ 0x65, 0x61, 0x64, 0x6c, 0x69, 0x6e, 0x65, 0x5f,
+ 0x63, 0x62, 0x2a, 0x72, 0x65, 0x61, 0x64, 0x6c,
+ 0x69, 0x6e, 0x65, 0x5f, 0x70, 0x72, 0x69, 0x6e,
+ 0x74, 0x5f, 0x70, 0x72, 0x6f, 0x6d, 0x70, 0x74,
+ 0x1c, 0x72, 0x65, 0x61, 0x64, 0x6c, 0x69, 0x6e,
+ 0x65, 0x5f, 0x73, 0x74, 0x61, 0x72, 0x74, 0x16,
+ 0x68, 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x5f, 0x63,
+ 0x68, 0x61, 0x72, 0x14, 0x68, 0x61, 0x6e, 0x64,
+ 0x6c, 0x65, 0x5f, 0x6b, 0x65, 0x79, 0x10, 0x68,
+ 0x65, 0x78, 0x5f, 0x6d, 0x6f, 0x64, 0x65, 0x28,
+ 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x5f, 0x74,
+ 0x6f, 0x5f, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67,
+ 0x5f, 0x68, 0x65, 0x78, 0x22, 0x65, 0x78, 0x74,
+ 0x72, 0x61, 0x63, 0x74, 0x5f, 0x64, 0x69, 0x72,
+ 0x65, 0x63, 0x74, 0x69, 0x76, 0x65, 0x20, 0x68,
+ 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x5f, 0x64, 0x69,
+ 0x72, 0x65, 0x63, 0x74, 0x69, 0x76, 0x65, 0x08,
+ 0x68, 0x65, 0x6c, 0x70, 0x12, 0x63, 0x6d, 0x64,
+ 0x5f, 0x73, 0x74, 0x61, 0x72, 0x74, 0x24, 0x63,
+ 0x6d, 0x64, 0x5f, 0x72, 0x65, 0x61, 0x64, 0x6c,
+ 0x69, 0x6e, 0x65, 0x5f, 0x73, 0x74, 0x61, 0x72,
+ 0x74, 0x26, 0x72, 0x65, 0x61, 0x64, 0x6c, 0x69,
+ 0x6e, 0x65, 0x5f, 0x68, 0x61, 0x6e, 0x64, 0x6c,
+ 0x65, 0x5f, 0x63, 0x6d, 0x64, 0x14, 0x68, 0x61,
+ 0x6e, 0x64, 0x6c, 0x65, 0x5f, 0x63, 0x6d, 0x64,
+ 0x28, 0x65, 0x76, 0x61, 0x6c, 0x5f, 0x61, 0x6e,
+ 0x64, 0x5f, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x5f,
+ 0x73, 0x74, 0x61, 0x72, 0x74, 0x22, 0x70, 0x72,
+ 0x69, 0x6e, 0x74, 0x5f, 0x65, 0x76, 0x61, 0x6c,
+ 0x5f, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x20,
+ 0x70, 0x72, 0x69, 0x6e, 0x74, 0x5f, 0x65, 0x76,
+ 0x61, 0x6c, 0x5f, 0x65, 0x72, 0x72, 0x6f, 0x72,
+ 0x1c, 0x68, 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x5f,
+ 0x63, 0x6d, 0x64, 0x5f, 0x65, 0x6e, 0x64, 0x16,
+ 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x69, 0x7a, 0x65,
+ 0x5f, 0x6a, 0x73, 0x2a, 0x20, 0x7e, 0x21, 0x25,
+ 0x5e, 0x26, 0x2a, 0x28, 0x2d, 0x2b, 0x3d, 0x7b,
+ 0x5b, 0x7c, 0x3a, 0x3b, 0x2c, 0x3c, 0x3e, 0x3f,
+ 0x2f, 0x0e, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x4f,
+ 0x66, 0x02, 0x2e, 0x02, 0x27, 0x02, 0x22, 0x02,
+ 0x5d, 0x02, 0x7d, 0x02, 0x2f, 0x10, 0x69, 0x6e,
+ 0x63, 0x6c, 0x75, 0x64, 0x65, 0x73, 0x26, 0x67,
+ 0x65, 0x74, 0x4f, 0x77, 0x6e, 0x50, 0x72, 0x6f,
+ 0x70, 0x65, 0x72, 0x74, 0x79, 0x4e, 0x61, 0x6d,
+ 0x65, 0x73, 0x14, 0x73, 0x74, 0x61, 0x72, 0x74,
+ 0x73, 0x57, 0x69, 0x74, 0x68, 0x08, 0x73, 0x6f,
+ 0x72, 0x74, 0x06, 0x74, 0x61, 0x62, 0x06, 0x63,
+ 0x74, 0x78, 0x0c, 0x73, 0x79, 0x6d, 0x63, 0x6d,
+ 0x70, 0x02, 0x28, 0x02, 0x29, 0x06, 0x6d, 0x61,
+ 0x78, 0x0a, 0x66, 0x6c, 0x6f, 0x6f, 0x72, 0x08,
+ 0x63, 0x65, 0x69, 0x6c, 0x0c, 0x70, 0x61, 0x64,
+ 0x45, 0x6e, 0x64, 0x02, 0x20, 0x0e, 0x74, 0x6f,
+ 0x46, 0x69, 0x78, 0x65, 0x64, 0x1a, 0x66, 0x72,
+ 0x6f, 0x6d, 0x43, 0x6f, 0x64, 0x65, 0x50, 0x6f,
+ 0x69, 0x6e, 0x74, 0x02, 0x1b, 0x02, 0x5b, 0x02,
+ 0x4f, 0x02, 0x3b, 0x02, 0x2d, 0x04, 0x30, 0x78,
+ 0x02, 0x5c, 0x02, 0x68, 0x02, 0x3f, 0x08, 0x6c,
+ 0x6f, 0x61, 0x64, 0x08, 0x74, 0x72, 0x69, 0x6d,
+ 0x16, 0x6c, 0x61, 0x73, 0x74, 0x49, 0x6e, 0x64,
+ 0x65, 0x78, 0x4f, 0x66, 0x06, 0x2e, 0x6a, 0x73,
+ 0x14, 0x6c, 0x6f, 0x61, 0x64, 0x53, 0x63, 0x72,
+ 0x69, 0x70, 0x74, 0x02, 0x78, 0x02, 0x64, 0x02,
+ 0x74, 0x0a, 0x63, 0x6c, 0x65, 0x61, 0x72, 0x0c,
+ 0x1b, 0x5b, 0x48, 0x1b, 0x5b, 0x4a, 0x02, 0x71,
+ 0x26, 0x55, 0x6e, 0x6b, 0x6e, 0x6f, 0x77, 0x6e,
+ 0x20, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69,
+ 0x76, 0x65, 0x3a, 0x20, 0x42, 0x5c, 0x68, 0x20,
+ 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+ 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x68, 0x65,
+ 0x6c, 0x70, 0x0a, 0x5c, 0x78, 0x20, 0x20, 0x20,
+ 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x36, 0x68,
+ 0x65, 0x78, 0x61, 0x64, 0x65, 0x63, 0x69, 0x6d,
+ 0x61, 0x6c, 0x20, 0x6e, 0x75, 0x6d, 0x62, 0x65,
+ 0x72, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61,
+ 0x79, 0x0a, 0x16, 0x5c, 0x64, 0x20, 0x20, 0x20,
+ 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2e, 0x64,
+ 0x65, 0x63, 0x69, 0x6d, 0x61, 0x6c, 0x20, 0x6e,
+ 0x75, 0x6d, 0x62, 0x65, 0x72, 0x20, 0x64, 0x69,
+ 0x73, 0x70, 0x6c, 0x61, 0x79, 0x0a, 0x16, 0x5c,
+ 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+ 0x20, 0x20, 0x2c, 0x74, 0x6f, 0x67, 0x67, 0x6c,
+ 0x65, 0x20, 0x74, 0x69, 0x6d, 0x69, 0x6e, 0x67,
+ 0x20, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79,
+ 0x0a, 0x3e, 0x5c, 0x63, 0x6c, 0x65, 0x61, 0x72,
+ 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6c,
+ 0x65, 0x61, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20,
+ 0x74, 0x65, 0x72, 0x6d, 0x69, 0x6e, 0x61, 0x6c,
+ 0x0a, 0x22, 0x5c, 0x71, 0x20, 0x20, 0x20, 0x20,
+ 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x78,
+ 0x69, 0x74, 0x0a, 0x06, 0x73, 0x65, 0x6c, 0x3a,
+ 0x51, 0x75, 0x69, 0x63, 0x6b, 0x4a, 0x53, 0x20,
+ 0x2d, 0x20, 0x54, 0x79, 0x70, 0x65, 0x20, 0x22,
+ 0x5c, 0x68, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x20,
+ 0x68, 0x65, 0x6c, 0x70, 0x0a, 0x08, 0x20, 0x20,
+ 0x20, 0x20, 0x06, 0x6e, 0x6f, 0x77, 0x14, 0x65,
+ 0x76, 0x61, 0x6c, 0x53, 0x63, 0x72, 0x69, 0x70,
+ 0x74, 0x22, 0x62, 0x61, 0x63, 0x6b, 0x74, 0x72,
+ 0x61, 0x63, 0x65, 0x5f, 0x62, 0x61, 0x72, 0x72,
+ 0x69, 0x65, 0x72, 0x02, 0x6e, 0x1a, 0x5f, 0x5f,
+ 0x70, 0x72, 0x69, 0x6e, 0x74, 0x4f, 0x62, 0x6a,
+ 0x65, 0x63, 0x74, 0x0e, 0x54, 0x68, 0x72, 0x6f,
+ 0x77, 0x3a, 0x20, 0x04, 0x67, 0x63, 0x88, 0x05,
+ 0x7c, 0x62, 0x72, 0x65, 0x61, 0x6b, 0x7c, 0x63,
+ 0x61, 0x73, 0x65, 0x7c, 0x63, 0x61, 0x74, 0x63,
+ 0x68, 0x7c, 0x63, 0x6f, 0x6e, 0x74, 0x69, 0x6e,
+ 0x75, 0x65, 0x7c, 0x64, 0x65, 0x62, 0x75, 0x67,
+ 0x67, 0x65, 0x72, 0x7c, 0x64, 0x65, 0x66, 0x61,
+ 0x75, 0x6c, 0x74, 0x7c, 0x64, 0x65, 0x6c, 0x65,
+ 0x74, 0x65, 0x7c, 0x64, 0x6f, 0x7c, 0x65, 0x6c,
+ 0x73, 0x65, 0x7c, 0x66, 0x69, 0x6e, 0x61, 0x6c,
+ 0x6c, 0x79, 0x7c, 0x66, 0x6f, 0x72, 0x7c, 0x66,
+ 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x7c,
+ 0x69, 0x66, 0x7c, 0x69, 0x6e, 0x7c, 0x69, 0x6e,
+ 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x6f, 0x66,
+ 0x7c, 0x6e, 0x65, 0x77, 0x7c, 0x72, 0x65, 0x74,
+ 0x75, 0x72, 0x6e, 0x7c, 0x73, 0x77, 0x69, 0x74,
+ 0x63, 0x68, 0x7c, 0x74, 0x68, 0x69, 0x73, 0x7c,
+ 0x74, 0x68, 0x72, 0x6f, 0x77, 0x7c, 0x74, 0x72,
+ 0x79, 0x7c, 0x74, 0x79, 0x70, 0x65, 0x6f, 0x66,
+ 0x7c, 0x77, 0x68, 0x69, 0x6c, 0x65, 0x7c, 0x77,
+ 0x69, 0x74, 0x68, 0x7c, 0x63, 0x6c, 0x61, 0x73,
+ 0x73, 0x7c, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x7c,
+ 0x65, 0x6e, 0x75, 0x6d, 0x7c, 0x69, 0x6d, 0x70,
+ 0x6f, 0x72, 0x74, 0x7c, 0x65, 0x78, 0x70, 0x6f,
+ 0x72, 0x74, 0x7c, 0x65, 0x78, 0x74, 0x65, 0x6e,
+ 0x64, 0x73, 0x7c, 0x73, 0x75, 0x70, 0x65, 0x72,
+ 0x7c, 0x69, 0x6d, 0x70, 0x6c, 0x65, 0x6d, 0x65,
+ 0x6e, 0x74, 0x73, 0x7c, 0x69, 0x6e, 0x74, 0x65,
+ 0x72, 0x66, 0x61, 0x63, 0x65, 0x7c, 0x6c, 0x65,
+ 0x74, 0x7c, 0x70, 0x61, 0x63, 0x6b, 0x61, 0x67,
+ 0x65, 0x7c, 0x70, 0x72, 0x69, 0x76, 0x61, 0x74,
+ 0x65, 0x7c, 0x70, 0x72, 0x6f, 0x74, 0x65, 0x63,
+ 0x74, 0x65, 0x64, 0x7c, 0x70, 0x75, 0x62, 0x6c,
+ 0x69, 0x63, 0x7c, 0x73, 0x74, 0x61, 0x74, 0x69,
+ 0x63, 0x7c, 0x79, 0x69, 0x65, 0x6c, 0x64, 0x7c,
+ 0x75, 0x6e, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65,
+ 0x64, 0x7c, 0x6e, 0x75, 0x6c, 0x6c, 0x7c, 0x74,
+ 0x72, 0x75, 0x65, 0x7c, 0x66, 0x61, 0x6c, 0x73,
+ 0x65, 0x7c, 0x49, 0x6e, 0x66, 0x69, 0x6e, 0x69,
+ 0x74, 0x79, 0x7c, 0x4e, 0x61, 0x4e, 0x7c, 0x65,
+ 0x76, 0x61, 0x6c, 0x7c, 0x61, 0x72, 0x67, 0x75,
+ 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x7c, 0x61, 0x77,
+ 0x61, 0x69, 0x74, 0x7c, 0x7a, 0x7c, 0x74, 0x68,
+ 0x69, 0x73, 0x7c, 0x73, 0x75, 0x70, 0x65, 0x72,
+ 0x7c, 0x75, 0x6e, 0x64, 0x65, 0x66, 0x69, 0x6e,
+ 0x65, 0x64, 0x7c, 0x6e, 0x75, 0x6c, 0x6c, 0x7c,
+ 0x74, 0x72, 0x75, 0x65, 0x7c, 0x66, 0x61, 0x6c,
+ 0x73, 0x65, 0x7c, 0x49, 0x6e, 0x66, 0x69, 0x6e,
+ 0x69, 0x74, 0x79, 0x7c, 0x4e, 0x61, 0x4e, 0x7c,
+ 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+ 0x73, 0x7c, 0x14, 0x7c, 0x76, 0x6f, 0x69, 0x64,
+ 0x7c, 0x76, 0x61, 0x72, 0x7c, 0x02, 0x2b, 0x02,
+ 0x60, 0x02, 0x7b, 0x14, 0x70, 0x75, 0x73, 0x68,
+ 0x5f, 0x73, 0x74, 0x61, 0x74, 0x65, 0x14, 0x6c,
+ 0x61, 0x73, 0x74, 0x5f, 0x73, 0x74, 0x61, 0x74,
+ 0x65, 0x12, 0x70, 0x6f, 0x70, 0x5f, 0x73, 0x74,
+ 0x61, 0x74, 0x65, 0x26, 0x70, 0x61, 0x72, 0x73,
+ 0x65, 0x5f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f,
+ 0x63, 0x6f, 0x6d, 0x6d, 0x65, 0x6e, 0x74, 0x24,
+ 0x70, 0x61, 0x72, 0x73, 0x65, 0x5f, 0x6c, 0x69,
+ 0x6e, 0x65, 0x5f, 0x63, 0x6f, 0x6d, 0x6d, 0x65,
+ 0x6e, 0x74, 0x18, 0x70, 0x61, 0x72, 0x73, 0x65,
+ 0x5f, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x16,
+ 0x70, 0x61, 0x72, 0x73, 0x65, 0x5f, 0x72, 0x65,
+ 0x67, 0x65, 0x78, 0x18, 0x70, 0x61, 0x72, 0x73,
+ 0x65, 0x5f, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72,
+ 0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x5f, 0x69,
+ 0x64, 0x65, 0x6e, 0x74, 0x69, 0x66, 0x69, 0x65,
+ 0x72, 0x02, 0x7c, 0x12, 0x73, 0x65, 0x74, 0x5f,
+ 0x73, 0x74, 0x79, 0x6c, 0x65, 0x0d, 0xdc, 0x03,
+ 0x02, 0xde, 0x03, 0x02, 0xe0, 0x03, 0x02, 0x00,
+ 0x00, 0x02, 0x00, 0x01, 0x82, 0x02, 0x00, 0x01,
+ 0x01, 0x82, 0x02, 0x01, 0x00, 0x0c, 0x20, 0x02,
+ 0x01, 0xa8, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00,
+ 0x08, 0x01, 0x0d, 0x00, 0xde, 0x03, 0x00, 0x1e,
+ 0x00, 0xe0, 0x03, 0x01, 0x1e, 0x00, 0xe6, 0x02,
+ 0x00, 0x05, 0x00, 0xe2, 0x03, 0x00, 0x05, 0x00,
+ 0x7c, 0x00, 0x05, 0x00, 0xdc, 0x02, 0x00, 0x05,
+ 0x00, 0xc4, 0x02, 0x00, 0x05, 0x00, 0x9e, 0x02,
+ 0x00, 0x05, 0x00, 0x08, 0xe8, 0x02, 0x29, 0xbe,
+ 0x00, 0x38, 0x07, 0x00, 0xed, 0x0e, 0x06, 0x2f,
+ 0x0c, 0x43, 0x02, 0x01, 0x00, 0x01, 0x74, 0x01,
+ 0x02, 0x75, 0x07, 0x47, 0xcd, 0x08, 0x75, 0x00,
+ 0x01, 0x2c, 0x40, 0x00, 0x00, 0x2d, 0x40, 0x00,
+ 0x01, 0x2e, 0x40, 0x00, 0x02, 0x2f, 0x40, 0x00,
+ 0x03, 0x30, 0x40, 0x00, 0x04, 0x0f, 0x40, 0x00,
+ 0x05, 0x31, 0x40, 0x00, 0x06, 0x32, 0x40, 0x00,
+ 0x07, 0x0c, 0x40, 0x00, 0x08, 0x0d, 0x40, 0x00,
+ 0x09, 0x21, 0x40, 0x00, 0x0a, 0x27, 0x40, 0x00,
+ 0x0b, 0x33, 0x40, 0x00, 0x0c, 0x34, 0x40, 0x00,
+ 0x0d, 0x35, 0x40, 0x00, 0x0e, 0x36, 0x40, 0x00,
+ 0x0f, 0x37, 0x40, 0x00, 0x10, 0x38, 0x40, 0x00,
+ 0x11, 0x39, 0x40, 0x00, 0x12, 0x3a, 0x40, 0x00,
+ 0x13, 0x06, 0x40, 0x00, 0x14, 0x3b, 0x40, 0x00,
+ 0x15, 0x13, 0x40, 0x00, 0x16, 0x3c, 0x40, 0x00,
+ 0x17, 0x3d, 0x40, 0x00, 0x18, 0x17, 0x40, 0x00,
+ 0x19, 0x3e, 0x40, 0x00, 0x1a, 0x11, 0x40, 0x00,
+ 0x1b, 0x1a, 0x40, 0x00, 0x1c, 0x12, 0x40, 0x00,
+ 0x1d, 0x14, 0x40, 0x00, 0x1e, 0x22, 0x40, 0x00,
+ 0x1f, 0x28, 0x40, 0x00, 0x20, 0x24, 0x40, 0x00,
+ 0x21, 0x1b, 0x40, 0x00, 0x22, 0x08, 0x40, 0x00,
+ 0x23, 0x09, 0x40, 0x00, 0x24, 0x00, 0x40, 0x00,
+ 0x25, 0x03, 0x40, 0x00, 0x26, 0x01, 0x40, 0x00,
+ 0x27, 0x0e, 0x40, 0x00, 0x28, 0x3f, 0x40, 0x00,
+ 0x29, 0x02, 0x40, 0x00, 0x2a, 0x04, 0x40, 0x00,
+ 0x2b, 0x05, 0x40, 0x00, 0x2c, 0x0a, 0x40, 0x00,
+ 0x2d, 0x0b, 0x40, 0x00, 0x2e, 0x1d, 0x40, 0x00,
+ 0x2f, 0x16, 0x40, 0x00, 0x30, 0x1c, 0x40, 0x00,
+ 0x31, 0x40, 0x40, 0x00, 0x32, 0x19, 0x40, 0x00,
+ 0x33, 0x10, 0x40, 0x00, 0x34, 0x15, 0x40, 0x00,
+ 0x35, 0x41, 0x40, 0x00, 0x36, 0x29, 0x40, 0x00,
+ 0x37, 0x42, 0x40, 0x00, 0x38, 0x43, 0x40, 0x00,
+ 0x39, 0x44, 0x40, 0x00, 0x3a, 0x45, 0x40, 0x00,
+ 0x3b, 0x46, 0x40, 0x00, 0x3c, 0x47, 0x40, 0x00,
+ 0x3d, 0x48, 0x40, 0x00, 0x3e, 0x1e, 0x40, 0x00,
+ 0x3f, 0x1f, 0x40, 0x00, 0x40, 0x49, 0x40, 0x00,
+ 0x41, 0x4a, 0x40, 0x00, 0x42, 0x4b, 0x40, 0x00,
+ 0x43, 0x20, 0x40, 0x00, 0x44, 0x4c, 0x40, 0x00,
+ 0x45, 0x4d, 0x40, 0x00, 0x46, 0x23, 0x40, 0x00,
+ 0x47, 0x4e, 0x40, 0x00, 0x48, 0x4f, 0x40, 0x00,
+ 0x49, 0x26, 0x40, 0x00, 0x4a, 0x50, 0x40, 0x00,
+ 0x4b, 0x51, 0x40, 0x00, 0x4c, 0x52, 0x40, 0x00,
+ 0x4d, 0x53, 0x40, 0x00, 0x4e, 0x54, 0x40, 0x00,
+ 0x4f, 0x55, 0x40, 0x00, 0x50, 0x56, 0x40, 0x00,
+ 0x51, 0x25, 0x40, 0x00, 0x52, 0x57, 0x40, 0x00,
+ 0x53, 0x58, 0x40, 0x00, 0x54, 0x59, 0x40, 0x00,
+ 0x55, 0x5a, 0x40, 0x00, 0x56, 0x5b, 0x40, 0x00,
+ 0x57, 0x2a, 0x40, 0x00, 0x58, 0x5c, 0x40, 0x00,
+ 0x59, 0x5d, 0x40, 0x00, 0x5a, 0x5e, 0x40, 0x00,
+ 0x5b, 0x5f, 0x40, 0x00, 0x5c, 0x60, 0x40, 0x00,
+ 0x5d, 0x61, 0x40, 0x00, 0x5e, 0x62, 0x40, 0x00,
+ 0x5f, 0x63, 0x40, 0x00, 0x60, 0x64, 0x40, 0x00,
+ 0x61, 0x65, 0x40, 0x00, 0x62, 0x2b, 0x40, 0x00,
+ 0x63, 0x66, 0x40, 0x00, 0x64, 0x07, 0x40, 0x00,
+ 0x65, 0x67, 0x40, 0x00, 0x66, 0x68, 0x40, 0x00,
+ 0x67, 0x69, 0x40, 0x00, 0x68, 0x6a, 0x40, 0x00,
+ 0x69, 0x6b, 0x40, 0x00, 0x6a, 0x6c, 0x40, 0x00,
+ 0x6b, 0x6d, 0x40, 0x00, 0x6c, 0x6e, 0x40, 0x00,
+ 0x6d, 0x6f, 0x40, 0x00, 0x6e, 0x70, 0x40, 0x00,
+ 0x6f, 0x71, 0x40, 0x00, 0x70, 0x72, 0x40, 0x00,
+ 0x71, 0x73, 0x40, 0x00, 0x72, 0x74, 0x40, 0x00,
+ 0x73, 0x18, 0x40, 0x00, 0x00, 0x1a, 0x00, 0x00,
+ 0x01, 0x1a, 0x00, 0xe6, 0x02, 0x02, 0x03, 0x00,
+ 0xe2, 0x03, 0x03, 0x03, 0x00, 0x7c, 0x04, 0x03,
+ 0x00, 0xdc, 0x02, 0x05, 0x03, 0x00, 0xc4, 0x02,
+ 0x06, 0x03, 0x00, 0xbe, 0x00, 0xc1, 0x28, 0xbe,
+ 0x01, 0xc1, 0x29, 0xbe, 0x02, 0xc1, 0x2a, 0xbe,
+ 0x03, 0xc1, 0x2b, 0xbe, 0x04, 0xc1, 0x2c, 0xbe,
+ 0x05, 0xc1, 0x2d, 0xbe, 0x06, 0xc1, 0x2e, 0xbe,
+ 0x07, 0xc1, 0x2f, 0xbe, 0x08, 0xc1, 0x30, 0xbe,
+ 0x09, 0xc1, 0x31, 0xbe, 0x0a, 0xc1, 0x32, 0xbe,
+ 0x0b, 0xc1, 0x33, 0xbe, 0x0c, 0xc1, 0x34, 0xbe,
+ 0x0d, 0xc1, 0x35, 0xbe, 0x0e, 0xc1, 0x36, 0xbe,
+ 0x0f, 0xc1, 0x37, 0xbe, 0x10, 0xc1, 0x38, 0xbe,
+ 0x11, 0xc1, 0x39, 0xbe, 0x12, 0xc1, 0x3a, 0xbe,
+ 0x13, 0xc1, 0x3b, 0xbe, 0x14, 0xc1, 0x3c, 0xbe,
+ 0x15, 0xc1, 0x3d, 0xbe, 0x16, 0xc1, 0x3e, 0xbe,
+ 0x17, 0xc1, 0x3f, 0xbe, 0x18, 0xc1, 0x40, 0xbe,
+ 0x19, 0xc1, 0x41, 0xbe, 0x1a, 0xc1, 0x42, 0xbe,
+ 0x1b, 0xc1, 0x43, 0xbe, 0x1c, 0xc1, 0x44, 0xbe,
+ 0x1d, 0xc1, 0x45, 0xbe, 0x1e, 0xc1, 0x46, 0xbe,
+ 0x1f, 0xc1, 0x47, 0xbe, 0x20, 0xc1, 0x48, 0xbe,
+ 0x21, 0xc1, 0x49, 0xbe, 0x22, 0xc1, 0x4a, 0xbe,
+ 0x23, 0xc1, 0x4b, 0xbe, 0x24, 0xc1, 0x4c, 0xbe,
+ 0x25, 0xc1, 0x4d, 0xbe, 0x26, 0xc1, 0x4e, 0xbe,
+ 0x27, 0xc1, 0x4f, 0xbe, 0x28, 0xc1, 0x50, 0xbe,
+ 0x29, 0xc1, 0x51, 0xbe, 0x2a, 0xc1, 0x52, 0xbe,
+ 0x2b, 0xc1, 0x53, 0xbe, 0x2c, 0xc1, 0x54, 0xbe,
+ 0x2d, 0xc1, 0x55, 0xbe, 0x2e, 0xc1, 0x56, 0xbe,
+ 0x2f, 0xc1, 0x57, 0xbe, 0x30, 0xc1, 0x58, 0xbe,
+ 0x31, 0xc1, 0x59, 0xbe, 0x32, 0xc1, 0x5a, 0xbe,
+ 0x33, 0xc1, 0x5b, 0xbe, 0x34, 0xc1, 0x5c, 0xbe,
+ 0x35, 0xc1, 0x5e, 0xbe, 0x36, 0xc1, 0x62, 0xbe,
+ 0x37, 0xc1, 0x63, 0xbe, 0x38, 0xc1, 0x64, 0xbe,
+ 0x39, 0xc1, 0x65, 0xbe, 0x3a, 0xc1, 0x67, 0xbe,
+ 0x3b, 0xc1, 0x68, 0xbe, 0x3c, 0xc1, 0x69, 0xbe,
+ 0x3d, 0xc1, 0x6a, 0xbe, 0x3e, 0xc1, 0x6b, 0xbe,
+ 0x3f, 0xc1, 0x6c, 0xbe, 0x40, 0xc1, 0x6d, 0xbe,
+ 0x41, 0xc1, 0x6e, 0xbe, 0x42, 0xc1, 0x6f, 0xbe,
+ 0x43, 0xc1, 0x70, 0xbe, 0x44, 0xc1, 0x71, 0xbe,
+ 0x45, 0xc1, 0x72, 0xbe, 0x46, 0xc1, 0x73, 0xcf,
+ 0x64, 0x01, 0x00, 0x3f, 0xf0, 0x00, 0x00, 0x00,
+ 0x00, 0x00, 0xcf, 0x64, 0x00, 0x00, 0x3f, 0xef,
+ 0x00, 0x00, 0x00, 0x01, 0x00, 0xcf, 0x3d, 0xa0,
+ 0x00, 0x00, 0x00, 0x02, 0x00, 0xc7, 0xcf, 0x3d,
+ 0xa4, 0x00, 0x00, 0x00, 0x03, 0x00, 0xc8, 0xcf,
+ 0x3d, 0xa1, 0x00, 0x00, 0x00, 0x04, 0x00, 0xc9,
+ 0xcf, 0x3d, 0xaa, 0x00, 0x00, 0x00, 0x05, 0x00,
+ 0xca, 0xcf, 0x3d, 0xa8, 0x00, 0x00, 0x00, 0x06,
+ 0x00, 0xc1, 0x04, 0xcf, 0x3d, 0xf2, 0x00, 0x00,
+ 0x00, 0x07, 0x00, 0xc1, 0x05, 0xcf, 0x3d, 0xf3,
+ 0x00, 0x00, 0x00, 0x08, 0x00, 0xc1, 0x06, 0x0b,
+ 0x04, 0xf4, 0x00, 0x00, 0x00, 0x49, 0xf5, 0x00,
+ 0x00, 0x00, 0x04, 0xf6, 0x00, 0x00, 0x00, 0x49,
+ 0xf7, 0x00, 0x00, 0x00, 0x04, 0xf8, 0x00, 0x00,
+ 0x00, 0x49, 0xf9, 0x00, 0x00, 0x00, 0x04, 0xfa,
+ 0x00, 0x00, 0x00, 0x49, 0xfb, 0x00, 0x00, 0x00,
+ 0x04, 0xfc, 0x00, 0x00, 0x00, 0x49, 0xfd, 0x00,
+ 0x00, 0x00, 0x04, 0xfe, 0x00, 0x00, 0x00, 0x49,
+ 0xff, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x00,
+ 0x00, 0x49, 0x01, 0x01, 0x00, 0x00, 0x04, 0x02,
+ 0x01, 0x00, 0x00, 0x49, 0x03, 0x01, 0x00, 0x00,
+ 0x04, 0x04, 0x01, 0x00, 0x00, 0x49, 0x05, 0x01,
+ 0x00, 0x00, 0x04, 0x06, 0x01, 0x00, 0x00, 0x49,
+ 0x07, 0x01, 0x00, 0x00, 0x04, 0x06, 0x01, 0x00,
+ 0x00, 0x49, 0x08, 0x01, 0x00, 0x00, 0x04, 0x09,
+ 0x01, 0x00, 0x00, 0x49, 0x0a, 0x01, 0x00, 0x00,
+ 0x04, 0x0b, 0x01, 0x00, 0x00, 0x49, 0x0c, 0x01,
+ 0x00, 0x00, 0x04, 0x0d, 0x01, 0x00, 0x00, 0x49,
+ 0x0e, 0x01, 0x00, 0x00, 0x04, 0x0f, 0x01, 0x00,
+ 0x00, 0x49, 0x10, 0x01, 0x00, 0x00, 0x04, 0x11,
+ 0x01, 0x00, 0x00, 0x49, 0x12, 0x01, 0x00, 0x00,
+ 0x04, 0x13, 0x01, 0x00, 0x00, 0x49, 0x14, 0x01,
+ 0x00, 0x00, 0x04, 0x15, 0x01, 0x00, 0x00, 0x49,
+ 0x16, 0x01, 0x00, 0x00, 0xc1, 0x07, 0x0b, 0x04,
+ 0x0c, 0x01, 0x00, 0x00, 0x49, 0x16, 0x00, 0x00,
+ 0x00, 0x04, 0x05, 0x01, 0x00, 0x00, 0x49, 0x17,
+ 0x01, 0x00, 0x00, 0x04, 0x14, 0x01, 0x00, 0x00,
+ 0x49, 0x4c, 0x00, 0x00, 0x00, 0x04, 0x03, 0x01,
+ 0x00, 0x00, 0x49, 0x18, 0x01, 0x00, 0x00, 0x04,
+ 0xfb, 0x00, 0x00, 0x00, 0x49, 0x4a, 0x00, 0x00,
+ 0x00, 0x04, 0x16, 0x01, 0x00, 0x00, 0x49, 0x19,
+ 0x01, 0x00, 0x00, 0x04, 0x0e, 0x01, 0x00, 0x00,
+ 0x49, 0x1b, 0x00, 0x00, 0x00, 0x04, 0x12, 0x01,
+ 0x00, 0x00, 0x49, 0x1a, 0x01, 0x00, 0x00, 0x04,
+ 0x0c, 0x01, 0x00, 0x00, 0x49, 0x1b, 0x01, 0x00,
+ 0x00, 0x04, 0xf9, 0x00, 0x00, 0x00, 0x49, 0x1c,
+ 0x01, 0x00, 0x00, 0x04, 0x16, 0x01, 0x00, 0x00,
+ 0x49, 0x1d, 0x01, 0x00, 0x00, 0x04, 0x0a, 0x01,
+ 0x00, 0x00, 0x49, 0x1e, 0x01, 0x00, 0x00, 0xc1,
+ 0x08, 0x26, 0x00, 0x00, 0xc1, 0x09, 0xbf, 0xc1,
+ 0x0a, 0xbf, 0xc1, 0x0e, 0xbf, 0xc1, 0x0f, 0xb3,
+ 0xc1, 0x10, 0x04, 0x1f, 0x01, 0x00, 0x00, 0xc1,
+ 0x11, 0x04, 0x20, 0x01, 0x00, 0x00, 0xc1, 0x12,
+ 0x0a, 0xc1, 0x13, 0x09, 0xc1, 0x14, 0x0a, 0xc1,
+ 0x15, 0xb3, 0xc1, 0x17, 0xbf, 0xc1, 0x18, 0xb3,
+ 0xc1, 0x19, 0xbf, 0xc1, 0x1a, 0xb3, 0xc1, 0x1b,
+ 0xbf, 0xc1, 0x1c, 0xb3, 0xc1, 0x1d, 0x09, 0xc1,
+ 0x21, 0xb3, 0xc1, 0x22, 0xb3, 0xc1, 0x23, 0xb3,
+ 0xc1, 0x27, 0x0b, 0xc0, 0x3a, 0x49, 0x21, 0x01,
+ 0x00, 0x00, 0xc0, 0x3d, 0x49, 0x22, 0x01, 0x00,
+ 0x00, 0xc0, 0x57, 0x49, 0x23, 0x01, 0x00, 0x00,
+ 0xc0, 0x4b, 0x49, 0x24, 0x01, 0x00, 0x00, 0xc0,
+ 0x3b, 0x49, 0x25, 0x01, 0x00, 0x00, 0xc0, 0x3c,
+ 0x49, 0x26, 0x01, 0x00, 0x00, 0xc0, 0x38, 0x49,
+ 0x27, 0x01, 0x00, 0x00, 0xc0, 0x4c, 0x49, 0x28,
+ 0x01, 0x00, 0x00, 0xc0, 0x5c, 0x49, 0x29, 0x01,
+ 0x00, 0x00, 0xc0, 0x42, 0x49, 0x2a, 0x01, 0x00,
+ 0x00, 0xc0, 0x52, 0x49, 0x2b, 0x01, 0x00, 0x00,
+ 0xc0, 0x42, 0x49, 0x2c, 0x01, 0x00, 0x00, 0xc0,
+ 0x45, 0x49, 0x2d, 0x01, 0x00, 0x00, 0xc0, 0x44,
+ 0x49, 0x2e, 0x01, 0x00, 0x00, 0xc0, 0x37, 0x49,
+ 0x2f, 0x01, 0x00, 0x00, 0xc0, 0x39, 0x49, 0x30,
+ 0x01, 0x00, 0x00, 0xc0, 0x39, 0x49, 0x31, 0x01,
+ 0x00, 0x00, 0xc0, 0x4d, 0x49, 0x32, 0x01, 0x00,
+ 0x00, 0xc0, 0x58, 0x49, 0x33, 0x01, 0x00, 0x00,
+ 0xc0, 0x56, 0x49, 0x34, 0x01, 0x00, 0x00, 0xc0,
+ 0x44, 0x49, 0x35, 0x01, 0x00, 0x00, 0xc0, 0x45,
+ 0x49, 0x36, 0x01, 0x00, 0x00, 0xc0, 0x3c, 0x49,
+ 0x37, 0x01, 0x00, 0x00, 0xc0, 0x3d, 0x49, 0x38,
+ 0x01, 0x00, 0x00, 0xc0, 0x40, 0x49, 0x39, 0x01,
+ 0x00, 0x00, 0xc0, 0x41, 0x49, 0x3a, 0x01, 0x00,
+ 0x00, 0xc0, 0x40, 0x49, 0x3b, 0x01, 0x00, 0x00,
+ 0xc0, 0x41, 0x49, 0x3c, 0x01, 0x00, 0x00, 0xc0,
+ 0x3a, 0x49, 0x3d, 0x01, 0x00, 0x00, 0xc0, 0x4a,
+ 0x49, 0x3e, 0x01, 0x00, 0x00, 0xc0, 0x3b, 0x49,
+ 0x3f, 0x01, 0x00, 0x00, 0xc0, 0x47, 0x49, 0x40,
+ 0x01, 0x00, 0x00, 0xc0, 0x48, 0x49, 0x41, 0x01,
+ 0x00, 0x00, 0xc0, 0x44, 0x49, 0x42, 0x01, 0x00,
+ 0x00, 0xc0, 0x45, 0x49, 0x43, 0x01, 0x00, 0x00,
+ 0xc0, 0x3c, 0x49, 0x44, 0x01, 0x00, 0x00, 0xc0,
+ 0x3d, 0x49, 0x45, 0x01, 0x00, 0x00, 0xc0, 0x3b,
+ 0x49, 0x46, 0x01, 0x00, 0x00, 0xc0, 0x3a, 0x49,
+ 0x47, 0x01, 0x00, 0x00, 0xc0, 0x55, 0x49, 0x48,
+ 0x01, 0x00, 0x00, 0xc0, 0x41, 0x49, 0x49, 0x01,
+ 0x00, 0x00, 0xc0, 0x54, 0x49, 0x4a, 0x01, 0x00,
+ 0x00, 0xc0, 0x40, 0x49, 0x4b, 0x01, 0x00, 0x00,
+ 0xc0, 0x53, 0x49, 0x4c, 0x01, 0x00, 0x00, 0xc0,
+ 0x50, 0x49, 0x4d, 0x01, 0x00, 0x00, 0xc0, 0x4e,
+ 0x49, 0x4e, 0x01, 0x00, 0x00, 0xc0, 0x4f, 0x49,
+ 0x4f, 0x01, 0x00, 0x00, 0xc0, 0x4c, 0x49, 0x50,
+ 0x01, 0x00, 0x00, 0xc1, 0x5d, 0x09, 0xc1, 0x66,
+ 0xc0, 0x28, 0xec, 0x0e, 0xc0, 0x6b, 0xec, 0x29,
+ 0x0c, 0x43, 0x02, 0x01, 0xa2, 0x05, 0x00, 0x01,
+ 0x00, 0x04, 0x00, 0x08, 0x00, 0x9d, 0x01, 0x01,
+ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00,
+ 0x00, 0x24, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00,
+ 0x00, 0x01, 0x1a, 0x00, 0x00, 0x29, 0x00, 0x00,
+ 0xe6, 0x02, 0x02, 0x03, 0x00, 0x00, 0x25, 0x00,
+ 0x00, 0x00, 0x2a, 0x00, 0x00, 0x64, 0x00, 0x00,
+ 0x3d, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e,
+ 0x52, 0x01, 0x00, 0x00, 0x01, 0x00, 0x24, 0x00,
+ 0x00, 0xe0, 0xbb, 0x50, 0xe1, 0x64, 0x03, 0x00,
+ 0x3e, 0x53, 0x01, 0x00, 0x00, 0x02, 0x00, 0xdc,
+ 0x24, 0x01, 0x00, 0xe8, 0x3d, 0x64, 0x03, 0x00,
+ 0x3d, 0x54, 0x01, 0x00, 0x00, 0x03, 0x00, 0xe8,
+ 0x16, 0x64, 0x03, 0x00, 0x3e, 0x54, 0x01, 0x00,
+ 0x00, 0x04, 0x00, 0xdc, 0x24, 0x01, 0x00, 0xcb,
+ 0xe8, 0x05, 0xc3, 0xb3, 0x43, 0xe1, 0x64, 0x03,
+ 0x00, 0x3d, 0x55, 0x01, 0x00, 0x00, 0x05, 0x00,
+ 0xe8, 0x10, 0x64, 0x03, 0x00, 0x3e, 0x55, 0x01,
+ 0x00, 0x00, 0x06, 0x00, 0xdc, 0x24, 0x01, 0x00,
+ 0x0e, 0x64, 0x03, 0x00, 0x3e, 0x56, 0x01, 0x00,
+ 0x00, 0x07, 0x00, 0x64, 0x03, 0x00, 0x3d, 0x57,
+ 0x01, 0x00, 0x00, 0x08, 0x00, 0x5b, 0x04, 0x00,
+ 0x24, 0x02, 0x00, 0x0e, 0x38, 0x05, 0x00, 0x11,
+ 0xbb, 0x40, 0x21, 0x01, 0x00, 0x5c, 0x06, 0x00,
+ 0x64, 0x03, 0x00, 0x3e, 0x58, 0x01, 0x00, 0x00,
+ 0x09, 0x00, 0xdc, 0x5b, 0x07, 0x00, 0x24, 0x02,
+ 0x00, 0x29, 0x0c, 0x43, 0x02, 0x01, 0xb2, 0x05,
+ 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x04,
+ 0x00, 0x00, 0x2b, 0x00, 0x00, 0xdb, 0xb6, 0xed,
+ 0x29, 0x0c, 0x43, 0x02, 0x01, 0xb4, 0x05, 0x00,
+ 0x02, 0x00, 0x06, 0x00, 0x04, 0x00, 0x2c, 0x02,
+ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+ 0x00, 0x01, 0x1a, 0x00, 0x00, 0x24, 0x00, 0x00,
+ 0x00, 0x25, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00,
+ 0x64, 0x00, 0x00, 0x3e, 0x5b, 0x01, 0x00, 0x00,
+ 0x00, 0x00, 0xdc, 0xdd, 0x3d, 0x5c, 0x01, 0x00,
+ 0x00, 0x01, 0x00, 0xb3, 0xdd, 0xe7, 0x24, 0x04,
+ 0x00, 0xc7, 0xb3, 0xc8, 0xc4, 0xc3, 0xf8, 0xe8,
+ 0x0b, 0xde, 0xdd, 0xc4, 0x43, 0xed, 0x0e, 0xfa,
+ 0x01, 0xea, 0xf2, 0x29, 0x0c, 0x43, 0x02, 0x01,
+ 0xba, 0x05, 0x01, 0x00, 0x01, 0x04, 0x00, 0x04,
+ 0x00, 0x5f, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00,
+ 0x13, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00,
+ 0x22, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0xdb,
+ 0x94, 0xe8, 0x06, 0xdc, 0xcf, 0xed, 0x0e, 0x29,
+ 0xdd, 0xb3, 0xaa, 0xe8, 0x24, 0xcf, 0xbc, 0x80,
+ 0x00, 0xa4, 0xe8, 0x1d, 0xcf, 0xbc, 0xc0, 0x00,
+ 0xf8, 0xe8, 0x16, 0xde, 0xb9, 0x9e, 0xcf, 0xbb,
+ 0x3f, 0xab, 0xad, 0xe2, 0xdd, 0x8c, 0xe5, 0xb3,
+ 0xa9, 0xe8, 0x33, 0xdc, 0xde, 0xed, 0x0e, 0x29,
+ 0xcf, 0xbc, 0xc0, 0x00, 0xa4, 0xe8, 0x21, 0xcf,
+ 0xbc, 0xf8, 0x00, 0xf8, 0xe8, 0x1a, 0xb4, 0xcf,
+ 0xbc, 0xe0, 0x00, 0xa4, 0x9b, 0xcf, 0xbc, 0xf0,
+ 0x00, 0xa4, 0x9b, 0xe1, 0xcf, 0xb4, 0xb9, 0xdd,
+ 0x9c, 0x9e, 0xb4, 0x9c, 0xab, 0xe2, 0x29, 0xb3,
+ 0xe1, 0xdc, 0xcf, 0xed, 0x0e, 0x29, 0x0c, 0x43,
+ 0x02, 0x01, 0xbc, 0x05, 0x01, 0x00, 0x01, 0x02,
+ 0x00, 0x00, 0x00, 0x35, 0x01, 0x00, 0x01, 0x00,
+ 0x00, 0xcf, 0x95, 0x04, 0x4c, 0x00, 0x00, 0x00,
+ 0xa9, 0x11, 0xe8, 0x2a, 0x0e, 0xcf, 0x04, 0x5f,
+ 0x01, 0x00, 0x00, 0xa4, 0x11, 0xe8, 0x09, 0x0e,
+ 0xcf, 0x04, 0x60, 0x01, 0x00, 0x00, 0xa2, 0x11,
+ 0xe9, 0x14, 0x0e, 0xcf, 0x04, 0x61, 0x01, 0x00,
+ 0x00, 0xa4, 0x11, 0xe8, 0x09, 0x0e, 0xcf, 0x04,
+ 0x62, 0x01, 0x00, 0x00, 0xa2, 0x28, 0x0c, 0x43,
+ 0x02, 0x01, 0xc6, 0x05, 0x01, 0x00, 0x01, 0x02,
+ 0x00, 0x00, 0x02, 0x19, 0x01, 0x00, 0x01, 0x00,
+ 0x00, 0xcf, 0x95, 0x04, 0x4c, 0x00, 0x00, 0x00,
+ 0xa9, 0x11, 0xe8, 0x0e, 0x0e, 0xcf, 0xbd, 0x00,
+ 0xa4, 0x11, 0xe8, 0x06, 0x0e, 0xcf, 0xbd, 0x01,
+ 0xa2, 0x28, 0x07, 0x02, 0x30, 0x07, 0x02, 0x39,
+ 0x0c, 0x43, 0x02, 0x01, 0xc8, 0x05, 0x01, 0x00,
+ 0x01, 0x02, 0x00, 0x02, 0x00, 0x2d, 0x01, 0x00,
+ 0x01, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00,
+ 0x2d, 0x00, 0x00, 0xcf, 0x95, 0x04, 0x4c, 0x00,
+ 0x00, 0x00, 0xa9, 0x11, 0xe8, 0x22, 0x0e, 0xdb,
+ 0xcf, 0xed, 0x11, 0xe9, 0x1b, 0x0e, 0xdc, 0xcf,
+ 0xed, 0x11, 0xe9, 0x14, 0x0e, 0xcf, 0x04, 0x65,
+ 0x01, 0x00, 0x00, 0xa7, 0x11, 0xe9, 0x09, 0x0e,
+ 0xcf, 0x04, 0x66, 0x01, 0x00, 0x00, 0xa7, 0x28,
+ 0x0c, 0x43, 0x02, 0x01, 0xce, 0x05, 0x01, 0x04,
+ 0x01, 0x03, 0x00, 0x00, 0x00, 0x34, 0x05, 0x00,
+ 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+ 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+ 0x03, 0x00, 0x00, 0xcf, 0xe7, 0xca, 0xb3, 0xc7,
+ 0xb3, 0xc9, 0xc5, 0xc6, 0xf8, 0xe8, 0x27, 0xcf,
+ 0x3e, 0x68, 0x01, 0x00, 0x00, 0x00, 0x00, 0xc5,
+ 0x24, 0x01, 0x00, 0xcc, 0x01, 0x00, 0xdc, 0x00,
+ 0x00, 0xa1, 0x11, 0xe9, 0x09, 0x0e, 0xc4, 0x01,
+ 0x00, 0xe0, 0x00, 0x00, 0xa4, 0xe8, 0x03, 0x91,
+ 0x00, 0xfa, 0x02, 0xea, 0xd6, 0xc3, 0x28, 0x0c,
+ 0x43, 0x02, 0x01, 0xd2, 0x05, 0x01, 0x01, 0x01,
+ 0x03, 0x00, 0x00, 0x00, 0x2b, 0x02, 0x00, 0x01,
+ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x95,
+ 0x04, 0x4c, 0x00, 0x00, 0x00, 0xaa, 0xe8, 0x03,
+ 0x09, 0x28, 0xcf, 0x3e, 0x6a, 0x01, 0x00, 0x00,
+ 0x00, 0x00, 0xb3, 0x24, 0x01, 0x00, 0xcb, 0x01,
+ 0x00, 0xdc, 0x00, 0x00, 0xa4, 0x11, 0xe8, 0x09,
+ 0x0e, 0xc3, 0x01, 0x00, 0xe0, 0x00, 0x00, 0xa1,
+ 0x28, 0x0c, 0x43, 0x02, 0x01, 0xd6, 0x05, 0x02,
+ 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x23, 0x02,
+ 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+ 0xcf, 0xd0, 0x9b, 0x11, 0x04, 0x6c, 0x01, 0x00,
+ 0x00, 0xa9, 0xe9, 0x13, 0x11, 0x04, 0x6d, 0x01,
+ 0x00, 0x00, 0xa9, 0xe9, 0x0a, 0x11, 0x04, 0x6e,
+ 0x01, 0x00, 0x00, 0xa9, 0xe8, 0x03, 0x0a, 0x28,
+ 0x0e, 0x09, 0x28, 0x0c, 0x43, 0x02, 0x01, 0xde,
+ 0x05, 0x03, 0x03, 0x03, 0x06, 0x00, 0x03, 0x00,
+ 0x6b, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+ 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+ 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02,
+ 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x07,
+ 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0xd0, 0xc8,
+ 0xc4, 0xcf, 0xe7, 0xf8, 0xe8, 0x63, 0xd1, 0xc4,
+ 0xcb, 0x43, 0xc9, 0xc4, 0x8d, 0xcc, 0xcf, 0xe7,
+ 0xf8, 0xe8, 0x08, 0xd1, 0xc4, 0x43, 0xc5, 0xa7,
+ 0xe9, 0xf2, 0x64, 0x00, 0x00, 0x3e, 0x70, 0x01,
+ 0x00, 0x00, 0x00, 0x00, 0xdc, 0xdd, 0xc5, 0x43,
+ 0x11, 0xe9, 0x07, 0x0e, 0x04, 0x16, 0x00, 0x00,
+ 0x00, 0x43, 0x24, 0x01, 0x00, 0x0e, 0x64, 0x00,
+ 0x00, 0x3e, 0x70, 0x01, 0x00, 0x00, 0x01, 0x00,
+ 0xcf, 0x3e, 0x71, 0x01, 0x00, 0x00, 0x02, 0x00,
+ 0xfb, 0xc4, 0x24, 0x02, 0x00, 0x24, 0x01, 0x00,
+ 0x0e, 0x64, 0x00, 0x00, 0x3e, 0x70, 0x01, 0x00,
+ 0x00, 0x03, 0x00, 0xdc, 0x04, 0xf5, 0x00, 0x00,
+ 0x00, 0x43, 0x24, 0x01, 0x00, 0x0e, 0xea, 0x99,
+ 0x29, 0x0c, 0x43, 0x02, 0x01, 0xe4, 0x05, 0x02,
+ 0x00, 0x02, 0x05, 0x00, 0x01, 0x00, 0x1f, 0x02,
+ 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+ 0x00, 0x00, 0x1a, 0x00, 0x64, 0x00, 0x00, 0x3e,
+ 0x70, 0x01, 0x00, 0x00, 0x00, 0x00, 0x04, 0x73,
+ 0x01, 0x00, 0x00, 0xcf, 0xb4, 0xa8, 0xe8, 0x04,
+ 0xcf, 0xea, 0x02, 0xbf, 0x9b, 0xd0, 0x9b, 0x24,
+ 0x01, 0x00, 0x29, 0x0c, 0x43, 0x02, 0x01, 0xe8,
+ 0x05, 0x01, 0x02, 0x01, 0x04, 0x00, 0x05, 0x00,
+ 0xa7, 0x01, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00,
+ 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+ 0x27, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00,
+ 0x00, 0x1a, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+ 0x33, 0x00, 0x00, 0xcf, 0xb3, 0xf9, 0xe8, 0x51,
+ 0xcf, 0xb3, 0xa8, 0x68, 0x9d, 0x00, 0x00, 0x00,
+ 0xdb, 0xdc, 0xb4, 0x9c, 0xa7, 0xe8, 0x1b, 0x64,
+ 0x02, 0x00, 0x3e, 0x70, 0x01, 0x00, 0x00, 0x00,
+ 0x00, 0x04, 0x2a, 0x01, 0x00, 0x00, 0x24, 0x01,
+ 0x00, 0x0e, 0xb3, 0xdf, 0xcf, 0x8c, 0xd3, 0xea,
+ 0xd8, 0xde, 0x3e, 0x75, 0x01, 0x00, 0x00, 0x01,
+ 0x00, 0xdc, 0xb4, 0x9c, 0xdb, 0x9c, 0xcf, 0x24,
+ 0x02, 0x00, 0xc8, 0x5b, 0x04, 0x00, 0xc4, 0x04,
+ 0x76, 0x01, 0x00, 0x00, 0xee, 0x0e, 0xcf, 0xc4,
+ 0x9c, 0xd3, 0xdb, 0xc4, 0x9b, 0xdf, 0xea, 0xb1,
+ 0xcf, 0x8a, 0xd3, 0xcf, 0xb3, 0xa8, 0xe8, 0x4a,
+ 0xdb, 0xb3, 0xa7, 0xe8, 0x22, 0x5b, 0x04, 0x00,
+ 0xb4, 0x04, 0x5f, 0x01, 0x00, 0x00, 0xee, 0x0e,
+ 0x5b, 0x04, 0x00, 0xdc, 0xb4, 0x9c, 0x04, 0x76,
+ 0x01, 0x00, 0x00, 0xee, 0x0e, 0xcf, 0x8c, 0xd3,
+ 0xdc, 0xb4, 0x9c, 0xdf, 0xea, 0xd6, 0xde, 0x3e,
+ 0x75, 0x01, 0x00, 0x00, 0x02, 0x00, 0xcf, 0xdb,
+ 0x24, 0x02, 0x00, 0xc8, 0x5b, 0x04, 0x00, 0xc4,
+ 0x04, 0x77, 0x01, 0x00, 0x00, 0xee, 0x0e, 0xcf,
+ 0xc4, 0x9c, 0xd3, 0xdb, 0xc4, 0x9c, 0xdf, 0xea,
+ 0xb3, 0x29, 0x0c, 0x43, 0x02, 0x01, 0xf0, 0x05,
+ 0x00, 0x05, 0x00, 0x06, 0x00, 0x0d, 0x00, 0xb4,
+ 0x02, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+ 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03,
+ 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x1a,
+ 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x15,
+ 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x00,
+ 0x1a, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x2f,
+ 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x73,
+ 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x27,
+ 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x1b,
+ 0x00, 0x00, 0xdb, 0xdc, 0xa8, 0x68, 0xd6, 0x00,
+ 0x00, 0x00, 0xdd, 0x94, 0xe8, 0x3a, 0xdc, 0x3e,
+ 0x71, 0x01, 0x00, 0x00, 0x00, 0x00, 0xb3, 0xde,
+ 0x24, 0x02, 0x00, 0xdb, 0x3e, 0x71, 0x01, 0x00,
+ 0x00, 0x01, 0x00, 0xb3, 0xde, 0x24, 0x02, 0x00,
+ 0xa7, 0xe8, 0x1d, 0x64, 0x04, 0x00, 0x3e, 0x70,
+ 0x01, 0x00, 0x00, 0x02, 0x00, 0xdb, 0x3e, 0x71,
+ 0x01, 0x00, 0x00, 0x03, 0x00, 0xde, 0x24, 0x01,
+ 0x00, 0x24, 0x01, 0x00, 0x0e, 0xea, 0x57, 0x5b,
+ 0x05, 0x00, 0x5b, 0x06, 0x00, 0xdc, 0x3e, 0x71,
+ 0x01, 0x00, 0x00, 0x04, 0x00, 0xb3, 0xde, 0x24,
+ 0x02, 0x00, 0xed, 0x8a, 0xed, 0x0e, 0xdd, 0xe8,
+ 0x2e, 0x5b, 0x07, 0x00, 0xe8, 0x0e, 0x5b, 0x07,
+ 0x00, 0x04, 0x2a, 0x01, 0x00, 0x00, 0x9b, 0xdb,
+ 0x9b, 0xea, 0x02, 0xdb, 0xcd, 0xe7, 0xdb, 0xe7,
+ 0x9c, 0xca, 0x5b, 0x08, 0x00, 0xc5, 0xed, 0xc1,
+ 0x04, 0x5b, 0x09, 0x00, 0xc5, 0xc6, 0xc0, 0x04,
+ 0xb5, 0x43, 0xef, 0x0e, 0xea, 0x10, 0x64, 0x04,
+ 0x00, 0x3e, 0x70, 0x01, 0x00, 0x00, 0x05, 0x00,
+ 0xdb, 0x24, 0x01, 0x00, 0x0e, 0x5b, 0x0a, 0x00,
+ 0x5b, 0x06, 0x00, 0xdb, 0xed, 0x9b, 0x5b, 0x0b,
+ 0x00, 0x9a, 0x5d, 0x0a, 0x00, 0xb3, 0xa7, 0xe8,
+ 0x14, 0x64, 0x04, 0x00, 0x3e, 0x70, 0x01, 0x00,
+ 0x00, 0x06, 0x00, 0x04, 0x79, 0x01, 0x00, 0x00,
+ 0x24, 0x01, 0x00, 0x0e, 0x64, 0x04, 0x00, 0x3e,
+ 0x70, 0x01, 0x00, 0x00, 0x07, 0x00, 0x04, 0x7a,
+ 0x01, 0x00, 0x00, 0x24, 0x01, 0x00, 0x0e, 0xdb,
+ 0xe0, 0xdb, 0xe7, 0xe2, 0x5b, 0x0c, 0x00, 0xde,
+ 0xf9, 0xe8, 0x1b, 0x5b, 0x05, 0x00, 0x5b, 0x06,
+ 0x00, 0xdb, 0x3e, 0x71, 0x01, 0x00, 0x00, 0x08,
+ 0x00, 0xde, 0x5b, 0x0c, 0x00, 0x24, 0x02, 0x00,
+ 0xed, 0xed, 0x0e, 0xea, 0x21, 0x5b, 0x0c, 0x00,
+ 0xde, 0xf8, 0xe8, 0x1a, 0x5b, 0x05, 0x00, 0x5b,
+ 0x06, 0x00, 0xdb, 0x3e, 0x71, 0x01, 0x00, 0x00,
+ 0x09, 0x00, 0x5b, 0x0c, 0x00, 0xde, 0x24, 0x02,
+ 0x00, 0xed, 0x8a, 0xed, 0x0e, 0x5b, 0x0c, 0x00,
+ 0xe2, 0x64, 0x04, 0x00, 0x3d, 0x7b, 0x01, 0x00,
+ 0x00, 0x0a, 0x00, 0x3e, 0x7c, 0x01, 0x00, 0x00,
+ 0x0b, 0x00, 0x24, 0x00, 0x00, 0x29, 0x0c, 0x43,
+ 0x02, 0x01, 0xfa, 0x05, 0x01, 0x00, 0x01, 0x04,
+ 0x00, 0x02, 0x00, 0x26, 0x01, 0x00, 0x01, 0x00,
+ 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x1b, 0x00,
+ 0x00, 0xcf, 0xe8, 0x23, 0xdb, 0x3e, 0x71, 0x01,
+ 0x00, 0x00, 0x00, 0x00, 0xb3, 0xdc, 0x24, 0x02,
+ 0x00, 0xcf, 0x9b, 0xdb, 0x3e, 0x71, 0x01, 0x00,
+ 0x00, 0x01, 0x00, 0xdc, 0x24, 0x01, 0x00, 0x9b,
+ 0xdf, 0xdc, 0xcf, 0xe7, 0x9b, 0xe0, 0x29, 0x0c,
+ 0x43, 0x02, 0x01, 0xfc, 0x05, 0x00, 0x00, 0x00,
+ 0x01, 0x00, 0x01, 0x00, 0x03, 0x00, 0x00, 0x21,
+ 0x00, 0x00, 0x0a, 0xdf, 0x29, 0x0c, 0x43, 0x02,
+ 0x01, 0xfe, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00,
+ 0x02, 0x00, 0x07, 0x00, 0x00, 0x1a, 0x00, 0x00,
+ 0x00, 0x1b, 0x00, 0x00, 0xbf, 0xdf, 0xb3, 0xe0,
+ 0xbb, 0xfe, 0x28, 0x0c, 0x43, 0x02, 0x01, 0x80,
+ 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+ 0x01, 0x00, 0x29, 0x0c, 0x43, 0x02, 0x01, 0x82,
+ 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00,
+ 0x03, 0x00, 0x00, 0x1b, 0x00, 0x00, 0xb3, 0xdf,
+ 0x29, 0x0c, 0x43, 0x02, 0x01, 0x84, 0x06, 0x00,
+ 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x04, 0x00,
+ 0x00, 0x1a, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00,
+ 0xdb, 0xe7, 0xe0, 0x29, 0x0c, 0x43, 0x02, 0x01,
+ 0x86, 0x06, 0x00, 0x00, 0x00, 0x04, 0x00, 0x03,
+ 0x00, 0x1f, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00,
+ 0x1a, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0xdb,
+ 0xdc, 0xe7, 0xf8, 0xe8, 0x19, 0xdb, 0x8d, 0xdf,
+ 0xdd, 0xdc, 0x3e, 0x84, 0x01, 0x00, 0x00, 0x00,
+ 0x00, 0xdb, 0x24, 0x01, 0x00, 0xed, 0xe8, 0x06,
+ 0xdb, 0x8d, 0xdf, 0xea, 0xec, 0x29, 0x0c, 0x43,
+ 0x02, 0x01, 0x8a, 0x06, 0x00, 0x00, 0x00, 0x04,
+ 0x00, 0x03, 0x00, 0x1e, 0x00, 0x00, 0x1b, 0x00,
+ 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x1a, 0x00,
+ 0x00, 0xdb, 0xb3, 0xf9, 0xe8, 0x19, 0xdb, 0x8c,
+ 0xdf, 0xdc, 0xdd, 0x3e, 0x84, 0x01, 0x00, 0x00,
+ 0x00, 0x00, 0xdb, 0x24, 0x01, 0x00, 0xed, 0xe8,
+ 0x06, 0xdb, 0x8c, 0xdf, 0xea, 0xec, 0x29, 0x0c,
+ 0x43, 0x02, 0x01, 0x8c, 0x06, 0x01, 0x00, 0x01,
+ 0x04, 0x00, 0x02, 0x00, 0x39, 0x01, 0x00, 0x01,
+ 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x2e,
+ 0x00, 0x00, 0xcf, 0xdb, 0xe7, 0xf8, 0xe8, 0x17,
+ 0xdc, 0xdb, 0x3e, 0x84, 0x01, 0x00, 0x00, 0x00,
+ 0x00, 0xcf, 0x24, 0x01, 0x00, 0xed, 0x94, 0xe8,
+ 0x06, 0xcf, 0x8d, 0xd3, 0xea, 0xe5, 0xcf, 0xdb,
+ 0xe7, 0xf8, 0xe8, 0x16, 0xdc, 0xdb, 0x3e, 0x84,
+ 0x01, 0x00, 0x00, 0x01, 0x00, 0xcf, 0x24, 0x01,
+ 0x00, 0xed, 0xe8, 0x06, 0xcf, 0x8d, 0xd3, 0xea,
+ 0xe6, 0xcf, 0x28, 0x0c, 0x43, 0x02, 0x01, 0x8e,
+ 0x06, 0x01, 0x00, 0x01, 0x05, 0x00, 0x02, 0x00,
+ 0x3b, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2e,
+ 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0xcf, 0xb3,
+ 0xf9, 0xe8, 0x19, 0xdb, 0xdc, 0x3e, 0x84, 0x01,
+ 0x00, 0x00, 0x00, 0x00, 0xcf, 0xb4, 0x9c, 0x24,
+ 0x01, 0x00, 0xed, 0x94, 0xe8, 0x06, 0xcf, 0x8c,
+ 0xd3, 0xea, 0xe4, 0xcf, 0xb3, 0xf9, 0xe8, 0x18,
+ 0xdb, 0xdc, 0x3e, 0x84, 0x01, 0x00, 0x00, 0x01,
+ 0x00, 0xcf, 0xb4, 0x9c, 0x24, 0x01, 0x00, 0xed,
+ 0xe8, 0x06, 0xcf, 0x8c, 0xd3, 0xea, 0xe5, 0xcf,
+ 0x28, 0x0c, 0x43, 0x02, 0x01, 0x90, 0x06, 0x00,
+ 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x05, 0x00,
+ 0x00, 0x3e, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00,
+ 0xdb, 0xdc, 0xed, 0xe0, 0x29, 0x0c, 0x43, 0x02,
+ 0x01, 0x92, 0x06, 0x00, 0x00, 0x00, 0x02, 0x00,
+ 0x02, 0x00, 0x05, 0x00, 0x00, 0x3f, 0x00, 0x00,
+ 0x00, 0x1b, 0x00, 0x00, 0xdb, 0xdc, 0xed, 0xe0,
+ 0x29, 0x0c, 0x43, 0x02, 0x01, 0x94, 0x06, 0x00,
+ 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x19, 0x00,
+ 0x00, 0x00, 0x1a, 0x00, 0x00, 0x43, 0x00, 0x00,
+ 0x00, 0x1a, 0x00, 0x00, 0x64, 0x00, 0x00, 0x3e,
+ 0x70, 0x01, 0x00, 0x00, 0x00, 0x00, 0x04, 0x2a,
+ 0x01, 0x00, 0x00, 0x24, 0x01, 0x00, 0x0e, 0xdc,
+ 0xdd, 0xed, 0x0e, 0xb2, 0x28, 0x0c, 0x43, 0x02,
+ 0x01, 0x96, 0x06, 0x01, 0x00, 0x01, 0x03, 0x00,
+ 0x02, 0x00, 0x14, 0x01, 0x00, 0x01, 0x00, 0x00,
+ 0x00, 0x09, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00,
+ 0xcf, 0xe8, 0x0e, 0xdb, 0x3e, 0x8c, 0x01, 0x00,
+ 0x00, 0x00, 0x00, 0xcf, 0x24, 0x01, 0x00, 0x0e,
+ 0xdb, 0xe7, 0xe0, 0x29, 0x0c, 0x43, 0x02, 0x01,
+ 0x9a, 0x06, 0x00, 0x00, 0x00, 0x03, 0x00, 0x04,
+ 0x00, 0x22, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
+ 0x09, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00,
+ 0x1b, 0x00, 0x00, 0xdb, 0xb3, 0xf9, 0xe8, 0x1d,
+ 0xdb, 0xdc, 0xe7, 0xa7, 0xe8, 0x0e, 0xdc, 0x3e,
+ 0x8c, 0x01, 0x00, 0x00, 0x00, 0x00, 0xdd, 0x24,
+ 0x01, 0x00, 0x0e, 0xdb, 0x8c, 0xdf, 0xdc, 0xdb,
+ 0x43, 0xe5, 0xe7, 0xe2, 0x29, 0x0c, 0x43, 0x02,
+ 0x01, 0x9c, 0x06, 0x00, 0x00, 0x00, 0x03, 0x00,
+ 0x04, 0x00, 0x12, 0x00, 0x00, 0x1e, 0x00, 0x00,
+ 0x00, 0x09, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00,
+ 0x00, 0x1b, 0x00, 0x00, 0xdb, 0xdc, 0xe7, 0xb4,
+ 0x9c, 0xf8, 0xe8, 0x0a, 0xdb, 0x8d, 0xdf, 0xdc,
+ 0xdb, 0x43, 0xe5, 0xe7, 0xe2, 0x29, 0x0c, 0x43,
+ 0x02, 0x01, 0x9e, 0x06, 0x01, 0x03, 0x01, 0x05,
+ 0x00, 0x04, 0x00, 0x41, 0x04, 0x00, 0x01, 0x00,
+ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+ 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x1b, 0x00,
+ 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x1e, 0x00,
+ 0x00, 0x00, 0x1a, 0x00, 0x00, 0xdb, 0xc7, 0xb4,
+ 0xc8, 0xc4, 0xdc, 0xe7, 0xa2, 0xe8, 0x37, 0xdc,
+ 0xe7, 0xc4, 0xcf, 0x98, 0x9b, 0xdd, 0x9b, 0xdc,
+ 0xe7, 0x9a, 0xc9, 0xdc, 0xc5, 0x43, 0x3e, 0x71,
+ 0x01, 0x00, 0x00, 0x00, 0x00, 0xb3, 0xc3, 0x24,
+ 0x02, 0x00, 0xde, 0x3e, 0x71, 0x01, 0x00, 0x00,
+ 0x01, 0x00, 0xb3, 0xc3, 0x24, 0x02, 0x00, 0xa7,
+ 0xe8, 0x08, 0xc5, 0xe1, 0xdc, 0xc5, 0x43, 0xe2,
+ 0x29, 0xfa, 0x01, 0xea, 0xc5, 0x29, 0x0c, 0x43,
+ 0x02, 0x01, 0xa0, 0x06, 0x00, 0x00, 0x00, 0x02,
+ 0x00, 0x01, 0x00, 0x05, 0x00, 0x00, 0x46, 0x00,
+ 0x00, 0xdb, 0xb2, 0x23, 0x01, 0x00, 0x0c, 0x43,
+ 0x02, 0x01, 0xa2, 0x06, 0x00, 0x00, 0x00, 0x02,
+ 0x00, 0x01, 0x00, 0x05, 0x00, 0x00, 0x46, 0x00,
+ 0x00, 0xdb, 0xb4, 0x23, 0x01, 0x00, 0x0c, 0x43,
+ 0x02, 0x01, 0xa4, 0x06, 0x01, 0x02, 0x01, 0x04,
+ 0x00, 0x05, 0x00, 0x6e, 0x03, 0x00, 0x01, 0x00,
+ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+ 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x30, 0x00,
+ 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x20, 0x00,
+ 0x00, 0x00, 0x51, 0x00, 0x00, 0xdb, 0xc7, 0xcf,
+ 0xb3, 0xf8, 0xe8, 0x17, 0x90, 0x00, 0xdc, 0xdd,
+ 0x3e, 0x84, 0x01, 0x00, 0x00, 0x00, 0x00, 0xc3,
+ 0x24, 0x01, 0x00, 0xed, 0xe8, 0x05, 0x90, 0x00,
+ 0xea, 0xed, 0xc3, 0xb4, 0x9b, 0xc8, 0xdc, 0xdd,
+ 0x3e, 0x84, 0x01, 0x00, 0x00, 0x01, 0x00, 0xc4,
+ 0x24, 0x01, 0x00, 0xed, 0xe8, 0x05, 0xfa, 0x01,
+ 0xea, 0xed, 0xc3, 0xb3, 0xa4, 0xe8, 0x34, 0xc3,
+ 0xdd, 0xe7, 0xf8, 0xe8, 0x2e, 0xde, 0x5b, 0x04,
+ 0x00, 0xa9, 0xe8, 0x0a, 0x5b, 0x04, 0x00, 0xfb,
+ 0xc4, 0xcf, 0xef, 0x0e, 0x29, 0xdd, 0x3e, 0x71,
+ 0x01, 0x00, 0x00, 0x02, 0x00, 0xb3, 0xc3, 0x24,
+ 0x02, 0x00, 0xdd, 0x3e, 0x71, 0x01, 0x00, 0x00,
+ 0x03, 0x00, 0xc4, 0x24, 0x01, 0x00, 0x9b, 0xe1,
+ 0xc3, 0xdf, 0x29, 0x0c, 0x43, 0x02, 0x01, 0xa6,
+ 0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00,
+ 0x04, 0x00, 0x00, 0x49, 0x00, 0x00, 0xdb, 0xb4,
+ 0xed, 0x29, 0x0c, 0x43, 0x02, 0x01, 0xa8, 0x06,
+ 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x21,
+ 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x1a,
+ 0x00, 0x00, 0x49, 0x00, 0x00, 0xdb, 0xe7, 0xb3,
+ 0xa7, 0xe8, 0x17, 0x64, 0x01, 0x00, 0x3e, 0x70,
+ 0x01, 0x00, 0x00, 0x00, 0x00, 0x04, 0x2a, 0x01,
+ 0x00, 0x00, 0x24, 0x01, 0x00, 0x0e, 0xbb, 0xfd,
+ 0x28, 0xdd, 0xb4, 0xed, 0x0e, 0x29, 0x0c, 0x43,
+ 0x02, 0x01, 0xaa, 0x06, 0x00, 0x00, 0x00, 0x02,
+ 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x49, 0x00,
+ 0x00, 0xdb, 0xb2, 0xed, 0x29, 0x0c, 0x43, 0x02,
+ 0x01, 0xac, 0x06, 0x00, 0x01, 0x00, 0x06, 0x00,
+ 0x02, 0x00, 0x59, 0x01, 0x00, 0x00, 0x00, 0x00,
+ 0x00, 0x1b, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00,
+ 0xdb, 0xc7, 0xdc, 0xe7, 0xb4, 0xf9, 0xe8, 0x51,
+ 0xc3, 0xb3, 0xf9, 0xe8, 0x4c, 0xc3, 0xdc, 0xe7,
+ 0xa7, 0xe8, 0x03, 0x90, 0x00, 0xdc, 0x3e, 0x71,
+ 0x01, 0x00, 0x00, 0x00, 0x00, 0xb3, 0xc3, 0xb4,
+ 0x9c, 0x24, 0x02, 0x00, 0xdc, 0x3e, 0x71, 0x01,
+ 0x00, 0x00, 0x01, 0x00, 0xc3, 0xc3, 0xb4, 0x9b,
+ 0x24, 0x02, 0x00, 0x9b, 0xdc, 0x3e, 0x71, 0x01,
+ 0x00, 0x00, 0x02, 0x00, 0xc3, 0xb4, 0x9c, 0xc3,
+ 0x24, 0x02, 0x00, 0x9b, 0xdc, 0x3e, 0x71, 0x01,
+ 0x00, 0x00, 0x03, 0x00, 0xc3, 0xb4, 0x9b, 0x24,
+ 0x01, 0x00, 0x9b, 0xe0, 0xc3, 0xb4, 0x9b, 0xdf,
+ 0x29, 0x0c, 0x43, 0x02, 0x01, 0xae, 0x06, 0x00,
+ 0x04, 0x00, 0x05, 0x00, 0x04, 0x00, 0x5f, 0x04,
+ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+ 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+ 0x00, 0x3f, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00,
+ 0x00, 0x3e, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00,
+ 0xdb, 0xdc, 0xed, 0xc7, 0xdd, 0xc3, 0xed, 0xc8,
+ 0xdd, 0xdc, 0xed, 0xc9, 0xdb, 0xc5, 0xed, 0xca,
+ 0xfb, 0xc4, 0xf8, 0xe8, 0x4a, 0xc4, 0xdc, 0xa2,
+ 0xe8, 0x45, 0xdc, 0xc6, 0xa2, 0xe8, 0x40, 0xc6,
+ 0xc5, 0xf8, 0xe8, 0x3b, 0xde, 0x3e, 0x71, 0x01,
+ 0x00, 0x00, 0x00, 0x00, 0xb3, 0xc3, 0x24, 0x02,
+ 0x00, 0xde, 0x3e, 0x71, 0x01, 0x00, 0x00, 0x01,
+ 0x00, 0xc6, 0xc5, 0x24, 0x02, 0x00, 0x9b, 0xde,
+ 0x3e, 0x71, 0x01, 0x00, 0x00, 0x02, 0x00, 0xc4,
+ 0xc6, 0x24, 0x02, 0x00, 0x9b, 0xde, 0x3e, 0x71,
+ 0x01, 0x00, 0x00, 0x03, 0x00, 0xfb, 0xc4, 0x24,
+ 0x02, 0x00, 0x9b, 0xe2, 0xc5, 0xe0, 0x29, 0x0c,
+ 0x43, 0x02, 0x01, 0xb0, 0x06, 0x00, 0x01, 0x00,
+ 0x05, 0x00, 0x03, 0x00, 0x38, 0x01, 0x00, 0x00,
+ 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x1b,
+ 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0xdb, 0xdc,
+ 0xed, 0xc7, 0xdd, 0x3e, 0x71, 0x01, 0x00, 0x00,
+ 0x00, 0x00, 0xb3, 0xdc, 0x24, 0x02, 0x00, 0xdd,
+ 0x3e, 0x71, 0x01, 0x00, 0x00, 0x01, 0x00, 0xdc,
+ 0xc3, 0x24, 0x02, 0x00, 0x3e, 0x99, 0x01, 0x00,
+ 0x00, 0x02, 0x00, 0x24, 0x00, 0x00, 0x9b, 0xdd,
+ 0x3e, 0x71, 0x01, 0x00, 0x00, 0x03, 0x00, 0xc3,
+ 0x24, 0x01, 0x00, 0x9b, 0xe1, 0x29, 0x0c, 0x43,
+ 0x02, 0x01, 0xb4, 0x06, 0x00, 0x01, 0x00, 0x05,
+ 0x00, 0x03, 0x00, 0x38, 0x01, 0x00, 0x00, 0x00,
+ 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x1b, 0x00,
+ 0x00, 0x00, 0x1a, 0x00, 0x00, 0xdb, 0xdc, 0xed,
+ 0xc7, 0xdd, 0x3e, 0x71, 0x01, 0x00, 0x00, 0x00,
+ 0x00, 0xb3, 0xdc, 0x24, 0x02, 0x00, 0xdd, 0x3e,
+ 0x71, 0x01, 0x00, 0x00, 0x01, 0x00, 0xdc, 0xc3,
+ 0x24, 0x02, 0x00, 0x3e, 0x9b, 0x01, 0x00, 0x00,
+ 0x02, 0x00, 0x24, 0x00, 0x00, 0x9b, 0xdd, 0x3e,
+ 0x71, 0x01, 0x00, 0x00, 0x03, 0x00, 0xc3, 0x24,
+ 0x01, 0x00, 0x9b, 0xe1, 0x29, 0x0c, 0x43, 0x02,
+ 0x01, 0xb8, 0x06, 0x03, 0x01, 0x03, 0x04, 0x00,
+ 0x06, 0x00, 0x64, 0x04, 0x00, 0x01, 0x00, 0x00,
+ 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00,
+ 0x00, 0x20, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00,
+ 0x00, 0x0a, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00,
+ 0x00, 0x1f, 0x00, 0x00, 0xdb, 0x3e, 0x71, 0x01,
+ 0x00, 0x00, 0x00, 0x00, 0xcf, 0xd0, 0x24, 0x02,
+ 0x00, 0xc7, 0xdc, 0xdd, 0xaa, 0xe8, 0x05, 0xc3,
+ 0xe2, 0xea, 0x10, 0xd1, 0xb3, 0xf8, 0xe8, 0x07,
+ 0xc3, 0xde, 0x9b, 0xe2, 0xea, 0x05, 0xde, 0xc3,
+ 0x9b, 0xe2, 0xdb, 0x3e, 0x71, 0x01, 0x00, 0x00,
+ 0x01, 0x00, 0xb3, 0xcf, 0x24, 0x02, 0x00, 0xdb,
+ 0x3e, 0x71, 0x01, 0x00, 0x00, 0x02, 0x00, 0xd0,
+ 0x24, 0x01, 0x00, 0x9b, 0xdf, 0x5b, 0x04, 0x00,
+ 0xd0, 0xf9, 0xe8, 0x0d, 0x5b, 0x04, 0x00, 0xd0,
+ 0xcf, 0x9c, 0x9c, 0x5c, 0x04, 0x00, 0xea, 0x0c,
+ 0x5b, 0x04, 0x00, 0xcf, 0xf9, 0xe8, 0x05, 0xcf,
+ 0x5c, 0x04, 0x00, 0xdd, 0x5c, 0x05, 0x00, 0x29,
+ 0x0c, 0x43, 0x02, 0x01, 0xba, 0x06, 0x00, 0x00,
+ 0x00, 0x04, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00,
+ 0x51, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00,
+ 0x1a, 0x00, 0x00, 0xdb, 0xdc, 0xdd, 0xe7, 0xb4,
+ 0xef, 0x29, 0x0c, 0x43, 0x02, 0x01, 0xbc, 0x06,
+ 0x00, 0x00, 0x00, 0x04, 0x00, 0x02, 0x00, 0x06,
+ 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0x1b, 0x00,
+ 0x00, 0xdb, 0xb3, 0xdc, 0xb2, 0xef, 0x29, 0x0c,
+ 0x43, 0x02, 0x01, 0xbe, 0x06, 0x00, 0x00, 0x00,
+ 0x04, 0x00, 0x03, 0x00, 0x08, 0x00, 0x00, 0x51,
+ 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x3e,
+ 0x00, 0x00, 0xdb, 0xdc, 0xdd, 0xdc, 0xed, 0xb4,
+ 0xef, 0x29, 0x0c, 0x43, 0x02, 0x01, 0xc0, 0x06,
+ 0x00, 0x00, 0x00, 0x04, 0x00, 0x03, 0x00, 0x08,
+ 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0x3f, 0x00,
+ 0x00, 0x00, 0x1b, 0x00, 0x00, 0xdb, 0xdc, 0xdd,
+ 0xed, 0xdd, 0xb2, 0xef, 0x29, 0x0c, 0x43, 0x02,
+ 0x01, 0xc2, 0x06, 0x00, 0x00, 0x00, 0x02, 0x00,
+ 0x02, 0x00, 0x04, 0x00, 0x00, 0x36, 0x00, 0x00,
+ 0x00, 0x0a, 0x00, 0x00, 0xdb, 0xdc, 0xed, 0x29,
+ 0x0c, 0x43, 0x02, 0x01, 0xc4, 0x06, 0x00, 0x00,
+ 0x00, 0x03, 0x00, 0x04, 0x00, 0x3f, 0x00, 0x00,
+ 0x20, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00,
+ 0x00, 0x1a, 0x00, 0x00, 0x62, 0x00, 0x00, 0xdb,
+ 0xdc, 0xa9, 0xe8, 0x24, 0x64, 0x02, 0x00, 0x3e,
+ 0x70, 0x01, 0x00, 0x00, 0x00, 0x00, 0x04, 0x2a,
+ 0x01, 0x00, 0x00, 0x24, 0x01, 0x00, 0x0e, 0x64,
+ 0x02, 0x00, 0x3e, 0xa3, 0x01, 0x00, 0x00, 0x01,
+ 0x00, 0xb3, 0x24, 0x01, 0x00, 0x0e, 0x29, 0x64,
+ 0x02, 0x00, 0x3e, 0x70, 0x01, 0x00, 0x00, 0x02,
+ 0x00, 0x04, 0xa4, 0x01, 0x00, 0x00, 0x24, 0x01,
+ 0x00, 0x0e, 0xde, 0xec, 0x0e, 0x29, 0x0c, 0x43,
+ 0x02, 0x01, 0xca, 0x06, 0x00, 0x00, 0x00, 0x01,
+ 0x00, 0x02, 0x00, 0x05, 0x00, 0x00, 0x1a, 0x00,
+ 0x00, 0x00, 0x1b, 0x00, 0x00, 0xbf, 0xdf, 0xb3,
+ 0xe0, 0x29, 0x0c, 0x43, 0x02, 0x01, 0xcc, 0x06,
+ 0x02, 0x01, 0x02, 0x04, 0x00, 0x01, 0x00, 0x1d,
+ 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00,
+ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x00,
+ 0x00, 0xbf, 0xc7, 0xd0, 0xb3, 0xf9, 0xe8, 0x15,
+ 0xdb, 0xcf, 0xd0, 0xb4, 0x9c, 0x43, 0xed, 0xe8,
+ 0x0c, 0xd0, 0x8c, 0xd4, 0xcf, 0xd0, 0x43, 0xc3,
+ 0x9b, 0xc7, 0xea, 0xe8, 0xc3, 0x28, 0x0c, 0x43,
+ 0x02, 0x01, 0xce, 0x06, 0x02, 0x06, 0x02, 0x05,
+ 0x08, 0x7a, 0x02, 0xaa, 0x02, 0x08, 0xd0, 0x06,
+ 0x01, 0x00, 0x40, 0xd2, 0x06, 0x01, 0x01, 0x40,
+ 0xd4, 0x06, 0x00, 0x02, 0x40, 0xd6, 0x06, 0x01,
+ 0x03, 0x40, 0xd8, 0x06, 0x02, 0x04, 0x40, 0x10,
+ 0x01, 0x05, 0x40, 0xea, 0x01, 0x01, 0x06, 0x40,
+ 0xa2, 0x01, 0x01, 0x07, 0x40, 0xda, 0x06, 0x00,
+ 0x01, 0x00, 0xc0, 0x02, 0x00, 0x00, 0x00, 0xc8,
+ 0x02, 0x01, 0x00, 0x00, 0xc2, 0x02, 0x02, 0x00,
+ 0x00, 0xd4, 0x02, 0x03, 0x00, 0x00, 0xd0, 0x02,
+ 0x04, 0x00, 0x00, 0xe4, 0x03, 0x05, 0x00, 0x00,
+ 0xe6, 0x03, 0x06, 0x00, 0x00, 0xdc, 0x06, 0x07,
+ 0x00, 0x00, 0xde, 0x06, 0x08, 0x00, 0x00, 0xe0,
+ 0x06, 0x09, 0x00, 0x00, 0xe2, 0x06, 0x0a, 0x00,
+ 0x00, 0xe4, 0x06, 0x0b, 0x00, 0x00, 0xe6, 0x06,
+ 0x0c, 0x00, 0x00, 0xe8, 0x06, 0x0d, 0x00, 0x00,
+ 0xea, 0x06, 0x0e, 0x00, 0x00, 0xec, 0x06, 0x0f,
+ 0x00, 0x00, 0xee, 0x06, 0x10, 0x00, 0x00, 0xf0,
+ 0x06, 0x11, 0x00, 0x00, 0xf2, 0x06, 0x12, 0x00,
+ 0x00, 0xf4, 0x06, 0x13, 0x00, 0x00, 0xf6, 0x06,
+ 0x14, 0x00, 0x00, 0xf8, 0x06, 0x15, 0x00, 0x00,
+ 0xfa, 0x06, 0x16, 0x00, 0x00, 0xfc, 0x06, 0x17,
+ 0x00, 0x00, 0xfe, 0x06, 0x18, 0x00, 0x00, 0x80,
+ 0x07, 0x19, 0x00, 0x00, 0x82, 0x07, 0x1a, 0x00,
+ 0x00, 0x84, 0x07, 0x1b, 0x00, 0x00, 0x86, 0x07,
+ 0x1c, 0x00, 0x00, 0x88, 0x07, 0x1d, 0x00, 0x00,
+ 0x8a, 0x07, 0x1e, 0x00, 0x00, 0x8c, 0x07, 0x1f,
+ 0x00, 0x00, 0x8e, 0x07, 0x20, 0x00, 0x00, 0x90,
+ 0x07, 0x21, 0x00, 0x00, 0x92, 0x07, 0x22, 0x00,
+ 0x00, 0x94, 0x07, 0x23, 0x00, 0x00, 0x96, 0x07,
+ 0x24, 0x00, 0x00, 0x98, 0x07, 0x25, 0x00, 0x00,
+ 0x9a, 0x07, 0x26, 0x00, 0x00, 0x9c, 0x07, 0x27,
+ 0x00, 0x00, 0xa2, 0x05, 0x28, 0x00, 0x00, 0xb2,
+ 0x05, 0x29, 0x00, 0x00, 0xb4, 0x05, 0x2a, 0x00,
+ 0x00, 0xba, 0x05, 0x2b, 0x00, 0x00, 0xbc, 0x05,
+ 0x2c, 0x00, 0x00, 0xc6, 0x05, 0x2d, 0x00, 0x00,
+ 0xc8, 0x05, 0x2e, 0x00, 0x00, 0xce, 0x05, 0x2f,
+ 0x00, 0x00, 0xd2, 0x05, 0x30, 0x00, 0x00, 0xd6,
+ 0x05, 0x31, 0x00, 0x00, 0xde, 0x05, 0x32, 0x00,
+ 0x00, 0xe4, 0x05, 0x33, 0x00, 0x00, 0xe8, 0x05,
+ 0x34, 0x00, 0x00, 0xf0, 0x05, 0x35, 0x00, 0x00,
+ 0xfa, 0x05, 0x36, 0x00, 0x00, 0xfc, 0x05, 0x37,
+ 0x00, 0x00, 0xfe, 0x05, 0x38, 0x00, 0x00, 0x80,
+ 0x06, 0x39, 0x00, 0x00, 0x82, 0x06, 0x3a, 0x00,
+ 0x00, 0x84, 0x06, 0x3b, 0x00, 0x00, 0x86, 0x06,
+ 0x3c, 0x00, 0x00, 0x8a, 0x06, 0x3d, 0x00, 0x00,
+ 0x8c, 0x06, 0x3e, 0x00, 0x00, 0x8e, 0x06, 0x3f,
+ 0x00, 0x00, 0x90, 0x06, 0x40, 0x00, 0x00, 0x92,
+ 0x06, 0x41, 0x00, 0x00, 0x94, 0x06, 0x42, 0x00,
+ 0x00, 0x96, 0x06, 0x43, 0x00, 0x00, 0x9a, 0x06,
+ 0x44, 0x00, 0x00, 0x9c, 0x06, 0x45, 0x00, 0x00,
+ 0x9e, 0x06, 0x46, 0x00, 0x00, 0xa0, 0x06, 0x47,
+ 0x00, 0x00, 0xa2, 0x06, 0x48, 0x00, 0x00, 0xa4,
+ 0x06, 0x49, 0x00, 0x00, 0xa6, 0x06, 0x4a, 0x00,
+ 0x00, 0xa8, 0x06, 0x4b, 0x00, 0x00, 0xaa, 0x06,
+ 0x4c, 0x00, 0x00, 0xac, 0x06, 0x4d, 0x00, 0x00,
+ 0xae, 0x06, 0x4e, 0x00, 0x00, 0xb0, 0x06, 0x4f,
+ 0x00, 0x00, 0xb4, 0x06, 0x50, 0x00, 0x00, 0xb8,
+ 0x06, 0x51, 0x00, 0x00, 0xba, 0x06, 0x52, 0x00,
+ 0x00, 0xbc, 0x06, 0x53, 0x00, 0x00, 0xbe, 0x06,
+ 0x54, 0x00, 0x00, 0xc0, 0x06, 0x55, 0x00, 0x00,
+ 0xc2, 0x06, 0x56, 0x00, 0x00, 0xc4, 0x06, 0x57,
+ 0x00, 0x00, 0xca, 0x06, 0x58, 0x00, 0x00, 0xcc,
+ 0x06, 0x59, 0x00, 0x00, 0xce, 0x06, 0x5a, 0x00,
+ 0x00, 0x9e, 0x07, 0x5b, 0x00, 0x00, 0xa0, 0x07,
+ 0x5c, 0x00, 0x00, 0xa2, 0x07, 0x5d, 0x00, 0x00,
+ 0xa4, 0x07, 0x5e, 0x00, 0x00, 0xa6, 0x07, 0x5f,
+ 0x00, 0x00, 0xa8, 0x07, 0x60, 0x00, 0x00, 0xaa,
+ 0x07, 0x61, 0x00, 0x00, 0xac, 0x07, 0x62, 0x00,
+ 0x00, 0xae, 0x07, 0x63, 0x00, 0x00, 0xb0, 0x07,
+ 0x64, 0x00, 0x00, 0xb2, 0x07, 0x65, 0x00, 0x00,
+ 0xb4, 0x07, 0x66, 0x00, 0x00, 0xb6, 0x07, 0x67,
+ 0x00, 0x00, 0xb8, 0x07, 0x68, 0x00, 0x00, 0xba,
+ 0x07, 0x69, 0x00, 0x00, 0xbc, 0x07, 0x6a, 0x00,
+ 0x00, 0xbe, 0x07, 0x6b, 0x00, 0x00, 0xc0, 0x07,
+ 0x6c, 0x00, 0x00, 0xc2, 0x07, 0x6d, 0x00, 0x00,
+ 0xc4, 0x07, 0x6e, 0x00, 0x00, 0xc6, 0x07, 0x6f,
+ 0x00, 0x00, 0xc8, 0x07, 0x70, 0x00, 0x00, 0xca,
+ 0x07, 0x71, 0x00, 0x00, 0xcc, 0x07, 0x72, 0x00,
+ 0x00, 0xce, 0x07, 0x73, 0x00, 0x00, 0xde, 0x03,
+ 0x00, 0x1a, 0x00, 0xe0, 0x03, 0x01, 0x1a, 0x00,
+ 0xe2, 0x03, 0x03, 0x03, 0x00, 0x7c, 0x04, 0x03,
+ 0x00, 0xdc, 0x02, 0x05, 0x03, 0x00, 0x0c, 0x03,
+ 0xc1, 0x04, 0x08, 0xca, 0x0c, 0x00, 0xc1, 0x05,
+ 0xd0, 0xb3, 0xa2, 0x11, 0xe9, 0x18, 0x0e, 0x04,
+ 0xe8, 0x01, 0x00, 0x00, 0x3e, 0xe9, 0x01, 0x00,
+ 0x00, 0x00, 0x00, 0xcf, 0xd0, 0xb4, 0x9c, 0x43,
+ 0x24, 0x01, 0x00, 0xb3, 0xa4, 0xe8, 0x03, 0xdb,
+ 0x28, 0xd0, 0xb5, 0xa4, 0x68, 0xfa, 0x00, 0x00,
+ 0x00, 0xcf, 0xd0, 0xb4, 0x9c, 0x43, 0x04, 0xea,
+ 0x01, 0x00, 0x00, 0xa9, 0x68, 0xea, 0x00, 0x00,
+ 0x00, 0xd0, 0x8c, 0xd4, 0x0b, 0xc7, 0xcf, 0xd0,
+ 0xb4, 0x9c, 0x43, 0xcd, 0x11, 0x04, 0xeb, 0x01,
+ 0x00, 0x00, 0xa9, 0xe9, 0x0a, 0x11, 0x04, 0xec,
+ 0x01, 0x00, 0x00, 0xa9, 0xe8, 0x07, 0x04, 0x61,
+ 0x01, 0x00, 0x00, 0x28, 0x11, 0x04, 0xed, 0x01,
+ 0x00, 0x00, 0xa9, 0xe8, 0x05, 0x26, 0x00, 0x00,
+ 0x28, 0x11, 0x04, 0xee, 0x01, 0x00, 0x00, 0xa9,
+ 0xe8, 0x03, 0x0b, 0x28, 0x11, 0x04, 0xef, 0x01,
+ 0x00, 0x00, 0xa9, 0xe8, 0x07, 0xbd, 0x00, 0xbd,
+ 0x01, 0x34, 0x28, 0x5b, 0x2f, 0x00, 0xc5, 0xed,
+ 0x68, 0x94, 0x00, 0x00, 0x00, 0x5b, 0x5a, 0x00,
+ 0xcf, 0xd0, 0xee, 0xc8, 0x04, 0x03, 0x00, 0x00,
+ 0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 0x04, 0x01,
+ 0x00, 0x00, 0x00, 0x04, 0x08, 0x00, 0x00, 0x00,
+ 0x26, 0x04, 0x00, 0x3e, 0xf0, 0x01, 0x00, 0x00,
+ 0x01, 0x00, 0xc4, 0x24, 0x01, 0x00, 0x11, 0xe9,
+ 0x09, 0x0e, 0x38, 0x77, 0x00, 0xc4, 0x8b, 0xed,
+ 0x94, 0xe8, 0x0b, 0x38, 0x78, 0x00, 0xc4, 0x32,
+ 0x01, 0x00, 0x01, 0x00, 0x28, 0xd0, 0xc4, 0xe7,
+ 0x9c, 0xb6, 0xa4, 0xe8, 0x1b, 0xcf, 0xd0, 0xc4,
+ 0xe7, 0x9c, 0xb4, 0x9c, 0x43, 0x04, 0xef, 0x01,
+ 0x00, 0x00, 0xa9, 0xe8, 0x0b, 0x38, 0x79, 0x00,
+ 0x11, 0xbf, 0xc4, 0x21, 0x02, 0x00, 0x28, 0x5b,
+ 0x5b, 0x00, 0xcf, 0xd0, 0xc4, 0xe7, 0x9c, 0xee,
+ 0xcb, 0xf1, 0x11, 0xe9, 0x04, 0x0e, 0xc3, 0xf0,
+ 0xe8, 0x03, 0xc3, 0x28, 0xc3, 0xdb, 0xa9, 0xe8,
+ 0x11, 0xfb, 0xc4, 0x43, 0xf0, 0xe8, 0x0b, 0x38,
+ 0x78, 0x00, 0xc4, 0x32, 0x01, 0x00, 0x01, 0x00,
+ 0x28, 0xfb, 0xc4, 0x43, 0x28, 0x0b, 0x28, 0x29,
+ 0x07, 0x02, 0x20, 0x07, 0x36, 0x00, 0x00, 0x01,
+ 0x00, 0x13, 0x00, 0x00, 0x00, 0x0e, 0x06, 0x00,
+ 0x00, 0x00, 0x06, 0x0d, 0xf5, 0xff, 0xff, 0xff,
+ 0x13, 0x00, 0x01, 0x20, 0x00, 0x14, 0x00, 0x10,
+ 0x0c, 0x43, 0x02, 0x01, 0x9e, 0x07, 0x02, 0x0a,
+ 0x02, 0x04, 0x00, 0x03, 0x01, 0xee, 0x01, 0x0c,
+ 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+ 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+ 0x00, 0x04, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
+ 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00,
+ 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa1,
+ 0x00, 0x59, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00,
+ 0x00, 0x00, 0x00, 0x00, 0xdb, 0xcf, 0xd0, 0xee,
+ 0xc7, 0xdc, 0xcf, 0xd0, 0xc3, 0xe7, 0x9c, 0xee,
+ 0xc9, 0x26, 0x00, 0x00, 0xca, 0xb3, 0xc1, 0x04,
+ 0xc5, 0xc8, 0xc0, 0x04, 0xbb, 0x0a, 0xf8, 0xe8,
+ 0x6f, 0xc4, 0xf1, 0xe9, 0x6b, 0xc4, 0x06, 0xaa,
+ 0xe8, 0x66, 0xdd, 0x3e, 0xf1, 0x01, 0x00, 0x00,
+ 0x00, 0x00, 0xc4, 0x24, 0x01, 0x00, 0xc1, 0x07,
+ 0xb3, 0xc1, 0x05, 0xc0, 0x05, 0xc0, 0x07, 0xe7,
+ 0xf8, 0xe8, 0x3c, 0xc0, 0x07, 0xc0, 0x05, 0x43,
+ 0xc2, 0x08, 0x95, 0x04, 0x4c, 0x00, 0x00, 0x00,
+ 0xa7, 0xe8, 0x28, 0xbf, 0xc0, 0x08, 0x8b, 0x9b,
+ 0xc0, 0x08, 0xa8, 0xe8, 0x1e, 0xc0, 0x08, 0x3e,
+ 0xf2, 0x01, 0x00, 0x00, 0x01, 0x00, 0xc3, 0x24,
+ 0x01, 0x00, 0xe8, 0x0f, 0xc6, 0x3e, 0x8c, 0x01,
+ 0x00, 0x00, 0x02, 0x00, 0xc0, 0x08, 0x24, 0x01,
+ 0x00, 0x0e, 0xfa, 0x05, 0xea, 0xbe, 0xdd, 0x3e,
+ 0x63, 0x00, 0x00, 0x00, 0x03, 0x00, 0xc4, 0x24,
+ 0x01, 0x00, 0xc8, 0xfa, 0x04, 0xea, 0x8c, 0xc6,
+ 0xe7, 0xb4, 0xf9, 0xe8, 0x49, 0xbe, 0x00, 0xc1,
+ 0x09, 0xbe, 0x00, 0x0e, 0xc6, 0x3e, 0xf3, 0x01,
+ 0x00, 0x00, 0x04, 0x00, 0x5f, 0x09, 0x00, 0x24,
+ 0x01, 0x00, 0x0e, 0xb4, 0xc2, 0x05, 0xc1, 0x04,
+ 0xc0, 0x04, 0xc6, 0xe7, 0xf8, 0xe8, 0x1d, 0xc6,
+ 0xc0, 0x04, 0x43, 0xc6, 0xc0, 0x04, 0xb4, 0x9c,
+ 0x43, 0xa8, 0xe8, 0x0c, 0xc6, 0xc0, 0x05, 0x8f,
+ 0xc1, 0x05, 0xc6, 0xc0, 0x04, 0x43, 0x46, 0xfa,
+ 0x04, 0xea, 0xde, 0xc6, 0xc0, 0x05, 0x3f, 0x32,
+ 0x00, 0x00, 0x00, 0x05, 0x00, 0x0b, 0xc6, 0x49,
+ 0xf4, 0x01, 0x00, 0x00, 0xc3, 0xe7, 0x49, 0xa9,
+ 0x01, 0x00, 0x00, 0xc5, 0x49, 0xf5, 0x01, 0x00,
+ 0x00, 0x28, 0x0c, 0x43, 0x02, 0x01, 0xec, 0x07,
+ 0x02, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x33,
+ 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00,
+ 0x00, 0xcf, 0xb3, 0x43, 0xd0, 0xb3, 0x43, 0xa8,
+ 0xe8, 0x1b, 0xcf, 0xb3, 0x43, 0x04, 0x65, 0x01,
+ 0x00, 0x00, 0xa7, 0xe8, 0x03, 0xb4, 0x28, 0xd0,
+ 0xb3, 0x43, 0x04, 0x65, 0x01, 0x00, 0x00, 0xa7,
+ 0xe8, 0x03, 0xb2, 0x28, 0xcf, 0xd0, 0xf8, 0xe8,
+ 0x03, 0xb2, 0x28, 0xcf, 0xd0, 0xf9, 0xe8, 0x03,
+ 0xb4, 0x28, 0xb3, 0x28, 0x0c, 0x43, 0x02, 0x01,
+ 0xa0, 0x07, 0x00, 0x0d, 0x00, 0x07, 0x00, 0x0a,
+ 0x00, 0xa5, 0x03, 0x0d, 0x00, 0x00, 0x00, 0x00,
+ 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+ 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+ 0x00, 0x05, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00,
+ 0x00, 0x07, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00,
+ 0x00, 0x09, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00,
+ 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00,
+ 0x00, 0x5b, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00,
+ 0x00, 0x1b, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00,
+ 0x00, 0x20, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x00,
+ 0x00, 0x04, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00,
+ 0x00, 0x00, 0x1a, 0x00, 0x00, 0x62, 0x00, 0x00,
+ 0xdb, 0xdc, 0xdd, 0xee, 0xcc, 0x3d, 0xf4, 0x01,
+ 0x00, 0x00, 0x00, 0x00, 0xcb, 0xe7, 0xb3, 0xa9,
+ 0xe8, 0x02, 0x29, 0xc3, 0xb3, 0x43, 0xcd, 0xe7,
+ 0xc1, 0x05, 0xb4, 0xca, 0xc6, 0xc3, 0xe7, 0xf8,
+ 0xe8, 0x2a, 0xc3, 0xc6, 0x43, 0xc1, 0x06, 0xb3,
+ 0xc1, 0x04, 0xc0, 0x04, 0xc0, 0x05, 0xf8, 0xe8,
+ 0x17, 0xc0, 0x06, 0xc0, 0x04, 0x43, 0xc5, 0xc0,
+ 0x04, 0x43, 0xaa, 0xe8, 0x07, 0xc0, 0x04, 0xc1,
+ 0x05, 0xea, 0x05, 0xfa, 0x04, 0xea, 0xe4, 0xfa,
+ 0x03, 0xea, 0xd2, 0xc4, 0x3d, 0xa9, 0x01, 0x00,
+ 0x00, 0x01, 0x00, 0xca, 0xc6, 0xc0, 0x05, 0xf8,
+ 0xe8, 0x0b, 0xde, 0xc5, 0xc6, 0x43, 0xed, 0x0e,
+ 0xfa, 0x03, 0xea, 0xf1, 0x5b, 0x04, 0x00, 0x5b,
+ 0x05, 0x00, 0xa9, 0xe8, 0x44, 0xc3, 0xe7, 0xb4,
+ 0xa7, 0xe8, 0x3e, 0xc4, 0x3d, 0xf5, 0x01, 0x00,
+ 0x00, 0x02, 0x00, 0xc3, 0xb3, 0x43, 0x43, 0xc2,
+ 0x0c, 0xf3, 0xe8, 0x1a, 0xde, 0x04, 0xf7, 0x01,
+ 0x00, 0x00, 0xed, 0x0e, 0xc0, 0x0c, 0xe7, 0xb3,
+ 0xa7, 0xe8, 0x1e, 0xde, 0x04, 0xf8, 0x01, 0x00,
+ 0x00, 0xed, 0x0e, 0xea, 0x14, 0xc0, 0x0c, 0x95,
+ 0x04, 0x4d, 0x00, 0x00, 0x00, 0xa7, 0xe8, 0x09,
+ 0xde, 0x04, 0xea, 0x01, 0x00, 0x00, 0xed, 0x0e,
+ 0x5b, 0x04, 0x00, 0x5b, 0x05, 0x00, 0xa9, 0x68,
+ 0xec, 0x00, 0x00, 0x00, 0xc3, 0xe7, 0xb5, 0xa4,
+ 0x68, 0xe3, 0x00, 0x00, 0x00, 0xb3, 0xc1, 0x07,
+ 0xb3, 0xca, 0xc6, 0xc3, 0xe7, 0xf8, 0xe8, 0x1a,
+ 0x5b, 0x06, 0x00, 0x3e, 0xf9, 0x01, 0x00, 0x00,
+ 0x03, 0x00, 0xc0, 0x07, 0xc3, 0xc6, 0x43, 0xe7,
+ 0x24, 0x02, 0x00, 0xc1, 0x07, 0xfa, 0x03, 0xea,
+ 0xe2, 0xb5, 0x92, 0x07, 0x5b, 0x06, 0x00, 0x3e,
+ 0xf9, 0x01, 0x00, 0x00, 0x04, 0x00, 0xb4, 0x5b,
+ 0x06, 0x00, 0x3e, 0xfa, 0x01, 0x00, 0x00, 0x05,
+ 0x00, 0x5b, 0x07, 0x00, 0xb4, 0x9b, 0xc0, 0x07,
+ 0x99, 0x24, 0x01, 0x00, 0x24, 0x02, 0x00, 0xc1,
+ 0x09, 0x5b, 0x06, 0x00, 0x3e, 0xfb, 0x01, 0x00,
+ 0x00, 0x06, 0x00, 0xc3, 0xe7, 0xc0, 0x09, 0x99,
+ 0x24, 0x01, 0x00, 0xc1, 0x0b, 0x64, 0x08, 0x00,
+ 0x3e, 0x70, 0x01, 0x00, 0x00, 0x07, 0x00, 0x04,
+ 0x2a, 0x01, 0x00, 0x00, 0x24, 0x01, 0x00, 0x0e,
+ 0xb3, 0xc1, 0x0a, 0xc0, 0x0a, 0xc0, 0x0b, 0xf8,
+ 0xe8, 0x5e, 0xb3, 0xc1, 0x08, 0xc0, 0x08, 0xc0,
+ 0x09, 0xf8, 0xe8, 0x3d, 0xc0, 0x08, 0xc0, 0x0b,
+ 0x98, 0xc0, 0x0a, 0x9b, 0xce, 0xc3, 0xe7, 0xa4,
+ 0xe9, 0x2f, 0xc3, 0xc6, 0x43, 0xc9, 0xc0, 0x08,
+ 0xc0, 0x09, 0xb4, 0x9c, 0xa8, 0xe8, 0x0f, 0xc5,
+ 0x3e, 0xfc, 0x01, 0x00, 0x00, 0x08, 0x00, 0xc0,
+ 0x07, 0x24, 0x01, 0x00, 0xc9, 0x64, 0x08, 0x00,
+ 0x3e, 0x70, 0x01, 0x00, 0x00, 0x09, 0x00, 0xc5,
+ 0x24, 0x01, 0x00, 0x0e, 0xfa, 0x08, 0xea, 0xbe,
+ 0x64, 0x08, 0x00, 0x3e, 0x70, 0x01, 0x00, 0x00,
+ 0x0a, 0x00, 0x04, 0x2a, 0x01, 0x00, 0x00, 0x24,
+ 0x01, 0x00, 0x0e, 0xfa, 0x0a, 0xea, 0x9d, 0x5b,
+ 0x09, 0x00, 0xec, 0x0e, 0x29, 0x0c, 0x43, 0x02,
+ 0x01, 0xa4, 0x07, 0x02, 0x01, 0x02, 0x02, 0x00,
+ 0x00, 0x00, 0x10, 0x03, 0x00, 0x01, 0x00, 0x00,
+ 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+ 0xbf, 0xc7, 0xd0, 0x8e, 0xd4, 0xb3, 0xf9, 0xe8,
+ 0x06, 0xcf, 0x92, 0x00, 0xea, 0xf5, 0xc3, 0x28,
+ 0x0c, 0x43, 0x02, 0x01, 0xac, 0x07, 0x00, 0x00,
+ 0x00, 0x03, 0x00, 0x07, 0x00, 0x20, 0x00, 0x00,
+ 0x00, 0x1a, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
+ 0x2f, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00,
+ 0x27, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+ 0x1d, 0x00, 0x00, 0x64, 0x00, 0x00, 0x3e, 0x70,
+ 0x01, 0x00, 0x00, 0x00, 0x00, 0xdc, 0x24, 0x01,
+ 0x00, 0x0e, 0xdd, 0xdc, 0xed, 0xde, 0x9a, 0x5c,
+ 0x04, 0x00, 0xbf, 0x5c, 0x05, 0x00, 0xb3, 0x5c,
+ 0x06, 0x00, 0x29, 0x0c, 0x43, 0x02, 0x01, 0xae,
+ 0x07, 0x02, 0x01, 0x02, 0x05, 0x00, 0x11, 0x00,
+ 0x82, 0x01, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00,
+ 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+ 0x1a, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00,
+ 0x09, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
+ 0x61, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
+ 0x0f, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+ 0x5e, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+ 0x12, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+ 0x17, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+ 0x62, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00,
+ 0x60, 0x00, 0x00, 0xcf, 0x11, 0xe9, 0x03, 0x0e,
+ 0xbf, 0xe3, 0xe7, 0xe0, 0xdd, 0xe7, 0xe2, 0xd0,
+ 0x5c, 0x04, 0x00, 0x5b, 0x05, 0x00, 0x5c, 0x06,
+ 0x00, 0x5b, 0x07, 0x00, 0xe8, 0x22, 0x5b, 0x06,
+ 0x00, 0x5b, 0x08, 0x00, 0x04, 0xfd, 0x01, 0x00,
+ 0x00, 0x5b, 0x09, 0x00, 0x5b, 0x06, 0x00, 0xe7,
+ 0x9c, 0xee, 0x9b, 0x5d, 0x06, 0x00, 0x5b, 0x0a,
+ 0x00, 0x9b, 0x5c, 0x06, 0x00, 0xea, 0x38, 0x5b,
+ 0x0b, 0x00, 0xe8, 0x22, 0x5b, 0x0c, 0x00, 0xbc,
+ 0xe8, 0x03, 0x99, 0xc7, 0x5b, 0x06, 0x00, 0xfc,
+ 0x3e, 0xfe, 0x01, 0x00, 0x00, 0x00, 0x00, 0xb9,
+ 0x24, 0x01, 0x00, 0x04, 0xfd, 0x01, 0x00, 0x00,
+ 0x9b, 0x9b, 0x5c, 0x06, 0x00, 0x5b, 0x06, 0x00,
+ 0xe7, 0x5c, 0x09, 0x00, 0x5b, 0x06, 0x00, 0x5b,
+ 0x0d, 0x00, 0x9b, 0x5c, 0x06, 0x00, 0x5b, 0x0e,
+ 0x00, 0xec, 0x0e, 0x5b, 0x0f, 0x00, 0xec, 0x0e,
+ 0xb3, 0x5c, 0x10, 0x00, 0x29, 0x0c, 0x43, 0x02,
+ 0x01, 0xb0, 0x07, 0x01, 0x01, 0x01, 0x03, 0x00,
+ 0x04, 0x02, 0x88, 0x01, 0x02, 0x00, 0x01, 0x00,
+ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+ 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x5f, 0x00,
+ 0x00, 0x00, 0x65, 0x00, 0x00, 0xdb, 0x3e, 0xff,
+ 0x01, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x24, 0x01,
+ 0x00, 0xc7, 0xdc, 0x11, 0xb3, 0xa9, 0xe8, 0x14,
+ 0xc3, 0x04, 0x00, 0x02, 0x00, 0x00, 0xa7, 0xe8,
+ 0x06, 0xc3, 0xe1, 0xb4, 0xe0, 0x29, 0xde, 0xc3,
+ 0xed, 0x0e, 0x29, 0x11, 0xb4, 0xa9, 0xe8, 0x24,
+ 0xdd, 0xc3, 0x9b, 0xe1, 0xc3, 0x04, 0x01, 0x02,
+ 0x00, 0x00, 0xa7, 0xe8, 0x04, 0xb5, 0xe0, 0x29,
+ 0xc3, 0x04, 0x02, 0x02, 0x00, 0x00, 0xa7, 0xe8,
+ 0x04, 0xb6, 0xe0, 0x29, 0xde, 0xdd, 0xed, 0x0e,
+ 0xb3, 0xe0, 0x29, 0x11, 0xb5, 0xa9, 0xe8, 0x26,
+ 0xdd, 0xc3, 0x9b, 0xe1, 0xc3, 0x04, 0x03, 0x02,
+ 0x00, 0x00, 0xa7, 0x11, 0xe9, 0x0e, 0x0e, 0xc3,
+ 0xbd, 0x00, 0xa4, 0x11, 0xe8, 0x06, 0x0e, 0xc3,
+ 0xbd, 0x01, 0xa2, 0x94, 0xe8, 0x17, 0xde, 0xdd,
+ 0xed, 0x0e, 0xb3, 0xe0, 0x29, 0x11, 0xb6, 0xa9,
+ 0xe8, 0x0b, 0xdd, 0xc3, 0x9b, 0xe1, 0xde, 0xdd,
+ 0xed, 0x0e, 0xb3, 0xe0, 0x29, 0x07, 0x02, 0x30,
+ 0x07, 0x02, 0x39, 0x0c, 0x43, 0x02, 0x01, 0xb2,
+ 0x07, 0x01, 0x01, 0x01, 0x05, 0x00, 0x0d, 0x00,
+ 0xb7, 0x01, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00,
+ 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
+ 0x2f, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00,
+ 0x5d, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00,
+ 0x61, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00,
+ 0x01, 0x1a, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
+ 0x20, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00,
+ 0x1b, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0xdb,
+ 0xe8, 0x11, 0xdc, 0xcf, 0xed, 0xb4, 0xa9, 0xe8,
+ 0x05, 0xdd, 0xcf, 0xed, 0x0e, 0x09, 0xdf, 0xeb,
+ 0x81, 0x00, 0xde, 0xcf, 0x43, 0xcb, 0xe8, 0x5b,
+ 0xc3, 0x5c, 0x04, 0x00, 0xc3, 0xcf, 0xed, 0x11,
+ 0xb2, 0xa9, 0xe8, 0x09, 0x5b, 0x05, 0x00, 0x5b,
+ 0x06, 0x00, 0xed, 0x29, 0x11, 0xbb, 0xfe, 0xa9,
+ 0xe8, 0x07, 0x5b, 0x05, 0x00, 0x07, 0xed, 0x29,
+ 0x11, 0xbb, 0xfd, 0xa9, 0xe8, 0x2c, 0x64, 0x07,
+ 0x00, 0x3e, 0x56, 0x01, 0x00, 0x00, 0x00, 0x00,
+ 0x64, 0x07, 0x00, 0x3d, 0x57, 0x01, 0x00, 0x00,
+ 0x01, 0x00, 0x07, 0x24, 0x02, 0x00, 0x0e, 0x64,
+ 0x07, 0x00, 0x3e, 0x58, 0x01, 0x00, 0x00, 0x02,
+ 0x00, 0x5b, 0x08, 0x00, 0x07, 0x24, 0x02, 0x00,
+ 0x29, 0x0e, 0x5b, 0x04, 0x00, 0x5c, 0x09, 0x00,
+ 0xea, 0x20, 0xdc, 0xcf, 0xed, 0xb4, 0xa9, 0xe8,
+ 0x14, 0xcf, 0x04, 0xfd, 0x01, 0x00, 0x00, 0xa4,
+ 0xe8, 0x0b, 0xdd, 0xcf, 0xed, 0x0e, 0xdd, 0x5c,
+ 0x09, 0x00, 0xea, 0x06, 0x5b, 0x0a, 0x00, 0xec,
+ 0x0e, 0x5b, 0x0b, 0x00, 0xb3, 0xf8, 0xe8, 0x04,
+ 0xb3, 0xea, 0x14, 0x5b, 0x0b, 0x00, 0x5b, 0x06,
+ 0x00, 0xe7, 0xf9, 0xe8, 0x07, 0x5b, 0x06, 0x00,
+ 0xe7, 0xea, 0x04, 0x5b, 0x0b, 0x00, 0x5c, 0x0b,
+ 0x00, 0x5b, 0x0c, 0x00, 0xec, 0x29, 0x0c, 0x43,
+ 0x02, 0x01, 0xb6, 0x07, 0x01, 0x01, 0x01, 0x05,
+ 0x00, 0x00, 0x00, 0x29, 0x02, 0x00, 0x01, 0x00,
+ 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xb3, 0xf8,
+ 0xe8, 0x0c, 0xcf, 0x8a, 0xd3, 0x04, 0x04, 0x02,
+ 0x00, 0x00, 0xc7, 0xea, 0x03, 0xbf, 0xc7, 0xc3,
+ 0x04, 0x05, 0x02, 0x00, 0x00, 0xcf, 0x3e, 0x3b,
+ 0x00, 0x00, 0x00, 0x00, 0x00, 0xbb, 0x10, 0x24,
+ 0x01, 0x00, 0x9b, 0x9b, 0xcb, 0x28, 0x0c, 0x43,
+ 0x02, 0x01, 0xb8, 0x07, 0x01, 0x01, 0x01, 0x04,
+ 0x00, 0x01, 0x00, 0x2e, 0x02, 0x00, 0x01, 0x00,
+ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x00,
+ 0x00, 0xcf, 0xb3, 0x43, 0x04, 0x06, 0x02, 0x00,
+ 0x00, 0xaa, 0xe8, 0x03, 0xbf, 0x28, 0xb4, 0xc7,
+ 0xc3, 0xcf, 0xe7, 0xf8, 0xe8, 0x0d, 0xdb, 0xcf,
+ 0xc3, 0x43, 0xed, 0x94, 0xe9, 0x05, 0xfa, 0x00,
+ 0xea, 0xef, 0xcf, 0x3e, 0x71, 0x01, 0x00, 0x00,
+ 0x00, 0x00, 0xb4, 0xc3, 0x25, 0x02, 0x00, 0x0c,
+ 0x43, 0x02, 0x01, 0xba, 0x07, 0x02, 0x04, 0x02,
+ 0x04, 0x00, 0x04, 0x00, 0x81, 0x02, 0x06, 0x00,
+ 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+ 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+ 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+ 0x6a, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00,
+ 0x66, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0xcf,
+ 0x04, 0x07, 0x02, 0x00, 0x00, 0xa9, 0x11, 0xe9,
+ 0x14, 0x0e, 0xcf, 0x04, 0x08, 0x02, 0x00, 0x00,
+ 0xa9, 0x11, 0xe9, 0x09, 0x0e, 0xcf, 0x04, 0xde,
+ 0x01, 0x00, 0x00, 0xa7, 0xe8, 0x07, 0xdb, 0xec,
+ 0x0e, 0xeb, 0xdc, 0x00, 0xcf, 0x04, 0x09, 0x02,
+ 0x00, 0x00, 0xa9, 0xe8, 0x55, 0xd0, 0x3e, 0x71,
+ 0x01, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xe7, 0xb4,
+ 0x9b, 0x24, 0x01, 0x00, 0x3e, 0x0a, 0x02, 0x00,
+ 0x00, 0x01, 0x00, 0x24, 0x00, 0x00, 0xce, 0x3e,
+ 0x0b, 0x02, 0x00, 0x00, 0x02, 0x00, 0x04, 0xea,
+ 0x01, 0x00, 0x00, 0x24, 0x01, 0x00, 0xc6, 0x3e,
+ 0x0b, 0x02, 0x00, 0x00, 0x03, 0x00, 0x04, 0xef,
+ 0x01, 0x00, 0x00, 0x24, 0x01, 0x00, 0xa2, 0xe8,
+ 0x08, 0x04, 0x0c, 0x02, 0x00, 0x00, 0x92, 0x03,
+ 0x64, 0x01, 0x00, 0x3e, 0x0d, 0x02, 0x00, 0x00,
+ 0x04, 0x00, 0xc6, 0x24, 0x01, 0x00, 0x0e, 0x09,
+ 0x28, 0xcf, 0x04, 0x0e, 0x02, 0x00, 0x00, 0xa9,
+ 0xe8, 0x05, 0x0a, 0xe1, 0xea, 0x71, 0xcf, 0x04,
+ 0x0f, 0x02, 0x00, 0x00, 0xa9, 0xe8, 0x05, 0x09,
+ 0xe1, 0xea, 0x64, 0xcf, 0x04, 0x10, 0x02, 0x00,
+ 0x00, 0xa9, 0xe8, 0x06, 0xde, 0x94, 0xe2, 0xea,
+ 0x56, 0xcf, 0x04, 0x11, 0x02, 0x00, 0x00, 0xa9,
+ 0xe8, 0x16, 0x64, 0x01, 0x00, 0x3e, 0x70, 0x01,
+ 0x00, 0x00, 0x05, 0x00, 0x04, 0x12, 0x02, 0x00,
+ 0x00, 0x24, 0x01, 0x00, 0x0e, 0xea, 0x38, 0xcf,
+ 0x04, 0x13, 0x02, 0x00, 0x00, 0xa9, 0xe8, 0x12,
+ 0x64, 0x01, 0x00, 0x3e, 0xa3, 0x01, 0x00, 0x00,
+ 0x06, 0x00, 0xb3, 0x24, 0x01, 0x00, 0x0e, 0xea,
+ 0x1e, 0x64, 0x01, 0x00, 0x3e, 0x70, 0x01, 0x00,
+ 0x00, 0x07, 0x00, 0x04, 0x14, 0x02, 0x00, 0x00,
+ 0xcf, 0x9b, 0x04, 0x2a, 0x01, 0x00, 0x00, 0x9b,
+ 0x24, 0x01, 0x00, 0x0e, 0x09, 0x28, 0x0a, 0x28,
+ 0x0c, 0x43, 0x02, 0x01, 0xbc, 0x07, 0x00, 0x01,
+ 0x00, 0x05, 0x00, 0x03, 0x01, 0x4d, 0x01, 0x00,
+ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00,
+ 0x66, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0xbe,
+ 0x00, 0xc7, 0x64, 0x00, 0x00, 0x3e, 0x70, 0x01,
+ 0x00, 0x00, 0x00, 0x00, 0x04, 0x15, 0x02, 0x00,
+ 0x00, 0xc3, 0xdc, 0xed, 0x9b, 0x04, 0x16, 0x02,
+ 0x00, 0x00, 0x9b, 0x04, 0x17, 0x02, 0x00, 0x00,
+ 0x9b, 0xc3, 0xdc, 0x94, 0xed, 0x9b, 0x04, 0x18,
+ 0x02, 0x00, 0x00, 0x9b, 0x04, 0x19, 0x02, 0x00,
+ 0x00, 0x9b, 0xc3, 0xdd, 0xed, 0x9b, 0x04, 0x1a,
+ 0x02, 0x00, 0x00, 0x9b, 0x04, 0x1b, 0x02, 0x00,
+ 0x00, 0x9b, 0x04, 0x1c, 0x02, 0x00, 0x00, 0x9b,
+ 0x24, 0x01, 0x00, 0x29, 0x0c, 0x43, 0x02, 0x01,
+ 0xba, 0x08, 0x01, 0x00, 0x01, 0x01, 0x00, 0x00,
+ 0x00, 0x0f, 0x01, 0x00, 0x01, 0x00, 0x00, 0xcf,
+ 0xe8, 0x07, 0x04, 0x81, 0x00, 0x00, 0x00, 0x28,
+ 0x04, 0xfd, 0x01, 0x00, 0x00, 0x28, 0x0c, 0x43,
+ 0x02, 0x01, 0xbe, 0x07, 0x00, 0x00, 0x00, 0x03,
+ 0x00, 0x02, 0x00, 0x16, 0x00, 0x00, 0x00, 0x1a,
+ 0x00, 0x00, 0x6c, 0x00, 0x00, 0x64, 0x00, 0x00,
+ 0x3e, 0x70, 0x01, 0x00, 0x00, 0x00, 0x00, 0x04,
+ 0x1e, 0x02, 0x00, 0x00, 0x24, 0x01, 0x00, 0x0e,
+ 0xdc, 0xec, 0x29, 0x0c, 0x43, 0x02, 0x01, 0xc0,
+ 0x07, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00,
+ 0x0c, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x5e,
+ 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x6d,
+ 0x00, 0x00, 0xdb, 0xdc, 0x04, 0x1f, 0x02, 0x00,
+ 0x00, 0xdd, 0xee, 0xde, 0xee, 0x29, 0x0c, 0x43,
+ 0x02, 0x01, 0xc2, 0x07, 0x01, 0x00, 0x01, 0x02,
+ 0x00, 0x02, 0x00, 0x0a, 0x01, 0x00, 0x01, 0x00,
+ 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x6c, 0x00,
+ 0x00, 0xdb, 0xcf, 0xed, 0x94, 0xe8, 0x04, 0xdc,
+ 0xec, 0x0e, 0x29, 0x0c, 0x43, 0x02, 0x01, 0xc4,
+ 0x07, 0x01, 0x02, 0x01, 0x04, 0x00, 0x08, 0x00,
+ 0x70, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+ 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x6a,
+ 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x69,
+ 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x73,
+ 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x19,
+ 0x00, 0x00, 0x00, 0x6f, 0x00, 0x00, 0xcf, 0xf1,
+ 0xe8, 0x05, 0xbf, 0xd3, 0x09, 0x28, 0xcf, 0x04,
+ 0x08, 0x02, 0x00, 0x00, 0xa9, 0xe8, 0x06, 0xdb,
+ 0xec, 0x0e, 0x09, 0x28, 0xdc, 0xcf, 0xed, 0xcc,
+ 0xe7, 0xb3, 0xf9, 0xe8, 0x1a, 0xdd, 0xc4, 0xcf,
+ 0xee, 0x94, 0xe8, 0x03, 0x09, 0x28, 0xcf, 0x3e,
+ 0x71, 0x01, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xe7,
+ 0xb4, 0x9b, 0x24, 0x01, 0x00, 0xd3, 0xcf, 0xbf,
+ 0xa9, 0xe8, 0x03, 0x09, 0x28, 0xde, 0xe8, 0x0b,
+ 0xde, 0x04, 0x2a, 0x01, 0x00, 0x00, 0x9b, 0xcf,
+ 0x9b, 0xd3, 0x5b, 0x04, 0x00, 0xcf, 0xed, 0xcb,
+ 0xb3, 0x43, 0x5c, 0x05, 0x00, 0xc3, 0xb4, 0x43,
+ 0x5c, 0x06, 0x00, 0x5b, 0x05, 0x00, 0xe8, 0x05,
+ 0xcf, 0xe2, 0x09, 0x28, 0xbf, 0xe2, 0x5b, 0x07,
+ 0x00, 0xcf, 0xed, 0x0e, 0x0a, 0x28, 0x0c, 0x43,
+ 0x02, 0x01, 0xc6, 0x07, 0x01, 0x02, 0x01, 0x06,
+ 0x00, 0x05, 0x00, 0x4f, 0x03, 0x00, 0x01, 0x00,
+ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+ 0x83, 0x00, 0x01, 0x1a, 0x00, 0x00, 0x16, 0x00,
+ 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x70, 0x00,
+ 0x00, 0x00, 0x71, 0x00, 0x00, 0x6b, 0x3f, 0x00,
+ 0x00, 0x00, 0x64, 0x00, 0x00, 0x3e, 0x20, 0x02,
+ 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0xe0,
+ 0x64, 0x02, 0x00, 0x3e, 0x21, 0x02, 0x00, 0x00,
+ 0x01, 0x00, 0xcf, 0x0b, 0x0a, 0x49, 0x22, 0x02,
+ 0x00, 0x00, 0x0a, 0x49, 0x89, 0x00, 0x00, 0x00,
+ 0x24, 0x02, 0x00, 0xcb, 0x3e, 0x83, 0x00, 0x00,
+ 0x00, 0x02, 0x00, 0xde, 0x5b, 0x04, 0x00, 0x24,
+ 0x02, 0x00, 0x0e, 0x0e, 0x29, 0xc8, 0x6b, 0x0c,
+ 0x00, 0x00, 0x00, 0x5b, 0x04, 0x00, 0xc4, 0xed,
+ 0x0e, 0x0e, 0x29, 0x30, 0x0c, 0x43, 0x02, 0x01,
+ 0xc8, 0x07, 0x01, 0x01, 0x01, 0x04, 0x00, 0x0b,
+ 0x00, 0xee, 0x01, 0x02, 0x00, 0x01, 0x00, 0x00,
+ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1a, 0x00,
+ 0x00, 0x16, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00,
+ 0x00, 0x00, 0x1a, 0x00, 0x00, 0x07, 0x00, 0x00,
+ 0x00, 0x08, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00,
+ 0x00, 0x04, 0x00, 0x00, 0x00, 0x67, 0x00, 0x00,
+ 0x00, 0x00, 0x01, 0x00, 0x00, 0x72, 0x00, 0x00,
+ 0x0a, 0xc7, 0xcf, 0x3d, 0x44, 0x00, 0x00, 0x00,
+ 0x00, 0x00, 0xd3, 0x64, 0x00, 0x00, 0x3e, 0x20,
+ 0x02, 0x00, 0x00, 0x01, 0x00, 0x24, 0x00, 0x00,
+ 0xdc, 0x9c, 0xe1, 0x64, 0x03, 0x00, 0x3e, 0x70,
+ 0x01, 0x00, 0x00, 0x02, 0x00, 0x5b, 0x04, 0x00,
+ 0x5b, 0x05, 0x00, 0x3d, 0x1d, 0x01, 0x00, 0x00,
+ 0x03, 0x00, 0x43, 0x24, 0x01, 0x00, 0x0e, 0x5b,
+ 0x06, 0x00, 0xe8, 0x66, 0xcf, 0x95, 0x04, 0x4a,
+ 0x00, 0x00, 0x00, 0xa7, 0xe8, 0x2a, 0xcf, 0x5b,
+ 0x07, 0x00, 0x3e, 0xfa, 0x01, 0x00, 0x00, 0x04,
+ 0x00, 0xcf, 0x24, 0x01, 0x00, 0xa9, 0xe8, 0x18,
+ 0x64, 0x03, 0x00, 0x3e, 0x70, 0x01, 0x00, 0x00,
+ 0x05, 0x00, 0x5b, 0x08, 0x00, 0xcf, 0xed, 0x24,
+ 0x01, 0x00, 0x0e, 0x09, 0xc7, 0xea, 0x33, 0xcf,
+ 0x95, 0x04, 0x90, 0x00, 0x00, 0x00, 0xa7, 0xe8,
+ 0x29, 0x64, 0x03, 0x00, 0x3e, 0x70, 0x01, 0x00,
+ 0x00, 0x06, 0x00, 0x5b, 0x08, 0x00, 0xcf, 0xed,
+ 0x24, 0x01, 0x00, 0x0e, 0x64, 0x03, 0x00, 0x3e,
+ 0x70, 0x01, 0x00, 0x00, 0x07, 0x00, 0x04, 0x23,
+ 0x02, 0x00, 0x00, 0x24, 0x01, 0x00, 0x0e, 0x09,
+ 0xc7, 0xc3, 0xe8, 0x10, 0x64, 0x03, 0x00, 0x3e,
+ 0x24, 0x02, 0x00, 0x00, 0x08, 0x00, 0xcf, 0x24,
+ 0x01, 0x00, 0x0e, 0x64, 0x03, 0x00, 0x3e, 0x70,
+ 0x01, 0x00, 0x00, 0x09, 0x00, 0x04, 0x2a, 0x01,
+ 0x00, 0x00, 0x24, 0x01, 0x00, 0x0e, 0x64, 0x03,
+ 0x00, 0x3e, 0x70, 0x01, 0x00, 0x00, 0x0a, 0x00,
+ 0x5b, 0x04, 0x00, 0x3d, 0xf5, 0x00, 0x00, 0x00,
+ 0x0b, 0x00, 0x24, 0x01, 0x00, 0x0e, 0x5b, 0x09,
+ 0x00, 0xcf, 0x3f, 0x65, 0x01, 0x00, 0x00, 0x0c,
+ 0x00, 0x5b, 0x0a, 0x00, 0xec, 0x29, 0x0c, 0x43,
+ 0x02, 0x01, 0xca, 0x07, 0x01, 0x00, 0x01, 0x04,
+ 0x00, 0x05, 0x00, 0x70, 0x01, 0x00, 0x01, 0x00,
+ 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x07, 0x00,
+ 0x00, 0x00, 0x08, 0x00, 0x00, 0xc4, 0x02, 0x06,
+ 0x03, 0x00, 0x00, 0x72, 0x00, 0x00, 0x64, 0x00,
+ 0x00, 0x3e, 0x70, 0x01, 0x00, 0x00, 0x00, 0x00,
+ 0xdc, 0xdd, 0x3d, 0x1e, 0x01, 0x00, 0x00, 0x01,
+ 0x00, 0x43, 0x24, 0x01, 0x00, 0x0e, 0xcf, 0x38,
+ 0x03, 0x00, 0xa5, 0x94, 0xe8, 0x14, 0x64, 0x00,
+ 0x00, 0x3e, 0x70, 0x01, 0x00, 0x00, 0x02, 0x00,
+ 0x04, 0x25, 0x02, 0x00, 0x00, 0x24, 0x01, 0x00,
+ 0x0e, 0x64, 0x00, 0x00, 0x3e, 0x24, 0x02, 0x00,
+ 0x00, 0x03, 0x00, 0xcf, 0x24, 0x01, 0x00, 0x0e,
+ 0x64, 0x00, 0x00, 0x3e, 0x70, 0x01, 0x00, 0x00,
+ 0x04, 0x00, 0x04, 0x2a, 0x01, 0x00, 0x00, 0x24,
+ 0x01, 0x00, 0x0e, 0x64, 0x00, 0x00, 0x3e, 0x70,
+ 0x01, 0x00, 0x00, 0x05, 0x00, 0xdc, 0x3d, 0xf5,
+ 0x00, 0x00, 0x00, 0x06, 0x00, 0x24, 0x01, 0x00,
+ 0x0e, 0x5b, 0x04, 0x00, 0xec, 0x29, 0x0c, 0x43,
+ 0x02, 0x01, 0xcc, 0x07, 0x00, 0x00, 0x00, 0x02,
+ 0x00, 0x03, 0x00, 0x13, 0x00, 0x00, 0x19, 0x00,
+ 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x6c, 0x00,
+ 0x00, 0xb3, 0xdf, 0x64, 0x01, 0x00, 0x3e, 0x26,
+ 0x02, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00,
+ 0x0e, 0xdd, 0xec, 0x29, 0x0c, 0x43, 0x02, 0x01,
+ 0xce, 0x07, 0x01, 0x17, 0x01, 0x04, 0x0f, 0x03,
+ 0x0a, 0xd9, 0x03, 0x18, 0x00, 0x01, 0x06, 0x40,
+ 0x00, 0x00, 0x04, 0x40, 0x00, 0x01, 0x08, 0x40,
+ 0x00, 0x02, 0x0a, 0x40, 0x00, 0x03, 0x05, 0x40,
+ 0x00, 0x04, 0x02, 0x40, 0x00, 0x05, 0x00, 0x40,
+ 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00,
+ 0x00, 0x08, 0x09, 0x40, 0x00, 0x09, 0x0e, 0x40,
+ 0x00, 0x0a, 0x03, 0x40, 0x00, 0x0b, 0x01, 0x40,
+ 0x00, 0x0c, 0x07, 0x40, 0x00, 0x0d, 0x00, 0x00,
+ 0x00, 0x0e, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00,
+ 0x00, 0x10, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00,
+ 0x00, 0x12, 0x0b, 0x40, 0x00, 0x13, 0x0c, 0x40,
+ 0x00, 0x14, 0x0d, 0x40, 0x00, 0x15, 0x00, 0x00,
+ 0x00, 0x16, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00,
+ 0x00, 0x31, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00,
+ 0xbe, 0x00, 0xc1, 0x0a, 0xbe, 0x01, 0xc1, 0x0b,
+ 0xbe, 0x02, 0xc1, 0x0c, 0xbe, 0x03, 0xc1, 0x0d,
+ 0xbe, 0x04, 0xc1, 0x0e, 0xbe, 0x05, 0xc1, 0x0f,
+ 0xbe, 0x06, 0xc1, 0x10, 0xbe, 0x07, 0xc1, 0x11,
+ 0xbe, 0x08, 0xc1, 0x15, 0xbe, 0x09, 0xc1, 0x16,
+ 0xcf, 0xe7, 0xca, 0xbf, 0xc1, 0x05, 0xb3, 0xc1,
+ 0x06, 0xb4, 0xc1, 0x08, 0x26, 0x00, 0x00, 0xc1,
+ 0x09, 0x04, 0x27, 0x02, 0x00, 0x00, 0xc1, 0x12,
+ 0x04, 0x28, 0x02, 0x00, 0x00, 0xc1, 0x13, 0x04,
+ 0x29, 0x02, 0x00, 0x00, 0xc1, 0x14, 0xb3, 0xc7,
+ 0xc3, 0xc6, 0xa1, 0x68, 0x75, 0x01, 0x00, 0x00,
+ 0x07, 0xc1, 0x04, 0xc3, 0xc9, 0xcf, 0xc3, 0x8f,
+ 0xc7, 0x43, 0xcc, 0x11, 0x04, 0xfd, 0x01, 0x00,
+ 0x00, 0xa9, 0xe9, 0x1c, 0x11, 0x04, 0x29, 0x01,
+ 0x00, 0x00, 0xa9, 0xe9, 0x13, 0x11, 0x04, 0x2c,
+ 0x01, 0x00, 0x00, 0xa9, 0xe9, 0x0a, 0x11, 0x04,
+ 0x2a, 0x01, 0x00, 0x00, 0xa9, 0xe8, 0x04, 0x0e,
+ 0xea, 0xc7, 0x11, 0x04, 0x2a, 0x02, 0x00, 0x00,
+ 0xa9, 0xe9, 0x0a, 0x11, 0x04, 0x04, 0x02, 0x00,
+ 0x00, 0xa9, 0xe8, 0x18, 0xc3, 0xc6, 0xf8, 0xe8,
+ 0x0d, 0xcf, 0xc3, 0x43, 0xc4, 0xa7, 0xe8, 0x06,
+ 0x91, 0x00, 0x0e, 0xea, 0xa4, 0xb4, 0xc1, 0x08,
+ 0x0e, 0xea, 0x9e, 0x11, 0x04, 0xef, 0x01, 0x00,
+ 0x00, 0xa9, 0xe8, 0x44, 0xc3, 0xc6, 0xf8, 0xe8,
+ 0x13, 0xcf, 0xc3, 0x43, 0x04, 0x81, 0x00, 0x00,
+ 0x00, 0xa7, 0xe8, 0x08, 0xc0, 0x0d, 0xec, 0x0e,
+ 0xeb, 0xe7, 0x00, 0xc3, 0xc6, 0xf8, 0xe8, 0x13,
+ 0xcf, 0xc3, 0x43, 0x04, 0xef, 0x01, 0x00, 0x00,
+ 0xa7, 0xe8, 0x08, 0xc0, 0x0e, 0xec, 0x0e, 0xeb,
+ 0xd0, 0x00, 0xc0, 0x08, 0xe8, 0x0b, 0xc0, 0x10,
+ 0xec, 0x0e, 0xb3, 0xc1, 0x08, 0xeb, 0xc2, 0x00,
+ 0xb4, 0xc1, 0x08, 0x0e, 0xeb, 0x53, 0xff, 0x11,
+ 0x04, 0xeb, 0x01, 0x00, 0x00, 0xa9, 0xe9, 0x13,
+ 0x11, 0x04, 0xec, 0x01, 0x00, 0x00, 0xa9, 0xe9,
+ 0x0a, 0x11, 0x04, 0x2b, 0x02, 0x00, 0x00, 0xa9,
+ 0xe8, 0x0c, 0xc0, 0x0f, 0xc4, 0xed, 0x0e, 0xb3,
+ 0xc1, 0x08, 0xeb, 0x95, 0x00, 0x11, 0x04, 0xf7,
+ 0x01, 0x00, 0x00, 0xa9, 0xe9, 0x13, 0x11, 0x04,
+ 0x01, 0x02, 0x00, 0x00, 0xa9, 0xe9, 0x0a, 0x11,
+ 0x04, 0x2c, 0x02, 0x00, 0x00, 0xa9, 0xe8, 0x0f,
+ 0xb4, 0xc1, 0x08, 0x91, 0x06, 0xc0, 0x0a, 0xc4,
+ 0xed, 0x0e, 0x0e, 0xeb, 0x04, 0xff, 0x11, 0x04,
+ 0xf8, 0x01, 0x00, 0x00, 0xa9, 0xe9, 0x13, 0x11,
+ 0x04, 0xed, 0x01, 0x00, 0x00, 0xa9, 0xe9, 0x0a,
+ 0x11, 0x04, 0xee, 0x01, 0x00, 0x00, 0xa9, 0xe8,
+ 0x25, 0xb3, 0xc1, 0x08, 0xc0, 0x06, 0xb3, 0xf9,
+ 0xe8, 0x13, 0xdc, 0xc0, 0x0b, 0xec, 0xc4, 0xee,
+ 0xe8, 0x0b, 0x90, 0x06, 0xc0, 0x0c, 0xec, 0x0e,
+ 0x0e, 0xeb, 0xce, 0xfe, 0x04, 0x1c, 0x01, 0x00,
+ 0x00, 0xc1, 0x04, 0xea, 0x2c, 0xdd, 0xc4, 0xed,
+ 0xe8, 0x0a, 0xc0, 0x11, 0xec, 0x0e, 0xb3, 0xc1,
+ 0x08, 0xea, 0x1e, 0xdb, 0xc4, 0xed, 0x11, 0xe9,
+ 0x09, 0x0e, 0xc4, 0x04, 0x66, 0x01, 0x00, 0x00,
+ 0xa7, 0xe8, 0x07, 0xc0, 0x15, 0xec, 0x0e, 0xea,
+ 0x08, 0xb4, 0xc1, 0x08, 0x0e, 0xeb, 0x9a, 0xfe,
+ 0x0e, 0xc0, 0x04, 0x68, 0x94, 0xfe, 0xff, 0xff,
+ 0xc0, 0x16, 0xc5, 0xc3, 0xee, 0x0e, 0xeb, 0x89,
+ 0xfe, 0xc0, 0x16, 0xc6, 0xc6, 0xee, 0x0e, 0xc0,
+ 0x05, 0xc0, 0x06, 0xc0, 0x09, 0x26, 0x03, 0x00,
+ 0x28, 0x0c, 0x43, 0x02, 0x01, 0xda, 0x08, 0x01,
+ 0x00, 0x01, 0x02, 0x00, 0x01, 0x00, 0x05, 0x01,
+ 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
+ 0xdb, 0xcf, 0x9b, 0xdf, 0x29, 0x0c, 0x43, 0x02,
+ 0x01, 0xdc, 0x08, 0x01, 0x00, 0x01, 0x04, 0x00,
+ 0x01, 0x00, 0x0f, 0x01, 0x00, 0x01, 0x00, 0x00,
+ 0x00, 0x05, 0x00, 0x00, 0xdb, 0x3e, 0x71, 0x01,
+ 0x00, 0x00, 0x00, 0x00, 0xdb, 0xe7, 0xb4, 0x9c,
+ 0x25, 0x01, 0x00, 0x0c, 0x43, 0x02, 0x01, 0xde,
+ 0x08, 0x01, 0x00, 0x01, 0x05, 0x00, 0x02, 0x00,
+ 0x16, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0b,
+ 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0xdb, 0xec,
+ 0xd3, 0xdc, 0x3e, 0x71, 0x01, 0x00, 0x00, 0x00,
+ 0x00, 0xb3, 0xdc, 0xe7, 0xb4, 0x9c, 0x24, 0x02,
+ 0x00, 0xe0, 0xcf, 0x28, 0x0c, 0x43, 0x02, 0x01,
+ 0xe0, 0x08, 0x00, 0x00, 0x00, 0x03, 0x00, 0x06,
+ 0x00, 0x49, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+ 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+ 0x03, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+ 0x0c, 0x00, 0x00, 0x04, 0x17, 0x01, 0x00, 0x00,
+ 0xdf, 0xdc, 0x04, 0xef, 0x01, 0x00, 0x00, 0xed,
+ 0x0e, 0xdd, 0x8d, 0xe1, 0xdd, 0xde, 0xb4, 0x9c,
+ 0xf8, 0xe8, 0x31, 0x5b, 0x04, 0x00, 0xdd, 0x43,
+ 0x04, 0x81, 0x00, 0x00, 0x00, 0xa7, 0xe8, 0x1f,
+ 0x5b, 0x04, 0x00, 0xdd, 0xb4, 0x9b, 0x43, 0x04,
+ 0xef, 0x01, 0x00, 0x00, 0xa7, 0xe8, 0x10, 0xdd,
+ 0xb5, 0x9b, 0xe1, 0x5b, 0x05, 0x00, 0x04, 0xef,
+ 0x01, 0x00, 0x00, 0xed, 0x0e, 0x29, 0xdd, 0x8d,
+ 0xe1, 0xea, 0xca, 0x29, 0x0c, 0x43, 0x02, 0x01,
+ 0xe2, 0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x04,
+ 0x00, 0x1f, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+ 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+ 0x00, 0x01, 0x00, 0x04, 0x17, 0x01, 0x00, 0x00,
+ 0xdf, 0xdc, 0x8d, 0xe0, 0xdc, 0xdd, 0xf8, 0xe8,
+ 0x11, 0xde, 0xdc, 0x43, 0x04, 0x2a, 0x01, 0x00,
+ 0x00, 0xa7, 0xe9, 0x06, 0xdc, 0x8d, 0xe0, 0xea,
+ 0xec, 0x29, 0x0c, 0x43, 0x02, 0x01, 0xe4, 0x08,
+ 0x01, 0x00, 0x01, 0x03, 0x00, 0x07, 0x00, 0x4c,
+ 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00,
+ 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
+ 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x01,
+ 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x00,
+ 0x00, 0x04, 0x4c, 0x00, 0x00, 0x00, 0xdf, 0xdc,
+ 0xcf, 0xed, 0x0e, 0xdd, 0xde, 0xf8, 0xe8, 0x3d,
+ 0x5b, 0x04, 0x00, 0xdd, 0x8f, 0xe1, 0x43, 0x5d,
+ 0x05, 0x00, 0x04, 0x2a, 0x01, 0x00, 0x00, 0xa7,
+ 0xe8, 0x09, 0x04, 0x1c, 0x01, 0x00, 0x00, 0xdf,
+ 0xea, 0xe2, 0x5b, 0x05, 0x00, 0x04, 0x06, 0x02,
+ 0x00, 0x00, 0xa7, 0xe8, 0x0b, 0xdd, 0xde, 0xa4,
+ 0xe9, 0x13, 0xdd, 0x8d, 0xe1, 0xea, 0xcd, 0x5b,
+ 0x05, 0x00, 0xcf, 0xa7, 0xe8, 0xc6, 0x5b, 0x06,
+ 0x00, 0xec, 0x0e, 0x29, 0x29, 0x0c, 0x43, 0x02,
+ 0x01, 0xe6, 0x08, 0x00, 0x00, 0x00, 0x03, 0x00,
+ 0x09, 0x00, 0xc4, 0x01, 0x00, 0x00, 0x04, 0x00,
+ 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
+ 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x01,
+ 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0b, 0x00,
+ 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x02,
+ 0x00, 0x04, 0x18, 0x01, 0x00, 0x00, 0xdf, 0xdc,
+ 0x04, 0xef, 0x01, 0x00, 0x00, 0xed, 0x0e, 0xdd,
+ 0xde, 0xa1, 0x68, 0xb1, 0x00, 0x00, 0x00, 0x5b,
+ 0x04, 0x00, 0xdd, 0x8f, 0xe1, 0x43, 0x5d, 0x05,
+ 0x00, 0x04, 0x2a, 0x01, 0x00, 0x00, 0xa7, 0xe8,
+ 0x09, 0x04, 0x1c, 0x01, 0x00, 0x00, 0xdf, 0xea,
+ 0xdf, 0x5b, 0x05, 0x00, 0x04, 0x06, 0x02, 0x00,
+ 0x00, 0xa7, 0xe8, 0x0b, 0xdd, 0xde, 0xf8, 0xe8,
+ 0xcf, 0xdd, 0x8d, 0xe1, 0xea, 0xca, 0x5b, 0x06,
+ 0x00, 0xec, 0x04, 0x01, 0x02, 0x00, 0x00, 0xa7,
+ 0xe8, 0x13, 0x5b, 0x05, 0x00, 0x04, 0xed, 0x01,
+ 0x00, 0x00, 0xa7, 0xe8, 0xb3, 0x5b, 0x07, 0x00,
+ 0xec, 0x0e, 0xea, 0xac, 0x5b, 0x05, 0x00, 0x04,
+ 0x01, 0x02, 0x00, 0x00, 0xa7, 0xe8, 0x2e, 0xdc,
+ 0x04, 0x01, 0x02, 0x00, 0x00, 0xed, 0x0e, 0x5b,
+ 0x04, 0x00, 0xdd, 0x43, 0x04, 0x01, 0x02, 0x00,
+ 0x00, 0xa7, 0x11, 0xe9, 0x0d, 0x0e, 0x5b, 0x04,
+ 0x00, 0xdd, 0x43, 0x04, 0xed, 0x01, 0x00, 0x00,
+ 0xa7, 0x68, 0x7d, 0xff, 0xff, 0xff, 0xdd, 0x8d,
+ 0xe1, 0xeb, 0x75, 0xff, 0x5b, 0x05, 0x00, 0x04,
+ 0xef, 0x01, 0x00, 0x00, 0xa7, 0x68, 0x69, 0xff,
+ 0xff, 0xff, 0x5b, 0x07, 0x00, 0xec, 0x0e, 0xdd,
+ 0xde, 0xf8, 0xe8, 0x11, 0x5b, 0x08, 0x00, 0x5b,
+ 0x04, 0x00, 0xdd, 0x43, 0xed, 0xe8, 0x06, 0xdd,
+ 0x8d, 0xe1, 0xea, 0xec, 0x29, 0x0c, 0x43, 0x02,
+ 0x01, 0xe8, 0x08, 0x00, 0x00, 0x00, 0x03, 0x00,
+ 0x05, 0x00, 0x41, 0x00, 0x00, 0x04, 0x00, 0x00,
+ 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+ 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00,
+ 0x04, 0x4a, 0x00, 0x00, 0x00, 0xdf, 0xdc, 0xdd,
+ 0xf8, 0xe8, 0x36, 0xde, 0x5b, 0x04, 0x00, 0xdc,
+ 0x43, 0xed, 0x11, 0xe9, 0x25, 0x0e, 0x5b, 0x04,
+ 0x00, 0xdc, 0x43, 0x04, 0xea, 0x01, 0x00, 0x00,
+ 0xa7, 0xe8, 0x1e, 0xdc, 0xdd, 0xb4, 0x9c, 0xa7,
+ 0x11, 0xe9, 0x0f, 0x0e, 0x5b, 0x04, 0x00, 0xdc,
+ 0xb4, 0x9b, 0x43, 0x04, 0xea, 0x01, 0x00, 0x00,
+ 0xa8, 0xe8, 0x06, 0xdc, 0x8d, 0xe0, 0xea, 0xc7,
+ 0x29, 0x0c, 0x43, 0x02, 0x01, 0xea, 0x08, 0x00,
+ 0x02, 0x00, 0x05, 0x00, 0x0a, 0x00, 0xbb, 0x01,
+ 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+ 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+ 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x02,
+ 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0x00,
+ 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x04, 0x00,
+ 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x14, 0x00,
+ 0x00, 0xb4, 0xdf, 0xdc, 0xdd, 0xf8, 0xe8, 0x0f,
+ 0xde, 0x5b, 0x04, 0x00, 0xdc, 0x43, 0xed, 0xe8,
+ 0x06, 0xdc, 0x8d, 0xe0, 0xea, 0xee, 0x04, 0x36,
+ 0x02, 0x00, 0x00, 0x5b, 0x04, 0x00, 0x3e, 0x71,
+ 0x01, 0x00, 0x00, 0x00, 0x00, 0x5b, 0x05, 0x00,
+ 0xdc, 0x24, 0x02, 0x00, 0x9b, 0x04, 0x36, 0x02,
+ 0x00, 0x00, 0x9b, 0xc7, 0x5b, 0x06, 0x00, 0x3e,
+ 0xe9, 0x01, 0x00, 0x00, 0x01, 0x00, 0xc3, 0x24,
+ 0x01, 0x00, 0xb3, 0xa4, 0xe8, 0x1e, 0x04, 0x19,
+ 0x01, 0x00, 0x00, 0x5c, 0x07, 0x00, 0x5b, 0x08,
+ 0x00, 0x3e, 0xe9, 0x01, 0x00, 0x00, 0x02, 0x00,
+ 0xc3, 0x24, 0x01, 0x00, 0xb3, 0xa4, 0xe8, 0x03,
+ 0xb3, 0xdf, 0x29, 0xdc, 0xc8, 0xc4, 0xdd, 0xf8,
+ 0xe8, 0x12, 0x5b, 0x04, 0x00, 0xc4, 0x43, 0x04,
+ 0xfd, 0x01, 0x00, 0x00, 0xa7, 0xe8, 0x05, 0xfa,
+ 0x01, 0xea, 0xeb, 0xc4, 0xdd, 0xf8, 0xe8, 0x17,
+ 0x5b, 0x04, 0x00, 0xc4, 0x43, 0x04, 0xf7, 0x01,
+ 0x00, 0x00, 0xa7, 0xe8, 0x0a, 0x04, 0x1b, 0x00,
+ 0x00, 0x00, 0x5c, 0x07, 0x00, 0x29, 0x5b, 0x09,
+ 0x00, 0x3e, 0xe9, 0x01, 0x00, 0x00, 0x03, 0x00,
+ 0xc3, 0x24, 0x01, 0x00, 0xb3, 0xa4, 0xe8, 0x0a,
+ 0x04, 0x1a, 0x01, 0x00, 0x00, 0x5c, 0x07, 0x00,
+ 0x29, 0x04, 0x1b, 0x01, 0x00, 0x00, 0x5c, 0x07,
+ 0x00, 0xb3, 0xdf, 0x29, 0x0c, 0x43, 0x02, 0x01,
+ 0xee, 0x08, 0x02, 0x00, 0x02, 0x03, 0x00, 0x02,
+ 0x00, 0x2f, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00,
+ 0x01, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+ 0x04, 0x00, 0x00, 0xdb, 0xe7, 0xcf, 0xf8, 0xe8,
+ 0x14, 0xdb, 0x3e, 0x8c, 0x01, 0x00, 0x00, 0x00,
+ 0x00, 0x04, 0x16, 0x00, 0x00, 0x00, 0x24, 0x01,
+ 0x00, 0x0e, 0xea, 0xe8, 0xdb, 0xe7, 0xd0, 0xf8,
+ 0xe8, 0x10, 0xdb, 0x3e, 0x8c, 0x01, 0x00, 0x00,
+ 0x01, 0x00, 0xdc, 0x24, 0x01, 0x00, 0x0e, 0xea,
+ 0xec, 0x29,
+};
+
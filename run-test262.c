@@ -34,6 +34,7 @@
 #include <time.h>
 #include <dirent.h>
 #include <ftw.h>
+#include <pthread.h>
 
 #include "cutils.h"
 #include "list.h"
@@ -42,6 +43,11 @@
 /* enable test262 thread support to test SharedArrayBuffer and Atomics */
 #define CONFIG_AGENT
 
+#if !defined(_WIN32)
+/* enable the parallel execution of the tests (needs open_memstream()) */
+#define CONFIG_PARALLEL
+#endif
+
 #define CMD_NAME "run-test262"
 
 typedef struct namelist_t {
@@ -55,7 +61,10 @@ namelist_t test_list;
 namelist_t exclude_list;
 namelist_t exclude_dir_list;
 
-FILE *outfile;
+/* The variables marked as __thread hold the output and the results of
+   the test run by the current thread. With '-j', the worker threads
+   buffer them and the main thread merges them in the test order. */
+__thread FILE *outfile;
 enum test_mode_t {
     TEST_DEFAULT_NOSTRICT, /* run tests as nostrict unless test is flagged as strictonly */
     TEST_DEFAULT_STRICT,   /* run tests as strict unless test is flagged as nostrict */
@@ -81,12 +90,33 @@ char *harness_skip_features;
 int *harness_skip_features_count;
 char *error_filename;
 char *error_file;
-FILE *error_out;
+__thread FILE *error_out;
+__thread FILE *log_out; /* messages output on stdout */
 char *report_filename;
 int update_errors;
-int test_count, test_failed, test_index, test_skipped, test_excluded;
-int new_errors, changed_errors, fixed_errors;
-int async_done;
+__thread int test_count, test_failed, test_skipped;
+int test_index, test_excluded;
+__thread int new_errors, changed_errors, fixed_errors;
+__thread int async_done;
+int nb_jobs = 1;
+/* protects the memory statistics and the skipped feature counts */
+static pthread_mutex_t stats_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+static int64_t get_clock_ms(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000 + (ts.tv_nsec / 1000000);
+}
+
+/* CPU time of the current thread. clock() would include the time of
+   the tests running in the other threads. */
+static int64_t get_thread_clock_ms(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return (uint64_t)ts.tv_sec * 1000 + (ts.tv_nsec / 1000000);
+}
 
 void warning(const char *, ...) __attribute__((__format__(__printf__, 1, 2)));
 void fatal(int, const char *, ...) __attribute__((__format__(__printf__, 2, 3)));
@@ -435,12 +465,12 @@ static JSValue js_evalScript(JSContext *ctx, JSValue this_val,
 
 #ifdef CONFIG_AGENT
 
-#include <pthread.h>
-
 typedef struct {
     struct list_head link;
     pthread_t tid;
     char *script;
+    FILE *outfile; /* outfile of the test */
+    struct list_head *report_list; /* report_list of the test */
     JSValue broadcast_func;
     BOOL broadcast_pending;
     JSValue broadcast_sab; /* in the main context */
@@ -459,12 +489,18 @@ static void add_helpers(JSContext *ctx);
 
 static pthread_mutex_t agent_mutex = PTHREAD_MUTEX_INITIALIZER;
 static pthread_cond_t agent_cond = PTHREAD_COND_INITIALIZER;
-/* list of Test262Agent.link */
-static struct list_head agent_list = LIST_HEAD_INIT(agent_list);
+/* list of Test262Agent.link of the current test */
+static __thread struct list_head agent_list;
 
 static pthread_mutex_t report_mutex = PTHREAD_MUTEX_INITIALIZER;
-/* list of AgentReport.link */
-static struct list_head report_list = LIST_HEAD_INIT(report_list);
+/* list of AgentReport.link of the current test */
+static __thread struct list_head report_list;
+
+static void js_agent_init(void)
+{
+    init_list_head(&agent_list);
+    init_list_head(&report_list);
+}
 
 static void *agent_start(void *arg)
 {
@@ -474,6 +510,7 @@ static void *agent_start(void *arg)
     JSValue ret_val;
     int ret;
 
+    outfile = agent->outfile; /* for js_print */
     rt = JS_NewRuntime();
     if (rt == NULL) {
         fatal(1, "JS_NewRuntime failure");
@@ -558,6 +595,8 @@ static JSValue js_agent_start(JSContext *ctx, JSValue this_val,
     agent->broadcast_func = JS_UNDEFINED;
     agent->broadcast_sab = JS_UNDEFINED;
     agent->script = strdup(script);
+    agent->outfile = outfile;
+    agent->report_list = &report_list;
     JS_FreeCString(ctx, script);
     list_add_tail(&agent->link, &agent_list);
     pthread_attr_init(&attr);
@@ -573,6 +612,7 @@ static void js_agent_free(JSContext *ctx)
 {
     struct list_head *el, *el1;
     Test262Agent *agent;
+    AgentReport *rep;
 
     list_for_each_safe(el, el1, &agent_list) {
         agent = list_entry(el, Test262Agent, link);
@@ -581,6 +621,13 @@ static void js_agent_free(JSContext *ctx)
         list_del(&agent->link);
         free(agent);
     }
+    /* the agents have exited: free the reports which were not read */
+    list_for_each_safe(el, el1, &report_list) {
+        rep = list_entry(el, AgentReport, link);
+        list_del(&rep->link);
+        free(rep->str);
+        free(rep);
+    }
 }
 
 static JSValue js_agent_leaving(JSContext *ctx, JSValue this_val,
@@ -669,13 +716,6 @@ static JSValue js_agent_sleep(JSContext *ctx, JSValue this_val,
     return JS_UNDEFINED;
 }
 
-static int64_t get_clock_ms(void)
-{
-    struct timespec ts;
-    clock_gettime(CLOCK_MONOTONIC, &ts);
-    return (uint64_t)ts.tv_sec * 1000 + (ts.tv_nsec / 1000000);
-}
-
 static JSValue js_agent_monotonicNow(JSContext *ctx, JSValue this_val,
                                      int argc, JSValue *argv)
 {
@@ -709,6 +749,7 @@ static JSValue js_agent_getReport(JSContext *ctx, JSValue this_val,
 static JSValue js_agent_report(JSContext *ctx, JSValue this_val,
                                int argc, JSValue *argv)
 {
+    Test262Agent *agent = JS_GetContextOpaque(ctx);
     const char *str;
     AgentReport *rep;
 
@@ -720,7 +761,7 @@ static JSValue js_agent_report(JSContext *ctx, JSValue this_val,
     JS_FreeCString(ctx, str);
 
     pthread_mutex_lock(&report_mutex);
-    list_add_tail(&rep->link, &report_list);
+    list_add_tail(&rep->link, agent ? agent->report_list : &report_list);
     pthread_mutex_unlock(&report_mutex);
     return JS_UNDEFINED;
 }
@@ -1379,7 +1420,7 @@ static int eval_buf(JSContext *ctx, const char *buf, size_t buf_len,
                     if (!has_error_line) {
                         longest_match(buf, msg, pos, &pos, pos_line, &error_line);
                     }
-                    printf("%s:%d: %sOK, now has error %s\n",
+                    fprintf(log_out, "%s:%d: %sOK, now has error %s\n",
                            filename, error_line, strict_mode, msg);
                     fixed_errors++;
                 }
@@ -1410,7 +1451,7 @@ static int eval_buf(JSContext *ctx, const char *buf, size_t buf_len,
                             error_file ? "unexpected error: " : "", msg);
 
                     if (s && (!str_equal(s, msg) || error_line != s_line)) {
-                        printf("%s:%d: %sprevious error: %s\n", filename, s_line, strict_mode, s);
+                        fprintf(log_out, "%s:%d: %sprevious error: %s\n", filename, s_line, strict_mode, s);
                         changed_errors++;
                     } else {
                         new_errors++;
@@ -1418,7 +1459,7 @@ static int eval_buf(JSContext *ctx, const char *buf, size_t buf_len,
                 }
             } else {
                 if (s) {
-                    printf("%s:%d: %sOK, fixed error: %s\n", filename, s_line, strict_mode, s);
+                    fprintf(log_out, "%s:%d: %sOK, fixed error: %s\n", filename, s_line, strict_mode, s);
                     fixed_errors++;
                 }
             }
@@ -1614,6 +1655,9 @@ int run_test_buf(const char *filename, const char *harness, namelist_t *ip,
     /* loader for ES6 modules */
     JS_SetModuleLoaderFunc2(rt, NULL, js_module_loader_test, NULL, (void *)filename);
 
+#ifdef CONFIG_AGENT
+    js_agent_init();
+#endif
     add_helpers(ctx);
 
     for (i = 0; i < ip->count; i++) {
@@ -1628,7 +1672,9 @@ int run_test_buf(const char *filename, const char *harness, namelist_t *ip,
     ret = (ret != 0);
 
     if (dump_memory) {
+        pthread_mutex_lock(&stats_mutex);
         update_stats(rt, filename);
+        pthread_mutex_unlock(&stats_mutex);
     }
 #ifdef CONFIG_AGENT
     js_agent_free(ctx);
@@ -1742,12 +1788,15 @@ int run_test(const char *filename, int index)
                         /* feature is enabled */
                     } else if ((p1 = find_word(harness_skip_features, option)) != NULL) {
                         /* skip disabled feature */
-                        if (harness_skip_features_count)
+                        if (harness_skip_features_count) {
+                            pthread_mutex_lock(&stats_mutex);
                             harness_skip_features_count[p1 - harness_skip_features]++;
+                            pthread_mutex_unlock(&stats_mutex);
+                        }
                         skip |= 1;
                     } else {
                         /* feature is not listed: skip and warn */
-                        printf("%s:%d: unknown feature: %s\n", filename, 1, option);
+                        fprintf(log_out, "%s:%d: unknown feature: %s\n", filename, 1, option);
                         skip |= 1;
                     }
                     free(option);
@@ -1856,14 +1905,14 @@ int run_test(const char *filename, int index)
         test_skipped++;
         ret = -2;
     } else {
-        clock_t clocks;
+        int64_t clocks;
 
         if (is_module) {
             eval_flags = JS_EVAL_TYPE_MODULE;
         } else {
             eval_flags = JS_EVAL_TYPE_GLOBAL;
         }
-        clocks = clock();
+        clocks = get_thread_clock_ms();
         ret = 0;
         if (use_nostrict) {
             ret = run_test_buf(filename, harness, ip, buf, buf_len,
@@ -1875,10 +1924,10 @@ int run_test(const char *filename, int index)
                                 error_type, eval_flags | JS_EVAL_FLAG_STRICT,
                                 is_negative, is_async, can_block);
         }
-        clocks = clock() - clocks;
-        if (outfile && index >= 0 && clocks >= CLOCKS_PER_SEC / 10) {
+        clocks = get_thread_clock_ms() - clocks;
+        if (outfile && index >= 0 && clocks >= 100) {
             /* output timings for tests that take more than 100 ms */
-            fprintf(outfile, " time: %d ms\n", (int)(clocks * 1000LL / CLOCKS_PER_SEC));
+            fprintf(outfile, " time: %d ms\n", (int)clocks);
         }
     }
     namelist_free(&include_list);
@@ -1918,6 +1967,9 @@ int run_test262_harness_test(const char *filename, BOOL is_module)
     /* loader for ES6 modules */
     JS_SetModuleLoaderFunc2(rt, NULL, js_module_loader_test, NULL, (void *)filename);
 
+#ifdef CONFIG_AGENT
+    js_agent_init();
+#endif
     add_helpers(ctx);
 
     buf = load_file(filename, &buf_len);
@@ -2001,11 +2053,176 @@ void show_progress(int force) {
 
 static int slow_test_threshold;
 
+void run_test_timed(const char *filename, int index)
+{
+    int ti;
+    if (slow_test_threshold != 0) {
+        ti = get_clock_ms();
+    } else {
+        ti = 0;
+    }
+    run_test(filename, index);
+    if (slow_test_threshold != 0) {
+        ti = get_clock_ms() - ti;
+        if (ti >= slow_test_threshold)
+            fprintf(stderr, "\n%s (%d ms)\n", filename, ti);
+    }
+}
+
+#ifdef CONFIG_PARALLEL
+
+/* parallel test execution: the tests are run by 'nb_jobs' worker
+   threads. The outputs of each test are buffered and written by the
+   main thread in the test order, so that the report and error files
+   are identical to a sequential run. */
+
+typedef struct {
+    const char *filename;
+    int index;
+    BOOL done;
+    /* outputs of the test */
+    char *out_buf, *err_buf, *log_buf;
+    size_t out_len, err_len, log_len;
+    int test_count, test_failed, test_skipped;
+    int new_errors, changed_errors, fixed_errors;
+} TestJob;
+
+static pthread_mutex_t job_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t job_cond = PTHREAD_COND_INITIALIZER;
+static TestJob *job_tab;
+static int job_count, job_next;
+/* output files of the main thread */
+static FILE *job_outfile, *job_error_out;
+
+static void *test_worker(void *arg)
+{
+    TestJob *job;
+
+    for(;;) {
+        pthread_mutex_lock(&job_mutex);
+        if (job_next >= job_count) {
+            pthread_mutex_unlock(&job_mutex);
+            break;
+        }
+        job = &job_tab[job_next++];
+        pthread_mutex_unlock(&job_mutex);
+
+        /* the outputs going to the same file share the same buffer to
+           keep their relative order */
+        log_out = open_memstream(&job->log_buf, &job->log_len);
+        if (!log_out)
+            perror_exit(1, "open_memstream");
+        if (job_error_out == stdout) {
+            error_out = log_out;
+        } else {
+            error_out = open_memstream(&job->err_buf, &job->err_len);
+            if (!error_out)
+                perror_exit(1, "open_memstream");
+        }
+        if (!job_outfile) {
+            outfile = NULL;
+        } else if (job_outfile == stdout) {
+            outfile = log_out;
+        } else {
+            outfile = open_memstream(&job->out_buf, &job->out_len);
+            if (!outfile)
+                perror_exit(1, "open_memstream");
+        }
+        test_count = test_failed = test_skipped = 0;
+        new_errors = changed_errors = fixed_errors = 0;
+
+        run_test_timed(job->filename, job->index);
+
+        if (outfile && outfile != log_out)
+            fclose(outfile);
+        if (error_out != log_out)
+            fclose(error_out);
+        fclose(log_out);
+        outfile = error_out = log_out = NULL;
+
+        job->test_count = test_count;
+        job->test_failed = test_failed;
+        job->test_skipped = test_skipped;
+        job->new_errors = new_errors;
+        job->changed_errors = changed_errors;
+        job->fixed_errors = fixed_errors;
+
+        pthread_mutex_lock(&job_mutex);
+        job->done = TRUE;
+        pthread_cond_signal(&job_cond);
+        pthread_mutex_unlock(&job_mutex);
+    }
+    return NULL;
+}
+
+static void run_test_jobs(void)
+{
+    pthread_t *tids;
+    pthread_attr_t attr;
+    TestJob *job;
+    int i, n;
+
+    job_outfile = outfile;
+    job_error_out = error_out;
+    job_next = 0;
+    n = min_int(nb_jobs, job_count);
+    tids = malloc(sizeof(tids[0]) * max_int(n, 1));
+    pthread_attr_init(&attr);
+    /* same stack size as the main thread since the tests are run
+       with the default JS stack size limit */
+    pthread_attr_setstacksize(&attr, 8 << 20);
+    for(i = 0; i < n; i++) {
+        if (pthread_create(&tids[i], &attr, test_worker, NULL))
+            fatal(1, "cannot create thread");
+    }
+    pthread_attr_destroy(&attr);
+
+    for(i = 0; i < job_count; i++) {
+        job = &job_tab[i];
+        pthread_mutex_lock(&job_mutex);
+        while (!job->done)
+            pthread_cond_wait(&job_cond, &job_mutex);
+        pthread_mutex_unlock(&job_mutex);
+
+        if (job->out_buf) {
+            fwrite(job->out_buf, 1, job->out_len, job_outfile);
+            fflush(job_outfile);
+        }
+        if (job->err_buf)
+            fwrite(job->err_buf, 1, job->err_len, job_error_out);
+        fwrite(job->log_buf, 1, job->log_len, stdout);
+        free(job->out_buf);
+        free(job->err_buf);
+        free(job->log_buf);
+
+        test_count += job->test_count;
+        test_failed += job->test_failed;
+        test_skipped += job->test_skipped;
+        new_errors += job->new_errors;
+        changed_errors += job->changed_errors;
+        fixed_errors += job->fixed_errors;
+        show_progress(FALSE);
+    }
+
+    for(i = 0; i < n; i++)
+        pthread_join(tids[i], NULL);
+    free(tids);
+}
+
+#endif /* CONFIG_PARALLEL */
+
 void run_test_dir_list(namelist_t *lp, int start_index, int stop_index)
 {
     int i;
 
     namelist_sort(lp);
+#ifdef CONFIG_PARALLEL
+    if (nb_jobs > 1) {
+        job_tab = malloc(sizeof(job_tab[0]) * max_int(lp->count, 1));
+        memset(job_tab, 0, sizeof(job_tab[0]) * max_int(lp->count, 1));
+        job_count = 0;
+    }
+#endif
     for (i = 0; i < lp->count; i++) {
         const char *p = lp->array[i];
         if (namelist_find(&exclude_list, p) >= 0) {
@@ -2014,23 +2231,25 @@ void run_test_dir_list(namelist_t *lp, int start_index, int stop_index)
             test_skipped++;
         } else if (stop_index >= 0 && test_index > stop_index) {
             test_skipped++;
+#ifdef CONFIG_PARALLEL
+        } else if (nb_jobs > 1) {
+            job_tab[job_count].filename = p;
+            job_tab[job_count].index = test_index;
+            job_count++;
+#endif
         } else {
-            int ti;
-            if (slow_test_threshold != 0) {
-                ti = get_clock_ms();
-            } else {
-                ti = 0;
-            }
-            run_test(p, test_index);
-            if (slow_test_threshold != 0) {
-                ti = get_clock_ms() - ti;
-                if (ti >= slow_test_threshold)
-                    fprintf(stderr, "\n%s (%d ms)\n", p, ti);
-            }
+            run_test_timed(p, test_index);
             show_progress(FALSE);
         }
         test_index++;
     }
+#ifdef CONFIG_PARALLEL
+    if (nb_jobs > 1) {
+        run_test_jobs();
+        free(job_tab);
+        job_tab = NULL;
+    }
+#endif
     show_progress(TRUE);
 }
 
@@ -2050,6 +2269,7 @@ void help(void)
            "-u             update error file\n"
            "-v             verbose: output error messages\n"
            "-T duration    display tests taking more than 'duration' ms\n"
+           "-j n           run the tests in 'n' parallel threads\n"
            "-c file        read configuration from 'file'\n"
            "-d dir         run all test files in directory tree 'dir'\n"
            "-e file        load the known errors from 'file'\n"
@@ -2077,7 +2297,9 @@ int main(int argc, char **argv)
     BOOL is_test262_harness = FALSE;
     BOOL is_module = FALSE;
     BOOL count_skipped_features = FALSE;
-    clock_t clocks;
+    int64_t clocks;
+
+    log_out = stdout;
 
 #if !defined(_WIN32)
     compact = !isatty(STDERR_FILENO);
@@ -2091,7 +2313,7 @@ int main(int argc, char **argv)
         if (*arg != '-')
             break;
         optind++;
-        if (strstr("-c -d -e -x -f -r -E -T", arg))
+        if (strstr("-c -d -e -x -f -r -E -T -j", arg))
             optind++;
         if (strstr("-d -f", arg))
             ignore = "testdir"; // run only the tests from -d or -f
@@ -2140,6 +2362,14 @@ int main(int argc, char **argv)
             only_check_errors = TRUE;
         } else if (str_equal(arg, "-T")) {
             slow_test_threshold = atoi(get_opt_arg(arg, argv[optind++]));
+        } else if (str_equal(arg, "-j")) {
+            nb_jobs = max_int(atoi(get_opt_arg(arg, argv[optind++])), 1);
+#ifndef CONFIG_PARALLEL
+            if (nb_jobs > 1) {
+                warning("parallel execution is not supported");
+                nb_jobs = 1;
+            }
+#endif
         } else if (str_equal(arg, "-N")) {
             is_test262_harness = TRUE;
         } else if (str_equal(arg, "--module")) {
@@ -2178,7 +2408,7 @@ int main(int argc, char **argv)
 
     update_exclude_dirs();
 
-    clocks = clock();
+    clocks = get_clock_ms();
 
     if (count_skipped_features) {
         /* not storage efficient but it is simple */
@@ -2224,7 +2454,7 @@ int main(int argc, char **argv)
         }
     }
 
-    clocks = clock() - clocks;
+    clocks = get_clock_ms() - clocks;
 
     if (dump_memory) {
         if (dump_memory > 1 && stats_count > 1) {
@@ -2279,7 +2509,7 @@ int main(int argc, char **argv)
         }
         fprintf(stderr, "\n");
         if (show_timings)
-            fprintf(stderr, "Total time: %.3fs\n", (double)clocks / CLOCKS_PER_SEC);
+            fprintf(stderr, "Total time: %.3fs\n", (double)clocks / 1000);
     }
 
     if (error_out && error_out != stdout) {
@@ -0,0 +1,69 @@
+/* GC pause benchmark: allocates cyclic garbage while a large heap is
+   alive and reports the percentiles of the time taken by each step.
+   The slow steps are the ones containing a GC pause.
+
+   usage: qjs [--gc-pause n] tests/gcbench.js [live_objects [steps]]
+*/
+
+function make_live_heap(n)
+{
+    var tab, i;
+    tab = [];
+    for(i = 0; i < n; i++) {
+        tab.push({ id: i, next: null, data: [ i, i + 1 ] });
+        if (i > 0)
+            tab[i - 1].next = tab[i];
+    }
+    return tab;
+}
+
+/* create 'n' small cycles and keep some of them alive for a while */
+function step(n, keep, k)
+{
+    var i, a, b;
+    for(i = 0; i < n; i++) {
+        a = { b: null, v: i };
+        b = { a: a, v: [ i ] };
+        a.b = b;
+        if ((i & 15) == 0)
+            keep[k++ % keep.length] = a;
+    }
+    return k;
+}
+
+function percentile(tab, p)
+{
+    return tab[Math.min(tab.length - 1, Math.floor(tab.length * p / 100))];
+}
+
+function main(args)
+{
+    var live_count, step_count, live, keep, times, i, t, k, total;
+
+    live_count = args[1] ? parseInt(args[1]) : 500000;
+    step_count = args[2] ? parseInt(args[2]) : 2000;
+
+    live = make_live_heap(live_count);
+    keep = new Array(10000);
+    times = [];
+    k = 0;
+    total = performance.now();
+    for(i = 0; i < step_count; i++) {
+        t = performance.now();
+        k = step(200, keep, k);
+        times.push(performance.now() - t);
+    }
+    total = performance.now() - total;
+    times.sort((a, b) => a - b);
+
+    print("live objects: " + live_count + ", steps: " + step_count);
+    print("step time (ms): p50=" + percentile(times, 50).toFixed(3) +
+          " p90=" + percentile(times, 90).toFixed(3) +
+          " p99=" + percentile(times, 99).toFixed(3) +
+          " p99.9=" + percentile(times, 99.9).toFixed(3) +
+          " max=" + times[times.length - 1].toFixed(3));
+    print("total (ms): " + total.toFixed(1));
+    return live.length;
+}
+
+main(typeof scriptArgs !== "undefined" ? scriptArgs : []);
@@ -0,0 +1,268 @@
+/*
+ * QuickJS: C API test functions (test only)
+ *
+ * Copyright (c) 2017-2019 Fabrice Bellard
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#include "../quickjs-libc.h"
+#include "../cutils.h"
+
+/* setGCPauseBudget(budget_us) */
+static JSValue js_jsapi_setGCPauseBudget(JSContext *ctx, JSValueConst this_val,
+                                         int argc, JSValueConst *argv)
+{
+    int budget;
+    if (JS_ToInt32(ctx, &budget, argv[0]))
+        return JS_EXCEPTION;
+    JS_SetGCPauseBudget(JS_GetRuntime(ctx), budget);
+    return JS_UNDEFINED;
+}
+
+static JSValue js_jsapi_runMinorGC(JSContext *ctx, JSValueConst this_val,
+                                   int argc, JSValueConst *argv)
+{
+    JS_RunMinorGC(JS_GetRuntime(ctx));
+    return JS_UNDEFINED;
+}
+
+static JSValue js_new_int64_array(JSContext *ctx, const int64_t *tab, int len)
+{
+    JSValue arr;
+    int i;
+    arr = JS_NewArray(ctx);
+    if (JS_IsException(arr))
+        return arr;
+    for(i = 0; i < len; i++) {
+        if (JS_SetPropertyUint32(ctx, arr, i, JS_NewInt64(ctx, tab[i])) < 0) {
+            JS_FreeValue(ctx, arr);
+            return JS_EXCEPTION;
+        }
+    }
+    return arr;
+}
+
+/* return a subset of the JS_ComputeMemoryUsage() result */
+static JSValue js_jsapi_memoryUsage(JSContext *ctx, JSValueConst this_val,
+                                    int argc, JSValueConst *argv)
+{
+    JSMemoryUsage s;
+    JSValue obj;
+
+    JS_ComputeMemoryUsage(JS_GetRuntime(ctx), &s);
+    obj = JS_NewObject(ctx);
+    if (JS_IsException(obj))
+        return obj;
+    JS_SetPropertyStr(ctx, obj, "obj_count", JS_NewInt64(ctx, s.obj_count));
+    JS_SetPropertyStr(ctx, obj, "str_count", JS_NewInt64(ctx, s.str_count));
+    JS_SetPropertyStr(ctx, obj, "shape_count", JS_NewInt64(ctx, s.shape_count));
+    JS_SetPropertyStr(ctx, obj, "slab_chunk_count",
+                      JS_NewInt64(ctx, s.slab_chunk_count));
+    JS_SetPropertyStr(ctx, obj, "slab_chunk_size",
+                      JS_NewInt64(ctx, s.slab_chunk_size));
+    JS_SetPropertyStr(ctx, obj, "slab_block_size",
+                      js_new_int64_array(ctx, s.slab_block_size,
+                                         JS_SLAB_CLASS_COUNT));
+    JS_SetPropertyStr(ctx, obj, "slab_used_count",
+                      js_new_int64_array(ctx, s.slab_used_count,
+                                         JS_SLAB_CLASS_COUNT));
+    JS_SetPropertyStr(ctx, obj, "slab_free_count",
+                      js_new_int64_array(ctx, s.slab_free_count,
+                                         JS_SLAB_CLASS_COUNT));
+    return obj;
+}
+
+/* arenaEval(src): evaluate the module 'src' in a new arena runtime
+   with the std and os modules, and return a copy of
+   'globalThis.result' after the runtime is freed. */
+static JSValue js_jsapi_arenaEval(JSContext *ctx, JSValueConst this_val,
+                                  int argc, JSValueConst *argv)
+{
+    JSRuntime *rt1;
+    JSContext *ctx1;
+    JSValue val, global_obj, ret;
+    const char *src, *msg;
+    size_t len;
+
+    src = JS_ToCStringLen(ctx, &len, argv[0]);
+    if (!src)
+        return JS_EXCEPTION;
+    rt1 = JS_NewArenaRuntime();
+    if (!rt1) {
+        JS_FreeCString(ctx, src);
+        return JS_ThrowOutOfMemory(ctx);
+    }
+    js_std_init_handlers(rt1);
+    ctx1 = JS_NewContext(rt1);
+    if (!ctx1) {
+        ret = JS_ThrowOutOfMemory(ctx);
+        goto done;
+    }
+    js_init_module_std(ctx1, "std");
+    js_init_module_os(ctx1, "os");
+    val = JS_Eval(ctx1, src, len, "<arena>", JS_EVAL_TYPE_MODULE);
+    if (!JS_IsException(val)) {
+        js_std_loop(ctx1);
+        val = js_std_await(ctx1, val);
+    }
+    if (JS_IsException(val)) {
+        val = JS_GetException(ctx1);
+        msg = JS_ToCString(ctx1, val);
+        ret = JS_ThrowInternalError(ctx, "arena: %s", msg ? msg : "?");
+        JS_FreeCString(ctx1, msg);
+    } else {
+        JS_FreeValue(ctx1, val);
+        global_obj = JS_GetGlobalObject(ctx1);
+        val = JS_GetPropertyStr(ctx1, global_obj, "result");
+        JS_FreeValue(ctx1, global_obj);
+        ret = JS_CopyValue(ctx, ctx1, val);
+    }
+    JS_FreeValue(ctx1, val);
+    JS_FreeContext(ctx1);
+ done:
+    js_std_free_handlers(rt1);
+    JS_FreeRuntime(rt1);
+    JS_FreeCString(ctx, src);
+    return ret;
+}
+
+/* compileModule(src, name): return the bytecode of a module as an
+   ArrayBuffer */
+static JSValue js_jsapi_compileModule(JSContext *ctx, JSValueConst this_val,
+                                      int argc, JSValueConst *argv)
+{
+    const char *src, *name;
+    size_t len;
+    uint8_t *buf;
+    JSValue obj, ret;
+
+    src = JS_ToCStringLen(ctx, &len, argv[0]);
+    if (!src)
+        return JS_EXCEPTION;
+    name = JS_ToCString(ctx, argv[1]);
+    if (!name) {
+        JS_FreeCString(ctx, src);
+        return JS_EXCEPTION;
+    }
+    obj = JS_Eval(ctx, src, len, name,
+                  JS_EVAL_TYPE_MODULE | JS_EVAL_FLAG_COMPILE_ONLY);
+    JS_FreeCString(ctx, src);
+    JS_FreeCString(ctx, name);
+    if (JS_IsException(obj))
+        return obj;
+    buf = JS_WriteObject(ctx, &len, obj, JS_WRITE_OBJ_BYTECODE);
+    JS_FreeValue(ctx, obj);
+    if (!buf)
+        return JS_EXCEPTION;
+    ret = JS_NewArrayBufferCopy(ctx, buf, len);
+    js_free(ctx, buf);
+    return ret;
+}
+
+/* evalBinary(buf): load and evaluate precompiled code as qjsc does.
+   The bytecode is shared only in the worker threads. */
+static JSValue js_jsapi_evalBinary(JSContext *ctx, JSValueConst this_val,
+                                   int argc, JSValueConst *argv)
+{
+    uint8_t *buf;
+    size_t len;
+
+    buf = JS_GetArrayBuffer(ctx, &len, argv[0]);
+    if (!buf)
+        return JS_EXCEPTION;
+    js_std_eval_binary(ctx, buf, len, 0);
+    return JS_UNDEFINED;
+}
+
+static JSValue js_jsapi_sharedBytecodeCount(JSContext *ctx,
+                                            JSValueConst this_val,
+                                            int argc, JSValueConst *argv)
+{
+    return JS_NewInt32(ctx, JS_GetSharedBytecodeCount());
+}
+
+static JSValue js_jsapi_enableTypeFeedback(JSContext *ctx,
+                                           JSValueConst this_val,
+                                           int argc, JSValueConst *argv)
+{
+    JS_EnableTypeFeedback(JS_GetRuntime(ctx), JS_ToBool(ctx, argv[0]));
+    return JS_UNDEFINED;
+}
+
+/* return the output of JS_DumpTypeFeedback() as a string */
+static JSValue js_jsapi_dumpTypeFeedback(JSContext *ctx,
+                                         JSValueConst this_val,
+                                         int argc, JSValueConst *argv)
+{
+    FILE *f;
+    char *buf;
+    long len;
+    JSValue ret;
+
+    f = tmpfile();
+    if (!f)
+        return JS_ThrowInternalError(ctx, "tmpfile failed");
+    JS_DumpTypeFeedback(f, JS_GetRuntime(ctx));
+    len = ftell(f);
+    buf = malloc(len + 1);
+    if (!buf) {
+        fclose(f);
+        return JS_ThrowOutOfMemory(ctx);
+    }
+    rewind(f);
+    len = fread(buf, 1, len, f);
+    fclose(f);
+    ret = JS_NewStringLen(ctx, buf, len);
+    free(buf);
+    return ret;
+}
+
+static const JSCFunctionListEntry js_jsapi_funcs[] = {
+    JS_CFUNC_DEF("setGCPauseBudget", 1, js_jsapi_setGCPauseBudget ),
+    JS_CFUNC_DEF("runMinorGC", 0, js_jsapi_runMinorGC ),
+    JS_CFUNC_DEF("memoryUsage", 0, js_jsapi_memoryUsage ),
+    JS_CFUNC_DEF("arenaEval", 1, js_jsapi_arenaEval ),
+    JS_CFUNC_DEF("compileModule", 2, js_jsapi_compileModule ),
+    JS_CFUNC_DEF("evalBinary", 1, js_jsapi_evalBinary ),
+    JS_CFUNC_DEF("sharedBytecodeCount", 0, js_jsapi_sharedBytecodeCount ),
+    JS_CFUNC_DEF("enableTypeFeedback", 1, js_jsapi_enableTypeFeedback ),
+    JS_CFUNC_DEF("dumpTypeFeedback", 0, js_jsapi_dumpTypeFeedback ),
+};
+
+static int js_jsapi_init(JSContext *ctx, JSModuleDef *m)
+{
+    return JS_SetModuleExportList(ctx, m, js_jsapi_funcs,
+                                  countof(js_jsapi_funcs));
+}
+
+#ifdef JS_SHARED_LIBRARY
+#define JS_INIT_MODULE js_init_module
+#else
+#define JS_INIT_MODULE js_init_module_jsapi
+#endif
+
+JSModuleDef *JS_INIT_MODULE(JSContext *ctx, const char *module_name)
+{
+    JSModuleDef *m;
+    m = JS_NewCModule(ctx, module_name, js_jsapi_init);
+    if (!m)
+        return NULL;
+    JS_AddModuleExportList(ctx, m, js_jsapi_funcs, countof(js_jsapi_funcs));
+    return m;
+}
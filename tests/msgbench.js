@@ -0,0 +1,57 @@
+/* worker message benchmark: many workers send messages to the main
+   thread, which measures the receive rate.
+
+   usage: qjs tests/msgbench.js [workers [messages_per_worker]]
+*/
+import * as os from "os";
+
+function worker_main()
+{
+    var parent = os.Worker.parent;
+    parent.onmessage = function (e) {
+        var i, n = e.data.count;
+        for(i = 0; i < n; i++)
+            parent.postMessage(i);
+        parent.postMessage(-1);
+        parent.onmessage = null;
+    };
+}
+
+function main(args)
+{
+    var worker_count, msg_count, workers, received, done, i, t;
+
+    worker_count = args[1] ? parseInt(args[1]) : 32;
+    msg_count = args[2] ? parseInt(args[2]) : 5000;
+
+    workers = [];
+    received = 0;
+    done = 0;
+    for(i = 0; i < worker_count; i++) {
+        let w = new os.Worker("./msgbench.js");
+        w.onmessage = function (e) {
+            if (e.data < 0) {
+                w.onmessage = null;
+                if (++done == worker_count) {
+                    t = performance.now() - t;
+                    print("workers: " + worker_count +
+                          ", messages: " + received);
+                    print("time (ms): " + t.toFixed(1) +
+                          ", per message (us): " +
+                          (t * 1000 / received).toFixed(2));
+                }
+            } else {
+                received++;
+            }
+        };
+        workers.push(w);
+    }
+    t = performance.now();
+    for(i = 0; i < worker_count; i++)
+        workers[i].postMessage({ count: msg_count });
+}
+
+if (os.Worker.parent)
+    worker_main();
+else
+    main(typeof scriptArgs !== "undefined" ? scriptArgs : []);
@@ -0,0 +1,48 @@
+/* event loop benchmark: measures the time to dispatch a read handler
+   when many other file descriptors are waited for but stay idle.
+
+   usage: qjs tests/pollbench.js [idle_fds [iterations]]
+*/
+import * as os from "os";
+
+function main(args)
+{
+    var idle_count, iter_count, idle, fds, buf, i, n, t;
+
+    idle_count = args[1] ? parseInt(args[1]) : 500;
+    iter_count = args[2] ? parseInt(args[2]) : 20000;
+
+    idle = [];
+    for(i = 0; i < idle_count; i++) {
+        let p = os.pipe();
+        os.setReadHandler(p[0], function () { throw Error("unexpected"); });
+        idle.push(p);
+    }
+
+    /* the active pipe writes to itself from its read handler */
+    fds = os.pipe();
+    buf = new Uint8Array(1);
+    n = 0;
+    os.setReadHandler(fds[0], function () {
+        os.read(fds[0], buf.buffer, 0, 1);
+        if (++n < iter_count) {
+            os.write(fds[1], buf.buffer, 0, 1);
+            return;
+        }
+        t = performance.now() - t;
+        print("idle fds: " + idle_count + ", iterations: " + iter_count);
+        print("time per event (us): " + (t * 1000 / iter_count).toFixed(3));
+        os.setReadHandler(fds[0], null);
+        os.close(fds[0]);
+        os.close(fds[1]);
+        for(i = 0; i < idle_count; i++) {
+            os.setReadHandler(idle[i][0], null);
+            os.close(idle[i][0]);
+            os.close(idle[i][1]);
+        }
+    });
+    t = performance.now();
+    os.write(fds[1], buf.buffer, 0, 1);
+}
+
+main(scriptArgs);
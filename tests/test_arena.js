@@ -0,0 +1,95 @@
+import * as std from "std";
+import * as os from "os";
+import * as jsapi from "./jsapi.so";
+
+function assert(actual, expected, message) {
+    if (arguments.length == 1)
+        expected = true;
+
+    if (Object.is(actual, expected))
+        return;
+
+    if (actual !== null && expected !== null
+    &&  typeof actual == 'object' && typeof expected == 'object'
+    &&  actual.toString() === expected.toString())
+        return;
+
+    throw Error("assertion failed: got |" + actual + "|" +
+                ", expected |" + expected + "|" +
+                (message ? " (" + message + ")" : ""));
+}
+
+/* number of open file descriptors, -1 if unknown */
+function fd_count()
+{
+    var [list, err] = os.readdir("/proc/self/fd");
+    if (err)
+        return -1;
+    return list.length;
+}
+
+function test_copy()
+{
+    var r;
+    r = jsapi.arenaEval(`
+        var o = { x: 1 };
+        var tab = [];
+        for(var i = 0; i < 1000; i++)
+            tab.push({ i: i, s: "s" + i });
+        globalThis.result = { a: [1, 2.5, "str", o], b: o, n: 10n,
+                              ta: new Uint8Array([1, 2, 3]),
+                              last: tab[999] };
+    `);
+    /* the copied value outlives the arena runtime */
+    std.gc();
+    assert(r.a.length, 4);
+    assert(r.a[1], 2.5);
+    assert(r.a[2], "str");
+    assert(r.a[3] === r.b, true, "shared reference");
+    assert(r.b.x, 1);
+    assert(r.n, 10n);
+    assert(r.ta.toString(), "1,2,3");
+    assert(r.last.s, "s999");
+
+    r = jsapi.arenaEval(`globalThis.result = await Promise.resolve(42);`);
+    assert(r, 42);
+
+    let err = null;
+    try {
+        jsapi.arenaEval(`throw new RangeError("bad");`);
+    } catch(e) {
+        err = e;
+    }
+    assert(err instanceof InternalError, true);
+    assert(err.message, "arena: RangeError: bad");
+}
+
+function test_teardown()
+{
+    var i, n0, n1, r;
+
+    n0 = fd_count();
+    for(i = 0; i < 200; i++) {
+        /* the files, the SharedArrayBuffers and the array buffers
+           with external data are released by JS_FreeRuntime() */
+        r = jsapi.arenaEval(`
+            import * as std from "std";
+            var f = std.tmpfile();
+            f.puts("hello");
+            var sab = new SharedArrayBuffer(1024);
+            var ta = new Int32Array(sab);
+            ta[0] = ${i};
+            var obj = { tab: [] };
+            for(var j = 0; j < 100; j++)
+                obj.tab.push({ j: j });
+            globalThis.result = { i: ta[0], f: f.tell() };
+        `);
+        assert(r.i, i);
+        assert(r.f, 5);
+    }
+    n1 = fd_count();
+    assert(n1, n0, "open files");
+}
+
+test_copy();
+test_teardown();
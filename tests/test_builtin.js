@@ -232,6 +232,59 @@ function test_array()
     assert(err && a.toString() === "1,2,3,4");
 }
 
+function test_array_sort()
+{
+    var a, b, i, n, err;
+
+    a = [10, 9, 1, -1, -10, 100, 0, -2147483648, 2147483647];
+    a.sort();
+    assert(a.join(), "-1,-10,-2147483648,0,1,10,100,2147483647,9");
+
+    a = [1.5, 10, "b", 2, true, null, "a", -0, NaN, 1e21, undefined];
+    a.sort();
+    assert(a.join(), "0,1.5,10,1e+21,2,NaN,a,b,,true,");
+    assert(a[10], undefined);
+
+    /* stability */
+    n = 1000;
+    a = [];
+    for(i = 0; i < n; i++)
+        a.push({ k: (i * 7) % 13, i: i });
+    a.sort((x, y) => x.k - y.k);
+    for(i = 1; i < n; i++) {
+        b = a[i - 1].k < a[i].k || (a[i - 1].k == a[i].k && a[i - 1].i < a[i].i);
+        if (!b)
+            break;
+    }
+    assert(i, n, "stable sort");
+
+    /* long runs */
+    a = [];
+    for(i = 0; i < n; i++)
+        a.push(i < n / 2 ? i * 2 : (n - i) * 2 + 1);
+    a.sort((x, y) => x - y);
+    for(i = 1; i < n && a[i - 1] < a[i]; i++)
+        continue;
+    assert(i, n, "runs");
+
+    /* exception in the comparator */
+    a = [3, 2, 1];
+    err = false;
+    try {
+        a.sort(() => { throw "abc"; });
+    } catch(e) {
+        err = (e === "abc");
+    }
+    assert(err && a.join() === "3,2,1", true);
+
+    /* inconsistent comparator */
+    a = [];
+    for(i = 0; i < n; i++)
+        a.push(i);
+    a.sort(() => (Math.random() * 3 | 0) - 1);
+    assert(a.length, n);
+}
+
 function test_string()
 {
     var a;
@@ -288,6 +341,26 @@ function test_string()
     assert("aaa".indexOf("", 2), 2);
     assert("aaa".indexOf("", 3), 3);
     assert("aaa".indexOf("", 4), 3);
+
+    /* long strings, 8 and 16 bit */
+    a = "x".repeat(100) + "abc" + "x".repeat(50);
+    assert(a.indexOf("abc"), 100);
+    assert(a.indexOf("abd"), -1);
+    assert(a.indexOf("xa"), 99);
+    assert(a.indexOf("x", 101), 103);
+    assert(a.lastIndexOf("cx"), 102);
+    assert(a.includes("xxab", 90), true);
+    assert(a.includes("xxab", 99), false);
+    assert(a.split("b").join(), "x".repeat(100) + "a,c" + "x".repeat(50));
+    a = "\u20ac".repeat(70) + "abc" + "\u20ac".repeat(10);
+    assert(a.indexOf("abc"), 70);
+    assert(a.indexOf("c\u20ac"), 72);
+    assert(a.indexOf("\u20ac", 71), 73);
+    assert(a.indexOf("\u20aca"), 69);
+    assert(a.indexOf("\u20acab\u20ac"), -1);
+    assert(a.lastIndexOf("\u20aca"), 69);
+    assert((a + "d" < a + "e"), true);
+    assert(("abc".repeat(30) + "\u20ac").indexOf("cab".repeat(20)), 2);
     assert("aaa".indexOf("", Infinity), 3);
 
     assert("aaa".lastIndexOf("a"), 2);
@@ -519,6 +592,55 @@ function test_typed_array()
     assert(a[0], 42);
     buffer.transfer();
     assert(a[0], undefined);
+
+    test_typed_array_sort();
+}
+
+function test_typed_array_sort()
+{
+    var a, b, i, n, tab, C;
+
+    /* long enough for the radix sort */
+    n = 200;
+    tab = [ Int8Array, Uint8Array, Int16Array, Uint16Array, Int32Array,
+            Uint32Array, Float16Array, Float32Array, Float64Array ];
+    for(C of tab) {
+        a = new C(n);
+        for(i = 0; i < n; i++)
+            a[i] = ((i * 37) % 101) - 50;
+        if (C === Float16Array || C === Float32Array || C === Float64Array) {
+            a[3] = NaN;
+            a[7] = -0;
+            a[8] = Infinity;
+            a[9] = -Infinity;
+            a[10] = 0;
+        }
+        b = Array.from(a).sort((x, y) => (isNaN(x) - isNaN(y)) || x - y);
+        a.sort();
+        assert(Array.from(a).join(), b.join(), C.name);
+    }
+    a = new Float64Array(n);
+    a[0] = NaN;
+    a[1] = 0;
+    a[2] = -0;
+    a.sort();
+    assert(Object.is(a[0], -0) && Object.is(a[n - 2], 0) && isNaN(a[n - 1]), true);
+    a = new BigInt64Array(n);
+    for(i = 0; i < n; i++)
+        a[i] = BigInt((i * 37) % 101 - 50) << 40n;
+    a.sort();
+    for(i = 1; i < n && a[i - 1] <= a[i]; i++)
+        continue;
+    assert(i, n, "BigInt64Array");
+
+    /* stability with a comparator */
+    a = new Int32Array(n);
+    for(i = 0; i < n; i++)
+        a[i] = ((i * 37) % 16) * 1000 + i;
+    a.sort((x, y) => (x / 1000 | 0) - (y / 1000 | 0));
+    for(i = 1; i < n && a[i - 1] < a[i]; i++)
+        continue;
+    assert(i, n, "stable typed array sort");
 }
 
 /* return [s, line_num, col_num] where line_num and col_num are the
@@ -607,6 +729,14 @@ function test_json()
 
     assert_json_error('\n"  \\@x"');
     assert_json_error('\n{ "a": @x }"');
+
+    /* long strings and white space */
+    s = "x".repeat(40);
+    a = JSON.parse('  \n\t [ "' + s + '\\n' + s + '\u20ac' + s + '" ,\r\n' +
+                   ' '.repeat(40) + '"' + s + '"  ] ');
+    assert(a[0], s + "\n" + s + "\u20ac" + s);
+    assert(a[1], s);
+    assert_json_error('"' + s + '@\u0001"');
 }
 
 function test_date()
@@ -986,6 +1116,8 @@ function test_finalization_registry()
         let finrec = new FinalizationRegistry(v => { actual = v });
         finrec.register({}, expected);
         os.setTimeout(() => {
+            /* the registry must stay alive until the callback is called */
+            assert(finrec !== null);
             assert(actual, expected);
         }, 0);
     }
@@ -995,6 +1127,8 @@ function test_finalization_registry()
         let finrec = new FinalizationRegistry(v => { actual = v });
         finrec.register({}, expected);
         os.setTimeout(() => {
+            /* the registry must stay alive until the callback is called */
+            assert(finrec !== null);
             assert(actual, expected);
         }, 0);
     }
@@ -1174,6 +1308,7 @@ test();
 test_function();
 test_enum();
 test_array();
+test_array_sort();
 test_string();
 test_math();
 test_number();
@@ -0,0 +1,114 @@
+/* type feedback test ('qjs --dump-feedback') */
+import * as std from "std";
+import * as os from "os";
+
+function assert(actual, expected, message) {
+    if (arguments.length == 1)
+        expected = true;
+
+    if (actual === expected)
+        return;
+
+    if (actual !== null && expected !== null
+    &&  typeof actual == 'object' && typeof expected == 'object'
+    &&  actual.toString() === expected.toString())
+        return;
+
+    throw Error("assertion failed: got |" + actual + "|" +
+                ", expected |" + expected + "|" +
+                (message ? " (" + message + ")" : ""));
+}
+
+const src = `
+function add_int(a, b) { return a + b; }
+function add_float(a, b) { return a + b; }
+function add_str(a, b) { return a + b; }
+function add_poly(a, b) { return a + b; }
+function less(a, b) { return a < b; }
+function get_el(a, i) { return a[i]; }
+function get_x(o) { return o.x; }
+function get_y(o) { return o.y; }
+function no_feedback(a) { return a; }
+for(var i = 0; i < 100; i++) {
+    add_int(i, 1);
+    add_float(i + 0.5, 1.5);
+    add_str("a", "b" + i);
+    add_poly(i, (i & 1) ? "s" : 1.5);
+    less(i, 3);
+    get_el([1, 2], 1);
+    get_el(new Uint8Array(2), 0);
+    get_x({ x: 1 });
+    get_y((i & 1) ? { y: 1 } : { z: 2, y: 1 });
+    no_feedback(i);
+}
+`;
+
+/* run the code with 'qjs --dump-feedback' and return the output */
+function dump_feedback(src)
+{
+    var fds, pid, f, out, ret, status;
+    fds = os.pipe();
+    pid = os.exec(["./qjs", "--dump-feedback", "-e", src],
+                  { stdout: fds[1], block: false });
+    assert(pid >= 0);
+    os.close(fds[1]);
+    f = std.fdopen(fds[0], "r");
+    out = f.readAsString();
+    f.close();
+    [ret, status] = os.waitpid(pid, 0);
+    assert(status, 0);
+    return out;
+}
+
+/* return { calls, sites } for each function. Each site is
+   { op, kinds, poly, quickened } */
+function parse_feedback(out)
+{
+    var funcs = {}, func = null, line, m;
+    for(line of out.split("\n")) {
+        if ((m = /^(\S+) \(.*\) calls=(\d+)$/.exec(line))) {
+            func = { calls: +m[2], sites: [] };
+            funcs[m[1]] = func;
+        } else if ((m = /^\s+\d+\s+\d+:\d+\s+(\S+)\s+(.*)$/.exec(line))) {
+            let words = m[2].split(" ");
+            func.sites.push({
+                op: m[1],
+                kinds: words.filter((w) => !/^shapes=|^POLYMORPHIC$|^QUICKENED$/.test(w)).join(","),
+                poly: words.includes("POLYMORPHIC"),
+                quickened: words.includes("QUICKENED"),
+            });
+        }
+    }
+    return funcs;
+}
+
+function check_site(funcs, name, op, kinds, poly, calls = 100)
+{
+    var f = funcs[name], site;
+    assert(f !== undefined, true, name);
+    assert(f.calls, calls, name);
+    site = f.sites.find((s) => s.op == op);
+    assert(site !== undefined, true, name + " " + op);
+    assert(site.kinds, kinds, name);
+    assert(site.poly, poly, name);
+}
+
+function test_feedback()
+{
+    var funcs = parse_feedback(dump_feedback(src));
+
+    check_site(funcs, "add_int", "add", "int32", false);
+    check_site(funcs, "add_float", "add", "float64", false);
+    check_site(funcs, "add_str", "add", "string", false);
+    check_site(funcs, "add_poly", "add", "int32,float64,string", true);
+    check_site(funcs, "less", "lt", "int32", false);
+    check_site(funcs, "get_el", "get_array_el", "array,typed_array", true, 200);
+    check_site(funcs, "get_x", "get_field", "object", false);
+    /* same type but several shapes */
+    check_site(funcs, "get_y", "get_field", "object", true);
+    /* the functions without recording opcode are listed without sites */
+    assert(funcs.no_feedback.calls, 100);
+    assert(funcs.no_feedback.sites.length, 0);
+}
+
+test_feedback();
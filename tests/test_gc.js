@@ -0,0 +1,167 @@
+/* generational GC test */
+import * as std from "std";
+import * as os from "os";
+import * as jsapi from "./jsapi.so";
+
+function assert(actual, expected, message) {
+    if (arguments.length == 1)
+        expected = true;
+
+    if (actual === expected)
+        return;
+
+    if (actual !== null && expected !== null
+    &&  typeof actual == 'object' && typeof expected == 'object'
+    &&  actual.toString() === expected.toString())
+        return;
+
+    throw Error("assertion failed: got |" + actual + "|" +
+                ", expected |" + expected + "|" +
+                (message ? " (" + message + ")" : ""));
+}
+
+/* the FinalizationRegistry callbacks of the objects freed in a cycle
+   are queued by the next GC */
+function minor_gc()
+{
+    jsapi.runMinorGC();
+    jsapi.runMinorGC();
+}
+
+function full_gc()
+{
+    std.gc();
+    std.gc();
+}
+
+/* run the pending jobs (e.g. the FinalizationRegistry callbacks) */
+function tick()
+{
+    return new Promise((resolve) => os.setTimeout(resolve, 0));
+}
+
+function make_live_heap(n)
+{
+    var tab, i;
+    tab = [];
+    for(i = 0; i < n; i++)
+        tab.push({ id: i, data: [ i ] });
+    return tab;
+}
+
+function check_live_heap(tab)
+{
+    var i;
+    for(i = 0; i < tab.length; i++) {
+        if (tab[i].id !== i || tab[i].data[0] !== i)
+            return false;
+    }
+    return true;
+}
+
+var finalized = new Set();
+var registry = new FinalizationRegistry((name) => finalized.add(name));
+
+function new_tracked(name)
+{
+    var obj = { name: name };
+    registry.register(obj, name);
+    return obj;
+}
+
+/* create a young cycle holding the only reference to 'old' */
+function make_young_cycle(old)
+{
+    var a, b;
+    a = { old: old };
+    b = { a: a };
+    a.b = b;
+}
+
+/* create a cycle between 'old' and a young object */
+function make_mixed_cycle(old)
+{
+    var young = { old: old };
+    old.young = young;
+}
+
+async function test_minor_gc()
+{
+    var live, old1, old2, young_ref, keep;
+
+    live = make_live_heap(100000);
+    old1 = new_tracked("old1");
+    old2 = new_tracked("old2");
+    keep = new_tracked("keep");
+    /* all the existing objects become old */
+    jsapi.setGCPauseBudget(10);
+
+    make_young_cycle(old1);
+    old1 = null;
+    make_mixed_cycle(old2);
+    old2 = null;
+    young_ref = new WeakRef(new_tracked("young"));
+
+    /* the old objects whose last reference was in a collected young
+       cycle are freed immediately */
+    minor_gc();
+    await tick();
+    assert(finalized.has("old1"), true, "old1");
+    assert(finalized.has("young"), true, "young");
+    assert(young_ref.deref(), undefined);
+    /* a cycle spanning old objects outside of the collected set is
+       not freed by a minor GC */
+    assert(finalized.has("old2"), false, "old2 minor");
+
+    full_gc();
+    await tick();
+    assert(finalized.has("old2"), true, "old2 full");
+    assert(finalized.has("keep"), false, "keep");
+    assert(keep.name, "keep");
+    assert(check_live_heap(live), true, "live heap");
+}
+
+/* the automatic minor GCs keep the live objects */
+async function test_pause_budget()
+{
+    var live, keep, i, j, tab, obj;
+
+    live = make_live_heap(20000);
+    jsapi.setGCPauseBudget(100);
+    keep = [];
+    for(i = 0; i < 200; i++) {
+        tab = [];
+        for(j = 0; j < 1000; j++) {
+            obj = { v: j, next: null };
+            obj.next = { prev: obj };
+            tab.push(obj);
+        }
+        /* old -> young references */
+        live[i].young = tab[i];
+        if ((i % 10) == 0)
+            keep.push(tab);
+    }
+    for(i = 0; i < 200; i++) {
+        assert(live[i].young.v, i);
+        assert(live[i].young.next.prev, live[i].young);
+    }
+    for(i = 0; i < keep.length; i++)
+        assert(keep[i][999].next.prev.v, 999);
+    assert(check_live_heap(live), true, "live heap");
+
+    /* disabled: a minor GC is a full GC */
+    jsapi.setGCPauseBudget(0);
+    make_mixed_cycle(new_tracked("disabled"));
+    minor_gc();
+    await tick();
+    assert(finalized.has("disabled"), true, "disabled");
+    assert(check_live_heap(live), true, "live heap");
+}
+
+async function main()
+{
+    await test_minor_gc();
+    await test_pause_budget();
+}
+
+main().catch((e) => { print(e); std.exit(1); });
@@ -664,6 +664,391 @@ function test_global_var_opt()
     assert(gvar1, 5);
 }
 
+function test_global_var_cache()
+{
+    var i, r, v;
+
+    function get_g() { return gvar2; }
+    function get_g_undef() { return typeof gvar2; }
+    function put_g(v) { gvar2 = v; }
+    function put_g_strict(v) { "use strict"; gvar2 = v; }
+
+    for(i = 0; i < 2; i++) {
+        assert_throws(ReferenceError, get_g);
+        assert(get_g_undef(), "undefined");
+        assert_throws(ReferenceError, () => put_g_strict(1));
+    }
+
+    /* inherited from the prototype of the global object */
+    Object.prototype.gvar2 = 1;
+    assert(get_g(), 1);
+    Object.prototype.gvar2 = 2;
+    assert(get_g(), 2);
+    delete Object.prototype.gvar2;
+    assert_throws(ReferenceError, get_g);
+
+    /* getter and setter */
+    Object.defineProperty(globalThis, "gvar2", {
+        get: function() { return v; },
+        set: function(a) { v = a + 1; },
+        configurable: true });
+    for(i = 0; i < 2; i++) {
+        put_g(i);
+        assert(get_g(), i + 1);
+    }
+    r = Object.getOwnPropertyDescriptor(globalThis, "gvar2");
+    Object.defineProperty(globalThis, "gvar2", {
+        get: function() { return -v; },
+        set: r.set });
+    assert(get_g(), -2);
+    delete globalThis.gvar2;
+    assert(get_g_undef(), "undefined");
+    put_g(3);
+    assert(get_g(), 3);
+    delete globalThis.gvar2;
+}
+
+function test_inline_cache()
+{
+    var tab, i, r, o;
+
+    function get_x(o) { return o.x; }
+    function set_x(o, v) { o.x = v; }
+
+    /* polymorphic and megamorphic accesses */
+    tab = [ { x: 1 }, { a: 0, x: 2 }, { b: 0, x: 3 }, { c: 0, x: 4 },
+            { d: 0, x: 5 }, { e: 0, x: 6 } ];
+    for(i = 0; i < 3; i++) {
+        r = 0;
+        tab.forEach((o) => r += get_x(o));
+        assert(r, 21);
+    }
+    tab.forEach((o) => set_x(o, 1));
+    r = 0;
+    tab.forEach((o) => r += get_x(o));
+    assert(r, 6);
+
+    /* shape changes after the cache is filled */
+    o = { y: 1, x: 2 };
+    assert(get_x(o), 2);
+    delete o.y;
+    assert(get_x(o), 2);
+    delete o.x;
+    assert(get_x(o), undefined);
+    o.x = 3;
+    assert(get_x(o), 3);
+    Object.defineProperty(o, "x", { get: function() { return 4; } });
+    assert(get_x(o), 4);
+
+    o = { x: 1 };
+    set_x(o, 2);
+    Object.freeze(o);
+    set_x(o, 3);
+    assert(o.x, 2);
+
+    o = { x: 1 };
+    set_x(o, 2);
+    Object.defineProperty(o, "x", { set: function(v) { this.y = v; } });
+    set_x(o, 5);
+    assert(o.y, 5);
+}
+
+function test_proto_inline_cache()
+{
+    var o, a, b, c;
+
+    function call_m(o) { return o.m(); }
+
+    class A { m() { return 1; } }
+    class B extends A {}
+    class C extends B {}
+    o = new C();
+    assert(call_m(o), 1);
+    assert(call_m(o), 1);
+
+    /* shadowing in the middle of the chain */
+    B.prototype.m = function() { return 2; };
+    assert(call_m(o), 2);
+    delete B.prototype.m;
+    assert(call_m(o), 1);
+
+    /* modification of the holder */
+    A.prototype.m = function() { return 3; };
+    assert(call_m(o), 3);
+    Object.defineProperty(A.prototype, "m", { get: function() { return () => 4; } });
+    assert(call_m(o), 4);
+    delete A.prototype.m;
+    assert_throws(TypeError, () => call_m(o));
+
+    /* prototype change in the middle of the chain */
+    a = { m() { return 5; } };
+    b = { m() { return 6; } };
+    c = Object.create(a);
+    o = Object.create(c);
+    assert(call_m(o), 5);
+    Object.setPrototypeOf(c, b);
+    assert(call_m(o), 6);
+
+    /* own property shadowing the prototype */
+    o.m = function() { return 7; };
+    assert(call_m(o), 7);
+
+    /* exotic object with the same shape as an ordinary one */
+    a = Object.create(Array.prototype);
+    assert(a.concat, Array.prototype.concat);
+    o = new Proxy({}, { get: function(t, p) { return 8; } });
+    b = Object.create(null);
+    function get_y(o) { return o.y; }
+    assert(get_y(b), undefined);
+    assert(get_y(o), 8);
+}
+
+function test_block_scope_slots()
+{
+    var r, i, fs;
+
+    /* the variables of disjoint blocks may share a slot */
+    function f(n) {
+        var r = [], k;
+        for(k = 0; k < n; k++) {
+            { let a = k, b = a * 2; r.push(a + b); }
+            { let c; r.push(c); c = k; }
+            { const d = "x" + k; r.push(d); }
+            switch(k) {
+            case 0: { let s = 5; r.push(s); break; }
+            default: { let u; r.push(u); }
+            }
+        }
+        return r.join();
+    }
+    assert(f(2), "0,,x0,5,3,,x1,");
+
+    /* uninitialized lexical variable */
+    function tdz() {
+        { let a = 1; a++; }
+        { b; let b = 2; }
+    }
+    assert_throws(ReferenceError, tdz);
+    try {
+        tdz();
+    } catch(e) {
+        assert(e.message, "b is not initialized");
+    }
+
+    /* captured variables */
+    fs = [];
+    for(let i = 0; i < 3; i++) {
+        let j = i * 2;
+        fs.push(() => i + j);
+    }
+    try {
+        { let q = 7; fs.push(() => q); throw 1; }
+    } catch(e) {
+        let y = 99;
+    }
+    { let w = 20; }
+    r = [];
+    for(i = 0; i < fs.length; i++)
+        r.push(fs[i]());
+    assert(r.join(), "0,3,6,7");
+
+    function *g() {
+        { let a = 1; yield a; }
+        { let b = 2; yield b; let c = 3; yield c; }
+        { let x; yield x; }
+    }
+    assert([...g()].join(), "1,2,3,");
+}
+
+function test_tail_call()
+{
+    "use strict";
+    var o, fs;
+
+    /* deeper than the stack */
+    function sum(n, acc) {
+        if (n == 0)
+            return acc;
+        return sum(n - 1, acc + n);
+    }
+    assert(sum(100000, 0), 5000050000);
+
+    function is_even(n) { return n == 0 ? true : is_odd(n - 1); }
+    function is_odd(n) { return n == 0 ? false : is_even(n - 1); }
+    assert(is_even(100001), false);
+
+    /* frames of different sizes, 'this' and arguments */
+    function big(n) {
+        let a = 1, b = 2, c = 3, d = 4;
+        if (n == 0)
+            return a + b + c + d + arguments.length;
+        return small(n);
+    }
+    function small(n) { return big(n - 1, 1, 2, 3, 4, 5, 6); }
+    assert(big(100000), 17);
+    o = {
+        n: 0,
+        m(k) {
+            if (k == 0)
+                return this;
+            this.n++;
+            return this.m(k - 1);
+        }
+    };
+    assert(o.m(100000), o);
+    assert(o.n, 100000);
+    function get_this() { return this; }
+    function call_get_this() { return get_this(); }
+    assert(call_get_this.call(o), undefined);
+
+    /* captured variables and arguments */
+    function clo(n, fs) {
+        let x = n;
+        fs.push(() => x + n);
+        if (n == 0)
+            return fs;
+        return clo(n - 1, fs);
+    }
+    fs = clo(3, []);
+    assert(fs.map((f) => f()).join(), "6,4,2,0");
+
+    /* exception in the called function */
+    function thrower(n) {
+        if (n == 0)
+            throw new Error("end");
+        return thrower(n - 1);
+    }
+    assert_throws(Error, () => thrower(100000));
+    class A {}
+    function call_ctor() { return A(); }
+    assert_throws(TypeError, call_ctor);
+}
+
+function test_spread_call()
+{
+    var a, r, o, saved, log;
+
+    function f() { return Array.prototype.join.call(arguments); }
+    function g(x, y) { return x + "," + y + "," + arguments.length; }
+    function h(...r) { return r.join(); }
+    function d(x = 1, y = 2) { return x + "," + y; }
+
+    a = [1, 2, 3];
+    assert(f(...a), "1,2,3");
+    assert(g(...a), "1,2,3");
+    assert(h(...a), "1,2,3");
+    assert(d(...[]), "1,2");
+    assert(d(...[undefined, 3]), "1,3");
+    assert(f(...a, 4), "1,2,3,4");
+    assert(f(...a, ...a,), "1,2,3,1,2,3");
+    assert(f(...a,), "1,2,3");
+    assert(f(..."ab"), "a,b");
+    assert(f(...new Set([1, 2])), "1,2");
+    assert(Math.max(...a), 3);
+    assert(f(...[ , 1]), ",1");
+    assert_throws(TypeError, () => f(...undefined));
+    assert_throws(TypeError, () => f(...1));
+
+    /* the callee modifies the array */
+    function m(x, y) { a.length = 0; a.push(5); return x + y + arguments[2]; }
+    a = [1, 2, 3];
+    assert(m(...a), 6);
+    a = [1, 2, 3];
+    assert(m.apply(null, a), 6);
+
+    o = { v: 1, m(x) { return this.v + x; } };
+    assert(o.m(...[2]), 3);
+    assert(o["m"](...[3]), 4);
+    assert(new Array(...[1, 2]).join(), "1,2");
+
+    class B { constructor(...r) { this.r = r; } }
+    class C extends B { constructor(...r) { super(...r); } }
+    assert(new C(1, 2).r.join(), "1,2");
+
+    /* modified iterators must be used */
+    a = [1, 2];
+    a[Symbol.iterator] = function* () { yield 7; };
+    assert(f(...a), "7");
+
+    saved = Array.prototype[Symbol.iterator];
+    Array.prototype[Symbol.iterator] = function* () { yield 8; };
+    try {
+        assert(f(...[1, 2]), "8");
+    } finally {
+        Array.prototype[Symbol.iterator] = saved;
+    }
+    saved = Object.getPrototypeOf([][Symbol.iterator]()).next;
+    Object.getPrototypeOf([][Symbol.iterator]()).next = function() {
+        return { done: true };
+    };
+    try {
+        assert(f(...[1, 2]), "");
+    } finally {
+        Object.getPrototypeOf([][Symbol.iterator]()).next = saved;
+    }
+    assert(f(...[1, 2]), "1,2");
+
+    /* arrays with holes or getters in the prototype */
+    a = [1, , 3];
+    Array.prototype[1] = 9;
+    try {
+        assert(f(...a), "1,9,3");
+        assert(f.apply(null, a), "1,9,3");
+    } finally {
+        delete Array.prototype[1];
+    }
+
+    /* apply */
+    function args() { return arguments; }
+    assert(f.apply(null, args(1, 2)), "1,2");
+    assert(g.apply(null, [1]), "1,undefined,1");
+    assert(Reflect.apply(g, null, [1, 2, 3]), "1,2,3");
+    log = [];
+    o = { get length() { log.push("length"); return 2; }, 0: 1, 1: 2 };
+    assert(g.apply(null, o), "1,2,2");
+    assert(log.join(), "length");
+    r = args(1, 2);
+    Object.defineProperty(r, "length", { get() { log.push("get"); return 1; } });
+    assert(f.apply(null, r), "1");
+    assert(log.join(), "length,get");
+}
+
+function test_constant_folding()
+{
+    var x = "a";
+
+    assert("a" + "b" + 1, "ab1");
+    assert(1 + 2 + "a", "3a");
+    assert(x + 1 + 2, "a12");
+    assert(1 + 2 + x, "3a");
+    assert(1 << 20, 1048576);
+    assert(-1 >>> 0, 4294967295);
+    assert(1 / -0, -Infinity);
+    assert(1 / -(0), -Infinity);
+    assert(Object.is(0 * -1, -0), true);
+    assert(7 % -3, 1);
+    assert(2 ** 10, 1024);
+    assert((-2) ** 2, 4);
+    assert(0.1 + 0.2, 0.30000000000000004);
+    assert("3" * "4", 12);
+    assert(1 + null, 1);
+    assert("x" + undefined, "xundefined");
+    assert(true + 1, 2);
+    assert(~5, -6);
+    assert(!"", true);
+    assert(+"12", 12);
+    assert(1 < 2, true);
+    assert("b" < "a", false);
+    assert(NaN < 1 || 1 < "x", false);
+    assert(null == undefined, true);
+    assert("1" === 1, false);
+    assert(`${null}${undefined}${true}${-0}${1e21}`, "nullundefinedtrue01e+21");
+    assert(`a${1 + 2}b${"c"}`, "a3bc");
+    assert(`a${x}b${1}`, "aab1");
+    assert_throws(TypeError, () => 1n + 1);
+    assert_throws(TypeError, () => 1 in 2);
+}
+
 test_op1();
 test_cvt();
 test_eq();
@@ -690,3 +1075,10 @@ test_optional_chaining();
 test_parse_arrow_function();
 test_unicode_ident();
 test_global_var_opt();
+test_global_var_cache();
+test_inline_cache();
+test_proto_inline_cache();
+test_block_scope_slots();
+test_tail_call();
+test_spread_call();
+test_constant_folding();
@@ -371,6 +371,157 @@ function test_try_catch8()
     assert(s === "xafyaf");
 }
 
+/* long loops switching between the int32 and float64 fast paths */
+function test_hot_loop()
+{
+    var i, s, a, m, c;
+
+    s = 2147483000;
+    for(i = 0; i < 2000; i++)
+        s += 1;
+    assert(s, 2147485000);
+
+    s = 0;
+    for(i = 0; i < 2000; i++)
+        s = s + i * 0.5;
+    assert(s, 999500);
+
+    m = 1;
+    for(i = 0; i < 2000; i++)
+        m = -m * 0;
+    assert(Object.is(m, 0), true);
+
+    c = 0;
+    for(i = 0; i < 2000; i++) {
+        if (NaN < i || NaN >= i)
+            c++;
+    }
+    assert(c, 0);
+
+    a = [];
+    for(i = 0; i < 2000; i++)
+        a[i] = i;
+    s = 0;
+    for(i = 0; i < a.length + 2; i++)
+        s += a[i] | 0;
+    assert(s, 1999000);
+    for(i = 0; i < 2000; i++)
+        a[i] = (i & 1) ? "x" : i;
+    assert(a[1999] + a[1998], "x1998");
+}
+
+function test_super_instructions()
+{
+    function count(a, b) {
+        var i, n = 0;
+        for(i = a; i < b; i++)
+            n++;
+        return n;
+    }
+    function count_down(a, b) {
+        var i, n = 0;
+        for(i = a; i > b; i--)
+            n++;
+        return n;
+    }
+    function first(o, p) {
+        return o.x;
+    }
+    var i;
+
+    /* the comparisons take the generic path with non int operands */
+    for(i = 0; i < 3; i++) {
+        assert(count(0, 5), 5);
+        assert(count(0.5, 3), 3);
+        assert(count("a", "c"), 1);
+        assert(count(1n, 4n), 3);
+        assert(count(0, NaN), 0);
+        assert(count_down(5, 0), 5);
+        assert(count_down(2.5, 0), 3);
+        assert(count_down({ valueOf() { return 2; } }, 0), 2);
+        assert(first({ x: 1 }), 1);
+        assert(first("ab"), undefined);
+    }
+    /* the increment overflows to a float */
+    assert(count(0x7ffffffe, 0x80000001), 3);
+    assert(count(-1, 2), 3);
+
+    /* 'x = v' statements on global variables */
+    (0, eval)("var g_super = 0; for(var j = 0; j < 3; j++) g_super = g_super + j;");
+    assert(globalThis.g_super, 3);
+}
+
+function test_quickening()
+{
+    function sum(a) {
+        var i, s = 0;
+        for(i = 0; i < a.length; i++)
+            s += a[i];
+        return s;
+    }
+    function get(a, i) {
+        return a[i];
+    }
+    function fill(a, v) {
+        var i;
+        for(i = 0; i < a.length; i++)
+            a[i] = v;
+        return a;
+    }
+    var i, a, s;
+
+    /* the same sites see typed arrays, arrays, strings and objects */
+    for(i = 0; i < 3; i++) {
+        assert(sum(new Int32Array([1, 2, 3])), 6);
+        assert(sum([1, 2, 3]), 6);
+        assert(sum(new Float64Array([0.5, 1.5])), 2);
+        assert(sum("ab"), "0ab");
+        assert(sum({ length: 2, 0: 1, 1: 2 }), 3);
+        assert(get(new Uint8Array([1, 2]), 1), 2);
+        assert(get(new BigInt64Array([1n, 2n]), 1), 2n);
+    }
+    assert(sum(new Uint32Array([0xffffffff])), 4294967295);
+    assert(sum(new Float16Array([0.5])), 0.5);
+
+    /* conversions of the stored values */
+    a = fill(new Uint8ClampedArray(4), 300.7);
+    assert(a[3], 255);
+    a = fill(new Uint8ClampedArray(4), 2.5);
+    assert(a[3], 2);
+    a = fill(new Int8Array(4), -129);
+    assert(a[3], 127);
+    a = fill(new Float32Array(4), 0.1);
+    assert(a[3], Math.fround(0.1));
+    a = fill(new Int16Array(4), "12");
+    assert(a[3], 12);
+    a = fill(new Int16Array(4), { valueOf() { return 7; } });
+    assert(a[3], 7);
+    a = fill([1, 2], 5);
+    assert(a.join(), "5,5");
+
+    /* out of bounds accesses and length changes */
+    a = new Int32Array(4);
+    s = 0;
+    for(i = 0; i < 6; i++) {
+        a[i] = i;
+        s += a[i] | 0;
+    }
+    assert(s, 6);
+    assert(a.length, 4);
+    a = [1, 2, 3];
+    for(i = 0; i < 3; i++) {
+        assert(a.length, 3 + i);
+        a.push(0);
+    }
+    a.length = 1;
+    assert(a.length, 1);
+    a = new Int32Array(new ArrayBuffer(16, { maxByteLength: 32 }));
+    assert(sum(a), 0);
+    a.buffer.resize(4);
+    assert(sum(a), 0);
+    assert(a.length, 1);
+}
+
 function test_cyclic_labels()
 {
     /* just check that it compiles without a crash */
@@ -386,6 +537,9 @@ test_while_break();
 test_do_while();
 test_for();
 test_for_break();
+test_hot_loop();
+test_quickening();
+test_super_instructions();
 test_switch1();
 test_switch2();
 test_for_in();
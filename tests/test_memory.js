@@ -0,0 +1,98 @@
+/* memory usage statistics test */
+import * as std from "std";
+import * as jsapi from "./jsapi.so";
+
+function assert(actual, expected, message) {
+    if (arguments.length == 1)
+        expected = true;
+
+    if (actual === expected)
+        return;
+
+    if (actual !== null && expected !== null
+    &&  typeof actual == 'object' && typeof expected == 'object'
+    &&  actual.toString() === expected.toString())
+        return;
+
+    throw Error("assertion failed: got |" + actual + "|" +
+                ", expected |" + expected + "|" +
+                (message ? " (" + message + ")" : ""));
+}
+
+/* the slab allocator statistics are consistent */
+function check_slab(s)
+{
+    var i, block_size, size;
+    size = 0;
+    for(i = 0; i < s.slab_block_size.length; i++) {
+        block_size = s.slab_block_size[i];
+        assert(block_size > 0, true);
+        if (i > 0)
+            assert(block_size > s.slab_block_size[i - 1], true);
+        assert(s.slab_used_count[i] >= 0, true);
+        assert(s.slab_free_count[i] >= 0, true);
+        size += (s.slab_used_count[i] + s.slab_free_count[i]) * block_size;
+    }
+    assert(size <= s.slab_chunk_size, true, "slab size");
+    assert(s.slab_chunk_size % s.slab_chunk_count, 0);
+}
+
+/* return the index of the size class whose used count increased the
+   most between 's0' and 's1' */
+function max_delta_class(s0, s1)
+{
+    var i, idx, delta;
+    idx = 0;
+    for(i = 1; i < s1.slab_used_count.length; i++) {
+        delta = s1.slab_used_count[i] - s0.slab_used_count[i];
+        if (delta > s1.slab_used_count[idx] - s0.slab_used_count[idx])
+            idx = i;
+    }
+    return idx;
+}
+
+function test_slab()
+{
+    var s0, s1, s2, tab, i, n, idx;
+
+    n = 10000;
+    std.gc();
+    s0 = jsapi.memoryUsage();
+    if (s0.slab_chunk_count == 0) {
+        /* built without CONFIG_SLAB_ALLOC */
+        assert(s0.slab_block_size[0], 0);
+        return;
+    }
+    check_slab(s0);
+
+    /* objects with no properties */
+    tab = [];
+    for(i = 0; i < n; i++)
+        tab.push({});
+    s1 = jsapi.memoryUsage();
+    check_slab(s1);
+    assert(s1.obj_count - s0.obj_count >= n, true, "obj_count");
+    idx = max_delta_class(s0, s1);
+    assert(s1.slab_used_count[idx] - s0.slab_used_count[idx] >= n, true,
+           "used blocks");
+
+    /* the freed blocks are kept in the free lists */
+    tab = null;
+    std.gc();
+    s2 = jsapi.memoryUsage();
+    check_slab(s2);
+    /* a few other objects may have been allocated in the meantime */
+    assert(s1.slab_used_count[idx] - s2.slab_used_count[idx] >= n - 100, true,
+           "freed blocks");
+    assert(s2.slab_free_count[idx] >= n - 100, true, "free blocks");
+    assert(s2.slab_chunk_count, s1.slab_chunk_count);
+
+    /* the free blocks are reused */
+    tab = [];
+    for(i = 0; i < n; i++)
+        tab.push({});
+    s1 = jsapi.memoryUsage();
+    assert(s1.slab_chunk_count, s2.slab_chunk_count, "reused blocks");
+}
+
+test_slab();
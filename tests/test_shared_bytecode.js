@@ -0,0 +1,141 @@
+/* shared bytecode cache test (JS_READ_OBJ_SHARED) */
+import * as os from "os";
+import * as jsapi from "./jsapi.so";
+
+function assert(actual, expected, message) {
+    if (arguments.length == 1)
+        expected = true;
+
+    if (actual === expected)
+        return;
+
+    if (actual !== null && expected !== null
+    &&  typeof actual == 'object' && typeof expected == 'object'
+    &&  actual.toString() === expected.toString())
+        return;
+
+    throw Error("assertion failed: got |" + actual + "|" +
+                ", expected |" + expected + "|" +
+                (message ? " (" + message + ")" : ""));
+}
+
+const mod_src = `
+export function fib(n) {
+    return n <= 1 ? n : fib(n - 1) + fib(n - 2);
+}
+export function get_str(id) {
+    return "worker " + id + ": " + [1, 2, 3].map((x) => x * 2).join(",");
+}
+`;
+
+/* wait until the worker runtimes are freed by their threads */
+async function wait_count(count)
+{
+    for(var i = 0; i < 500; i++) {
+        if (jsapi.sharedBytecodeCount() == count)
+            break;
+        await os.sleepAsync(10);
+    }
+    return jsapi.sharedBytecodeCount();
+}
+
+/* the workers load the same module in parallel, then exit at the same
+   time so that the cache is released from several threads */
+function run_workers(n, buf)
+{
+    return new Promise((resolve) => {
+        var workers = [], results = [], ready = 0, done = 0, i;
+        function onmessage(e) {
+            var ev = e.data;
+            switch(ev.type) {
+            case "ready":
+                if (++ready == n) {
+                    for(let j = 0; j < n; j++)
+                        workers[j].postMessage({ type: "load", id: j, buf: buf });
+                }
+                break;
+            case "loaded":
+                results[ev.id] = ev;
+                if (++done == n) {
+                    for(let w of workers) {
+                        w.postMessage({ type: "exit" });
+                        w.onmessage = null;
+                    }
+                    resolve(results);
+                }
+                break;
+            }
+        }
+        for(i = 0; i < n; i++) {
+            workers[i] = new os.Worker("./test_shared_bytecode_module.js");
+            workers[i].onmessage = onmessage;
+        }
+    });
+}
+
+/* the bytecode loaded by the main thread is private, so it is
+   quickened */
+async function test_quicken()
+{
+    var buf, m, a, i, out, lines, line;
+
+    buf = jsapi.compileModule(`
+export function sum(a) {
+    var s = 0;
+    for(var i = 0; i < a.length; i++)
+        s += a[i];
+    return s;
+}
+`, "hot_mod");
+    jsapi.enableTypeFeedback(true);
+    jsapi.evalBinary(buf);
+    m = await import("hot_mod");
+    a = new Uint8Array(10).fill(1);
+    for(i = 0; i < 100; i++)
+        assert(m.sum(a), 10);
+    out = jsapi.dumpTypeFeedback();
+    jsapi.enableTypeFeedback(false);
+    assert(jsapi.sharedBytecodeCount(), 0);
+
+    lines = out.split("\n");
+    i = lines.findIndex((l) => l.startsWith("sum "));
+    assert(i >= 0, true, out);
+    for(i++; i < lines.length && /^\s/.test(lines[i]); i++) {
+        if (/ get_array_el /.test(lines[i]))
+            line = lines[i];
+    }
+    assert(line !== undefined, true, out);
+    assert(line.includes("QUICKENED"), true, line);
+}
+
+async function test_shared_bytecode()
+{
+    var buf, results, r, i, n = 4;
+
+    assert(jsapi.sharedBytecodeCount(), 0);
+    buf = jsapi.compileModule(mod_src, "shared_mod");
+
+    results = await run_workers(n, buf);
+    for(i = 0; i < n; i++) {
+        r = results[i];
+        assert(r.fib, 6765);
+        assert(r.str, "worker " + i + ": 2,4,6");
+        /* the other runtimes reuse the cached bytecode */
+        assert(r.count, 1);
+    }
+    assert(await wait_count(0), 0, "released cache");
+
+    /* the cache is created again after being released */
+    results = await run_workers(2, buf);
+    assert(results[1].fib, 6765);
+    assert(results[0].count, 1);
+    assert(await wait_count(0), 0, "released cache");
+}
+
+async function main()
+{
+    await test_quicken();
+    await test_shared_bytecode();
+}
+
+main();
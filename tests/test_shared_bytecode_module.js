@@ -0,0 +1,28 @@
+/* Worker code for test_shared_bytecode.js */
+import * as os from "os";
+import * as jsapi from "./jsapi.so";
+
+var parent = os.Worker.parent;
+
+async function handle_msg(e) {
+    var ev = e.data;
+    switch(ev.type) {
+    case "load":
+        /* all the workers get here in the same state, so the atoms of
+           the module have the same values and the bytecode is shared */
+        jsapi.evalBinary(ev.buf);
+        {
+            let m = await import("shared_mod");
+            parent.postMessage({ type: "loaded", id: ev.id,
+                                 fib: m.fib(20), str: m.get_str(ev.id),
+                                 count: jsapi.sharedBytecodeCount() });
+        }
+        break;
+    case "exit":
+        parent.onmessage = null; /* terminate the worker */
+        break;
+    }
+}
+
+parent.onmessage = handle_msg;
+parent.postMessage({ type: "ready" });
@@ -0,0 +1,255 @@
+import * as std from "std";
+import * as os from "os";
+
+function assert(actual, expected, message) {
+    if (arguments.length == 1)
+        expected = true;
+
+    if (Object.is(actual, expected))
+        return;
+
+    if (actual !== null && expected !== null
+    &&  typeof actual == 'object' && typeof expected == 'object'
+    &&  actual.toString() === expected.toString())
+        return;
+
+    throw Error("assertion failed: got |" + actual + "|" +
+                ", expected |" + expected + "|" +
+                (message ? " (" + message + ")" : ""));
+}
+
+const tmp_dir = "test_tmp_snapshot";
+
+function write_file(name, str)
+{
+    var f = std.open(tmp_dir + "/" + name, "w");
+    f.puts(str);
+    f.close();
+    return tmp_dir + "/" + name;
+}
+
+/* run a command and return its exit status and its output */
+function run(args)
+{
+    var fds, pid, f, out, ret, status;
+    fds = os.pipe();
+    pid = os.exec(args, { stdout: fds[1], stderr: fds[1], block: false });
+    assert(pid >= 0);
+    os.close(fds[1]);
+    f = std.fdopen(fds[0], "r");
+    out = f.readAsString();
+    f.close();
+    [ret, status] = os.waitpid(pid, 0);
+    assert(ret, pid);
+    /* a signal means that the image crashed the interpreter */
+    assert(status & 0x7f, 0, "exited: " + args.join(" "));
+    return { status: status >> 8, out: out };
+}
+
+function make_snapshot(snap_name, files)
+{
+    return run(["./qjsc", "--snapshot", "-o", tmp_dir + "/" + snap_name].concat(files));
+}
+
+function run_snapshot(snap_name, file)
+{
+    return run(["./qjs", "--snapshot", tmp_dir + "/" + snap_name, file]);
+}
+
+/* the checks run in the restored context */
+const check_prologue = `
+function assert(actual, expected, message) {
+    if (!Object.is(actual, expected))
+        throw Error("assertion failed: got |" + actual + "|" +
+                    ", expected |" + expected + "|" +
+                    (message ? " (" + message + ")" : ""));
+}
+`;
+
+function test_restore()
+{
+    var boot1, boot2, check, r;
+
+    boot1 = write_file("boot1.js", `
+        function make_counter() {
+            var n = 0;
+            return { inc: function() { return ++n; }, get: () => n };
+        }
+        var counter = make_counter();
+        counter.inc();
+        let shared = 10;
+        function get_shared() { return shared; }
+        function set_shared(v) { shared = v; }
+
+        var sym = Symbol("tag");
+        var obj = { [sym]: 1, x: 2 };
+        var ta = new Float64Array([1.5, 2.5]);
+        var u8 = new Uint8Array(ta.buffer, 8, 8);
+        var m = new Map([[1, "a"], ["b", obj]]);
+        var s = new Set([1, "c", obj]);
+    `);
+    boot2 = write_file("boot2.js", `
+        class A {
+            constructor() { this.a = 1; }
+            f() { return "A"; }
+        }
+        class B extends A {
+            f() { return "B" + super.f(); }
+        }
+        var b = new B();
+        var o2 = Object.create(b, { y: { value: 3, enumerable: false } });
+        globalThis.user_global = "hello";
+        Array.prototype.sum = function() {
+            return this.reduce((a, b) => a + b, 0);
+        };
+        delete Math.hypot;
+        var done = 0;
+        Promise.resolve(1).then(() => { done = 1; });
+    `);
+    r = make_snapshot("test.snap", [boot1, boot2]);
+    assert(r.status, 0, r.out);
+
+    check = write_file("check.js", check_prologue + `
+        /* closures sharing their variables */
+        assert(counter.get(), 1);
+        assert(counter.inc(), 2);
+        assert(counter.get(), 2);
+        assert(get_shared(), 10);
+        set_shared(20);
+        assert(get_shared(), 20);
+        assert(shared, 20);
+
+        /* symbols */
+        assert(typeof sym, "symbol");
+        assert(sym.description, "tag");
+        assert(obj[sym], 1);
+        assert(Object.getOwnPropertySymbols(obj)[0], sym);
+        assert(obj.x, 2);
+
+        /* typed arrays */
+        assert(ta instanceof Float64Array, true);
+        assert(ta.length, 2);
+        assert(ta[1], 2.5);
+        assert(u8.buffer, ta.buffer, "shared buffer");
+        u8.fill(0);
+        assert(ta[1], 0);
+
+        /* Map and Set */
+        assert(m.size, 2);
+        assert(m.get(1), "a");
+        assert(m.get("b"), obj);
+        assert(s.size, 3);
+        assert(s.has("c"), true);
+        assert(s.has(obj), true);
+
+        /* prototype chains */
+        assert(b instanceof B, true);
+        assert(b instanceof A, true);
+        assert(b.f(), "BA");
+        assert(b.a, 1);
+        assert(Object.getPrototypeOf(B), A);
+        assert(Object.getPrototypeOf(o2), b);
+        assert(o2.y, 3);
+        assert(Object.keys(o2).length, 0);
+        assert(new B().f(), "BA");
+
+        /* user globals and modified intrinsics */
+        assert(user_global, "hello");
+        assert(globalThis.user_global, "hello");
+        assert([1, 2, 3].sum(), 6);
+        assert(Math.hypot, undefined);
+        assert(done, 1);
+        print("OK");
+    `);
+    r = run_snapshot("test.snap", check);
+    assert(r.status, 0, r.out);
+    assert(r.out, "OK\n");
+}
+
+function test_unsupported()
+{
+    var file, r;
+
+    /* a pending promise */
+    file = write_file("promise.js", `var p = new Promise(() => {});`);
+    r = make_snapshot("promise.snap", [file]);
+    assert(r.status, 1);
+    assert(r.out.includes("unsupported object class 'Promise'"), true, r.out);
+
+    /* an unsupported class */
+    file = write_file("weakref.js", `var w = new WeakRef({});`);
+    r = make_snapshot("weakref.snap", [file]);
+    assert(r.status, 1);
+    assert(r.out.includes("unsupported object class 'WeakRef'"), true, r.out);
+}
+
+function test_corrupted()
+{
+    var file, f, buf, check, r, i, len, pos;
+
+    file = write_file("small.js", `
+        var v = { a: [1, 2, 3], s: "str" };
+        function get() { return v.a.length + v.s; }
+    `);
+    r = make_snapshot("small.snap", [file]);
+    assert(r.status, 0, r.out);
+    check = write_file("check_small.js", check_prologue + `
+        assert(get(), "3str");
+        print("OK");
+    `);
+    r = run_snapshot("small.snap", check);
+    assert(r.status, 0, r.out);
+
+    f = std.open(tmp_dir + "/small.snap", "rb");
+    f.seek(0, std.SEEK_END);
+    len = f.tell();
+    f.seek(0, std.SEEK_SET);
+    buf = new Uint8Array(len);
+    assert(f.read(buf.buffer, 0, len), len);
+    f.close();
+
+    /* truncated images */
+    for(pos of [1, 3, len >> 1, len - 1]) {
+        f = std.open(tmp_dir + "/bad.snap", "wb");
+        f.write(buf.buffer, 0, pos);
+        f.close();
+        r = run_snapshot("bad.snap", check);
+        assert(r.status, 1);
+        assert(r.out.includes("invalid snapshot"), true, r.out);
+    }
+
+    /* corrupted images */
+    for(i = 0; i < 8; i++) {
+        pos = Math.floor(len * i / 8);
+        buf[pos] ^= 0x80;
+        f = std.open(tmp_dir + "/bad.snap", "wb");
+        f.write(buf.buffer, 0, len);
+        f.close();
+        buf[pos] ^= 0x80;
+        r = run_snapshot("bad.snap", check);
+        assert(r.status, 1);
+        assert(r.out.includes("invalid snapshot"), true, r.out);
+    }
+}
+
+function cleanup()
+{
+    var [files, err] = os.readdir(tmp_dir);
+    if (err)
+        return;
+    for(var name of files) {
+        if (name != "." && name != "..")
+            os.remove(tmp_dir + "/" + name);
+    }
+    os.remove(tmp_dir);
+}
+
+cleanup();
+assert(os.mkdir(tmp_dir, 0o755), 0);
+try {
+    test_restore();
+    test_unsupported();
+    test_corrupted();
+} finally {
+    cleanup();
+}
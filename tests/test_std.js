@@ -152,6 +152,36 @@ c\\vd", // multi-line strings, '\v' escape
     assert(obj[7], -0.2);
 }
 
+function test_json_buffer()
+{
+    var s, buf, u8, i, obj;
+    s = '{"a": [1, 2.5, "caf\u00e9 \\u20ac", true, null], "b": "x"}';
+    /* UTF-8 encoding */
+    s = unescape(encodeURIComponent(s));
+    buf = new ArrayBuffer(s.length + 4);
+    u8 = new Uint8Array(buf, 2, s.length);
+    for(i = 0; i < s.length; i++)
+        u8[i] = s.charCodeAt(i);
+    obj = std.parseJSONBuffer(u8);
+    assert(JSON.stringify(obj), '{"a":[1,2.5,"caf\u00e9 \u20ac",true,null],"b":"x"}');
+    obj = std.parseJSONBuffer([ u8.subarray(0, 10), u8.subarray(10).slice().buffer ]);
+    assert(obj.a[2], "caf\u00e9 \u20ac");
+    assert(std.parseJSONBuffer(new Uint8Array([0x5b, 0x31, 0x2c, 0x5d]), true).length, 1);
+    /* no zero terminator */
+    u8 = new Uint8Array([0x31, 0x32, 0x33]).subarray(0, 2);
+    assert(std.parseJSONBuffer(u8), 12);
+    /* the typed array errors are not hidden */
+    u8 = new Uint8Array(4);
+    u8.buffer.transfer();
+    try {
+        std.parseJSONBuffer(u8);
+        assert(false);
+    } catch(e) {
+        assert(e instanceof TypeError, true);
+        assert(e.message.includes("ArrayBuffer object expected"), false, e.message);
+    }
+}
+
 function test_os()
 {
     var fd, fpath, fname, fdir, buf, buf2, i, files, err, fdate, st, link_path;
@@ -286,6 +316,119 @@ function test_timer()
         os.clearTimeout(th[i]);
 }
 
+function test_timer_order()
+{
+    var log, expected, th, i, t1, t2, t2_called;
+
+    log = [];
+    expected = [];
+    th = [];
+    for(i = 0; i < 60; i++) {
+        let delay = ((i * 7) % 13) * 5, n = i;
+        th.push(os.setTimeout(function () { log.push([delay, n]); }, delay));
+        if (i % 3 != 0)
+            expected.push([delay, n]);
+    }
+    for(i = 0; i < 60; i += 3)
+        os.clearTimeout(th[i]);
+    /* same timeout: called in creation order */
+    expected.sort((a, b) => (a[0] - b[0]) || (a[1] - b[1]));
+
+    /* a timer cleared by an expired timer is not called */
+    t1 = os.setTimeout(function () { os.clearTimeout(t2); }, 0);
+    t2_called = false;
+    t2 = os.setTimeout(function () { t2_called = true; }, 0);
+
+    os.setTimeout(function () {
+        assert(log.join(";"), expected.join(";"));
+        assert(t2_called, false);
+    }, 100);
+}
+
+function test_rw_handlers()
+{
+    var fds_tab, buf, i, ready_count, log;
+
+    /* only half of the fds become readable */
+    fds_tab = [];
+    for(i = 0; i < 20; i++)
+        fds_tab.push(os.pipe());
+    buf = new Uint8Array(1);
+    ready_count = 0;
+    log = [];
+    for(i = 0; i < fds_tab.length; i++) {
+        let fds = fds_tab[i];
+        os.setReadHandler(fds[0], function () {
+            assert(os.read(fds[0], buf.buffer, 0, 1), 1);
+            os.setReadHandler(fds[0], null);
+            /* the pending jobs are run between two handlers */
+            log.push("handler");
+            Promise.resolve().then(() => log.push("job"));
+            if (++ready_count == fds_tab.length / 2)
+                os.setTimeout(check, 0);
+        });
+    }
+    for(i = 0; i < fds_tab.length; i += 2)
+        assert(os.write(fds_tab[i][1], buf.buffer, 0, 1), 1);
+
+    function check() {
+        assert(log.join(), "handler,job,".repeat(fds_tab.length / 2).slice(0, -1));
+        for(i = 0; i < fds_tab.length; i++) {
+            os.setReadHandler(fds_tab[i][0], null);
+            os.close(fds_tab[i][0]);
+            os.close(fds_tab[i][1]);
+        }
+        test_rw_handlers_file();
+    }
+}
+
+/* regular files cannot be waited for with epoll() */
+function test_rw_handlers_file()
+{
+    var f, fd;
+    f = std.tmpfile();
+    fd = f.fileno();
+    os.setReadHandler(fd, function () {
+        os.setReadHandler(fd, null);
+        f.close();
+    });
+}
+
+/* a handler set for a reused fd does not get the pending events of
+   the removed handler */
+function test_rw_handlers_reuse()
+{
+    var p1, p2, p3, buf, called, done;
+
+    p1 = os.pipe();
+    p2 = os.pipe();
+    p3 = os.pipe(); /* never readable */
+    buf = new Uint8Array(1);
+    called = false;
+    done = false;
+    function on_ready(fds, other) {
+        assert(os.read(fds[0], buf.buffer, 0, 1), 1);
+        os.setReadHandler(fds[0], null);
+        if (done)
+            return;
+        done = true;
+        /* the event of 'other' is pending */
+        os.setReadHandler(other[0], null);
+        assert(os.dup2(p3[0], other[0]), other[0]);
+        os.setReadHandler(other[0], function () { called = true; });
+        os.setTimeout(function () {
+            os.setReadHandler(other[0], null);
+            for(var fd of [...p1, ...p2, ...p3])
+                os.close(fd);
+            assert(called, false);
+        }, 10);
+    }
+    os.setReadHandler(p1[0], () => on_ready(p1, p2));
+    os.setReadHandler(p2[0], () => on_ready(p2, p1));
+    assert(os.write(p1[1], buf.buffer, 0, 1), 1);
+    assert(os.write(p2[1], buf.buffer, 0, 1), 1);
+}
+
 /* test closure variable handling when freeing asynchronous
    function */
 function test_async_gc()
@@ -330,7 +473,11 @@ test_popen();
 test_os();
 test_os_exec();
 test_timer();
+test_timer_order();
+test_rw_handlers();
+test_rw_handlers_reuse();
 test_ext_json();
+test_json_buffer();
 test_async_gc();
 test_async_promise_rejection();
 
@@ -47,6 +47,15 @@ function test_worker()
                 let buf = ev.buf;
                 /* check that the SharedArrayBuffer was modified */
                 assert(buf[2], 10);
+                test_transfer();
+            }
+            break;
+        case "transfer_done":
+            {
+                let tab = new Uint8Array(ev.buf);
+                assert(tab.length, 1 << 20);
+                assert(tab[0], 1);
+                assert(tab[tab.length - 1], 2);
                 worker.postMessage({ type: "abort" });
             }
             break;
@@ -59,4 +68,152 @@ function test_worker()
 }
 
 
+/* the transferred ArrayBuffers are detached */
+function test_transfer()
+{
+    var ab, tab, err;
+
+    ab = new ArrayBuffer(1 << 20);
+    tab = new Uint8Array(ab);
+    tab[tab.length - 1] = 1;
+    worker.postMessage({ type: "transfer", buf: tab }, [ ab ]);
+    assert(ab.byteLength, 0);
+    assert(tab.length, 0);
+
+    err = false;
+    try {
+        worker.postMessage({}, [ ab ]);
+    } catch(e) {
+        err = e instanceof TypeError;
+    }
+    assert(err, true, "detached ArrayBuffer");
+
+    ab = new ArrayBuffer(8);
+    err = false;
+    try {
+        worker.postMessage({}, [ ab, ab ]);
+    } catch(e) {
+        err = e instanceof TypeError;
+    }
+    assert(err, true, "duplicate ArrayBuffer");
+    /* not detached if the message is not sent */
+    assert(ab.byteLength, 8);
+
+    err = false;
+    try {
+        worker.postMessage({}, [ new SharedArrayBuffer(8) ]);
+    } catch(e) {
+        err = e instanceof TypeError;
+    }
+    assert(err, true, "SharedArrayBuffer");
+}
+
 test_worker();
+
+/* the messages of several workers are received in order for each
+   worker */
+function test_fan_in()
+{
+    var n = 4, count = 1000, next = [], total = 0, done = 0, i;
+
+    for(i = 0; i < n; i++) {
+        let w = new os.Worker("./test_worker_module.js");
+        next[i] = 0;
+        w.onmessage = function (e) {
+            var ev = e.data;
+            switch(ev.type) {
+            case "fan_in_num":
+                assert(ev.num, next[ev.id], "worker " + ev.id);
+                next[ev.id]++;
+                total++;
+                break;
+            case "fan_in_done":
+                assert(next[ev.id], count);
+                w.onmessage = null;
+                if (++done == n)
+                    assert(total, n * count);
+                break;
+            }
+        };
+        w.postMessage({ type: "fan_in", id: i, count: count });
+    }
+}
+
+test_fan_in();
+
+function test_worker_pool()
+{
+    var pool, tab, i, ab, err;
+
+    pool = new os.WorkerPool("./test_worker_pool_module.js", 4);
+
+    tab = [];
+    for(i = 0; i < 32; i++)
+        tab.push(pool.run("fib", [ 15 + (i & 3) ]));
+    Promise.all(tab).then((res) => {
+        for(i = 0; i < res.length; i++)
+            assert(res[i], [ 610, 987, 1597, 2584 ][i & 3]);
+    });
+
+    pool.run("add", [ 1, 2 ]).then((res) => assert(res, 3));
+    pool.run("delay", [ 10, "x" ]).then((res) => assert(res, "x"));
+
+    ab = new ArrayBuffer(1024);
+    pool.run("fill", [ ab, 7 ], [ ab ]).then((res) => {
+        var tab = new Uint8Array(res);
+        assert(tab.length, 1024);
+        assert(tab[0], 7);
+        assert(tab[1023], 7);
+    });
+    assert(ab.byteLength, 0);
+
+    pool.run("throw_error", [ "bad" ]).then(() => assert(false), (e) => {
+        assert(e instanceof RangeError, true);
+        assert(e.name, "RangeError");
+        assert(e.message, "bad");
+        assert(typeof e.stack, "string");
+    });
+    pool.run("throw_value", [ { a: 1 } ]).then(() => assert(false), (e) => {
+        assert(e.a, 1);
+    });
+    pool.run("reject_error", [ "async" ]).then(() => assert(false), (e) => {
+        assert(e instanceof TypeError, true);
+        assert(e.name, "TypeError");
+        assert(e.message, "async");
+    });
+    /* the returned value cannot be serialized */
+    pool.run("return_function").then(() => assert(false), (e) => {
+        assert(e instanceof Error, true);
+    });
+    pool.run("not_exported").then(() => assert(false), (e) => {
+        assert(e.name, "TypeError");
+    });
+    /* the other errors are rebuilt as Error objects */
+    pool.run("throw_custom_error", [ "custom" ]).then(() => assert(false), (e) => {
+        assert(Object.getPrototypeOf(e), Error.prototype);
+        assert(e.name, "CustomError");
+        assert(e.message, "custom");
+    });
+
+    /* the arguments must be an array-like object */
+    err = false;
+    try {
+        pool.run("add", 5);
+    } catch(e) {
+        err = e instanceof TypeError;
+    }
+    assert(err, true, "invalid arguments");
+
+    /* the queued tasks still run after terminate() */
+    pool.run("add", [ "a", "b" ]).then((res) => assert(res, "ab"));
+    pool.terminate();
+    err = false;
+    try {
+        pool.run("add", [ 1, 2 ]);
+    } catch(e) {
+        err = e instanceof TypeError;
+    }
+    assert(err, true, "terminated pool");
+}
+
+test_worker_pool();
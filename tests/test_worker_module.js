@@ -17,6 +17,20 @@ function handle_msg(e) {
         ev.buf[2] = 10;
         parent.postMessage({ type: "sab_done", buf: ev.buf });
         break;
+    case "fan_in":
+        /* numbered messages, then terminate the worker */
+        for(let i = 0; i < ev.count; i++)
+            parent.postMessage({ type: "fan_in_num", id: ev.id, num: i });
+        parent.postMessage({ type: "fan_in_done", id: ev.id });
+        parent.onmessage = null;
+        break;
+    case "transfer":
+        /* the data is moved to this worker and sent back */
+        ev.buf[0] = 1;
+        ev.buf[ev.buf.length - 1]++;
+        parent.postMessage({ type: "transfer_done", buf: ev.buf.buffer },
+                           [ ev.buf.buffer ]);
+        break;
     }
 }
 
@@ -0,0 +1,60 @@
+/* Module run by the threads of the os.WorkerPool test */
+import * as os from "os";
+
+export function add(a, b)
+{
+    return a + b;
+}
+
+/* busy loop so that the tasks are spread over the threads */
+export function fib(n)
+{
+    return n < 2 ? n : fib(n - 1) + fib(n - 2);
+}
+
+export function delay(ms, val)
+{
+    return new Promise((resolve) => {
+        os.setTimeout(() => resolve(val), ms);
+    });
+}
+
+/* modify the transferred buffer and return a copy of it */
+export function fill(buf, val)
+{
+    new Uint8Array(buf).fill(val);
+    return buf;
+}
+
+export function throw_error(msg)
+{
+    throw new RangeError(msg);
+}
+
+class CustomError extends Error {
+    constructor(msg)
+    {
+        super(msg);
+        this.name = "CustomError";
+    }
+}
+
+export function throw_custom_error(msg)
+{
+    throw new CustomError(msg);
+}
+
+export function throw_value(val)
+{
+    throw val;
+}
+
+export async function reject_error(msg)
+{
+    throw new TypeError(msg);
+}
+
+export function return_function()
+{
+    return function () {};
+}
@@ -0,0 +1,48 @@
+/* timer benchmark: creates many concurrent timers, cancels half of
+   them and measures the time taken to insert and cancel them and the
+   delay between the timeout of each timer and its call.
+
+   usage: qjs tests/timerbench.js [timers]
+*/
+import * as os from "os";
+
+function main(args)
+{
+    var n, th, i, t, t0, fired, late_sum, late_max;
+
+    n = args[1] ? parseInt(args[1]) : 100000;
+
+    fired = 0;
+    late_sum = 0;
+    late_max = 0;
+    th = [];
+    t0 = performance.now();
+    for(i = 0; i < n; i++) {
+        let delay = 100 + (i * 7919) % 1000;
+        let due = performance.now() + delay;
+        th.push(os.setTimeout(function () {
+            var late = performance.now() - due;
+            fired++;
+            late_sum += late;
+            late_max = Math.max(late_max, late);
+        }, delay));
+    }
+    t = performance.now() - t0;
+    print("timers: " + n);
+    print("setTimeout (us/timer): " + (t * 1000 / n).toFixed(3));
+
+    t = performance.now();
+    for(i = 0; i < n; i += 2)
+        os.clearTimeout(th[i]);
+    t = performance.now() - t;
+    print("clearTimeout (us/timer): " + (t * 2000 / n).toFixed(3));
+
+    os.setTimeout(function () {
+        if (fired != n - ((n + 1) >> 1))
+            throw Error("unexpected number of fired timers: " + fired);
+        print("lateness (ms): avg=" + (late_sum / fired).toFixed(3) +
+              " max=" + late_max.toFixed(3));
+    }, 1200);
+}
+
+main(scriptArgs);